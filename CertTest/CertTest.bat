@@ -83,6 +83,13 @@ REM  FAST test sequence definition:
 @SET  TEST24=Test #24: NREL 5 MW Baseline Offshore Turbine with OC3-Hywind Configuration
 @SET  TEST25=Test #25: NREL 5 MW Baseline Offshore Turbine with OC4-DeepCwind Semi-submersible Configuration
 @SET  TEST26=Test #26: NREL 5 MW Baseline Land-based Turbine with BeamDyn for blade dynamics
+@SET  TEST27=Test #27: Farm simulation of Tests #01 and #03; each turbine's output is compared with its serial run
+@SET  TEST28=Test #28: NREL 5 MW Baseline Land-based Turbine with the ElastoDyn generalized-alpha integrator and 4x the time step of Test #18
+@SET  TEST29=Test #29: NREL 5 MW Baseline Offshore Turbine with OC3-Monopile Configuration and wave kinematics evaluated on demand
+@SET  TEST30=Test #30: NREL 5 MW Baseline Offshore Turbine with OC3-Monopile Configuration and the wave kinematics cache (miss, hit, and truncated file)
+@SET  TEST31=Test #31: NREL 5 MW Baseline Offshore Turbine with OC3-Hywind Configuration and the state-space radiation model fitted at initialization (RdtnMod=3)
+@SET  TEST32=Test #32: NREL 5 MW Baseline Land-based Turbine with the ElastoDyn mass-matrix factorization reused across integrator stages (MMTol=1e-6)
+@SET  TEST33=Test #33: WindPACT 1.5 MW Baseline with stationary linearization in a vacuum and the ElastoDyn dX/du load columns checked against finite differences (LinJac=3)
 
 @SET  DASHES=---------------------------------------------------------------------------------------------
 @SET  POUNDS=#############################################################################################
@@ -376,6 +383,175 @@ rem *******************************************************
 @CALL :RunFASTandCrunch 26 outb
 @CALL :CompareOutput 26
 
+rem *******************************************************
+:Test27
+@SET TEST=27
+@CALL :GenTestHeader %Test27%
+%FAST% -farm %FST_DIR%\Test27.frm
+
+@IF NOT EXIST %FST_DIR%\Test01.T1.out  GOTO ERROR
+@IF NOT EXIST %FST_DIR%\Test03.T2.out  GOTO ERROR
+
+:: The turbines of a farm write to <root>.T<i>, whose headers differ from the single-turbine runs, so compare the channels of
+:: each with the runs of Test #01 and #03 above in MATLAB (they use the same inputs, so they must match to the printed digits):
+echo. Running Matlab to compare Test27 with Test01 and Test03. If an error occurs, close Matlab to continue CertTest....
+%MATLAB% /wait /r "addpath(genpath('%MATLAB_Toolbox%'));p1=CompareOutputsToTolerance('%FST_DIR%\Test01.T1.out','%FST_DIR%\Test01.out',{'Wind1VelX','TipDxb2','TipDyb2','YawBrRDxt','RootMyc1','RootMxc1','Spn3MLxb1','RotTorq','TwrBsMzt'},1.0e-5);p2=CompareOutputsToTolerance('%FST_DIR%\Test03.T2.out','%FST_DIR%\Test03.out',{'Wind1VelX','Azimuth','TeetDefl','OoPDefl2','IPDefl2','RootMOoP2','RotTorq','NacYaw','TwrBsMyt'},1.0e-5);if ~(p1&&p2),exit(1),end;exit" /logfile Test27.cmp
+
+@IF NOT EXIST Test27.cmp  GOTO ERROR
+echo %DASHES%                          >> %CompareFile%
+type Test27.cmp                        >> %CompareFile%
+
+rem *******************************************************
+:Test28
+@SET TEST=28
+@CALL :GenTestHeader %Test28%
+%FAST% %FST_DIR%\Test28.fst
+
+@IF NOT EXIST %FST_DIR%\Test28.outb  GOTO ERROR
+
+:: The larger time step changes the results slightly, so compare the main channels with the saved Test #18 results to a tolerance in MATLAB.
+:: The 2% (of each channel's range) is an estimate, not yet checked against a run: at 0.025 s the modes below ~1.1 Hz that set these
+:: channels' ranges have ~36 or more steps per period (period error under 0.3%), the 2nd tower and flap modes (2-3 Hz) up to ~2%,
+:: and the ~6 Hz drivetrain mode is under-resolved and damped (RhoInf = 0.9); the controller and AeroDyn also run at 4x the step.
+echo. Running Matlab to compare Test28 with Test18. If an error occurs, close Matlab to continue CertTest....
+%MATLAB% /wait /r "addpath(genpath('%MATLAB_Toolbox%'));if ~CompareOutputsToTolerance('Test28.outb','TstFiles\Test18.outb',{'RotSpeed','GenSpeed','BldPitch1','OoPDefl1','IPDefl1','TTDspFA','RootMyb1','TwrBsMyt'},0.02),exit(1),end;exit" /logfile Test28.cmp
+
+@IF NOT EXIST Test28.cmp  GOTO ERROR
+echo %DASHES%                          >> %CompareFile%
+type Test28.cmp                        >> %CompareFile%
+
+rem *******************************************************
+:Test29
+@SET TEST=29
+@CALL :GenTestHeader %Test29%
+%FAST% %FST_DIR%\Test29.fst
+
+@IF NOT EXIST %FST_DIR%\Test29.outb  GOTO ERROR
+
+:: WvKinMod=1 sums the wave spectrum at each step instead of interpolating the precomputed kinematics, so it only differs from
+:: the Test #19 results run above by round-off; compare the two in MATLAB to a tight tolerance:
+echo. Running Matlab to compare Test29 with Test19. If an error occurs, close Matlab to continue CertTest....
+%MATLAB% /wait /r "addpath(genpath('%MATLAB_Toolbox%'));if ~CompareOutputsToTolerance('Test29.outb','Test19.outb',{'Wave1Elev','PtfmSurge','PtfmPitch','TwHt1TPxi','M1N1MKye','M2N1MKye'},1.0e-3),exit(1),end;exit" /logfile Test29.cmp
+
+@IF NOT EXIST Test29.cmp  GOTO ERROR
+echo %DASHES%                          >> %CompareFile%
+type Test29.cmp                        >> %CompareFile%
+
+rem *******************************************************
+:Test30
+@SET TEST=30
+@CALL :GenTestHeader %Test30%
+
+:: The first run starts with an empty cache directory, so it computes the wave kinematics and writes the cache file:
+@IF EXIST %FST_DIR%\Test30Cache  RMDIR /S /Q %FST_DIR%\Test30Cache
+MKDIR %FST_DIR%\Test30Cache
+%FAST% %FST_DIR%\Test30.fst > %FST_DIR%\Test30_Miss.log
+@IF NOT EXIST %FST_DIR%\Test30.outb  GOTO ERROR
+@FINDSTR /C:"Reading the incident wave kinematics" %FST_DIR%\Test30_Miss.log > NUL
+@IF NOT ERRORLEVEL 1  GOTO ERROR
+@IF NOT EXIST %FST_DIR%\Test30Cache\Waves_*.wvc  GOTO ERROR
+COPY /Y %FST_DIR%\Test30.outb %FST_DIR%\Test30_Miss.outb > NUL
+
+:: The second run must read the wave kinematics from the cache file:
+%FAST% %FST_DIR%\Test30.fst > %FST_DIR%\Test30_Hit.log
+@IF NOT EXIST %FST_DIR%\Test30.outb  GOTO ERROR
+@FINDSTR /C:"Reading the incident wave kinematics" %FST_DIR%\Test30_Hit.log > NUL
+@IF ERRORLEVEL 1  GOTO ERROR
+COPY /Y %FST_DIR%\Test30.outb %FST_DIR%\Test30_Hit.outb > NUL
+
+:: Truncate the cache file to half its size; the third run must ignore it, compute the wave kinematics again, and replace it:
+powershell -NoProfile -Command "Get-ChildItem '%FST_DIR%\Test30Cache\Waves_*.wvc' | ForEach-Object { $b=[IO.File]::ReadAllBytes($_.FullName); [IO.File]::WriteAllBytes($_.FullName, $b[0..([int]($b.Length/2))]) }"
+%FAST% %FST_DIR%\Test30.fst > %FST_DIR%\Test30_Truncated.log
+@IF NOT EXIST %FST_DIR%\Test30.outb  GOTO ERROR
+@FINDSTR /C:"Reading the incident wave kinematics" %FST_DIR%\Test30_Truncated.log > NUL
+@IF NOT ERRORLEVEL 1  GOTO ERROR
+COPY /Y %FST_DIR%\Test30.outb %FST_DIR%\Test30_Truncated.outb > NUL
+
+:: The fourth run must read the replaced cache file:
+%FAST% %FST_DIR%\Test30.fst > %FST_DIR%\Test30_Rewritten.log
+@IF NOT EXIST %FST_DIR%\Test30.outb  GOTO ERROR
+@FINDSTR /C:"Reading the incident wave kinematics" %FST_DIR%\Test30_Rewritten.log > NUL
+@IF ERRORLEVEL 1  GOTO ERROR
+
+:: The cache holds the unchanged results of the calculation, so all runs must match the Test #19 results run above:
+echo. Running Matlab to compare the Test30 runs with Test19. If an error occurs, close Matlab to continue CertTest....
+%MATLAB% /wait /r "addpath(genpath('%MATLAB_Toolbox%'));Chan={'Wave1Elev','PtfmSurge','PtfmPitch','TwHt1TPxi','M1N1MKye','M2N1MKye'};Passed=true;for f={'Test30_Miss.outb','Test30_Hit.outb','Test30_Truncated.outb','Test30.outb'},Passed=CompareOutputsToTolerance(f{1},'Test19.outb',Chan,1.0e-6)&&Passed;end;if ~Passed,exit(1),end;exit" /logfile Test30.cmp
+
+@IF NOT EXIST Test30.cmp  GOTO ERROR
+echo %DASHES%                          >> %CompareFile%
+type Test30.cmp                        >> %CompareFile%
+
+rem *******************************************************
+:Test31
+@SET TEST=31
+@CALL :GenTestHeader %Test31%
+
+:: The first run starts with an empty cache directory, so it fits the state-space model to the radiation kernels and caches it:
+@IF EXIST %FST_DIR%\Test31Cache  RMDIR /S /Q %FST_DIR%\Test31Cache
+MKDIR %FST_DIR%\Test31Cache
+%FAST% %FST_DIR%\Test31.fst > %FST_DIR%\Test31_Miss.log
+@IF NOT EXIST %FST_DIR%\Test31.outb  GOTO ERROR
+@FINDSTR /C:"Reading the state-space radiation model" %FST_DIR%\Test31_Miss.log > NUL
+@IF NOT ERRORLEVEL 1  GOTO ERROR
+@IF NOT EXIST %FST_DIR%\Test31Cache\SSRad_*.wvc  GOTO ERROR
+COPY /Y %FST_DIR%\Test31.outb %FST_DIR%\Test31_Miss.outb > NUL
+
+:: The second run must read the fitted model from the cache file:
+%FAST% %FST_DIR%\Test31.fst > %FST_DIR%\Test31_Hit.log
+@IF NOT EXIST %FST_DIR%\Test31.outb  GOTO ERROR
+@FINDSTR /C:"Reading the state-space radiation model" %FST_DIR%\Test31_Hit.log > NUL
+@IF ERRORLEVEL 1  GOTO ERROR
+
+:: The fitted model approximates the radiation kernels to RdtnSSTol, so compare the platform motions with the convolution
+:: (RdtnMod=1) results of Test #24 run above to a loose tolerance, and the run that read the cache with the first run to a tight one:
+echo. Running Matlab to compare Test31 with Test24. If an error occurs, close Matlab to continue CertTest....
+%MATLAB% /wait /r "addpath(genpath('%MATLAB_Toolbox%'));Chan={'Wave1Elev','PtfmSurge','PtfmHeave','PtfmPitch','PtfmYaw','PtfmTAxt'};Passed=CompareOutputsToTolerance('Test31_Miss.outb','Test24.outb',Chan,2.0e-2);Passed=CompareOutputsToTolerance('Test31.outb','Test31_Miss.outb',Chan,1.0e-6)&&Passed;if ~Passed,exit(1),end;exit" /logfile Test31.cmp
+
+@IF NOT EXIST Test31.cmp  GOTO ERROR
+echo %DASHES%                          >> %CompareFile%
+type Test31.cmp                        >> %CompareFile%
+
+rem *******************************************************
+:Test32
+@SET TEST=32
+@CALL :GenTestHeader %Test32%
+%FAST% %FST_DIR%\Test32.fst
+
+@IF NOT EXIST %FST_DIR%\Test32.outb  GOTO ERROR
+
+:: With MMTol = 1e-6 each solution of the equations of motion is accurate to 1e-6 of the forcing, not to round-off, so compare
+:: the main channels with the Test #18 results from this run (MMTol = 0) to a tolerance in MATLAB:
+echo. Running Matlab to compare Test32 with Test18. If an error occurs, close Matlab to continue CertTest....
+%MATLAB% /wait /r "addpath(genpath('%MATLAB_Toolbox%'));if ~CompareOutputsToTolerance('Test32.outb','Test18.outb',{'RotSpeed','GenSpeed','BldPitch1','OoPDefl1','IPDefl1','TTDspFA','RootMyb1','TwrBsMyt'},1.0e-3),exit(1),end;exit" /logfile Test32.cmp
+
+@IF NOT EXIST Test32.cmp  GOTO ERROR
+echo %DASHES%                          >> %CompareFile%
+type Test32.cmp                        >> %CompareFile%
+
+rem *******************************************************
+:Test33
+@SET TEST=33
+@CALL :GenTestHeader %Test33%
+
+:: FAST stops with a fatal error (and writes no .lin file) if an analytic column of dX/du differs from its finite-difference
+:: column by more than 1%; the screen output must report the check:
+%FAST% %FST_DIR%\Test33.fst > %FST_DIR%\Test33.log
+
+@IF NOT EXIST %FST_DIR%\Test%TEST%.1.lin  GOTO ERROR
+@FINDSTR /C:"ElastoDyn dX/du at t =" %FST_DIR%\Test33.log > NUL
+@IF ERRORLEVEL 1  GOTO ERROR
+
+:: LinJac only changes the load columns of dX/du, so the eigenanalysis must match Test #14 from this run:
+echo. Running Matlab to calculate eigenvalues. If an error occurs, close Matlab to continue CertTest....
+%MATLAB% /wait /r addpath(genpath('%MATLAB_Toolbox%'));Test%TEST% /logfile Test%TEST%.eig
+
+IF ERRORLEVEL 1  GOTO MATLABERROR
+
+@IF NOT EXIST Test%TEST%.eig  GOTO MATLABERROR
+
+echo %DASHES%                          >> %CompareFile%
+%Compare% Test33.eig Test14.eig        >> %CompareFile%
+
 rem ******************************************************
 rem  Let's look at the comparisons.
 :MatlabComparisons
@@ -499,6 +675,13 @@ EXIT /B
 @SET TEST24=
 @SET TEST25=
 @SET TEST26=
+@SET TEST27=
+@SET TEST28=
+@SET TEST29=
+@SET TEST30=
+@SET TEST31=
+@SET TEST32=
+@SET TEST33=
 
 SET EXE_VER=
 SET FST_DIR=
@@ -0,0 +1,74 @@
+function Passed = CompareOutputsToTolerance( newFile, refFile, Channels, RelTol )
+% CompareOutputsToTolerance.m
+%function Passed = CompareOutputsToTolerance( newFile, refFile, Channels, RelTol )
+% This function compares the time series of the listed channels in FAST 
+% output file newFile with those in reference file refFile. It is used by
+% the CertTests that check a run against another run (or a saved result) 
+% that is not expected to match to the last digit, e.g., a run with a 
+% different integrator or time step.
+%
+% The reference time series are interpolated to the output times of 
+% newFile. For each channel, the largest absolute difference is divided by 
+% the range (max - min) of the reference channel; the comparison passes if 
+% this relative difference is at most RelTol for every channel.
+%
+% The files may be text (.out) or binary (.outb) FAST output files; the 
+% MATLAB_Toolbox must be on the MATLAB path (for ReadFASTtext and 
+% ReadFASTbinary).
+
+[newData, newCols] = ReadOutputFile( newFile );
+[refData, refCols] = ReadOutputFile( refFile );
+
+fprintf( '\nComparing %s with %s (relative tolerance %g):\n', newFile, refFile, RelTol );
+fprintf( '  %-12s %14s %14s\n', 'Channel', 'Max Diff', 'Rel. Diff' );
+
+Passed = true;
+for iChan = 1:length(Channels)
+    
+    iNew = find( strcmpi( Channels{iChan}, newCols ), 1 );
+    iRef = find( strcmpi( Channels{iChan}, refCols ), 1 );
+    if isempty(iNew) || isempty(iRef)
+        fprintf( '  %-12s not found: FAILED\n', Channels{iChan} );
+        Passed = false;
+        continue;
+    end
+    
+        % compare over the times both files contain
+    t      = newData(:,1);
+    inTime = t >= refData(1,1) & t <= refData(end,1);
+    refInterp = interp1( refData(:,1), refData(:,iRef), t(inTime) );
+    
+    MaxDiff = max( abs( newData(inTime,iNew) - refInterp ) );
+    Range   = max( refData(:,iRef) ) - min( refData(:,iRef) );
+    RelDiff = MaxDiff / max( Range, eps );
+    
+    if RelDiff > RelTol
+        Status = 'FAILED';
+        Passed = false;
+    else
+        Status = 'ok';
+    end
+    fprintf( '  %-12s %14.6g %14.6g %s\n', Channels{iChan}, MaxDiff, RelDiff, Status );
+    
+end
+
+if Passed
+    fprintf( 'PASSED\n' );
+else
+    fprintf( 'FAILED\n' );
+end
+
+return
+end
+%% ------------------------------------------------------------------------
+function [Data, Cols] = ReadOutputFile( FileName )
+
+[~, ~, ext] = fileparts( FileName );
+if strcmpi( ext, '.outb' )
+    [Data, Cols] = ReadFASTbinary( FileName );
+else
+    [Data, Cols] = ReadFASTtext( FileName, '', 8, 7, 8 ); % header lines, channel-name line, and units line of FAST v8 text output files
+end
+
+return
+end
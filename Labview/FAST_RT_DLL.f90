@@ -5,121 +5,269 @@
 ! 
 !  Modification of FAST for Labview RT
 !  Also includes code from FAST_Simulink Adaptation
+!
+!  This file is a thin wrapper around the FAST_Library routines (FAST_Library.f90), so it must be compiled and linked with the
+!  same sources as FAST_Library.dll. It simulates one turbine per DLL:
+!  FAST_RT_DLL_INIT  - reads the input files, initializes the turbine, and (optionally) turns on the real-time profile
+!  FAST_RT_DLL_SIM   - advances the turbine one FAST time step and returns the outputs to Labview RT
+!  FAST_RT_DLL_STATS - returns the step-time statistics of the real-time profile (see FAST_GetRealTimeStats)
+!  FAST_RT_DLL_END   - ends the simulation and frees the turbine
+!
+!  Compared with the FAST v7 version of this DLL, FAST_RT_DLL_INIT also takes the simulation length and the step deadline and
+!  returns the number of outputs and the time step, and all routines return an error status (errors are written to the screen).
 !====================================================================================
+MODULE FAST_RT_DLL_Data
 
-subroutine FAST_RT_DLL_INIT (FileName_RT_Byte, FLen)
+   USE FAST_Data
 
-  ! Expose subroutine FAST_RT_DLL_INIT to users of this DLL
-  !
-  !DEC$ ATTRIBUTES DLLEXPORT::FAST_RT_DLL_INIT
+   IMPLICIT NONE
+   SAVE
 
-USE                     NWTC_Library
-USE							General, ONLY : PriFile, Cmpl4LV
+   INTEGER(C_INT)                        :: Handle  = 0                              ! handle of the turbine simulated by this DLL (0 if none)
+   INTEGER(C_INT)                        :: NumOuts = 0                              ! number of outputs from FAST_Update, including time
+   REAL(DbKi)                            :: TMax_RT = 0.0_DbKi                       ! simulation length (s)
+   REAL(C_DOUBLE), ALLOCATABLE           :: OutputAry(:)                             ! outputs from FAST_Update (time, then the output channels)
 
-USE                     FAST_IO_Subs  ! FAST_Input(), FAST_Begin()
-USE                     FASTSubs      ! FAST_Initialize()
+CONTAINS
+!====================================================================================
+!> Writes a nonempty error message returned from the FAST_Library routines to the screen.
+subroutine WrRTMsg(ErrStat_c, ErrMsg_c)
 
-				! This sub-routine is called by RT to initialize all internal variables
+   INTEGER(C_INT),         INTENT(IN   ) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: ErrMsg_c(IntfStrLen)
 
-IMPLICIT				NONE
+   ! local
+   CHARACTER(IntfStrLen)                 :: ErrMsg
+   INTEGER                               :: I
 
-INTEGER, PARAMETER         :: MaxFileNameLen = 100    
-INTEGER(B1Ki)              :: FileName_RT_Byte(MaxFileNameLen)   ! FileName_RT_Byte
+   IF ( ErrStat_c == ErrID_None ) RETURN
 
-CHARACTER(MaxFileNameLen)  :: FileName_RT_Char        ! FileName_RT_Byte converted to ASCII characters
-INTEGER						   :: FLen                    ! trim length of FileName_RT_Byte
-INTEGER                    :: I                       ! temporary loop counter
+   ErrMsg = TRANSFER( ErrMsg_c, ErrMsg )
+   I = INDEX(ErrMsg,C_NULL_CHAR) - 1
+   IF ( I >= 0 ) ErrMsg = ErrMsg(1:I)
+   CALL WrScr( 'FAST_RT_DLL: '//TRIM(ErrMsg) )
 
+end subroutine WrRTMsg
+!====================================================================================
+END MODULE FAST_RT_DLL_Data
+!====================================================================================
+subroutine FAST_RT_DLL_INIT (FileName_RT_Byte, FLen, TMax_In, Deadline_RT, NumOuts_RT, DT_RT, ErrStat_RT)
 
-IF ( FLen > MaxFileNameLen ) CALL ProgAbort('File name is too long in FAST_RT_DLL_INIT.')
-DO I=1,FLen
-   FileName_RT_Char(I:I) = ACHAR(FileName_RT_Byte(I))
-END DO
-!EQUIVALENCE(FileName_RT_Byte2,FileName_RT_Char)  !Make the character filename equivalent to incoming filename byte array
+  ! Expose subroutine FAST_RT_DLL_INIT to users of this DLL
+  !
+  !DEC$ ATTRIBUTES DLLEXPORT::FAST_RT_DLL_INIT
 
-!FileName_RT_Byte2(:) = FileName_RT_Byte(:)
+   USE FAST_RT_DLL_Data
+
+   IMPLICIT NONE
+
+            ! This sub-routine is called by RT to initialize all internal variables
+
+   INTEGER, PARAMETER         :: MaxFileNameLen = 100    
+   INTEGER(B1Ki), INTENT(IN)  :: FileName_RT_Byte(MaxFileNameLen)   ! FileName_RT_Byte
+   INTEGER,       INTENT(IN)  :: FLen                    ! trim length of FileName_RT_Byte
+   REAL(ReKi),    INTENT(IN)  :: TMax_In                 ! simulation length (s)
+   REAL(ReKi),    INTENT(IN)  :: Deadline_RT             ! wall-clock time allowed for one step (s); <= 0 turns off the real-time profile
+   INTEGER,       INTENT(OUT) :: NumOuts_RT              ! number of output channels returned in OutData_RT (not including time)
+   REAL(ReKi),    INTENT(OUT) :: DT_RT                   ! FAST time step (s), i.e., the time advanced by each call to FAST_RT_DLL_SIM
+   INTEGER,       INTENT(OUT) :: ErrStat_RT              ! error status
+
+   ! local
+   CHARACTER(KIND=C_CHAR)     :: FileName_c(IntfStrLen)  ! FileName_RT_Byte converted to a C string
+   CHARACTER(KIND=C_CHAR)     :: ErrMsg_c(IntfStrLen)
+   CHARACTER(KIND=C_CHAR)     :: ChannelNames_c(ChanLen*MAXOUTPUTS+1)
+   REAL(C_DOUBLE)             :: InitInpAry(MAXInitINPUTS)
+   REAL(C_DOUBLE)             :: InputAry(NumFixedInputs)
+   REAL(C_DOUBLE)             :: dt_c
+   INTEGER(C_INT)             :: ErrStat_c
+   INTEGER(C_INT)             :: AbortErrLev_c
+   INTEGER(C_INT)             :: Handle_c
+   INTEGER                    :: I                       ! temporary loop counter
+
+   NumOuts_RT = 0
+   DT_RT      = 0.0_ReKi
+   ErrStat_RT = ErrID_Fatal
+
+   IF ( FLen > MaxFileNameLen ) THEN
+      CALL WrScr( 'FAST_RT_DLL: File name is too long in FAST_RT_DLL_INIT.' )
+      RETURN
+   ELSEIF ( Handle /= 0 ) THEN
+      CALL WrScr( 'FAST_RT_DLL: FAST_RT_DLL_END must be called before FAST_RT_DLL_INIT is called again.' )
+      RETURN
+   END IF
+
+   FileName_c = C_NULL_CHAR
+   DO I=1,FLen
+      FileName_c(I) = ACHAR(FileName_RT_Byte(I))
+   END DO
+
+   CALL FAST_Create( Handle, ErrStat_c, ErrMsg_c )
+   CALL WrRTMsg( ErrStat_c, ErrMsg_c )
+   IF ( ErrStat_c >= AbortErrLev ) RETURN
+
+      ! Open and read input files, initialize global parameters (no sensor type or Lidar inputs).
+   TMax_RT    = TMax_In
+   InitInpAry = 0.0_C_DOUBLE
+   CALL FAST_Sizes( Handle, REAL(TMax_RT,C_DOUBLE), InitInpAry, FileName_c, AbortErrLev_c, NumOuts, dt_c, ErrStat_c, ErrMsg_c, ChannelNames_c )
+   CALL WrRTMsg( ErrStat_c, ErrMsg_c )
+
+   IF ( ErrStat_c < AbortErrLev_c ) THEN
+      ALLOCATE( OutputAry(NumOuts), STAT=I )
+      IF ( I /= 0 ) THEN
+         CALL WrScr( 'FAST_RT_DLL: Could not allocate the output array in FAST_RT_DLL_INIT.' )
+         ErrStat_c = ErrID_Fatal
+      END IF
+   END IF
+
+      ! Set up initial values for all degrees of freedom.
+   IF ( ErrStat_c < AbortErrLev_c ) THEN
+      InputAry = 0.0_C_DOUBLE
+      CALL FAST_Start( Handle, NumFixedInputs, NumOuts, InputAry, OutputAry, ErrStat_c, ErrMsg_c )
+      CALL WrRTMsg( ErrStat_c, ErrMsg_c )
+   END IF
+
+   IF ( ErrStat_c < AbortErrLev_c .AND. Deadline_RT > 0.0_ReKi ) THEN
+         ! the Labview RT timed loop paces the calls, so FAST only monitors the step times
+      CALL FAST_SetRealTime( Handle, REAL(Deadline_RT,C_DOUBLE), 0_C_INT, ErrStat_c, ErrMsg_c )
+      CALL WrRTMsg( ErrStat_c, ErrMsg_c )
+   END IF
+
+   IF ( ErrStat_c >= AbortErrLev_c ) THEN
+      Handle_c = Handle
+      Handle   = 0
+      IF ( ALLOCATED(OutputAry) ) DEALLOCATE( OutputAry )
+      CALL FAST_Destroy( Handle_c, ErrStat_c, ErrMsg_c )
+      ErrStat_RT = ErrID_Fatal
+      RETURN
+   END IF
+
+   NumOuts_RT = NumOuts - 1
+   DT_RT      = REAL(dt_c,ReKi)
+   ErrStat_RT = ErrStat_c
 
+end subroutine FAST_RT_DLL_INIT
+!====================================================================================
+subroutine FAST_RT_DLL_SIM (BlPitchCom_RT, YawPosCom_RT, YawRateCom_RT, ElecPwr_RT, GenTrq_RT, OutData_RT, Time_RT, HSSBrFrac_RT, ErrStat_RT)
 
 
-!Assign PriFile based on passed in string
-PriFile = FileName_RT_Char(1:FLen)
+  ! Expose subroutine FAST_RT_DLL_SIM to users of this DLL
+  !
+  !DEC$ ATTRIBUTES DLLEXPORT::FAST_RT_DLL_SIM
 
+   USE FAST_RT_DLL_Data
 
-     ! Open and read input files, initialize global parameters.
-CALL FAST_Begin( PriFile, RootName, DirRoot )
+   IMPLICIT NONE
 
+            !  This sub-routine advances the simulation one time step and returns outputs to Labview RT
 
-!Set compiler flag for Simulink
-Cmpl4LV   = .TRUE.
+  ! Variables
+   REAL(ReKi), INTENT(IN)       :: GenTrq_RT                          ! Mechanical generator torque.
+   REAL(ReKi), INTENT(IN)       :: ElecPwr_RT                         ! Electrical power
+   REAL(ReKi), INTENT(IN)       :: YawPosCom_RT                       ! Yaw position
+   REAL(ReKi), INTENT(IN)       :: YawRateCom_RT                      ! Yaw rate
+   REAL(ReKi), INTENT(IN)       :: BlPitchCom_RT  (*)                 ! Blade pitch commands (3 values)
+   REAL(ReKi), INTENT(OUT)      :: OutData_RT  (*)                    ! Outputs (NumOuts_RT channels, then TMax, then Time_RT)
+   REAL(ReKi), INTENT(OUT)      :: Time_RT
+   REAL(ReKi), INTENT(IN)       :: HSSBrFrac_RT                       ! Brake Fraction
+   INTEGER,    INTENT(OUT)      :: ErrStat_RT                         ! error status (ErrID_Info when the simulation has completed)
+
+   ! local
+   REAL(C_DOUBLE)               :: InputAry(NumFixedInputs)
+   INTEGER(C_INT)               :: ErrStat_c
+   CHARACTER(KIND=C_CHAR)       :: ErrMsg_c(IntfStrLen)
+
+   IF ( Handle == 0 ) THEN
+      CALL WrScr( 'FAST_RT_DLL: FAST_RT_DLL_INIT must be called before FAST_RT_DLL_SIM.' )
+      ErrStat_RT = ErrID_Fatal
+      RETURN
+   END IF
+
+  !Copy in inputs from RT (see FAST_SetExternalInputs)
+   InputAry(1)   = GenTrq_RT
+   InputAry(2)   = ElecPwr_RT
+   InputAry(3)   = YawPosCom_RT
+   InputAry(4)   = YawRateCom_RT
+   InputAry(5:7) = BlPitchCom_RT(1:3)
+   InputAry(8)   = HSSBrFrac_RT
+
+  !Run simulation
+   CALL FAST_Update( Handle, NumFixedInputs, NumOuts, InputAry, OutputAry, ErrStat_c, ErrMsg_c )
+   IF ( ErrStat_c /= ErrID_Info ) CALL WrRTMsg( ErrStat_c, ErrMsg_c )   ! don't print "Simulation completed." in every call after TMax
+
+  !Copy outputs
+   Time_RT = REAL(OutputAry(1),ReKi)
+   OutData_RT(1:NumOuts-1) = REAL(OutputAry(2:NumOuts),ReKi)
+   OutData_RT(NumOuts)     = REAL(TMax_RT,ReKi)
+   OutData_RT(NumOuts+1)   = Time_RT
+   ErrStat_RT = ErrStat_c
 
-CALL FAST_Input()
+end subroutine FAST_RT_DLL_SIM
+!====================================================================================
+subroutine FAST_RT_DLL_STATS (NumSteps_RT, NumOverruns_RT, WorstStepTime_RT, MeanStepTime_RT, ErrStat_RT)
 
-   ! Set up initial values for all degrees of freedom.
-CALL FAST_Initialize(p,x,y,OtherState)
+  ! Expose subroutine FAST_RT_DLL_STATS to users of this DLL
+  !
+  !DEC$ ATTRIBUTES DLLEXPORT::FAST_RT_DLL_STATS
 
+   USE FAST_RT_DLL_Data
 
-end subroutine FAST_RT_DLL_INIT
+   IMPLICIT NONE
 
+            !  This sub-routine returns the step-time statistics collected since FAST_RT_DLL_INIT (with Deadline_RT > 0)
 
+   INTEGER,    INTENT(OUT)      :: NumSteps_RT                        ! number of steps timed
+   INTEGER,    INTENT(OUT)      :: NumOverruns_RT                     ! number of steps that took longer than Deadline_RT
+   REAL(ReKi), INTENT(OUT)      :: WorstStepTime_RT                   ! longest step time (s)
+   REAL(ReKi), INTENT(OUT)      :: MeanStepTime_RT                    ! mean step time (s)
+   INTEGER,    INTENT(OUT)      :: ErrStat_RT                         ! error status
 
+   ! local
+   INTEGER(C_INT)               :: NumSteps_c, NumOverruns_c, LastOverrun_c, NumBins_c
+   REAL(C_DOUBLE)               :: WorstStepTime_c, MeanStepTime_c, BinWidth_c
+   INTEGER(C_INT)               :: Histogram_c(NumRTBins)
+   INTEGER(C_INT)               :: ErrStat_c
+   CHARACTER(KIND=C_CHAR)       :: ErrMsg_c(IntfStrLen)
 
-!====================================================================================
-subroutine FAST_RT_DLL_SIM (BlPitchCom_RT, YawPosCom_RT, YawRateCom_RT, ElecPwr_RT, GenTrq_RT, OutData_RT, Time_RT, HSSBrFrac_RT)
+   NumBins_c = NumRTBins
+   CALL FAST_GetRealTimeStats( Handle, NumSteps_c, NumOverruns_c, LastOverrun_c, WorstStepTime_c, MeanStepTime_c, &
+                               NumBins_c, BinWidth_c, Histogram_c, ErrStat_c, ErrMsg_c )
+   CALL WrRTMsg( ErrStat_c, ErrMsg_c )
 
+   NumSteps_RT      = NumSteps_c
+   NumOverruns_RT   = NumOverruns_c
+   WorstStepTime_RT = REAL(WorstStepTime_c,ReKi)
+   MeanStepTime_RT  = REAL(MeanStepTime_c,ReKi)
+   ErrStat_RT       = ErrStat_c
 
-  ! Expose subroutine FAST_RT_DLL_SIM to users of this DLL
+end subroutine FAST_RT_DLL_STATS
+!====================================================================================
+subroutine FAST_RT_DLL_END (ErrStat_RT)
+
+  ! Expose subroutine FAST_RT_DLL_END to users of this DLL
   !
-  !DEC$ ATTRIBUTES DLLEXPORT::FAST_RT_DLL_SIM
+  !DEC$ ATTRIBUTES DLLEXPORT::FAST_RT_DLL_END
 
+   USE FAST_RT_DLL_Data
 
-USE                             SimCont      !ZTime
+   IMPLICIT NONE
 
-! These are needed for FirstTime = .FALSE.
-USE                             DriveTrain   ! GenTrq and now also HSSBrFrac
-USE                             TurbCont     ! BlPitch
-USE                             TurbConf     ! NumBl
-USE                             Blades       ! TipNode
-USE                             Precision    ! ReKi
-USE                             Features     ! CompAero
-USE                             Output       ! for WrOutHdr
+            !  This sub-routine ends the simulation (writing the binary output file) and frees the turbine
 
-USE                           FASTSubs       ! TimeMarch()
+   INTEGER,    INTENT(OUT)      :: ErrStat_RT                         ! error status
 
-IMPLICIT						NONE
+   ! local
+   INTEGER(C_INT)               :: ErrStat_c
+   CHARACTER(KIND=C_CHAR)       :: ErrMsg_c(IntfStrLen)
 
-				!  This sub-routine implements n-iterations of time step and returns outputs to Labview RT
+   ErrStat_RT = ErrID_None
+   IF ( Handle == 0 ) RETURN
 
-  ! Variables
-REAL(ReKi), INTENT(IN)       :: GenTrq_RT                          ! Mechanical generator torque.
-REAL(ReKi), INTENT(IN)       :: ElecPwr_RT                         ! Electrical power
-REAL(ReKi), INTENT(IN)       :: YawPosCom_RT                       ! Yaw position
-REAL(ReKi), INTENT(IN)       :: YawRateCom_RT                      ! Yaw rate
-REAL(ReKi), INTENT(IN)       :: BlPitchCom_RT  (*) 
-REAL(ReKi), INTENT(OUT)      :: OutData_RT  (*) 
-REAL(ReKi), INTENT(OUT)      :: Time_RT
-REAL(ReKi), INTENT(IN)       :: HSSBrFrac_RT                       ! Brake Fraction
-
-  !Copy in inputs from RT
-   BlPitchCom = BlPitchCom_RT(1:NumBl)
-   YawPosCom = YawPosCom_RT
-   YawRateCom = YawRateCom_RT
-   ElecPwr = ElecPwr_RT
-   GenTrq= GenTrq_RT
-   HSSBrFrac = HSSBrFrac_RT
-
-   ! Set the command pitch angles to the actual pitch angles since we have no
-   ! built-in pitch actuator:
-    BlPitch = BlPitchCom
-
-
-!Run simulation
-Call TimeMarch( p_StrD, x_StrD, OtherSt_StrD, y_StrD, ErrStat, ErrMsg )
-
-
-!Copy outputs
-OutData_RT(1:p_StrD%NumOuts) = OutData(1:p_StrD%NumOuts)
-Time_RT = ZTime;
-OutData_RT(p_StrD%NumOuts+1) = TMax;
-OutData_RT(p_StrD%NumOuts+2) = Time_RT;
+   CALL FAST_End( Handle )
+   CALL FAST_Destroy( Handle, ErrStat_c, ErrMsg_c )
+   CALL WrRTMsg( ErrStat_c, ErrMsg_c )
+   ErrStat_RT = ErrStat_c
 
-end subroutine FAST_RT_DLL_SIM
+   Handle = 0
+   IF ( ALLOCATED(OutputAry) ) DEALLOCATE( OutputAry )
+
+end subroutine FAST_RT_DLL_END
@@ -34,5 +34,10 @@ TMax = 20;
 % run the model
 sim('Test01_SIG.mdl',[0,TMax]);
 
+% The FAST block stores the names of its output channels in its UserData when the model is initialized. With only one FAST
+% block in the model (as here), it also sets OutList and DT in the base workspace, which the Fcn blocks of this model use.
+% In a model with several FAST blocks, OutList and DT are not set; read each block's list after the model is initialized:
+% OutList = get_param('Test01_SIG/FAST Nonlinear Wind Turbine/S-Function','UserData');
+
 % look at results:
 % PlotFASToutput({'../../CertTest/Test01.SFunc.out','../../CertTest/Test01.out'},{'SFunc','exe'});
\ No newline at end of file
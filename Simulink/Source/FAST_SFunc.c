@@ -25,36 +25,54 @@
  * its associated macro definitions.
  */
 #include "simstruc.h"
-#include "mex.h"     // for mexPutVariable
-#include "matrix.h"  // for mxCreateDoubleScalar
+#include "mex.h"     // for mexCallMATLAB and mexPutVariable
+#include "matrix.h"  // for mxCreateCellMatrix
 #include "FAST_Library.h"
 
 
 #define PARAM_FILENAME 0
 #define PARAM_TMAX 1
 #define PARAM_ADDINPUTS 2
+#define PARAM_NUMSTEPS 3   // optional: number of FAST time steps per Simulink sample (default 1)
 #define NUM_PARAM 3
+#define NUM_PARAM_MAX 4
 
 // two DWork arrays:
 #define WORKARY_OUTPUT 0
 #define WORKARY_INPUT 1
 
-
-static double dt = 0;
-static double TMax = 0;
-static int NumInputs = NumFixedInputs;
-static int NumAddInputs = 0;  // number of additional inputs
-static int NumOutputs = 1;
-static int ErrStat = 0;
-static char ErrMsg[INTERFACE_STRING_LENGTH];        // make sure this is the same size as IntfStrLen in FAST_Library.f90
-static char InputFileName[INTERFACE_STRING_LENGTH]; // make sure this is the same size as IntfStrLen in FAST_Library.f90
-static int n_t_global = -2;  // counter to determine which fixed-step simulation time we are at currently (start at -2 for initialization)
+// one PWork pointer:
+#define WORKPTR_BLOCK 0
+
+
+// Data for one FAST block. Each block has its own turbine instance in the FAST library, so a model can contain several FAST blocks.
+// The data is allocated in mdlInitializeSizes (kept in the block's UserData until its PWork exists) and freed in mdlTerminate.
+typedef struct {
+   double dt;
+   double TMax;
+   int NumInputs;
+   int NumAddInputs;  // number of additional inputs
+   int NumOutputs;
+   int NumStepsPerSample; // number of FAST time steps taken in each call to mdlUpdate
+   int OutputRow;     // row of the output DWork array that holds the latest outputs
+   int AbortErrLev;   // abort error level; compare with NWTC Library (set by FAST_Sizes)
+   int ErrStat;
+   char ErrMsg[INTERFACE_STRING_LENGTH];        // make sure this is the same size as IntfStrLen in FAST_Library.f90
+   char InputFileName[INTERFACE_STRING_LENGTH]; // make sure this is the same size as IntfStrLen in FAST_Library.f90
+   int n_t_global;    // counter to determine which fixed-step simulation time we are at currently (start at -2 for initialization)
+   int Handle;        // handle of the turbine instance in the FAST library
+} FAST_Block_t;
+
+static char ErrStatusMsg[INTERFACE_STRING_LENGTH]; // ssSetErrorStatus needs persistent memory; the block data is freed when the block terminates
 
 // function definitions
-static int checkError(SimStruct *S);
+static int checkError(SimStruct *S, FAST_Block_t *Block);
 static void mdlTerminate(SimStruct *S); // defined here so I can call it from checkError
+static FAST_Block_t *getBlock(SimStruct *S);
 static void getInputs(SimStruct *S, double *InputAry);
-static void setOutputs(SimStruct *S, double *OutputAry);
+static void setOutputs(SimStruct *S, FAST_Block_t *Block, double *OutputAry);
+static int setBlockOutList(SimStruct *S, mxArray *OutList);
+static int countFASTBlocks(SimStruct *S);
 
 
 /* Error handling
@@ -70,25 +88,38 @@ static void setOutputs(SimStruct *S, double *OutputAry);
 * It cannot be a local variable. 
 */
 static int
-checkError(SimStruct *S){
+checkError(SimStruct *S, FAST_Block_t *Block){
 
-   if (ErrStat >= AbortErrLev){
+   if (Block->ErrStat >= Block->AbortErrLev){
       ssPrintf("\n");
-      ssSetErrorStatus(S, ErrMsg);
+      strcpy(ErrStatusMsg, Block->ErrMsg);
+      ssSetErrorStatus(S, ErrStatusMsg);
       mdlTerminate(S);  // terminate on error (in case Simulink doesn't do so itself)
       return 1;
    }
-   else if (ErrStat >= ErrID_Warn){
+   else if (Block->ErrStat >= ErrID_Warn){
       ssPrintf("\n");
-      ssWarning(S, ErrMsg);
+      ssWarning(S, Block->ErrMsg);
    }
-   else if (ErrStat != ErrID_None){
-      ssPrintf("\n%s\n", ErrMsg);
+   else if (Block->ErrStat != ErrID_None){
+      ssPrintf("\n%s\n", Block->ErrMsg);
    }
    return 0;
 
 }
 
+static FAST_Block_t *
+getBlock(SimStruct *S){
+
+   FAST_Block_t *Block = (FAST_Block_t *)ssGetUserData(S); // before mdlStart
+
+   if (Block == NULL && ssGetPWork(S) != NULL){
+      Block = (FAST_Block_t *)ssGetPWorkValue(S, WORKPTR_BLOCK);
+   }
+   return Block;
+
+}
+
 static void
 getInputs(SimStruct *S, double *InputAry){
 
@@ -101,14 +132,70 @@ getInputs(SimStruct *S, double *InputAry){
    
 }
 
+// Stores the cell array of output channel names in this block's UserData, so each FAST block in a model keeps its own list
+// (read it with get_param(<block path>, 'UserData')). Returns 0 on success.
+static int
+setBlockOutList(SimStruct *S, mxArray *OutList){
+
+#ifdef MATLAB_MEX_FILE
+   mxArray *rhs[3];
+   int ErrStat;
+
+   rhs[0] = mxCreateString(ssGetPath(S));
+   rhs[1] = mxCreateString("UserData");
+   rhs[2] = OutList;
+   ErrStat = mexCallMATLAB(0, NULL, 3, rhs, "set_param");
+   mxDestroyArray(rhs[0]);
+   mxDestroyArray(rhs[1]);
+   return ErrStat;
+#else
+   return 0;   // generated code has no block to store the names in
+#endif
+
+}
+
+// Returns the number of FAST SFunc blocks in the model that contains this block (0 if it can't be determined).
+static int
+countFASTBlocks(SimStruct *S){
+
+#ifdef MATLAB_MEX_FILE
+   mxArray *rhs[9];
+   mxArray *lhs[1];
+   int NumBlocks = 0;
+   int i;
+
+   rhs[0] = mxCreateString(ssGetModelName(ssGetRootSS(S)));
+   rhs[1] = mxCreateString("LookUnderMasks");
+   rhs[2] = mxCreateString("all");
+   rhs[3] = mxCreateString("FollowLinks");
+   rhs[4] = mxCreateString("on");
+   rhs[5] = mxCreateString("BlockType");
+   rhs[6] = mxCreateString("S-Function");
+   rhs[7] = mxCreateString("FunctionName");
+   rhs[8] = mxCreateString(ssGetSFunctionName(S));
+   if (mexCallMATLAB(1, lhs, 9, rhs, "find_system") == 0){
+      NumBlocks = (int)mxGetNumberOfElements(lhs[0]);
+      mxDestroyArray(lhs[0]);
+   }
+   for (i = 0; i < 9; i++){
+      mxDestroyArray(rhs[i]);
+   }
+   return NumBlocks;
+#else
+   return 0;
+#endif
+
+}
+
 static void
-setOutputs(SimStruct *S, double *OutputAry){
+setOutputs(SimStruct *S, FAST_Block_t *Block, double *OutputAry){
 
    int     k;
    double *y = ssGetOutputPortRealSignal(S, 0);
+   double *LatestOutputs = OutputAry + Block->OutputRow * Block->NumOutputs;
 
-   for (k = 0; k < ssGetOutputPortWidth(S, WORKARY_OUTPUT); k++) {
-      y[k] = OutputAry[k];
+   for (k = 0; k < ssGetOutputPortWidth(S, 0); k++) {
+      y[k] = LatestOutputs[k];
    }
 
 }
@@ -135,39 +222,66 @@ static void mdlInitializeSizes(SimStruct *S)
    //static char OutList[MAXIMUM_OUTPUTS][CHANNEL_LENGTH + 1];
    static char OutList[CHANNEL_LENGTH + 1];
    double *AdditionalInitInputs;
+   FAST_Block_t *Block;
    mxArray *pm, *chrAry;
    mwSize m, n;
    mwIndex indx;
 
-   if (n_t_global == -2) {
+   if (ssGetUserData(S) == NULL) {
 
             /* Expected S-Function Input Parameter(s) */
-      ssSetNumSFcnParams(S, NUM_PARAM);  /* Number of expected parameters */
+      ssSetNumSFcnParams(S, NUM_PARAM);  /* Number of expected parameters (the number of steps per sample is optional) */
+      if (ssGetSFcnParamsCount(S) == NUM_PARAM_MAX) ssSetNumSFcnParams(S, NUM_PARAM_MAX);
       if (ssGetNumSFcnParams(S) != ssGetSFcnParamsCount(S)) {
            /* Return if number of expected != number of actual parameters */
            return;
        }
+
+       Block = (FAST_Block_t *)calloc(1, sizeof(FAST_Block_t));
+       if (Block == NULL){
+          strcpy(ErrStatusMsg, "Error allocating memory for the FAST SFunc block.");
+          ssSetErrorStatus(S, ErrStatusMsg);
+          return;
+       }
+       Block->NumInputs = NumFixedInputs;
+       Block->NumOutputs = 1;
+       Block->NumStepsPerSample = 1;
+       Block->AbortErrLev = ErrID_Fatal;
+       Block->n_t_global = -2;
+       ssSetUserData(S, Block); // PWork doesn't exist yet; mdlStart moves this pointer there
     
          // The parameters should not be changed during the course of a simulation
        ssSetSFcnParamTunable(S, PARAM_FILENAME, SS_PRM_NOT_TUNABLE); 
-       mxGetString(ssGetSFcnParam(S, PARAM_FILENAME), InputFileName, INTERFACE_STRING_LENGTH);
+       mxGetString(ssGetSFcnParam(S, PARAM_FILENAME), Block->InputFileName, INTERFACE_STRING_LENGTH);
 
        ssSetSFcnParamTunable(S, PARAM_TMAX, SS_PRM_NOT_TUNABLE); 
-       TMax = mxGetScalar(ssGetSFcnParam(S, PARAM_TMAX));
+       Block->TMax = mxGetScalar(ssGetSFcnParam(S, PARAM_TMAX));
 
        ssSetSFcnParamTunable(S, PARAM_ADDINPUTS, SS_PRM_NOT_TUNABLE);
-       NumAddInputs = (int)(mxGetScalar(ssGetSFcnParam(S, PARAM_ADDINPUTS)) + 0.5); // add 0.5 for rounding from double
+       Block->NumAddInputs = (int)(mxGetScalar(ssGetSFcnParam(S, PARAM_ADDINPUTS)) + 0.5); // add 0.5 for rounding from double
 
-       if (NumAddInputs < 0){
-          ErrStat = ErrID_Fatal;
-          strcpy(ErrMsg, "Parameter specifying number of additional inputs to the FAST SFunc must not be negative.\n");
-          checkError(S);
+       if (Block->NumAddInputs < 0){
+          Block->ErrStat = ErrID_Fatal;
+          strcpy(Block->ErrMsg, "Parameter specifying number of additional inputs to the FAST SFunc must not be negative.\n");
+          checkError(S, Block);
           return;
        }
-       NumInputs = NumFixedInputs + NumAddInputs;
+       Block->NumInputs = NumFixedInputs + Block->NumAddInputs;
+
+       if (ssGetNumSFcnParams(S) == NUM_PARAM_MAX){
+          ssSetSFcnParamTunable(S, PARAM_NUMSTEPS, SS_PRM_NOT_TUNABLE);
+          Block->NumStepsPerSample = (int)(mxGetScalar(ssGetSFcnParam(S, PARAM_NUMSTEPS)) + 0.5); // add 0.5 for rounding from double
+
+          if (Block->NumStepsPerSample < 1){
+             Block->ErrStat = ErrID_Fatal;
+             strcpy(Block->ErrMsg, "Parameter specifying number of FAST time steps per sample in the FAST SFunc must be at least 1.\n");
+             checkError(S, Block);
+             return;
+          }
+       }
 
        // now see if there are other inputs that need to be processed...
-       if (NumAddInputs > 0){
+       if (Block->NumAddInputs > 0){
     
           k = (int)mxGetNumberOfElements(ssGetSFcnParam(S, PARAM_ADDINPUTS));
           k = min( k , MAXInitINPUTS );
@@ -190,29 +304,27 @@ static void mdlInitializeSizes(SimStruct *S)
     /*  ---------------------------------------------  */
     //   strcpy(InputFileName, "../../CertTest/Test01.fst");
 
-       FAST_Sizes(&TMax, InitInputAry, InputFileName, &AbortErrLev, &NumOutputs, &dt, &ErrStat, ErrMsg, ChannelNames);
+       FAST_Create(&Block->Handle, &Block->ErrStat, Block->ErrMsg);
+       if (checkError(S, Block)) return;
 
-       n_t_global = -1;
-       if (checkError(S)) return;
+       FAST_Sizes(&Block->Handle, &Block->TMax, InitInputAry, Block->InputFileName, &Block->AbortErrLev, &Block->NumOutputs, &Block->dt, 
+                  &Block->ErrStat, Block->ErrMsg, ChannelNames);
 
+       Block->n_t_global = -1;
+       if (checkError(S, Block)) return;
 
-       // set DT in the Matlab workspace (necessary for Simulink block solver options)
-       pm = mxCreateDoubleScalar(dt);
-       ErrStat = mexPutVariable("base", "DT", pm);
-       mxDestroyArray(pm);
-       if (ErrStat != 0){
-          ErrStat = ErrID_Fatal;
-          strcpy(ErrMsg, "Error copying string array to 'DT' variable in the base Matlab workspace.");
-          checkError(S);
-          return;
-       }
 
-  
-       // put the names of the output channels in a cell-array variable called "OutList" in the base matlab workspace
-       m = NumOutputs;
+       // The sample time of this block (dt * NumStepsPerSample) is set in mdlInitializeSampleTimes; a fixed-step solver with
+       // FixedStep = 'auto' picks it up from there.
+
+       // put the names of the output channels in a cell array in this block's UserData. When this is the only FAST block in the
+       // model, also put them in a cell-array variable called "OutList" and the sample time in "DT" in the base matlab workspace,
+       // as earlier versions did, so existing models (e.g., Fcn blocks that use OutList) still work. With several FAST blocks,
+       // these variables would belong to whichever block was initialized last, so they are not set; use each block's UserData.
+       m = Block->NumOutputs;
        n = 1;
        pm = mxCreateCellMatrix(m, n);
-       for (i = 0; i < NumOutputs; i++){
+       for (i = 0; i < Block->NumOutputs; i++){
           j = CHANNEL_LENGTH - 1;
           while (ChannelNames[i*CHANNEL_LENGTH + j] == ' '){
              j--;
@@ -225,15 +337,39 @@ static void mdlInitializeSizes(SimStruct *S)
           mxSetCell(pm, indx, chrAry);
           //mxDestroyArray(chrAry);
        }
-       ErrStat = mexPutVariable("base", "OutList", pm);
-       mxDestroyArray(pm);
+       Block->ErrStat = setBlockOutList(S, pm);
 
-       if (ErrStat != 0){
-          ErrStat = ErrID_Fatal;
-          strcpy(ErrMsg, "Error copying string array to 'OutList' variable in the base Matlab workspace.");
-          checkError(S);
+       if (Block->ErrStat != 0){
+          mxDestroyArray(pm);
+          Block->ErrStat = ErrID_Fatal;
+          strcpy(Block->ErrMsg, "Error storing the output channel names in the UserData of the FAST SFunc block.");
+          checkError(S, Block);
           return;
        }
+
+       if (countFASTBlocks(S) == 1){
+          Block->ErrStat = mexPutVariable("base", "OutList", pm);
+          mxDestroyArray(pm);
+          if (Block->ErrStat != 0){
+             Block->ErrStat = ErrID_Fatal;
+             strcpy(Block->ErrMsg, "Error copying string array to 'OutList' variable in the base Matlab workspace.");
+             checkError(S, Block);
+             return;
+          }
+
+          pm = mxCreateDoubleScalar(Block->dt * Block->NumStepsPerSample);
+          Block->ErrStat = mexPutVariable("base", "DT", pm);
+          mxDestroyArray(pm);
+          if (Block->ErrStat != 0){
+             Block->ErrStat = ErrID_Fatal;
+             strcpy(Block->ErrMsg, "Error copying string array to 'DT' variable in the base Matlab workspace.");
+             checkError(S, Block);
+             return;
+          }
+       }
+       else{
+          mxDestroyArray(pm);
+       }
        //  ---------------------------------------------  
     
 
@@ -242,7 +378,7 @@ static void mdlInitializeSizes(SimStruct *S)
 
          /* sets input port characteristics */
        if (!ssSetNumInputPorts(S, 1)) return; 
-       ssSetInputPortWidth(S, 0, NumInputs); // width of first input port
+       ssSetInputPortWidth(S, 0, Block->NumInputs); // width of first input port
 
        /*
         * Set direct feedthrough flag (1=yes, 0=no).
@@ -252,7 +388,7 @@ static void mdlInitializeSizes(SimStruct *S)
        ssSetInputPortDirectFeedThrough(S, 0, 0); // no direct feedthrough because we're just putting everything in one update routine (acting like a discrete system)
 
        if (!ssSetNumOutputPorts(S, 1)) return;
-       ssSetOutputPortWidth(S, 0, NumOutputs);
+       ssSetOutputPortWidth(S, 0, Block->NumOutputs);
 
        ssSetNumSampleTimes(S, 1); // -> setting this > 0 calls mdlInitializeSampleTimes()
 
@@ -269,12 +405,14 @@ static void mdlInitializeSizes(SimStruct *S)
         */
        if(!ssSetNumDWork(   S, 2)) return;
 
-       ssSetDWorkWidth(   S, WORKARY_OUTPUT, ssGetOutputPortWidth(S, 0));
+       ssSetDWorkWidth(   S, WORKARY_OUTPUT, ssGetOutputPortWidth(S, 0) * Block->NumStepsPerSample); // one row of outputs per FAST step in a sample
        ssSetDWorkDataType(S, WORKARY_OUTPUT, SS_DOUBLE); /* use SS_DOUBLE if needed */
 
        ssSetDWorkWidth(   S, WORKARY_INPUT, ssGetInputPortWidth(S, 0));
        ssSetDWorkDataType(S, WORKARY_INPUT, SS_DOUBLE);
 
+       ssSetNumPWork(S, 1); // pointer to the block data
+
        ssSetNumNonsampledZCs(S, 0);
 
        /* Specify the sim state compliance to be same as a built-in block */
@@ -302,7 +440,9 @@ static void mdlInitializeSampleTimes(SimStruct *S)
      * step) sample time, 1 second is chosen below.
      */
 
-    ssSetSampleTime(S, 0, dt); /* Choose the sample time here if discrete */ 
+    FAST_Block_t *Block = getBlock(S);
+
+    ssSetSampleTime(S, 0, Block->dt * Block->NumStepsPerSample); /* Choose the sample time here if discrete */ 
     ssSetOffsetTime(S, 0, 0.0);
    
     ssSetModelReferenceSampleTimeDefaultInheritance(S);
@@ -326,15 +466,21 @@ static void mdlInitializeSampleTimes(SimStruct *S)
      */
      double *InputAry = (double *)ssGetDWork(S, WORKARY_INPUT); //malloc(NumInputs*sizeof(double));   
      double *OutputAry = (double *)ssGetDWork(S, WORKARY_OUTPUT);
+     FAST_Block_t *Block = getBlock(S);
+
+     // keep the block data with this block's PWork from now on
+     ssSetPWorkValue(S, WORKPTR_BLOCK, Block);
+     ssSetUserData(S, NULL);
 
      //n_t_global is -1 here; maybe use this fact in mdlOutputs
-     if (n_t_global == -1){ // first time to compute outputs:
+     if (Block->n_t_global == -1){ // first time to compute outputs:
 
 //        getInputs(S, InputAry);
 
-        FAST_Start(&NumInputs, &NumOutputs, InputAry, OutputAry, &ErrStat, ErrMsg);
-        n_t_global = 0;
-        if (checkError(S)) return;
+        FAST_Start(&Block->Handle, &Block->NumInputs, &Block->NumOutputs, InputAry, OutputAry, &Block->ErrStat, Block->ErrMsg);
+        Block->OutputRow = 0;
+        Block->n_t_global = 0;
+        if (checkError(S, Block)) return;
 
      }
   }
@@ -369,18 +515,20 @@ static void mdlOutputs(SimStruct *S, int_T tid)
     
     double *InputAry  = (double *)ssGetDWork(S, WORKARY_INPUT);
     double *OutputAry = (double *)ssGetDWork(S, WORKARY_OUTPUT);
+    FAST_Block_t *Block = getBlock(S);
 
-    if (n_t_global == -1){ // first time to compute outputs:
+    if (Block->n_t_global == -1){ // first time to compute outputs:
 
        getInputs(S, InputAry);
 
-       FAST_Start(&NumInputs, &NumOutputs, InputAry, OutputAry, &ErrStat, ErrMsg);
-       n_t_global = 0;
-       if (checkError(S)) return;
+       FAST_Start(&Block->Handle, &Block->NumInputs, &Block->NumOutputs, InputAry, OutputAry, &Block->ErrStat, Block->ErrMsg);
+       Block->OutputRow = 0;
+       Block->n_t_global = 0;
+       if (checkError(S, Block)) return;
 
     }
 
-    setOutputs(S, OutputAry);
+    setOutputs(S, Block, OutputAry);
 
 }
 
@@ -407,6 +555,9 @@ static void mdlUpdate(SimStruct *S, int_T tid)
      */
     double *InputAry  = (double *)ssGetDWork(S, WORKARY_INPUT);
     double *OutputAry = (double *)ssGetDWork(S, WORKARY_OUTPUT);
+    FAST_Block_t *Block = getBlock(S);
+    int NumInputSamples = 1;  // inputs are held constant over the FAST steps in a sample
+    int NumStepsTaken = 0;
 
     //time_T t = ssGetSampleTime(S, 0);
 
@@ -414,12 +565,20 @@ static void mdlUpdate(SimStruct *S, int_T tid)
 
     /* ==== Call the Fortran routine (args are pass-by-reference) */
     
-    FAST_Update(&NumInputs, &NumOutputs, InputAry, OutputAry, &ErrStat, ErrMsg);
-    n_t_global = n_t_global + 1;
+    if (Block->NumStepsPerSample == 1){
+       FAST_Update(&Block->Handle, &Block->NumInputs, &Block->NumOutputs, InputAry, OutputAry, &Block->ErrStat, Block->ErrMsg);
+       NumStepsTaken = 1;
+    }
+    else{
+       FAST_UpdateN(&Block->Handle, &Block->NumStepsPerSample, &Block->NumInputs, &NumInputSamples, &Block->NumOutputs, InputAry, OutputAry,
+                    &NumStepsTaken, &Block->ErrStat, Block->ErrMsg);
+    }
+    Block->n_t_global = Block->n_t_global + NumStepsTaken;
+    if (NumStepsTaken > 0) Block->OutputRow = NumStepsTaken - 1;
 
-    if (checkError(S)) return;
+    if (checkError(S, Block)) return;
 
-    setOutputs(S, OutputAry);
+    setOutputs(S, Block, OutputAry);
 
 }
 #endif /* MDL_UPDATE */
@@ -435,11 +594,24 @@ static void mdlUpdate(SimStruct *S, int_T tid)
  */
 static void mdlTerminate(SimStruct *S)
 {
-   if (n_t_global > -2){ // just in case we've never initialized, check this time step
-      FAST_End();
-      n_t_global = -2;
+   FAST_Block_t *Block = getBlock(S);
+
+   if (Block == NULL) return;  // already terminated (or never initialized)
+
+   if (Block->n_t_global > -2){ // just in case we've never initialized, check this time step
+      FAST_End(&Block->Handle);
+      Block->n_t_global = -2;
    }  
 
+   if (Block->Handle != 0){
+      FAST_Destroy(&Block->Handle, &Block->ErrStat, Block->ErrMsg);
+      Block->Handle = 0;
+   }  
+
+   free(Block);
+   ssSetUserData(S, NULL);
+   if (ssGetPWork(S) != NULL) ssSetPWorkValue(S, WORKPTR_BLOCK, NULL);
+
 }
 
 
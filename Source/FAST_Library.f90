@@ -1,9 +1,21 @@
 !  FAST_Library.f90 
 !
 !  FUNCTIONS/SUBROUTINES exported from FAST_Library.dll:
-!  FAST_Start  - subroutine 
-!  FAST_Update - subroutine 
-!  FAST_End    - subroutine 
+!  FAST_Create  - subroutine
+!  FAST_Start   - subroutine
+!  FAST_Update  - subroutine
+!  FAST_UpdateN - subroutine
+!  FAST_BindOutputBuffer - subroutine
+!  FAST_SetRealTime      - subroutine
+!  FAST_GetRealTimeStats - subroutine
+!  FAST_End     - subroutine
+!  FAST_Destroy - subroutine
+!
+!  Each turbine simulated by this library is an instance referenced by the (opaque) integer handle returned from FAST_Create.
+!  All other exported routines take that handle as their first argument, so one process can host several turbines.
+!  The library is not thread safe: the NWTC Library keeps process-wide state (the unit numbers from GetNewUnit, AbortErrLev,
+!  and the WrScr/ProgAbort output), and a Bladed-style controller DLL is loaded once per process. All calls, for any instance,
+!  must therefore be made from one thread at a time.
 !   
 ! DO NOT REMOVE or MODIFY LINES starting with "!DEC$" or "!GCC$"
 ! !DEC$ specifies attributes for IVF and !GCC$ specifies attributes for gfortran
@@ -24,22 +36,212 @@ MODULE FAST_Data
    INTEGER(IntKi), PARAMETER             :: MAXOUTPUTS = 1000                       ! Maximum number of outputs
    INTEGER(IntKi), PARAMETER             :: MAXInitINPUTS = 10                      ! Maximum number of initialization values from Simulink
    INTEGER(IntKi), PARAMETER             :: NumFixedInputs = 8
+   INTEGER(IntKi), PARAMETER             :: NumRTBins = 20                          ! Number of bins in the real-time step-time histogram
+   
    
+      !> Step timing for the real-time profile of one turbine instance (see FAST_SetRealTime)
+   TYPE :: FAST_RealTimeType
+      LOGICAL                            :: Enabled       = .FALSE.                 ! whether the step times are monitored
+      LOGICAL                            :: Pace          = .FALSE.                 ! whether each step waits for wall-clock time to catch up with simulation time
+      REAL(DbKi)                         :: Deadline      = 0.0_DbKi                ! wall-clock time allowed for one step (s)
+      REAL(DbKi)                         :: BinWidth      = 0.0_DbKi                ! width of the histogram bins (s)
+      INTEGER(B8Ki)                      :: ClockRate     = 1                       ! SYSTEM_CLOCK counts per second
+      INTEGER(B8Ki)                      :: StepStart     = 0                       ! SYSTEM_CLOCK count at the start of the current step
+      INTEGER(B8Ki)                      :: PaceStart     = 0                       ! SYSTEM_CLOCK count when the simulation was at PaceTime
+      REAL(DbKi)                         :: PaceTime      = 0.0_DbKi                ! simulation time when pacing started (s)
+      INTEGER(IntKi)                     :: NumSteps      = 0                       ! number of steps timed
+      INTEGER(IntKi)                     :: NumOverruns   = 0                       ! number of steps that took longer than Deadline
+      INTEGER(IntKi)                     :: LastOverrun   = -1                      ! time step (n_t_global) of the latest overrun
+      REAL(DbKi)                         :: WorstStepTime = 0.0_DbKi                ! longest step time (s)
+      REAL(DbKi)                         :: SumStepTime   = 0.0_DbKi                ! sum of the step times (s)
+      INTEGER(IntKi)                     :: Histogram(NumRTBins) = 0                ! step-time histogram; the last bin also counts longer steps
+   END TYPE FAST_RealTimeType
    
+      !> Data for one turbine instance; the handle returned to external code is the index of this instance in Instances(:)
+   TYPE :: FAST_LibInstanceType
+      TYPE(FAST_TurbineType)             :: Turbine                                 ! Data for this turbine
+      INTEGER(IntKi)                     :: n_t_global  = 0                         ! simulation time step, loop counter for global (FAST) simulation
+      INTEGER(IntKi)                     :: ErrStat     = ErrID_None                ! Error status
+      CHARACTER(IntfStrLen-1)            :: ErrMsg      = ''                        ! Error message  (this needs to be static so that it will print in Matlab's mex library)
+      LOGICAL                            :: Initialized = .FALSE.                   ! whether the turbine data has been initialized (and must be ended)
+      REAL(C_DOUBLE),    POINTER         :: OutBuf(:,:) => NULL()                   ! caller-owned ring of output rows (NumOuts x NumRows), bound with FAST_BindOutputBuffer
+      INTEGER(C_INT),    POINTER         :: OutBufRowsWritten => NULL()             ! caller-owned count of completed rows written to OutBuf
+      REAL(C_DOUBLE),    POINTER         :: OpFM_Pos(:,:)   => NULL()               ! caller-owned OpenFOAM node positions (Nnodes x 3), bound with FAST_OpFM_BindBuffers
+      REAL(C_DOUBLE),    POINTER         :: OpFM_Vel(:,:)   => NULL()               ! caller-owned OpenFOAM node velocities (Nnodes x 3)
+      REAL(R8Ki),        ALLOCATABLE     :: OpFM_PosPrev(:,:)                       ! OpenFOAM node positions at the start of the current FAST step (for sub-cycling)
+      TYPE(FAST_RealTimeType)            :: RT                                      ! deadline monitor and pacing for real-time use
+   END TYPE FAST_LibInstanceType
+
+      !> Pointer wrapper so that the list of instances can grow without copying turbine data
+   TYPE :: FAST_LibInstancePtr
+      TYPE(FAST_LibInstanceType), POINTER :: Ptr => NULL()
+   END TYPE FAST_LibInstancePtr
+
+
       ! Global (static) data:
-   TYPE(FAST_TurbineType)                :: Turbine                                 ! Data for each turbine
-   INTEGER(IntKi)                        :: n_t_global                              ! simulation time step, loop counter for global (FAST) simulation
-   INTEGER(IntKi)                        :: ErrStat                                 ! Error status
-   CHARACTER(IntfStrLen-1)               :: ErrMsg                                  ! Error message  (this needs to be static so that it will print in Matlab's mex library)
+   TYPE(FAST_LibInstancePtr), ALLOCATABLE :: Instances(:)                           ! Data for each turbine instance (indexed by handle)
    
 contains
 !================================================================================================================================== 
-subroutine FAST_Sizes(TMax, InitInpAry, InputFileName_c, AbortErrLev_c, NumOuts_c, dt_c, ErrStat_c, ErrMsg_c, ChannelNames_c) BIND (C, NAME='FAST_Sizes')
+subroutine FAST_Create(Handle_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Create')
+!DEC$ ATTRIBUTES DLLEXPORT::FAST_Create
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_Create
+#endif
+   INTEGER(C_INT),         INTENT(  OUT) :: Handle_c                               ! handle of the new turbine instance (0 on error)
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+   ! local
+   TYPE(FAST_LibInstancePtr), ALLOCATABLE :: TmpInstances(:)
+   INTEGER(IntKi)                        :: i
+   INTEGER(IntKi)                        :: ErrStat2
+   CHARACTER(IntfStrLen-1)               :: ErrMsg                                  ! Error message
+
+   Handle_c  = 0
+   ErrStat_c = ErrID_None
+   ErrMsg    = ""
+
+   IF ( .NOT. ALLOCATED(Instances) ) THEN
+      ALLOCATE( Instances(1), STAT=ErrStat2 )
+      IF (ErrStat2 /= 0) THEN
+         ErrStat_c = ErrID_Fatal
+         ErrMsg    = "FAST_Create:could not allocate the list of turbine instances."
+      END IF
+   END IF
+
+      ! reuse a free slot if there is one; otherwise, grow the list of instances
+   IF ( ErrStat_c == ErrID_None ) THEN
+      DO i=1,SIZE(Instances)
+         IF ( .NOT. ASSOCIATED(Instances(i)%Ptr) ) THEN
+            Handle_c = i
+            EXIT
+         END IF
+      END DO
+
+      IF ( Handle_c == 0 ) THEN
+         ALLOCATE( TmpInstances(2*SIZE(Instances)), STAT=ErrStat2 )
+         IF (ErrStat2 /= 0) THEN
+            ErrStat_c = ErrID_Fatal
+            ErrMsg    = "FAST_Create:could not grow the list of turbine instances."
+         ELSE
+            Handle_c = SIZE(Instances) + 1
+            TmpInstances(1:SIZE(Instances)) = Instances   ! copies the pointers only
+            CALL MOVE_ALLOC( TmpInstances, Instances )
+         END IF
+      END IF
+   END IF
+
+   IF ( ErrStat_c == ErrID_None ) THEN
+      ALLOCATE( Instances(Handle_c)%Ptr, STAT=ErrStat2 )
+      IF (ErrStat2 /= 0) THEN
+         NULLIFY( Instances(Handle_c)%Ptr )
+         Handle_c  = 0
+         ErrStat_c = ErrID_Fatal
+         ErrMsg    = "FAST_Create:could not allocate turbine instance."
+      END IF
+   END IF
+
+   ErrMsg_c = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+
+end subroutine FAST_Create
+!==================================================================================================================================
+subroutine FAST_Destroy(Handle_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Destroy')
+!DEC$ ATTRIBUTES DLLEXPORT::FAST_Destroy
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_Destroy
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+   ! local
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+      ! end the simulation if external code didn't call FAST_End
+   IF ( Inst%Initialized ) CALL EndInstance( Inst )
+
+   DEALLOCATE( Instances(Handle_c)%Ptr )
+   NULLIFY( Instances(Handle_c)%Ptr )
+
+   IF ( .NOT. ANY( IsAssociated(Instances) ) ) DEALLOCATE( Instances )
+
+   ErrStat_c = ErrID_None
+   ErrMsg_c  = C_NULL_CHAR
+
+end subroutine FAST_Destroy
+!==================================================================================================================================
+!> Returns a pointer to the instance referenced by Handle_c. If the handle is invalid, the returned pointer is not associated and
+!! the C error status and message are set.
+function GetInstance(Handle_c, ErrStat_c, ErrMsg_c) result(Inst)
+
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   ! local
+   CHARACTER(IntfStrLen-1)               :: ErrMsg                                  ! Error message
+
+   NULLIFY( Inst )
+   IF ( ALLOCATED(Instances) ) THEN
+      IF ( Handle_c >= 1 .AND. Handle_c <= SIZE(Instances) ) Inst => Instances(Handle_c)%Ptr
+   END IF
+
+   IF ( .NOT. ASSOCIATED(Inst) ) THEN
+      ErrStat_c = ErrID_Fatal
+      ErrMsg    = "Invalid FAST turbine handle ("//TRIM(Num2LStr(Handle_c))//"). Call FAST_Create first."
+      ErrMsg_c  = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+   END IF
+
+end function GetInstance
+!==================================================================================================================================
+!> Returns .TRUE. for each element of Instances that holds a turbine.
+elemental function IsAssociated(Instance)
+   TYPE(FAST_LibInstancePtr), INTENT(IN) :: Instance
+   LOGICAL                               :: IsAssociated
+
+   IsAssociated = ASSOCIATED(Instance%Ptr)
+
+end function IsAssociated
+!==================================================================================================================================
+!> Ends the simulation of one turbine instance. The program is never stopped here (the calling program owns the process), so a
+!! handle can be initialized again after it is ended, and new handles can be created after the last one is destroyed.
+subroutine EndInstance(Inst)
+   TYPE(FAST_LibInstanceType), INTENT(INOUT) :: Inst
+
+   Inst%Initialized = .FALSE.
+   CALL ExitThisProgram_T( Inst%Turbine, ErrID_None, .FALSE. )
+   CALL WrScr( NewLine//' '//TRIM(FAST_Ver%Name)//' completed.'//NewLine )
+
+end subroutine EndInstance
+!==================================================================================================================================
+!> Marks an instance as initialized if its initialization (or restart) succeeded. Otherwise, the data allocated before the error
+!! is freed, so that the handle can be initialized again or destroyed without ending the program.
+subroutine SetInitialized(Inst)
+   TYPE(FAST_LibInstanceType), INTENT(INOUT) :: Inst
+
+   IF ( Inst%ErrStat < AbortErrLev ) THEN
+      Inst%Initialized = .TRUE.
+   ELSE
+      Inst%Initialized = .FALSE.
+      CALL ExitThisProgram_T( Inst%Turbine, Inst%ErrStat, .FALSE., 'during initialization' )
+   END IF
+
+end subroutine SetInitialized
+!==================================================================================================================================
+subroutine FAST_Sizes(Handle_c, TMax, InitInpAry, InputFileName_c, AbortErrLev_c, NumOuts_c, dt_c, ErrStat_c, ErrMsg_c, ChannelNames_c) BIND (C, NAME='FAST_Sizes')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_Sizes
    IMPLICIT NONE 
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_Sizes
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
    REAL(C_DOUBLE),         INTENT(IN   ) :: TMax      
    REAL(C_DOUBLE),         INTENT(IN   ) :: InitInpAry(MAXInitINPUTS)      
    CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: InputFileName_c(IntfStrLen)      
@@ -54,6 +256,10 @@ subroutine FAST_Sizes(TMax, InitInpAry, InputFileName_c, AbortErrLev_c, NumOuts_
    CHARACTER(IntfStrLen)               :: InputFileName   
    INTEGER                             :: i, j, k
    TYPE(FAST_ExternInitType)           :: ExternInitData
+   TYPE(FAST_LibInstanceType), POINTER :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
    
       ! transfer the character array from C to a Fortran string:   
    InputFileName = TRANSFER( InputFileName_c, InputFileName )
@@ -61,7 +267,7 @@ subroutine FAST_Sizes(TMax, InitInpAry, InputFileName_c, AbortErrLev_c, NumOuts_
    IF ( I > 0 ) InputFileName = InputFileName(1:I)     ! remove it
    
       ! initialize variables:   
-   n_t_global = 0
+   Inst%n_t_global = 0
    
    ExternInitData%TMax       = TMax
    ExternInitData%TurbineID  = -1        ! we're not going to use this to simulate a wind farm
@@ -78,26 +284,27 @@ subroutine FAST_Sizes(TMax, InitInpAry, InputFileName_c, AbortErrLev_c, NumOuts_
    
    
    
-   CALL FAST_InitializeAll_T( t_initial, 1_IntKi, Turbine, ErrStat, ErrMsg, InputFileName, ExternInitData )
+   CALL FAST_InitializeAll_T( t_initial, 1_IntKi, Inst%Turbine, Inst%ErrStat, Inst%ErrMsg, InputFileName, ExternInitData )
+   CALL SetInitialized( Inst )
                   
    AbortErrLev_c = AbortErrLev   
-   NumOuts_c     = min(MAXOUTPUTS, 1 + SUM( Turbine%y_FAST%numOuts )) ! includes time
-   dt_c          = Turbine%p_FAST%dt
+   NumOuts_c     = min(MAXOUTPUTS, 1 + SUM( Inst%Turbine%y_FAST%numOuts )) ! includes time
+   dt_c          = Inst%Turbine%p_FAST%dt
 
-   ErrStat_c     = ErrStat
-   ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
-   ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+   ErrStat_c     = Inst%ErrStat
+   Inst%ErrMsg   = TRIM(Inst%ErrMsg)//C_NULL_CHAR
+   ErrMsg_c      = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
    
 #ifdef CONSOLE_FILE   
-   if (ErrStat /= ErrID_None) call wrscr1(trim(ErrMsg))
+   if (Inst%ErrStat /= ErrID_None) call wrscr1(trim(Inst%ErrMsg))
 #endif   
     
       ! return the names of the output channels
-   IF ( ALLOCATED( Turbine%y_FAST%ChannelNames ) )  then
+   IF ( ALLOCATED( Inst%Turbine%y_FAST%ChannelNames ) )  then
       k = 1;
       DO i=1,NumOuts_c
          DO j=1,ChanLen
-            ChannelNames_c(k)=Turbine%y_FAST%ChannelNames(i)(j:j)
+            ChannelNames_c(k)=Inst%Turbine%y_FAST%ChannelNames(i)(j:j)
             k = k+1
          END DO
       END DO
@@ -108,12 +315,13 @@ subroutine FAST_Sizes(TMax, InitInpAry, InputFileName_c, AbortErrLev_c, NumOuts_
       
 end subroutine FAST_Sizes
 !==================================================================================================================================
-subroutine FAST_Start(NumInputs_c, NumOutputs_c, InputAry, OutputAry, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Start')
+subroutine FAST_Start(Handle_c, NumInputs_c, NumOutputs_c, InputAry, OutputAry, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Start')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_Start
    IMPLICIT NONE 
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_Start
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
    INTEGER(C_INT),         INTENT(IN   ) :: NumInputs_c      
    INTEGER(C_INT),         INTENT(IN   ) :: NumOutputs_c      
    REAL(C_DOUBLE),         INTENT(IN   ) :: InputAry(NumInputs_c)
@@ -125,13 +333,16 @@ subroutine FAST_Start(NumInputs_c, NumOutputs_c, InputAry, OutputAry, ErrStat_c,
    ! local
    CHARACTER(IntfStrLen)                 :: InputFileName   
    INTEGER                               :: i
-   REAL(ReKi)                            :: Outputs(NumOutputs_c-1)
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
      
    INTEGER(IntKi)                        :: ErrStat2                                ! Error status
    CHARACTER(IntfStrLen-1)               :: ErrMsg2                                 ! Error message  (this needs to be static so that it will print in Matlab's mex library)
    
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
       ! initialize variables:   
-   n_t_global = 0
+   Inst%n_t_global = 0
 
 #ifdef SIMULINK_DirectFeedThrough   
    IF(  NumInputs_c /= NumFixedInputs .AND. NumInputs_c /= NumFixedInputs+3 ) THEN
@@ -140,29 +351,27 @@ subroutine FAST_Start(NumInputs_c, NumOutputs_c, InputAry, OutputAry, ErrStat_c,
       RETURN
    END IF
 
-   CALL FAST_SetExternalInputs(NumInputs_c, InputAry, Turbine%m_FAST)
+   CALL FAST_SetExternalInputs(NumInputs_c, InputAry, Inst%Turbine%m_FAST)
 
 #endif      
    !...............................................................................................................................
    ! Initialization of solver: (calculate outputs based on states at t=t_initial as well as guesses of inputs and constraint states)
    !...............................................................................................................................  
-   CALL FAST_Solution0_T(Turbine, ErrStat, ErrMsg )      
+   CALL FAST_Solution0_T(Inst%Turbine, Inst%ErrStat, Inst%ErrMsg )
    
-   if (ErrStat <= AbortErrLev) then
+   if (Inst%ErrStat <= AbortErrLev) then
          ! return outputs here, too
-      IF(NumOutputs_c /= SIZE(Turbine%y_FAST%ChannelNames) ) THEN
-         ErrStat = ErrID_Fatal
-         ErrMsg  = trim(ErrMsg)//NewLine//"FAST_Start:size of NumOutputs is invalid."
+      IF( .NOT. ValidNumOutputs(Inst, NumOutputs_c) ) THEN
+         Inst%ErrStat = ErrID_Fatal
+         Inst%ErrMsg  = trim(Inst%ErrMsg)//NewLine//"FAST_Start:size of NumOutputs is invalid."
       ELSE
       
-         CALL FillOutputAry_T(Turbine, Outputs)   
-         OutputAry(1)              = Turbine%m_FAST%t_global 
-         OutputAry(2:NumOutputs_c) = Outputs 
+         CALL SetOutputs(Inst, NumOutputs_c, OutputAry, NewRow=.TRUE.)
 
-         CALL FAST_Linearize_T(t_initial, 0, Turbine, ErrStat, ErrMsg)
+         CALL FAST_Linearize_T(t_initial, 0, Inst%Turbine, Inst%ErrStat, Inst%ErrMsg)
          if (ErrStat2 /= ErrID_None) then
-            ErrStat = max(ErrStat,ErrStat2)
-            ErrMsg = TRIM(ErrMsg)//NewLine//TRIM(ErrMsg2)
+            Inst%ErrStat = max(Inst%ErrStat,ErrStat2)
+            Inst%ErrMsg = TRIM(Inst%ErrMsg)//NewLine//TRIM(ErrMsg2)
          end if
          
                   
@@ -170,22 +379,23 @@ subroutine FAST_Start(NumInputs_c, NumOutputs_c, InputAry, OutputAry, ErrStat_c,
    end if
    
    
-   ErrStat_c     = ErrStat
-   ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
-   ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+   ErrStat_c     = Inst%ErrStat
+   Inst%ErrMsg   = TRIM(Inst%ErrMsg)//C_NULL_CHAR
+   ErrMsg_c      = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
    
 #ifdef CONSOLE_FILE   
-   if (ErrStat /= ErrID_None) call wrscr1(trim(ErrMsg))
+   if (Inst%ErrStat /= ErrID_None) call wrscr1(trim(Inst%ErrMsg))
 #endif   
       
 end subroutine FAST_Start
 !==================================================================================================================================
-subroutine FAST_Update(NumInputs_c, NumOutputs_c, InputAry, OutputAry, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Update')
+subroutine FAST_Update(Handle_c, NumInputs_c, NumOutputs_c, InputAry, OutputAry, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Update')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_Update
    IMPLICIT NONE
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_Update
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
    INTEGER(C_INT),         INTENT(IN   ) :: NumInputs_c      
    INTEGER(C_INT),         INTENT(IN   ) :: NumOutputs_c      
    REAL(C_DOUBLE),         INTENT(IN   ) :: InputAry(NumInputs_c)
@@ -194,69 +404,424 @@ subroutine FAST_Update(NumInputs_c, NumOutputs_c, InputAry, OutputAry, ErrStat_c
    CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)      
    
       ! local variables
-   REAL(ReKi)                            :: Outputs(NumOutputs_c-1)
    INTEGER(IntKi)                        :: i
    INTEGER(IntKi)                        :: ErrStat2                                ! Error status
    CHARACTER(IntfStrLen-1)               :: ErrMsg2                                 ! Error message  (this needs to be static so that it will print in Matlab's mex library)
+   LOGICAL                               :: Stepped                                 ! whether this call advanced the simulation
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
                  
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+   
+   Stepped = .FALSE.
    
-   IF ( n_t_global > Turbine%p_FAST%n_TMax_m1 ) THEN !finish 
+   IF ( Inst%n_t_global > Inst%Turbine%p_FAST%n_TMax_m1 ) THEN !finish
       
       ! we can't continue because we might over-step some arrays that are allocated to the size of the simulation
 
-      IF (n_t_global == Turbine%p_FAST%n_TMax_m1 + 1) THEN  ! we call update an extra time in Simulink, which we can ignore until the time shift with outputs is solved
-         n_t_global = n_t_global + 1
+      IF (Inst%n_t_global == Inst%Turbine%p_FAST%n_TMax_m1 + 1) THEN  ! we call update an extra time in Simulink, which we can ignore until the time shift with outputs is solved
+         Inst%n_t_global = Inst%n_t_global + 1
          ErrStat_c = ErrID_None
-         ErrMsg = C_NULL_CHAR
-         ErrMsg_c = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+         Inst%ErrMsg = C_NULL_CHAR
+         ErrMsg_c = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
       ELSE     
          ErrStat_c = ErrID_Info
-         ErrMsg = "Simulation completed."//C_NULL_CHAR
-         ErrMsg_c = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+         Inst%ErrMsg = "Simulation completed."//C_NULL_CHAR
+         ErrMsg_c = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
       END IF
       
-   ELSEIF(NumOutputs_c /= SIZE(Turbine%y_FAST%ChannelNames) ) THEN
-      ErrStat_c = ErrID_Fatal
-      ErrMsg    = "FAST_Update:size of OutputAry is invalid or FAST has too many outputs."//C_NULL_CHAR
-      ErrMsg_c  = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+   ELSEIF( .NOT. ValidNumOutputs(Inst, NumOutputs_c) ) THEN
+      ErrStat_c   = ErrID_Fatal
+      Inst%ErrMsg = "FAST_Update:size of OutputAry is invalid or FAST has too many outputs."//C_NULL_CHAR
+      ErrMsg_c    = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
       RETURN
    ELSEIF(  NumInputs_c /= NumFixedInputs .AND. NumInputs_c /= NumFixedInputs+3 ) THEN
-      ErrStat_c = ErrID_Fatal
-      ErrMsg    = "FAST_Update:size of InputAry is invalid."//C_NULL_CHAR
-      ErrMsg_c  = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+      ErrStat_c   = ErrID_Fatal
+      Inst%ErrMsg = "FAST_Update:size of InputAry is invalid."//C_NULL_CHAR
+      ErrMsg_c    = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
       RETURN
    ELSE
 
-      CALL FAST_SetExternalInputs(NumInputs_c, InputAry, Turbine%m_FAST)
+      IF ( Inst%RT%Enabled ) CALL RT_StartStep(Inst%RT)
+      CALL FAST_SetExternalInputs(NumInputs_c, InputAry, Inst%Turbine%m_FAST)
 
-      CALL FAST_Solution_T( t_initial, n_t_global, Turbine, ErrStat, ErrMsg )                  
-      n_t_global = n_t_global + 1
+      CALL FAST_Solution_T( t_initial, Inst%n_t_global, Inst%Turbine, Inst%ErrStat, Inst%ErrMsg )
+      Inst%n_t_global = Inst%n_t_global + 1
+      Stepped = .TRUE.
 
-      CALL FAST_Linearize_T( t_initial, n_t_global, Turbine, ErrStat2, ErrMsg2)
+      CALL FAST_Linearize_T( t_initial, Inst%n_t_global, Inst%Turbine, ErrStat2, ErrMsg2)
       if (ErrStat2 /= ErrID_None) then
-         ErrStat = max(ErrStat,ErrStat2)
-         ErrMsg = TRIM(ErrMsg)//NewLine//TRIM(ErrMsg2)
+         Inst%ErrStat = max(Inst%ErrStat,ErrStat2)
+         Inst%ErrMsg = TRIM(Inst%ErrMsg)//NewLine//TRIM(ErrMsg2)
       end if
       
       
       ! set the outputs for external code here...
       ! return y_FAST%ChannelNames
       
-      ErrStat_c     = ErrStat
-      ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
-      ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+      ErrStat_c     = Inst%ErrStat
+      Inst%ErrMsg   = TRIM(Inst%ErrMsg)//C_NULL_CHAR
+      ErrMsg_c      = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
    END IF
    
-   CALL FillOutputAry_T(Turbine, Outputs)   
-   OutputAry(1)              = Turbine%m_FAST%t_global 
-   OutputAry(2:NumOutputs_c) = Outputs 
+   CALL SetOutputs(Inst, NumOutputs_c, OutputAry, NewRow=Stepped)
+   IF ( Stepped .AND. Inst%RT%Enabled ) CALL RT_EndStep(Inst%RT, Inst%n_t_global, Inst%Turbine%m_FAST%t_global)
 
 #ifdef CONSOLE_FILE   
-   if (ErrStat /= ErrID_None) call wrscr1(trim(ErrMsg))
+   if (Inst%ErrStat /= ErrID_None) call wrscr1(trim(Inst%ErrMsg))
 #endif   
       
 end subroutine FAST_Update 
 !==================================================================================================================================
+!> Advances the turbine NumSteps_c global time steps in one call, for drivers whose coupling step is a multiple of FAST's dt.
+!! InputAry holds NumInputSamples_c samples of the FAST_Update inputs, spread evenly over the call: one sample holds the inputs
+!! constant; more samples are linearly interpolated to the start of each step. Column i of OutputAry holds the FAST_Update
+!! outputs after step i (i.e., the rows are contiguous in C). Stepping stops early on an abort-level error or at the end of the
+!! simulation; NumStepsTaken_c returns the number of valid output rows.
+subroutine FAST_UpdateN(Handle_c, NumSteps_c, NumInputs_c, NumInputSamples_c, NumOutputs_c, InputAry, OutputAry, NumStepsTaken_c, &
+                        ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_UpdateN')
+!DEC$ ATTRIBUTES DLLEXPORT::FAST_UpdateN
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_UpdateN
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+   INTEGER(C_INT),         INTENT(IN   ) :: NumSteps_c
+   INTEGER(C_INT),         INTENT(IN   ) :: NumInputs_c
+   INTEGER(C_INT),         INTENT(IN   ) :: NumInputSamples_c
+   INTEGER(C_INT),         INTENT(IN   ) :: NumOutputs_c
+   REAL(C_DOUBLE),         INTENT(IN   ) :: InputAry(NumInputs_c,NumInputSamples_c)
+   REAL(C_DOUBLE),         INTENT(  OUT) :: OutputAry(NumOutputs_c,NumSteps_c)
+   INTEGER(C_INT),         INTENT(  OUT) :: NumStepsTaken_c
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+      ! local variables
+   REAL(C_DOUBLE)                        :: Inputs(NumInputs_c)                     ! inputs for the current step
+   REAL(DbKi)                            :: s                                       ! position of the current step in the input samples (0 to NumInputSamples_c-1)
+   REAL(DbKi)                            :: w                                       ! interpolation weight of the next input sample
+   INTEGER(IntKi)                        :: i                                       ! step counter
+   INTEGER(IntKi)                        :: j                                       ! input sample preceding the current step
+   INTEGER(IntKi)                        :: ErrStat2                                ! Error status
+   CHARACTER(IntfStrLen-1)               :: ErrMsg2                                 ! Error message
+   CHARACTER(*),           PARAMETER     :: RoutineName = 'FAST_UpdateN'
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   NumStepsTaken_c = 0
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+   Inst%ErrStat = ErrID_None
+   Inst%ErrMsg  = ''
+
+   IF ( NumSteps_c < 1 .OR. NumInputSamples_c < 1 ) THEN
+      CALL SetErrStat( ErrID_Fatal, "NumSteps and NumInputSamples must be at least 1.", Inst%ErrStat, Inst%ErrMsg, RoutineName )
+   ELSEIF ( .NOT. ValidNumOutputs(Inst, NumOutputs_c) ) THEN
+      CALL SetErrStat( ErrID_Fatal, "size of OutputAry is invalid or FAST has too many outputs.", Inst%ErrStat, Inst%ErrMsg, RoutineName )
+   ELSEIF ( NumInputs_c /= NumFixedInputs .AND. NumInputs_c /= NumFixedInputs+3 ) THEN
+      CALL SetErrStat( ErrID_Fatal, "size of InputAry is invalid.", Inst%ErrStat, Inst%ErrMsg, RoutineName )
+   ELSE
+
+      DO i = 1,NumSteps_c
+
+         IF ( Inst%n_t_global > Inst%Turbine%p_FAST%n_TMax_m1 ) THEN ! we can't continue because we might over-step some arrays that are allocated to the size of the simulation
+            CALL SetErrStat( ErrID_Info, "Simulation completed.", Inst%ErrStat, Inst%ErrMsg, RoutineName )
+            EXIT
+         END IF
+
+         IF ( Inst%RT%Enabled ) CALL RT_StartStep(Inst%RT)
+
+            ! inputs at the start of this step
+         IF ( NumInputSamples_c == 1 ) THEN
+            Inputs = InputAry(:,1)
+         ELSE
+            s = REAL(i-1,DbKi) / REAL(NumSteps_c,DbKi) * REAL(NumInputSamples_c-1,DbKi)
+            j = MIN( INT(s) + 1, NumInputSamples_c-1 )
+            w = s - REAL(j-1,DbKi)
+            Inputs = (1.0_DbKi - w)*InputAry(:,j) + w*InputAry(:,j+1)
+         END IF
+
+         CALL FAST_SetExternalInputs(NumInputs_c, Inputs, Inst%Turbine%m_FAST)
+
+         CALL FAST_Solution_T( t_initial, Inst%n_t_global, Inst%Turbine, ErrStat2, ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, Inst%ErrStat, Inst%ErrMsg, RoutineName )
+         Inst%n_t_global = Inst%n_t_global + 1
+
+         CALL FAST_Linearize_T( t_initial, Inst%n_t_global, Inst%Turbine, ErrStat2, ErrMsg2)
+            CALL SetErrStat( ErrStat2, ErrMsg2, Inst%ErrStat, Inst%ErrMsg, RoutineName )
+
+         CALL SetOutputs(Inst, NumOutputs_c, OutputAry(:,i), NewRow=.TRUE.)
+         NumStepsTaken_c = i
+         IF ( Inst%RT%Enabled ) CALL RT_EndStep(Inst%RT, Inst%n_t_global, Inst%Turbine%m_FAST%t_global)
+
+         IF ( Inst%ErrStat >= AbortErrLev ) EXIT
+
+      END DO
+
+   END IF
+
+   ErrStat_c     = Inst%ErrStat
+   Inst%ErrMsg   = TRIM(Inst%ErrMsg)//C_NULL_CHAR
+   ErrMsg_c      = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
+
+#ifdef CONSOLE_FILE
+   if (Inst%ErrStat /= ErrID_None) call wrscr1(trim(Inst%ErrMsg))
+#endif
+
+end subroutine FAST_UpdateN
+!==================================================================================================================================
+!> Registers a caller-owned ring of NumRows_c output rows (each NumOuts_c doubles: time followed by the channels returned by
+!! FAST_Sizes). Each time step FAST_Start, FAST_Update, and FAST_UpdateN fill the next row (wrapping around) and then increment
+!! the caller-owned counter NumRowsWritten_c, so another consumer can read completed rows without copying or calling the library.
+!! Once a buffer is bound, NumOutputs_c may be 0 in those calls to skip filling OutputAry. A null buffer or NumRows_c < 1 unbinds.
+subroutine FAST_BindOutputBuffer(Handle_c, OutputBuffer_c, NumRows_c, NumOuts_c, NumRowsWritten_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_BindOutputBuffer')
+!DEC$ ATTRIBUTES DLLEXPORT::FAST_BindOutputBuffer
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_BindOutputBuffer
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+   TYPE(C_PTR),     VALUE, INTENT(IN   ) :: OutputBuffer_c                          ! double[NumRows_c][NumOuts_c], owned by the caller
+   INTEGER(C_INT),         INTENT(IN   ) :: NumRows_c
+   INTEGER(C_INT),         INTENT(IN   ) :: NumOuts_c
+   TYPE(C_PTR),     VALUE, INTENT(IN   ) :: NumRowsWritten_c                        ! int, owned by the caller
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+   ! local
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+   NULLIFY( Inst%OutBuf, Inst%OutBufRowsWritten )
+   ErrStat_c   = ErrID_None
+   Inst%ErrMsg = ""
+
+   IF ( C_ASSOCIATED(OutputBuffer_c) .AND. NumRows_c > 0 ) THEN
+      IF ( .NOT. ALLOCATED(Inst%Turbine%y_FAST%ChannelNames) ) THEN
+         ErrStat_c   = ErrID_Fatal
+         Inst%ErrMsg = "FAST_BindOutputBuffer:the output channels are not known; call FAST_Sizes first."
+      ELSEIF ( NumOuts_c /= SIZE(Inst%Turbine%y_FAST%ChannelNames) ) THEN
+         ErrStat_c   = ErrID_Fatal
+         Inst%ErrMsg = "FAST_BindOutputBuffer:NumOuts must be "//TRIM(Num2LStr(SIZE(Inst%Turbine%y_FAST%ChannelNames)))//"."
+      ELSEIF ( .NOT. C_ASSOCIATED(NumRowsWritten_c) ) THEN
+         ErrStat_c   = ErrID_Fatal
+         Inst%ErrMsg = "FAST_BindOutputBuffer:NumRowsWritten must not be NULL."
+      ELSE
+         CALL C_F_POINTER( OutputBuffer_c, Inst%OutBuf, [NumOuts_c, NumRows_c] )
+         CALL C_F_POINTER( NumRowsWritten_c, Inst%OutBufRowsWritten )
+         Inst%OutBufRowsWritten = 0
+      END IF
+   END IF
+
+   ErrMsg_c = TRANSFER( TRIM(Inst%ErrMsg)//C_NULL_CHAR, ErrMsg_c )
+
+end subroutine FAST_BindOutputBuffer
+!==================================================================================================================================
+!> Returns .TRUE. if NumOutputs_c is a valid size for the OutputAry argument: the number of channels, or 0 when the outputs go
+!! only to a buffer bound with FAST_BindOutputBuffer.
+logical function ValidNumOutputs(Inst, NumOutputs_c)
+   TYPE(FAST_LibInstanceType), INTENT(IN) :: Inst
+   INTEGER(C_INT),             INTENT(IN) :: NumOutputs_c
+
+   ValidNumOutputs = NumOutputs_c == SIZE(Inst%Turbine%y_FAST%ChannelNames) .OR. ( NumOutputs_c == 0 .AND. ASSOCIATED(Inst%OutBuf) )
+
+end function ValidNumOutputs
+!==================================================================================================================================
+!> Returns the output row (time followed by the output channels) at the current time in OutputAry and, if NewRow is true, writes
+!! it to the next row of the buffer bound with FAST_BindOutputBuffer. In double-precision builds the channels are written directly
+!! into the bound row.
+subroutine SetOutputs(Inst, NumOutputs_c, OutputAry, NewRow)
+   TYPE(FAST_LibInstanceType), INTENT(INOUT) :: Inst
+   INTEGER(C_INT),             INTENT(IN   ) :: NumOutputs_c
+   REAL(C_DOUBLE),             INTENT(  OUT) :: OutputAry(NumOutputs_c)
+   LOGICAL,                    INTENT(IN   ) :: NewRow                              ! whether this is a new time step that belongs in the bound buffer
+
+   ! local
+   REAL(ReKi)                                :: Outputs(SIZE(Inst%Turbine%y_FAST%ChannelNames)-1)
+   INTEGER(IntKi)                            :: Row
+
+   IF ( NewRow .AND. ASSOCIATED(Inst%OutBuf) ) THEN
+      Row = MOD( Inst%OutBufRowsWritten, SIZE(Inst%OutBuf,2) ) + 1
+      Inst%OutBuf(1,Row) = Inst%Turbine%m_FAST%t_global
+#ifdef DOUBLE_PRECISION
+      CALL FillOutputAry_T(Inst%Turbine, Inst%OutBuf(2:,Row))
+#else
+      CALL FillOutputAry_T(Inst%Turbine, Outputs)
+      Inst%OutBuf(2:,Row) = Outputs
+#endif
+      IF ( NumOutputs_c > 0 ) OutputAry = Inst%OutBuf(:,Row)
+      Inst%OutBufRowsWritten = Inst%OutBufRowsWritten + 1     ! publish the row only after it is complete
+   ELSEIF ( NumOutputs_c > 0 ) THEN
+      CALL FillOutputAry_T(Inst%Turbine, Outputs)
+      OutputAry(1)              = Inst%Turbine%m_FAST%t_global
+      OutputAry(2:NumOutputs_c) = Outputs
+   END IF
+
+end subroutine SetOutputs
+!==================================================================================================================================
+!> Turns on the real-time profile of a turbine instance (for hardware-in-the-loop use): the wall-clock time of each step taken in
+!! FAST_Update, FAST_UpdateN, and FAST_OpFM_Step is compared with Deadline_c (seconds) and collected for FAST_GetRealTimeStats.
+!! If Pace_c is nonzero, each step also waits (busy-waits, to avoid the coarse resolution of OS sleeps) until wall-clock time
+!! has caught up with simulation time. A Deadline_c <= 0 turns the profile off. Calling this again resets the statistics.
+!! Output that writes to files in every step isn't deterministic, so turning the profile on closes the text output file (it keeps
+!! the rows written so far) and stops the VTK animation files for the rest of the simulation, with a warning. Binary output files
+!! are buffered in memory and written when the simulation ends, and FAST_BindOutputBuffer rows are written to caller-owned memory,
+!! so both are kept. Turning the profile off again does not restart the text or VTK output.
+!! This routine only measures and paces the steps; it does not bound their time. Compile with -DDEBUG_SCRATCH_ALLOC to check that
+!! the integrators don't allocate memory after the first step.
+subroutine FAST_SetRealTime(Handle_c, Deadline_c, Pace_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_SetRealTime')
+!DEC$ ATTRIBUTES DLLEXPORT::FAST_SetRealTime
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_SetRealTime
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+   REAL(C_DOUBLE),         INTENT(IN   ) :: Deadline_c                              ! wall-clock time allowed for one step (s)
+   INTEGER(C_INT),         INTENT(IN   ) :: Pace_c                                  ! 1 = lock simulation time to wall-clock time; 0 = run as fast as possible
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+   ! local
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+   Inst%RT = FAST_RealTimeType()  ! reset the statistics
+   ErrStat_c   = ErrID_None
+   Inst%ErrMsg = ""
+
+   IF ( Deadline_c > 0.0_C_DOUBLE ) THEN
+      IF ( .NOT. Inst%Initialized ) THEN
+         ErrStat_c   = ErrID_Fatal
+         Inst%ErrMsg = "FAST_SetRealTime:the turbine is not initialized."
+      ELSE
+         CALL SYSTEM_CLOCK( COUNT_RATE=Inst%RT%ClockRate )
+         Inst%RT%Enabled  = .TRUE.
+         Inst%RT%Pace     = Pace_c /= 0
+         Inst%RT%Deadline = Deadline_c
+         Inst%RT%BinWidth = 2.0_DbKi*Deadline_c / NumRTBins   ! the bins cover twice the deadline
+         Inst%RT%PaceTime = Inst%Turbine%m_FAST%t_global
+         CALL SYSTEM_CLOCK( Inst%RT%PaceStart )
+
+            ! stop the output that writes to files in every step:
+         IF ( Inst%Turbine%p_FAST%WrTxtOutFile ) THEN
+            IF ( Inst%Turbine%y_FAST%UnOu > 0 ) CLOSE( Inst%Turbine%y_FAST%UnOu )
+            Inst%Turbine%y_FAST%UnOu = -1
+            Inst%Turbine%p_FAST%WrTxtOutFile = .FALSE.
+            ErrStat_c   = ErrID_Warn
+            Inst%ErrMsg = "FAST_SetRealTime:the text output file was closed at t = "//TRIM(Num2LStr(Inst%Turbine%m_FAST%t_global))// &
+                          " s; use binary output or FAST_BindOutputBuffer for the rest of the simulation."
+         END IF
+         IF ( Inst%Turbine%p_FAST%WrVTK == VTK_Animate ) THEN
+            Inst%Turbine%p_FAST%WrVTK = VTK_None
+            IF ( ErrStat_c /= ErrID_None ) Inst%ErrMsg = TRIM(Inst%ErrMsg)//NewLine
+            ErrStat_c   = ErrID_Warn
+            Inst%ErrMsg = TRIM(Inst%ErrMsg)//"FAST_SetRealTime:VTK animation files are not written for the rest of the simulation."
+         END IF
+      END IF
+   END IF
+
+   ErrMsg_c = TRANSFER( TRIM(Inst%ErrMsg)//C_NULL_CHAR, ErrMsg_c )
+
+end subroutine FAST_SetRealTime
+!==================================================================================================================================
+!> Returns the statistics collected since FAST_SetRealTime: the number of steps timed, the number of deadline overruns and the
+!! time step of the latest one (-1 if none), the worst-case and mean step times (s), and the step-time histogram (NumBins_c must
+!! be at least the number of bins, 20; bin i counts the steps that took between (i-1) and i times BinWidth_c seconds, and the
+!! last bin also counts longer steps).
+subroutine FAST_GetRealTimeStats(Handle_c, NumSteps_c, NumOverruns_c, LastOverrun_c, WorstStepTime_c, MeanStepTime_c, &
+                                 NumBins_c, BinWidth_c, Histogram_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_GetRealTimeStats')
+!DEC$ ATTRIBUTES DLLEXPORT::FAST_GetRealTimeStats
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_GetRealTimeStats
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+   INTEGER(C_INT),         INTENT(  OUT) :: NumSteps_c
+   INTEGER(C_INT),         INTENT(  OUT) :: NumOverruns_c
+   INTEGER(C_INT),         INTENT(  OUT) :: LastOverrun_c
+   REAL(C_DOUBLE),         INTENT(  OUT) :: WorstStepTime_c
+   REAL(C_DOUBLE),         INTENT(  OUT) :: MeanStepTime_c
+   INTEGER(C_INT),         INTENT(INOUT) :: NumBins_c                               ! size of Histogram_c on input; number of bins on output
+   REAL(C_DOUBLE),         INTENT(  OUT) :: BinWidth_c
+   INTEGER(C_INT),         INTENT(  OUT) :: Histogram_c(*)
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+   ! local
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+   ErrStat_c   = ErrID_None
+   Inst%ErrMsg = ""
+
+   IF ( NumBins_c < NumRTBins ) THEN
+      ErrStat_c   = ErrID_Fatal
+      Inst%ErrMsg = "FAST_GetRealTimeStats:NumBins must be at least "//TRIM(Num2LStr(NumRTBins))//"."
+   ELSE
+      NumSteps_c      = Inst%RT%NumSteps
+      NumOverruns_c   = Inst%RT%NumOverruns
+      LastOverrun_c   = Inst%RT%LastOverrun
+      WorstStepTime_c = Inst%RT%WorstStepTime
+      MeanStepTime_c  = Inst%RT%SumStepTime / MAX( 1, Inst%RT%NumSteps )
+      NumBins_c       = NumRTBins
+      BinWidth_c      = Inst%RT%BinWidth
+      Histogram_c(1:NumRTBins) = Inst%RT%Histogram
+   END IF
+
+   ErrMsg_c = TRANSFER( TRIM(Inst%ErrMsg)//C_NULL_CHAR, ErrMsg_c )
+
+end subroutine FAST_GetRealTimeStats
+!==================================================================================================================================
+!> Marks the start of a time step for the real-time profile.
+subroutine RT_StartStep(RT)
+   TYPE(FAST_RealTimeType), INTENT(INOUT) :: RT
+
+   CALL SYSTEM_CLOCK( RT%StepStart )
+
+end subroutine RT_StartStep
+!==================================================================================================================================
+!> Records the wall-clock time of the step started with RT_StartStep and, when pacing, waits until wall-clock time reaches the
+!! simulation time t_global.
+subroutine RT_EndStep(RT, n_t_global, t_global)
+   TYPE(FAST_RealTimeType), INTENT(INOUT) :: RT
+   INTEGER(IntKi),          INTENT(IN   ) :: n_t_global                             ! time step that was just completed
+   REAL(DbKi),              INTENT(IN   ) :: t_global                               ! simulation time at the end of the step
+
+   ! local
+   INTEGER(B8Ki)                          :: Count                                  ! current SYSTEM_CLOCK count
+   INTEGER(B8Ki)                          :: PaceCount                              ! SYSTEM_CLOCK count at which t_global is reached in wall-clock time
+   REAL(DbKi)                             :: StepTime                               ! wall-clock time of this step (s)
+   INTEGER(IntKi)                         :: Bin                                    ! histogram bin of this step
+
+   CALL SYSTEM_CLOCK( Count )
+   StepTime = REAL( Count - RT%StepStart, DbKi ) / REAL( RT%ClockRate, DbKi )
+
+   RT%NumSteps    = RT%NumSteps + 1
+   RT%SumStepTime = RT%SumStepTime + StepTime
+   RT%WorstStepTime = MAX( RT%WorstStepTime, StepTime )
+   IF ( StepTime > RT%Deadline ) THEN
+      RT%NumOverruns = RT%NumOverruns + 1
+      RT%LastOverrun = n_t_global
+   END IF
+   Bin = INT( MIN( StepTime / RT%BinWidth, REAL(NumRTBins-1,DbKi) ) ) + 1
+   RT%Histogram(Bin) = RT%Histogram(Bin) + 1
+
+   IF ( RT%Pace ) THEN
+      PaceCount = RT%PaceStart + NINT( (t_global - RT%PaceTime) * RT%ClockRate, B8Ki )
+      DO WHILE ( Count < PaceCount )
+         CALL SYSTEM_CLOCK( Count )
+      END DO
+   END IF
+
+end subroutine RT_EndStep
+!==================================================================================================================================
 subroutine FAST_SetExternalInputs(NumInputs_c, InputAry, m_FAST)
 
    USE, INTRINSIC :: ISO_C_Binding
@@ -287,23 +852,33 @@ subroutine FAST_SetExternalInputs(NumInputs_c, InputAry, m_FAST)
       
 end subroutine FAST_SetExternalInputs
 !==================================================================================================================================
-subroutine FAST_End() BIND (C, NAME='FAST_End')
+subroutine FAST_End(Handle_c) BIND (C, NAME='FAST_End')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_End
    IMPLICIT NONE
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_End
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+
+   ! local
+   INTEGER(C_INT)                        :: ErrStat_c
+   CHARACTER(KIND=C_CHAR)                :: ErrMsg_c(IntfStrLen)
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
 
-   CALL ExitThisProgram_T( Turbine, ErrID_None, .TRUE. )
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+   IF ( Inst%Initialized ) CALL EndInstance( Inst )
    
 end subroutine FAST_End
 !==================================================================================================================================
-subroutine FAST_CreateCheckpoint(CheckpointRootName_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_CreateCheckpoint')
+subroutine FAST_CreateCheckpoint(Handle_c, CheckpointRootName_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_CreateCheckpoint')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_CreateCheckpoint
    IMPLICIT NONE
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_CreateCheckpoint
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
    CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: CheckpointRootName_c(IntfStrLen)      
    INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
    CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)      
@@ -312,7 +887,10 @@ subroutine FAST_CreateCheckpoint(CheckpointRootName_c, ErrStat_c, ErrMsg_c) BIND
    CHARACTER(IntfStrLen)                 :: CheckpointRootName   
    INTEGER(IntKi)                        :: I
    INTEGER(IntKi)                        :: Unit
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
              
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
    
       ! transfer the character array from C to a Fortran string:   
    CheckpointRootName = TRANSFER( CheckpointRootName_c, CheckpointRootName )
@@ -320,31 +898,32 @@ subroutine FAST_CreateCheckpoint(CheckpointRootName_c, ErrStat_c, ErrMsg_c) BIND
    IF ( I > 0 ) CheckpointRootName = CheckpointRootName(1:I)     ! remove it
    
    if ( LEN_TRIM(CheckpointRootName) == 0 ) then
-      CheckpointRootName = TRIM(Turbine%p_FAST%OutFileRoot)//'.'//trim( Num2LStr(n_t_global) )
+      CheckpointRootName = TRIM(Inst%Turbine%p_FAST%OutFileRoot)//'.'//trim( Num2LStr(Inst%n_t_global) )
    end if
    
       
    Unit = -1
-   CALL FAST_CreateCheckpoint_T(t_initial, n_t_global, 1, Turbine, CheckpointRootName, ErrStat, ErrMsg, Unit )
+   CALL FAST_CreateCheckpoint_T(t_initial, Inst%n_t_global, 1, Inst%Turbine, CheckpointRootName, Inst%ErrStat, Inst%ErrMsg, Unit )
 
       ! transfer Fortran variables to C:      
-   ErrStat_c     = ErrStat
-   ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
-   ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+   ErrStat_c     = Inst%ErrStat
+   Inst%ErrMsg   = TRIM(Inst%ErrMsg)//C_NULL_CHAR
+   ErrMsg_c      = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
 
 
 #ifdef CONSOLE_FILE   
-   if (ErrStat /= ErrID_None) call wrscr1(trim(ErrMsg))
+   if (Inst%ErrStat /= ErrID_None) call wrscr1(trim(Inst%ErrMsg))
 #endif   
       
 end subroutine FAST_CreateCheckpoint 
 !==================================================================================================================================
-subroutine FAST_Restart(CheckpointRootName_c, AbortErrLev_c, NumOuts_c, dt_c, n_t_global_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Restart')
+subroutine FAST_Restart(Handle_c, CheckpointRootName_c, AbortErrLev_c, NumOuts_c, dt_c, n_t_global_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_Restart')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_Restart
    IMPLICIT NONE
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_Restart
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
    CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: CheckpointRootName_c(IntfStrLen)      
    INTEGER(C_INT),         INTENT(  OUT) :: AbortErrLev_c      
    INTEGER(C_INT),         INTENT(  OUT) :: NumOuts_c      
@@ -359,8 +938,11 @@ subroutine FAST_Restart(CheckpointRootName_c, AbortErrLev_c, NumOuts_c, dt_c, n_
    INTEGER(IntKi)                        :: Unit
    REAL(DbKi)                            :: t_initial_out
    INTEGER(IntKi)                        :: NumTurbines_out
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
    CHARACTER(*),           PARAMETER     :: RoutineName = 'FAST_Restart' 
              
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
    
    call NWTC_Init() ! make sure we re-initialize global constants in NWTC Library
    
@@ -371,36 +953,38 @@ subroutine FAST_Restart(CheckpointRootName_c, AbortErrLev_c, NumOuts_c, dt_c, n_
    IF ( I > 0 ) CheckpointRootName = CheckpointRootName(1:I)     ! remove it
    
    Unit = -1
-   CALL FAST_RestoreFromCheckpoint_T(t_initial_out, n_t_global, NumTurbines_out, Turbine, CheckpointRootName, ErrStat, ErrMsg, Unit )
+   CALL FAST_RestoreFromCheckpoint_T(t_initial_out, Inst%n_t_global, NumTurbines_out, Inst%Turbine, CheckpointRootName, Inst%ErrStat, Inst%ErrMsg, Unit )
    
       ! check that these are valid:
-      IF (t_initial_out /= t_initial) CALL SetErrStat(ErrID_Fatal, "invalid value of t_initial.", ErrStat, ErrMsg, RoutineName )
-      IF (NumTurbines_out /= 1) CALL SetErrStat(ErrID_Fatal, "invalid value of NumTurbines.", ErrStat, ErrMsg, RoutineName )
+      IF (t_initial_out /= t_initial) CALL SetErrStat(ErrID_Fatal, "invalid value of t_initial.", Inst%ErrStat, Inst%ErrMsg, RoutineName )
+      IF (NumTurbines_out /= 1) CALL SetErrStat(ErrID_Fatal, "invalid value of NumTurbines.", Inst%ErrStat, Inst%ErrMsg, RoutineName )
+   CALL SetInitialized( Inst )
    
    
       ! transfer Fortran variables to C: 
-   n_t_global_c  = n_t_global
+   n_t_global_c  = Inst%n_t_global
    AbortErrLev_c = AbortErrLev   
-   NumOuts_c     = min(MAXOUTPUTS, 1 + SUM( Turbine%y_FAST%numOuts )) ! includes time
-   dt_c          = Turbine%p_FAST%dt      
+   NumOuts_c     = min(MAXOUTPUTS, 1 + SUM( Inst%Turbine%y_FAST%numOuts )) ! includes time
+   dt_c          = Inst%Turbine%p_FAST%dt
       
-   ErrStat_c     = ErrStat
-   ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
-   ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+   ErrStat_c     = Inst%ErrStat
+   Inst%ErrMsg   = TRIM(Inst%ErrMsg)//C_NULL_CHAR
+   ErrMsg_c      = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
 
 #ifdef CONSOLE_FILE   
-   if (ErrStat /= ErrID_None) call wrscr1(trim(ErrMsg))
+   if (Inst%ErrStat /= ErrID_None) call wrscr1(trim(Inst%ErrMsg))
 #endif   
       
 end subroutine FAST_Restart 
 !==================================================================================================================================
-subroutine FAST_OpFM_Init(TMax, InputFileName_c, TurbID, NumSC2Ctrl, NumCtrl2SC, TurbPosn, AbortErrLev_c, dt_c, NumBl_c, NumBlElem_c, &
+subroutine FAST_OpFM_Init(Handle_c, TMax, InputFileName_c, TurbID, NumSC2Ctrl, NumCtrl2SC, TurbPosn, AbortErrLev_c, dt_c, NumBl_c, NumBlElem_c, &
                           OpFM_Input_from_FAST, OpFM_Output_to_FAST, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_Init')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_OpFM_Init
    IMPLICIT NONE 
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_Init
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
    REAL(C_DOUBLE),         INTENT(IN   ) :: TMax      
    CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: InputFileName_c(IntfStrLen)      
    INTEGER(C_INT),         INTENT(IN   ) :: TurbID      
@@ -420,6 +1004,10 @@ subroutine FAST_OpFM_Init(TMax, InputFileName_c, TurbID, NumSC2Ctrl, NumCtrl2SC,
    CHARACTER(IntfStrLen)                 :: InputFileName   
    INTEGER(C_INT)                        :: i    
    TYPE(FAST_ExternInitType)             :: ExternInitData
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
    
       ! transfer the character array from C to a Fortran string:   
    InputFileName = TRANSFER( InputFileName_c, InputFileName )
@@ -427,9 +1015,9 @@ subroutine FAST_OpFM_Init(TMax, InputFileName_c, TurbID, NumSC2Ctrl, NumCtrl2SC,
    IF ( I > 0 ) InputFileName = InputFileName(1:I)     ! remove it
    
       ! initialize variables:   
-   n_t_global = 0   
-   ErrStat = ErrID_None
-   ErrMsg = ""
+   Inst%n_t_global = 0
+   Inst%ErrStat = ErrID_None
+   Inst%ErrMsg = ""
    
    ExternInitData%TMax = TMax
    ExternInitData%TurbineID = TurbID
@@ -438,25 +1026,29 @@ subroutine FAST_OpFM_Init(TMax, InputFileName_c, TurbID, NumSC2Ctrl, NumCtrl2SC,
    ExternInitData%NumCtrl2SC = NumCtrl2SC
    ExternInitData%NumSC2Ctrl = NumSC2Ctrl
 
-   CALL FAST_InitializeAll_T( t_initial, 1_IntKi, Turbine, ErrStat, ErrMsg, InputFileName, ExternInitData )
+   CALL FAST_InitializeAll_T( t_initial, 1_IntKi, Inst%Turbine, Inst%ErrStat, Inst%ErrMsg, InputFileName, ExternInitData )
+   CALL SetInitialized( Inst )
    
       ! set values for return to OpenFOAM
    AbortErrLev_c = AbortErrLev   
-   dt_c          = Turbine%p_FAST%dt
-   ErrStat_c     = ErrStat
-   ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
-   ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+   dt_c          = Inst%Turbine%p_FAST%dt
+   ErrStat_c     = Inst%ErrStat
+   Inst%ErrMsg   = TRIM(Inst%ErrMsg)//C_NULL_CHAR
+   ErrMsg_c      = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
    
-   call SetOpenFOAM_pointers(OpFM_Input_from_FAST, OpFM_Output_to_FAST)
+   call SetOpenFOAM_pointers(Inst%Turbine, OpFM_Input_from_FAST, OpFM_Output_to_FAST)
                         
    ! 7-Sep-2015: Sang wants these integers for the OpenFOAM mapping, which is tied to the AeroDyn nodes. FAST doesn't restrict the number of nodes on each 
    ! blade mesh to be the same, so if this DOES ever change, we'll need to make OpenFOAM less tied to the AeroDyn mapping.
-   IF (Turbine%p_FAST%CompAero == MODULE_AD14) THEN   
-      NumBl_c     = SIZE(Turbine%AD14%Input(1)%InputMarkers)
-      NumBlElem_c = Turbine%AD14%Input(1)%InputMarkers(1)%Nnodes
-   ELSEIF (Turbine%p_FAST%CompAero == MODULE_AD) THEN  
-      NumBl_c     = SIZE(Turbine%AD%Input(1)%BladeMotion)
-      NumBlElem_c = Turbine%AD%Input(1)%BladeMotion(1)%Nnodes
+   IF (.NOT. Inst%Initialized) THEN
+      NumBl_c     = 0
+      NumBlElem_c = 0
+   ELSEIF (Inst%Turbine%p_FAST%CompAero == MODULE_AD14) THEN
+      NumBl_c     = SIZE(Inst%Turbine%AD14%Input(1)%InputMarkers)
+      NumBlElem_c = Inst%Turbine%AD14%Input(1)%InputMarkers(1)%Nnodes
+   ELSEIF (Inst%Turbine%p_FAST%CompAero == MODULE_AD) THEN
+      NumBl_c     = SIZE(Inst%Turbine%AD%Input(1)%BladeMotion)
+      NumBlElem_c = Inst%Turbine%AD%Input(1)%BladeMotion(1)%Nnodes
    ELSE
       NumBl_c     = 0
       NumBlElem_c = 0
@@ -464,33 +1056,41 @@ subroutine FAST_OpFM_Init(TMax, InputFileName_c, TurbID, NumSC2Ctrl, NumCtrl2SC,
    
 end subroutine   
 !==================================================================================================================================
-subroutine FAST_OpFM_Solution0(ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_Solution0')
+subroutine FAST_OpFM_Solution0(Handle_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_Solution0')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_OpFM_Solution0
    IMPLICIT NONE 
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_Solution0
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
    INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
    CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen) 
       
+   ! local
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
    
-   call FAST_Solution0_T(Turbine, ErrStat, ErrMsg ) 
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+   call FAST_Solution0_T(Inst%Turbine, Inst%ErrStat, Inst%ErrMsg )
+   call SetOpFMBuffers(Inst, .FALSE.)
    
       ! set values for return to OpenFOAM
-   ErrStat_c     = ErrStat
-   ErrMsg        = TRIM(ErrMsg)//C_NULL_CHAR
-   ErrMsg_c      = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+   ErrStat_c     = Inst%ErrStat
+   Inst%ErrMsg   = TRIM(Inst%ErrMsg)//C_NULL_CHAR
+   ErrMsg_c      = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
    
                         
 end subroutine FAST_OpFM_Solution0
 !==================================================================================================================================
-subroutine FAST_OpFM_Restart(CheckpointRootName_c, AbortErrLev_c, dt_c, n_t_global_c, &
+subroutine FAST_OpFM_Restart(Handle_c, CheckpointRootName_c, AbortErrLev_c, dt_c, n_t_global_c, &
                       OpFM_Input_from_FAST, OpFM_Output_to_FAST, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_Restart')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_OpFM_Restart
    IMPLICIT NONE
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_Restart
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
    CHARACTER(KIND=C_CHAR), INTENT(IN   ) :: CheckpointRootName_c(IntfStrLen)      
    INTEGER(C_INT),         INTENT(  OUT) :: AbortErrLev_c      
    REAL(C_DOUBLE),         INTENT(  OUT) :: dt_c      
@@ -502,19 +1102,24 @@ subroutine FAST_OpFM_Restart(CheckpointRootName_c, AbortErrLev_c, dt_c, n_t_glob
    
    ! local variables
    INTEGER(C_INT)                        :: NumOuts_c      
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
 
    call NWTC_Init() ! make sure we re-initialize global constants in NWTC Library   
    
-   call FAST_Restart(CheckpointRootName_c, AbortErrLev_c, NumOuts_c, dt_c, n_t_global_c, ErrStat_c, ErrMsg_c)
+   call FAST_Restart(Handle_c, CheckpointRootName_c, AbortErrLev_c, NumOuts_c, dt_c, n_t_global_c, ErrStat_c, ErrMsg_c)
    
-   call SetOpenFOAM_pointers(OpFM_Input_from_FAST, OpFM_Output_to_FAST)
+   call SetOpenFOAM_pointers(Inst%Turbine, OpFM_Input_from_FAST, OpFM_Output_to_FAST)
 
 end subroutine FAST_OpFM_Restart
 !==================================================================================================================================
-subroutine SetOpenFOAM_pointers(OpFM_Input_from_FAST, OpFM_Output_to_FAST)
+subroutine SetOpenFOAM_pointers(Turbine, OpFM_Input_from_FAST, OpFM_Output_to_FAST)
 
    IMPLICIT NONE
 
+   TYPE(FAST_TurbineType), INTENT(IN   ) :: Turbine                                 ! Data for this turbine
    TYPE(OpFM_InputType_C), INTENT(INOUT) :: OpFM_Input_from_FAST
    TYPE(OpFM_OutputType_C),INTENT(INOUT) :: OpFM_Output_to_FAST
 
@@ -536,43 +1141,217 @@ subroutine SetOpenFOAM_pointers(OpFM_Input_from_FAST, OpFM_Output_to_FAST)
       
 end subroutine SetOpenFOAM_pointers
 !==================================================================================================================================
-subroutine FAST_OpFM_Step(ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_Step')
+subroutine FAST_OpFM_Step(Handle_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_Step')
 !DEC$ ATTRIBUTES DLLEXPORT::FAST_OpFM_Step
    IMPLICIT NONE
 #ifndef IMPLICIT_DLLEXPORT
 !GCC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_Step
 #endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
    INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c      
    CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)      
                     
+   ! local
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
    
-   IF ( n_t_global > Turbine%p_FAST%n_TMax_m1 ) THEN !finish 
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+   IF ( Inst%n_t_global > Inst%Turbine%p_FAST%n_TMax_m1 ) THEN !finish
       
       ! we can't continue because we might over-step some arrays that are allocated to the size of the simulation
 
-      IF (n_t_global == Turbine%p_FAST%n_TMax_m1 + 1) THEN  ! we call update an extra time in Simulink, which we can ignore until the time shift with outputs is solved
-         n_t_global = n_t_global + 1
+      IF (Inst%n_t_global == Inst%Turbine%p_FAST%n_TMax_m1 + 1) THEN  ! we call update an extra time in Simulink, which we can ignore until the time shift with outputs is solved
+         Inst%n_t_global = Inst%n_t_global + 1
          ErrStat_c = ErrID_None
-         ErrMsg = C_NULL_CHAR
-         ErrMsg_c = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+         Inst%ErrMsg = C_NULL_CHAR
+         ErrMsg_c = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
       ELSE     
          ErrStat_c = ErrID_Info
-         ErrMsg = "Simulation completed."//C_NULL_CHAR
-         ErrMsg_c = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+         Inst%ErrMsg = "Simulation completed."//C_NULL_CHAR
+         ErrMsg_c = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
       END IF
       
    ELSE
 
-      CALL FAST_Solution_T( t_initial, n_t_global, Turbine, ErrStat, ErrMsg )                  
-      n_t_global = n_t_global + 1
+      IF ( Inst%RT%Enabled ) CALL RT_StartStep(Inst%RT)
+      IF ( ASSOCIATED(Inst%OpFM_Pos) ) Inst%OpFM_PosPrev = Inst%Turbine%OpFM%m%Pos
+      CALL FAST_Solution_T( t_initial, Inst%n_t_global, Inst%Turbine, Inst%ErrStat, Inst%ErrMsg )
+      Inst%n_t_global = Inst%n_t_global + 1
+      CALL SetOpFMBuffers(Inst, .TRUE.)
+      IF ( Inst%RT%Enabled ) CALL RT_EndStep(Inst%RT, Inst%n_t_global, Inst%Turbine%m_FAST%t_global)
             
-      ErrStat_c = ErrStat
-      ErrMsg = TRIM(ErrMsg)//C_NULL_CHAR
-      ErrMsg_c  = TRANSFER( ErrMsg//C_NULL_CHAR, ErrMsg_c )
+      ErrStat_c = Inst%ErrStat
+      Inst%ErrMsg = TRIM(Inst%ErrMsg)//C_NULL_CHAR
+      ErrMsg_c  = TRANSFER( Inst%ErrMsg//C_NULL_CHAR, ErrMsg_c )
    END IF
    
       
 end subroutine FAST_OpFM_Step 
 !==================================================================================================================================   
-END MODULE FAST_Data
+!> Binds caller-owned double-precision buffers for the OpenFOAM coupling, each double[3][NumNodes_c] (all x components, then all y,
+!! then all z), so the CFD code can use the node data in place instead of converting the single-precision arrays in OpFM_InputType_C
+!! and OpFM_OutputType_C. FAST writes the positions after each FAST_OpFM_Solution0/FAST_OpFM_Step; the caller writes velocities and
+!! hands the nodes that changed to FAST_OpFM_SetVelocities. Forces_c returns FAST's own double[3][NumNodes_c] array of normalized
+!! forces, which SetOpFMForces fills in place each step; it stays valid until FAST_End or FAST_OpFM_Restart. Null buffers unbind.
+subroutine FAST_OpFM_BindBuffers(Handle_c, NumNodes_c, Positions_c, Forces_c, Velocities_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_BindBuffers')
+!DEC$ ATTRIBUTES DLLEXPORT::FAST_OpFM_BindBuffers
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_BindBuffers
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+   INTEGER(C_INT),         INTENT(IN   ) :: NumNodes_c                              ! number of nodes on the FAST-OpenFOAM interface
+   TYPE(C_PTR),     VALUE, INTENT(IN   ) :: Positions_c                             ! double[3][NumNodes_c], owned by the caller
+   TYPE(C_PTR),            INTENT(  OUT) :: Forces_c                                ! double[3][NumNodes_c], owned by FAST (C_NULL_PTR when not bound)
+   TYPE(C_PTR),     VALUE, INTENT(IN   ) :: Velocities_c                            ! double[3][NumNodes_c], owned by the caller
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+   ! local
+   INTEGER(IntKi)                        :: ErrStat2
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
 
+   NULLIFY( Inst%OpFM_Pos, Inst%OpFM_Vel )
+   IF ( ALLOCATED(Inst%OpFM_PosPrev) ) DEALLOCATE(Inst%OpFM_PosPrev)
+   Forces_c    = C_NULL_PTR
+   ErrStat_c   = ErrID_None
+   Inst%ErrMsg = ""
+
+   IF ( C_ASSOCIATED(Positions_c) .OR. C_ASSOCIATED(Velocities_c) ) THEN
+      IF ( .NOT. Inst%Initialized .OR. Inst%Turbine%p_FAST%CompInflow /= Module_OpFM ) THEN
+         ErrStat_c   = ErrID_Fatal
+         Inst%ErrMsg = "FAST_OpFM_BindBuffers:the turbine is not initialized for OpenFOAM coupling; call FAST_OpFM_Init first."
+      ELSEIF ( NumNodes_c /= Inst%Turbine%OpFM%p%Nnodes ) THEN
+         ErrStat_c   = ErrID_Fatal
+         Inst%ErrMsg = "FAST_OpFM_BindBuffers:NumNodes must be "//TRIM(Num2LStr(Inst%Turbine%OpFM%p%Nnodes))//"."
+      ELSEIF ( .NOT. (C_ASSOCIATED(Positions_c) .AND. C_ASSOCIATED(Velocities_c)) ) THEN
+         ErrStat_c   = ErrID_Fatal
+         Inst%ErrMsg = "FAST_OpFM_BindBuffers:Positions and Velocities must both be bound."
+      ELSE
+         ALLOCATE( Inst%OpFM_PosPrev(NumNodes_c,3), STAT=ErrStat2 )
+         IF ( ErrStat2 /= 0 ) THEN
+            ErrStat_c   = ErrID_Fatal
+            Inst%ErrMsg = "FAST_OpFM_BindBuffers:could not allocate the sub-cycling positions."
+         ELSE
+            CALL C_F_POINTER( Positions_c,  Inst%OpFM_Pos,   [NumNodes_c, 3] )
+            CALL C_F_POINTER( Velocities_c, Inst%OpFM_Vel,   [NumNodes_c, 3] )
+            Forces_c = C_LOC( Inst%Turbine%OpFM%m%Force(1,1) )
+
+            Inst%OpFM_Vel(:,1) = Inst%Turbine%OpFM%y%u
+            Inst%OpFM_Vel(:,2) = Inst%Turbine%OpFM%y%v
+            Inst%OpFM_Vel(:,3) = Inst%Turbine%OpFM%y%w
+            CALL SetOpFMBuffers(Inst, .FALSE.)
+         END IF
+      END IF
+   END IF
+
+   ErrMsg_c = TRANSFER( TRIM(Inst%ErrMsg)//C_NULL_CHAR, ErrMsg_c )
+
+end subroutine FAST_OpFM_BindBuffers
+!==================================================================================================================================
+!> Copies the OpenFOAM node positions that OpFM_SetInputs computed for the latest FAST solution into the buffer bound with
+!! FAST_OpFM_BindBuffers. FAST_OpFM_Step saves the positions from the previous solution so FAST_OpFM_SubStep can interpolate.
+subroutine SetOpFMBuffers(Inst, NewStep)
+   TYPE(FAST_LibInstanceType), INTENT(INOUT) :: Inst
+   LOGICAL,                    INTENT(IN   ) :: NewStep                             ! .FALSE. when there is no previous solution to interpolate from
+
+   IF ( .NOT. ASSOCIATED(Inst%OpFM_Pos) ) RETURN
+
+   IF ( .NOT. NewStep ) Inst%OpFM_PosPrev = Inst%Turbine%OpFM%m%Pos
+   Inst%OpFM_Pos = Inst%Turbine%OpFM%m%Pos
+
+end subroutine SetOpFMBuffers
+!==================================================================================================================================
+!> Copies the velocities of the listed nodes from the buffer bound with FAST_OpFM_BindBuffers into the OpenFOAM outputs used by
+!! FAST, so the CFD code only has to send the nodes whose velocities changed. ChangedNodes_c holds zero-based node indices; a
+!! negative NumChanged_c copies all nodes.
+subroutine FAST_OpFM_SetVelocities(Handle_c, NumChanged_c, ChangedNodes_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_SetVelocities')
+!DEC$ ATTRIBUTES DLLEXPORT::FAST_OpFM_SetVelocities
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_SetVelocities
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+   INTEGER(C_INT),         INTENT(IN   ) :: NumChanged_c                            ! number of nodes in ChangedNodes_c (<0 for all nodes)
+   INTEGER(C_INT),         INTENT(IN   ) :: ChangedNodes_c(*)                       ! zero-based indices of the nodes whose velocities changed
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+   ! local
+   INTEGER(IntKi)                        :: i
+   INTEGER(IntKi)                        :: Node
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+   ErrStat_c   = ErrID_None
+   Inst%ErrMsg = ""
+
+   IF ( .NOT. ASSOCIATED(Inst%OpFM_Vel) ) THEN
+      ErrStat_c   = ErrID_Fatal
+      Inst%ErrMsg = "FAST_OpFM_SetVelocities:no velocity buffer is bound; call FAST_OpFM_BindBuffers first."
+   ELSEIF ( NumChanged_c < 0 ) THEN
+      Inst%Turbine%OpFM%y%u = Inst%OpFM_Vel(:,1)
+      Inst%Turbine%OpFM%y%v = Inst%OpFM_Vel(:,2)
+      Inst%Turbine%OpFM%y%w = Inst%OpFM_Vel(:,3)
+   ELSE
+      DO i=1,NumChanged_c
+         Node = ChangedNodes_c(i) + 1
+         IF ( Node < 1 .OR. Node > SIZE(Inst%OpFM_Vel,1) ) THEN
+            ErrStat_c   = ErrID_Fatal
+            Inst%ErrMsg = "FAST_OpFM_SetVelocities:node index "//TRIM(Num2LStr(ChangedNodes_c(i)))//" is out of range."
+            EXIT
+         END IF
+         Inst%Turbine%OpFM%y%u(Node) = Inst%OpFM_Vel(Node,1)
+         Inst%Turbine%OpFM%y%v(Node) = Inst%OpFM_Vel(Node,2)
+         Inst%Turbine%OpFM%y%w(Node) = Inst%OpFM_Vel(Node,3)
+      END DO
+   END IF
+
+   ErrMsg_c = TRANSFER( TRIM(Inst%ErrMsg)//C_NULL_CHAR, ErrMsg_c )
+
+end subroutine FAST_OpFM_SetVelocities
+!==================================================================================================================================
+!> Lets the CFD code sub-cycle within one FAST step: writes the node positions linearly interpolated between the previous and the
+!! latest FAST solution into the bound position buffer. Fraction_c is 0 at the start of the FAST step and 1 at its end; the next
+!! FAST_OpFM_Step resets the buffer to the positions at the end of the new step.
+subroutine FAST_OpFM_SubStep(Handle_c, Fraction_c, ErrStat_c, ErrMsg_c) BIND (C, NAME='FAST_OpFM_SubStep')
+!DEC$ ATTRIBUTES DLLEXPORT::FAST_OpFM_SubStep
+   IMPLICIT NONE
+#ifndef IMPLICIT_DLLEXPORT
+!GCC$ ATTRIBUTES DLLEXPORT :: FAST_OpFM_SubStep
+#endif
+   INTEGER(C_INT),         INTENT(IN   ) :: Handle_c
+   REAL(C_DOUBLE),         INTENT(IN   ) :: Fraction_c                              ! fraction of the FAST step at which the CFD code needs positions [0,1]
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_c
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_c(IntfStrLen)
+
+   ! local
+   TYPE(FAST_LibInstanceType), POINTER   :: Inst
+
+   Inst => GetInstance(Handle_c, ErrStat_c, ErrMsg_c)
+   IF ( .NOT. ASSOCIATED(Inst) ) RETURN
+
+   ErrStat_c   = ErrID_None
+   Inst%ErrMsg = ""
+
+   IF ( .NOT. ASSOCIATED(Inst%OpFM_Pos) ) THEN
+      ErrStat_c   = ErrID_Fatal
+      Inst%ErrMsg = "FAST_OpFM_SubStep:no position buffer is bound; call FAST_OpFM_BindBuffers first."
+   ELSEIF ( Fraction_c < 0.0_C_DOUBLE .OR. Fraction_c > 1.0_C_DOUBLE ) THEN
+      ErrStat_c   = ErrID_Fatal
+      Inst%ErrMsg = "FAST_OpFM_SubStep:Fraction must be between 0 and 1."
+   ELSE
+      Inst%OpFM_Pos = Inst%OpFM_PosPrev + Fraction_c*( Inst%Turbine%OpFM%m%Pos - Inst%OpFM_PosPrev )
+   END IF
+
+   ErrMsg_c = TRANSFER( TRIM(Inst%ErrMsg)//C_NULL_CHAR, ErrMsg_c )
+
+end subroutine FAST_OpFM_SubStep
+!==================================================================================================================================   
+END MODULE FAST_Data
@@ -7,19 +7,41 @@
 #define EXTERNAL_ROUTINE extern
 #endif
 
-EXTERNAL_ROUTINE void FAST_OpFM_Restart(char *CheckpointRootName, int *AbortErrLev, double * dt, int * NumBl, int * NumBlElem, int * n_t_global,
+// Each turbine is an instance referenced by the opaque handle returned from FAST_Create; all other routines take this handle.
+// The library is not thread safe (the NWTC Library and the controller DLLs keep process-wide state): calls for any handle
+// must be made from one thread at a time.
+EXTERNAL_ROUTINE void FAST_Create(int *Handle, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_Destroy(int *Handle, int *ErrStat, char *ErrMsg);
+
+EXTERNAL_ROUTINE void FAST_OpFM_Restart(int *Handle, char *CheckpointRootName, int *AbortErrLev, double * dt, int * NumBl, int * NumBlElem, int * n_t_global,
    OpFM_InputType_t* OpFM_Input, OpFM_OutputType_t* OpFM_Output, int *ErrStat, char *ErrMsg);
-EXTERNAL_ROUTINE void FAST_OpFM_Init(double *TMax, char *InputFileName, int * TurbineID, int * NumSC2Ctrl, int * NumCtrl2SC, float * TurbinePosition,
+EXTERNAL_ROUTINE void FAST_OpFM_Init(int *Handle, double *TMax, char *InputFileName, int * TurbineID, int * NumSC2Ctrl, int * NumCtrl2SC, float * TurbinePosition,
    int *AbortErrLev, double * dt, int * NumBl, int * NumBlElem, OpFM_InputType_t* OpFM_Input, OpFM_OutputType_t* OpFM_Output, int *ErrStat, char *ErrMsg);
-EXTERNAL_ROUTINE void FAST_OpFM_Solution0(int *ErrStat, char *ErrMsg);
-EXTERNAL_ROUTINE void FAST_OpFM_Step(int *ErrStat, char *ErrMsg);
-
-EXTERNAL_ROUTINE void FAST_Restart(char *CheckpointRootName, int *AbortErrLev, int * NumOuts, double * dt, int * n_t_global, int *ErrStat, char *ErrMsg);
-EXTERNAL_ROUTINE void FAST_Sizes(double *TMax, double *InitInputAry, char *InputFileName, int *AbortErrLev, int * NumOuts, double * dt, int *ErrStat, char *ErrMsg, char *ChannelNames);
-EXTERNAL_ROUTINE void FAST_Start(int *NumInputs_c, int *NumOutputs_c, double *InputAry, double *OutputAry, int *ErrStat, char *ErrMsg);
-EXTERNAL_ROUTINE void FAST_Update(int *NumInputs_c, int *NumOutputs_c, double *InputAry, double *OutputAry, int *ErrStat, char *ErrMsg);
-EXTERNAL_ROUTINE void FAST_End();
-EXTERNAL_ROUTINE void FAST_CreateCheckpoint(char *CheckpointRootName, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_OpFM_Solution0(int *Handle, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_OpFM_Step(int *Handle, int *ErrStat, char *ErrMsg);
+// registers caller-owned double[3][NumNodes] position and velocity buffers (x, y, z blocks); positions are written by FAST each step.
+// *Forces is set to FAST's own double[3][NumNodes] force array, updated in place each step (valid until FAST_End/FAST_OpFM_Restart)
+EXTERNAL_ROUTINE void FAST_OpFM_BindBuffers(int *Handle, int *NumNodes, double *Positions, double **Forces, double *Velocities, int *ErrStat, char *ErrMsg);
+// copies the velocities of the listed (zero-based) nodes from the bound buffer; NumChanged < 0 copies all nodes
+EXTERNAL_ROUTINE void FAST_OpFM_SetVelocities(int *Handle, int *NumChanged, int *ChangedNodes, int *ErrStat, char *ErrMsg);
+// writes positions interpolated at Fraction (0 to 1) of the current FAST step into the bound position buffer
+EXTERNAL_ROUTINE void FAST_OpFM_SubStep(int *Handle, double *Fraction, int *ErrStat, char *ErrMsg);
+
+EXTERNAL_ROUTINE void FAST_Restart(int *Handle, char *CheckpointRootName, int *AbortErrLev, int * NumOuts, double * dt, int * n_t_global, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_Sizes(int *Handle, double *TMax, double *InitInputAry, char *InputFileName, int *AbortErrLev, int * NumOuts, double * dt, int *ErrStat, char *ErrMsg, char *ChannelNames);
+EXTERNAL_ROUTINE void FAST_Start(int *Handle, int *NumInputs_c, int *NumOutputs_c, double *InputAry, double *OutputAry, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_Update(int *Handle, int *NumInputs_c, int *NumOutputs_c, double *InputAry, double *OutputAry, int *ErrStat, char *ErrMsg);
+// advances NumSteps steps: InputAry is [NumInputSamples][NumInputs_c] (interpolated if NumInputSamples > 1); OutputAry is [NumSteps][NumOutputs_c]
+EXTERNAL_ROUTINE void FAST_UpdateN(int *Handle, int *NumSteps, int *NumInputs_c, int *NumInputSamples, int *NumOutputs_c, double *InputAry, double *OutputAry,
+   int *NumStepsTaken, int *ErrStat, char *ErrMsg);
+// registers a caller-owned ring of output rows, double[NumRows][NumOuts]; *NumRowsWritten counts the completed rows
+EXTERNAL_ROUTINE void FAST_BindOutputBuffer(int *Handle, double *OutputBuffer, int *NumRows, int *NumOuts, int *NumRowsWritten, int *ErrStat, char *ErrMsg);
+// real-time profile: times each step against Deadline (s) and, if Pace is nonzero, locks simulation time to wall-clock time
+EXTERNAL_ROUTINE void FAST_SetRealTime(int *Handle, double *Deadline, int *Pace, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_GetRealTimeStats(int *Handle, int *NumSteps, int *NumOverruns, int *LastOverrun, double *WorstStepTime, double *MeanStepTime,
+   int *NumBins, double *BinWidth, int *Histogram, int *ErrStat, char *ErrMsg);
+EXTERNAL_ROUTINE void FAST_End(int *Handle);
+EXTERNAL_ROUTINE void FAST_CreateCheckpoint(int *Handle, char *CheckpointRootName, int *ErrStat, char *ErrMsg);
 
 // some constants (keep these synced with values in FAST's fortran code)
 #define INTERFACE_STRING_LENGTH 1025
@@ -6,7 +6,7 @@
 #include <stdlib.h> 
 #include <malloc.h>
 
-int checkError(const int ErrStat, const char * ErrMsg);
+int checkError(int Handle, const int ErrStat, const char * ErrMsg);
 void setOutputsToFAST(OpFM_InputType_t* OpFM_Input_from_FAST, OpFM_OutputType_t* OpFM_Output_to_FAST);
 
 
@@ -17,6 +17,7 @@ main(int argc, char *argv[], char *env[])
    double TMax=10.0;
    float TurbinePos[3];
    int TurbID;
+   int Handle = 0;   // handle of the turbine instance in the FAST library
    int ErrStat = 0;
    char ErrMsg[INTERFACE_STRING_LENGTH];        // make sure this is the same size as IntfStrLen in FAST_Library.f90
    char InputFileName[INTERFACE_STRING_LENGTH]; // make sure this is the same size as IntfStrLen in FAST_Library.f90
@@ -44,6 +45,8 @@ main(int argc, char *argv[], char *env[])
       return 1;
    }
 
+   FAST_Create(&Handle, &ErrStat, ErrMsg);
+   if (checkError(Handle, ErrStat, ErrMsg)) return 1;
 
 
    if (0){ // restart from checkpoint file
@@ -53,8 +56,8 @@ main(int argc, char *argv[], char *env[])
       ********************************* */
       /* note that this will set n_t_global inside the FAST library */
       strcpy(CheckpointFileRoot, "../../../CertTest/Test18.1200");
-      FAST_OpFM_Restart(CheckpointFileRoot, &AbortErrLev, &dt, &NumBlades, &NumElementsPerBlade, &n_t_global_start, OpFM_Input_from_FAST, OpFM_Output_to_FAST, &ErrStat, ErrMsg);
-      if (checkError(ErrStat, ErrMsg)) return 1;
+      FAST_OpFM_Restart(&Handle, CheckpointFileRoot, &AbortErrLev, &dt, &NumBlades, &NumElementsPerBlade, &n_t_global_start, OpFM_Input_from_FAST, OpFM_Output_to_FAST, &ErrStat, ErrMsg);
+      if (checkError(Handle, ErrStat, ErrMsg)) return 1;
 
    }
    else{
@@ -69,9 +72,9 @@ main(int argc, char *argv[], char *env[])
       TurbinePos[1] = 0.0;  // y location of turbine
       TurbinePos[2] = 0.0;  // z location of turbine
 
-      FAST_OpFM_Init(&TMax, InputFileName, &TurbID, &NumScOutputs, &NumScInputs, TurbinePos, &AbortErrLev, &dt, &NumBlades, &NumElementsPerBlade,
+      FAST_OpFM_Init(&Handle, &TMax, InputFileName, &TurbID, &NumScOutputs, &NumScInputs, TurbinePos, &AbortErrLev, &dt, &NumBlades, &NumElementsPerBlade,
                      OpFM_Input_from_FAST, OpFM_Output_to_FAST, &ErrStat, ErrMsg);
-      if (checkError(ErrStat, ErrMsg)) return 1;
+      if (checkError(Handle, ErrStat, ErrMsg)) return 1;
 
       NumTwrElements = OpFM_Output_to_FAST->u_Len - NumBlades*NumElementsPerBlade - 1;
 
@@ -79,8 +82,8 @@ main(int argc, char *argv[], char *env[])
       // set wind speeds at initial locations
       setOutputsToFAST(OpFM_Input_from_FAST, OpFM_Output_to_FAST);
 
-      FAST_OpFM_Solution0(&ErrStat, ErrMsg);
-      if (checkError(ErrStat, ErrMsg)) return 1;
+      FAST_OpFM_Solution0(&Handle, &ErrStat, ErrMsg);
+      if (checkError(Handle, ErrStat, ErrMsg)) return 1;
 
    }
 
@@ -98,8 +101,8 @@ main(int argc, char *argv[], char *env[])
       if (n_t_global == n_checkpoint){
          //sprintf(CheckpointFileRoot, "../../CertTest/Test18.%d", n_t_global);
          sprintf(CheckpointFileRoot, " "); // if blank, it will use FAST convention <RootName>.n_t_global
-         FAST_CreateCheckpoint(CheckpointFileRoot, &ErrStat, ErrMsg);
-         checkError(ErrStat, ErrMsg);
+         FAST_CreateCheckpoint(&Handle, CheckpointFileRoot, &ErrStat, ErrMsg);
+         checkError(Handle, ErrStat, ErrMsg);
       }
 
 
@@ -113,8 +116,8 @@ main(int argc, char *argv[], char *env[])
 
       // this advances the states, calls CalcOutput, and solves for next inputs. Predictor-corrector loop is imbeded here:
       // (note OpenFOAM could do subcycling around this step)
-      FAST_OpFM_Step(&ErrStat, ErrMsg);
-      if (checkError(ErrStat, ErrMsg)) return 1;
+      FAST_OpFM_Step(&Handle, &ErrStat, ErrMsg);
+      if (checkError(Handle, ErrStat, ErrMsg)) return 1;
 
 
       // do something with 
@@ -131,7 +134,8 @@ main(int argc, char *argv[], char *env[])
    End the program
    ********************************* */
 
-   FAST_End();
+   FAST_End(&Handle);
+   FAST_Destroy(&Handle, &ErrStat, ErrMsg);
 
    // deallocate types we allocated earlier
    if (OpFM_Input_from_FAST != NULL) {
@@ -146,13 +150,15 @@ main(int argc, char *argv[], char *env[])
 }
 
 int
-checkError(const int ErrStat, const char * ErrMsg){
+checkError(int Handle, const int ErrStat, const char * ErrMsg){
 
    if (ErrStat != ErrID_None){
       fprintf(stderr, "%s\n", ErrMsg);
 
       if (ErrStat >= AbortErrLev){
-         FAST_End();
+         int ErrStat2;
+         char ErrMsg2[INTERFACE_STRING_LENGTH];
+         FAST_Destroy(&Handle, &ErrStat2, ErrMsg2); // also ends the simulation
          return 1;
       }
 
@@ -27,7 +27,15 @@
 PROGRAM FAST
 ! This program models 2- or 3-bladed turbines of a standard configuration.
 !
+! usage:
+!   FAST <primary FAST input file>      (single turbine)
+!   FAST -farm <farm input file>        (several turbines stepped together; see FAST_ReadFarmInputFile)
+!   FAST -restart <checkpoint root>     (restart a single-turbine or farm simulation from a checkpoint file)
+!
 ! noted compilation switches:
+!   FARM_PARALLEL           (with OpenMP, advances the turbines of a farm in parallel each global time step, unless a turbine
+!                            writes VTK animation or linearization files; only safe when no turbine uses a Bladed-style
+!                            controller DLL. Without it, the turbines of a farm are advanced one after another.)
 !   SOLVE_OPTION_1_BEFORE_2 (uses a different order for solving input-output relationships)
 !   OUTPUT_ADDEDMASS        (outputs a file called "<RootName>.AddedMass" that contains HydroDyn's added-mass matrix.
 !   OUTPUT_JACOBIAN
@@ -42,15 +50,28 @@ IMPLICIT  NONE
    
    ! Local parameters:
 REAL(DbKi),             PARAMETER     :: t_initial = 0.0_DbKi                    ! Initial time
-INTEGER(IntKi),         PARAMETER     :: NumTurbines = 1
    
    ! Other/Misc variables
-TYPE(FAST_TurbineType)                :: Turbine(NumTurbines)                    ! Data for each turbine instance
+TYPE(FAST_TurbineType), ALLOCATABLE   :: Turbine(:)                              ! Data for each turbine instance
+TYPE(FAST_ExternInitType)             :: ExternInitData                          ! Initialization data for each turbine of a farm simulation
 
+INTEGER(IntKi)                        :: NumTurbines                             ! number of turbines in this simulation
+LOGICAL                               :: StepInParallel                          ! whether the turbines are advanced in parallel (FARM_PARALLEL)
 INTEGER(IntKi)                        :: i_turb                                  ! current turbine number
 INTEGER(IntKi)                        :: n_t_global                              ! simulation time step, loop counter for global (FAST) simulation
 INTEGER(IntKi)                        :: ErrStat                                 ! Error status
 CHARACTER(1024)                       :: ErrMsg                                  ! Error message
+INTEGER(IntKi),         ALLOCATABLE   :: ErrStat_T(:)                            ! Error status of each turbine during a (parallel) time step
+CHARACTER(1024),        ALLOCATABLE   :: ErrMsg_T(:)                             ! Error message of each turbine during a (parallel) time step
+INTEGER(IntKi)                        :: ErrStat2                                ! temporary Error status
+CHARACTER(1024)                       :: ErrMsg2                                 ! temporary Error message
+
+   ! data for farm simulations:
+LOGICAL                               :: IsFarm                                  ! whether the turbines are listed in a farm input file
+CHARACTER(1024)                       :: FarmFile                                ! name of the farm input file
+CHARACTER(1024),        ALLOCATABLE   :: FSTFile(:)                              ! primary FAST input file for each turbine of a farm
+REAL(ReKi),             ALLOCATABLE   :: TurbinePos(:,:)                         ! position of each turbine of a farm (m)
+REAL(DbKi)                            :: TMax                                    ! simulation length of a farm (s)
 
    ! data for restart:
 CHARACTER(1024)                       :: CheckpointRoot                          ! Rootname of the checkpoint file
@@ -66,6 +87,22 @@ INTEGER(IntKi)                        :: Restart_step
    CheckpointRoot = ""
    CALL CheckArgs( CheckpointRoot, ErrStat, Flag=FlagArg )  ! if ErrStat /= ErrID_None, we'll ignore and deal with the problem when we try to read the input file
       
+   IsFarm = TRIM(FlagArg) == 'FARM'
+   IF ( IsFarm ) THEN
+      FarmFile = CheckpointRoot
+      CALL FAST_ReadFarmInputFile( FarmFile, TMax, FSTFile, TurbinePos, ErrStat, ErrMsg )
+         CALL CheckError( ErrStat, ErrMsg, 'while reading the farm input file' )
+      NumTurbines = SIZE(FSTFile)
+   ELSEIF ( TRIM(FlagArg) == 'RESTART' ) THEN
+      CALL FAST_GetCheckpointNumTurbines( CheckpointRoot, NumTurbines, ErrStat, ErrMsg )
+         CALL CheckError( ErrStat, ErrMsg, 'during restore from checkpoint' )
+   ELSE
+      NumTurbines = 1
+   END IF
+   
+   ALLOCATE( Turbine(NumTurbines), ErrStat_T(NumTurbines), ErrMsg_T(NumTurbines), STAT=ErrStat )
+   IF ( ErrStat /= 0 ) CALL CheckError( ErrID_Fatal, 'Error allocating data for '//TRIM(Num2LStr(NumTurbines))//' turbines.', 'during initialization' )
+   
    IF ( TRIM(FlagArg) == 'RESTART' ) THEN ! Restart from checkpoint file
       CALL FAST_RestoreFromCheckpoint_Tary(t_initial, Restart_step, Turbine, CheckpointRoot, ErrStat, ErrMsg  )
          CALL CheckError( ErrStat, ErrMsg, 'during restore from checkpoint'  )            
@@ -77,7 +114,20 @@ INTEGER(IntKi)                        :: Restart_step
          ! initialization
          !+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
          
-         CALL FAST_InitializeAll_T( t_initial, i_turb, Turbine(i_turb), ErrStat, ErrMsg )     ! bjj: we need to get the input files for each turbine (not necessarially the same one)
+         IF ( IsFarm ) THEN
+               ! each turbine gets its own input file and position; TurbineID appends ".T<i_turb>" to its output file names
+            ExternInitData%TMax         = TMax
+            ExternInitData%TurbineID    = i_turb
+            ExternInitData%TurbinePos   = TurbinePos(:,i_turb)
+            ExternInitData%SensorType   = SensorType_None
+            ExternInitData%LidRadialVel = .false.
+            ExternInitData%NumSC2Ctrl   = 0
+            ExternInitData%NumCtrl2SC   = 0
+            
+            CALL FAST_InitializeAll_T( t_initial, i_turb, Turbine(i_turb), ErrStat, ErrMsg, FSTFile(i_turb), ExternInitData )
+         ELSE
+            CALL FAST_InitializeAll_T( t_initial, i_turb, Turbine(i_turb), ErrStat, ErrMsg )
+         END IF
          CALL CheckError( ErrStat, ErrMsg, 'during module initialization' )
                         
       !+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -108,9 +158,26 @@ INTEGER(IntKi)                        :: Restart_step
    ! Time Stepping:
    !...............................................................................................................................         
    
+   DO i_turb = 2,NumTurbines
+      IF ( Turbine(i_turb)%p_FAST%DT /= Turbine(1)%p_FAST%DT .OR. Turbine(i_turb)%p_FAST%n_TMax_m1 /= Turbine(1)%p_FAST%n_TMax_m1 ) THEN
+         CALL CheckError( ErrID_Fatal, 'All turbines in a farm simulation must use the same DT and TMax (turbine '//TRIM(Num2LStr(i_turb))//' differs from turbine 1).', 'during initialization' )
+      END IF
+   END DO
+   
+   StepInParallel = .FALSE.
+#ifdef FARM_PARALLEL
+      ! VTK animation and linearization open files during a step, and the NWTC Library's GetNewUnit isn't thread safe
+   StepInParallel = NumTurbines > 1
+   DO i_turb = 1,NumTurbines
+      IF ( Turbine(i_turb)%p_FAST%WrVTK == VTK_Animate .OR. Turbine(i_turb)%p_FAST%Linearize ) StepInParallel = .FALSE.
+   END DO
+   IF ( NumTurbines > 1 .AND. .NOT. StepInParallel ) &
+      CALL WrScr( ' The turbines are advanced one after another because VTK animation or linearization files are written.' )
+#endif
+   
    DO n_t_global = Restart_step, Turbine(1)%p_FAST%n_TMax_m1 
       
-      ! bjj: we have to make sure the n_TMax_m1 and n_ChkptTime are the same for all turbines or have some different logic here
+      ! the checkpoint frequency of the first turbine is used for the whole farm
       
       
       ! write checkpoint file if requested
@@ -127,18 +194,33 @@ INTEGER(IntKi)                        :: Restart_step
 
       
       ! this takes data from n_t_global and gets values at n_t_global + 1
+      ! The turbines are stepped one after another: a Bladed-style controller DLL is loaded once per process, and the NWTC Library
+      ! (WrScr, ProgAbort, unit numbers) keeps process-wide state. Compiling with -DFARM_PARALLEL and OpenMP advances them in
+      ! parallel instead (if StepInParallel), in which case the end of the parallel loop is the barrier that makes sure all
+      ! turbines have reached n_t_global + 1 before we check errors or write a checkpoint file.
+#ifdef FARM_PARALLEL
+      !$OMP PARALLEL DO IF(StepInParallel) DEFAULT(SHARED) PRIVATE(i_turb, ErrStat2, ErrMsg2) SCHEDULE(DYNAMIC,1)
+#endif
       DO i_turb = 1,NumTurbines
   
-         CALL FAST_Solution_T( t_initial, n_t_global, Turbine(i_turb), ErrStat, ErrMsg )
-            CALL CheckError( ErrStat, ErrMsg  )
+         CALL FAST_Solution_T( t_initial, n_t_global, Turbine(i_turb), ErrStat_T(i_turb), ErrMsg_T(i_turb) )
                                    
             
             ! if we need to do linarization analysis, do it at this operating point (which is now n_t_global + 1) 
             ! put this at the end of the loop so that we can output linearization analysis at last OP if desired
-         CALL FAST_Linearize_T(t_initial, n_t_global+1, Turbine(i_turb), ErrStat, ErrMsg)
-            CALL CheckError( ErrStat, ErrMsg  )
+         IF ( ErrStat_T(i_turb) < AbortErrLev ) THEN
+            CALL FAST_Linearize_T(t_initial, n_t_global+1, Turbine(i_turb), ErrStat2, ErrMsg2)
+               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat_T(i_turb), ErrMsg_T(i_turb), 'FAST_Linearize_T' )
+         END IF
             
       END DO
+#ifdef FARM_PARALLEL
+      !$OMP END PARALLEL DO
+#endif
+      
+      DO i_turb = 1,NumTurbines
+         CALL CheckError( ErrStat_T(i_turb), ErrMsg_T(i_turb) )
+      END DO
 
       
       
@@ -179,6 +261,8 @@ CONTAINS
                SimMsg = 'at simulation time '//TRIM(Num2LStr(Turbine(1)%m_FAST%t_global))//' of '//TRIM(Num2LStr(Turbine(1)%p_FAST%TMax))//' seconds'
             END IF
             
+            IF ( .NOT. ALLOCATED(Turbine) ) CALL ProgAbort( 'Aborting FAST '//TRIM(SimMsg)//'.' ) ! no turbine data to clean up yet
+            
             DO i_turb2 = 1,NumTurbines
                CALL ExitThisProgram_T( Turbine(i_turb2), ErrID, i_turb2==NumTurbines, SimMsg )
             END DO
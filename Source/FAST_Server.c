@@ -0,0 +1,210 @@
+// FAST_Server.c
+//
+// Co-simulation server: hosts one or more turbines from FAST_Library and exchanges their inputs and outputs with a client
+// process through POSIX shared memory (see FAST_ShmProtocol.h for the layout and the client routines). Each turbine is served
+// by its own thread, so a turbine whose client is slow to post does not hold up the others. FAST_Library is not thread safe, so
+// the calls into it are serialized with a mutex. Linux only.
+//
+// usage: FAST_Server <shared-memory name> <ring depth> <TMax> <file1.fst> [<file2.fst> ...]
+//
+// build: "make server" in Compiling with FAST_driver = FAST_Library (builds the FAST_Library shared library first)
+
+#include "FAST_Library.h"
+#include "FAST_ShmProtocol.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+typedef struct {
+   int Index;           // turbine number in the shared memory
+   int Handle;          // handle of the turbine instance in the FAST library
+   int NumOutputs;
+   double dt;
+} ServerTurbine_t;
+
+static int NumInputs = NumFixedInputs;
+static FAST_ShmClient_t Shm;               // the server's view of the shared memory
+static pthread_mutex_t LibMutex = PTHREAD_MUTEX_INITIALIZER; // FAST_Library is not thread safe: one call at a time
+
+static void *serveTurbine(void *Arg);
+static void stopTurbine(FAST_ShmTurbine_t *t);
+static int createSharedMemory(const char *Name, int NumTurbines, int RingDepth, int MaxOutputs);
+
+
+int
+main(int argc, char *argv[])
+{
+   double TMax;
+   double InitInputAry[MAXInitINPUTS] = { 0 };
+   int NumTurbines;
+   int RingDepth;
+   int MaxOutputs = 1;
+   int ErrStat = 0;
+   int i;
+   int NumStarted;
+   char ErrMsg[INTERFACE_STRING_LENGTH];        // make sure this is the same size as IntfStrLen in FAST_Library.f90
+   char InputFileName[INTERFACE_STRING_LENGTH]; // make sure this is the same size as IntfStrLen in FAST_Library.f90
+   static char ChannelNames[CHANNEL_LENGTH * MAXIMUM_OUTPUTS + 1];
+   ServerTurbine_t *Turbine;
+   pthread_t *Thread;
+
+   if (argc < 5){
+      fprintf(stderr, "usage: %s <shared-memory name> <ring depth> <TMax> <file1.fst> [<file2.fst> ...]\n", argv[0]);
+      return 1;
+   }
+   RingDepth = atoi(argv[2]);
+   TMax = atof(argv[3]);
+   NumTurbines = argc - 4;
+   if (RingDepth < 1){
+      fprintf(stderr, "The ring depth must be at least 1.\n");
+      return 1;
+   }
+
+   Turbine = calloc(NumTurbines, sizeof(ServerTurbine_t));
+   Thread = calloc(NumTurbines, sizeof(pthread_t));
+   if (Turbine == NULL || Thread == NULL){
+      fprintf(stderr, "Error allocating space for the turbines.\n");
+      return 1;
+   }
+
+   /* ******************************
+   initialization (one turbine at a time; FAST_Create and FAST_Sizes must not run concurrently)
+   ********************************* */
+   InitInputAry[0] = SensorType_None;
+   for (i = 0; i < NumTurbines; i++){
+      Turbine[i].Index = i;
+      strncpy(InputFileName, argv[i + 4], INTERFACE_STRING_LENGTH - 1);
+      InputFileName[INTERFACE_STRING_LENGTH - 1] = '\0';
+
+      FAST_Create(&Turbine[i].Handle, &ErrStat, ErrMsg);
+      if (ErrStat < AbortErrLev){
+         FAST_Sizes(&Turbine[i].Handle, &TMax, InitInputAry, InputFileName, &AbortErrLev, &Turbine[i].NumOutputs, &Turbine[i].dt, &ErrStat, ErrMsg, ChannelNames);
+      }
+      if (ErrStat >= AbortErrLev){
+         fprintf(stderr, "%s\n", ErrMsg);
+         return 1;
+      }
+      if (Turbine[i].NumOutputs > MaxOutputs) MaxOutputs = Turbine[i].NumOutputs;
+   }
+
+   if (createSharedMemory(argv[1], NumTurbines, RingDepth, MaxOutputs)) return 1;
+
+   for (i = 0; i < NumTurbines; i++){
+      Shm.Turbine[i].NumOutputs = Turbine[i].NumOutputs;
+      Shm.Turbine[i].dt = Turbine[i].dt;
+   }
+   __atomic_store_n(&Shm.Header->Magic, FAST_SHM_MAGIC, __ATOMIC_RELEASE); // the client can connect now
+
+
+   /* ******************************
+   serve the requests for each turbine
+   ********************************* */
+   for (NumStarted = 0; NumStarted < NumTurbines; NumStarted++){
+      if (pthread_create(&Thread[NumStarted], NULL, serveTurbine, &Turbine[NumStarted]) != 0){
+         fprintf(stderr, "Error creating the thread for turbine %d.\n", NumStarted + 1);
+         for (i = NumStarted; i < NumTurbines; i++){
+            Shm.Turbine[i].ErrStat = ErrID_Fatal;
+            strcpy(Shm.Turbine[i].ErrMsg, "FAST_Server: error creating the thread for this turbine.");
+            stopTurbine(&Shm.Turbine[i]);
+         }
+         break;
+      }
+   }
+   for (i = 0; i < NumStarted; i++){
+      pthread_join(Thread[i], NULL);
+   }
+
+
+   /* ******************************
+   End the program (the library stops the program when the last turbine is ended, so release the shared memory first)
+   ********************************* */
+   munmap(Shm.Header, Shm.Size);
+   shm_unlink(argv[1]);
+
+   for (i = 0; i < NumTurbines; i++){
+      FAST_End(&Turbine[i].Handle);
+      FAST_Destroy(&Turbine[i].Handle, &ErrStat, ErrMsg);
+   }
+
+   free(Turbine);
+   free(Thread);
+   return 0;
+}
+
+static int
+createSharedMemory(const char *Name, int NumTurbines, int RingDepth, int MaxOutputs){
+   size_t Size = FAST_ShmSize(NumTurbines, RingDepth, NumInputs, MaxOutputs);
+   int fd;
+
+   shm_unlink(Name); // remove an object left by a server that didn't exit normally
+   fd = shm_open(Name, O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+   if (fd < 0 || ftruncate(fd, (off_t)Size) != 0){
+      fprintf(stderr, "Error creating the shared-memory object %s.\n", Name);
+      if (fd >= 0) close(fd);
+      return 1;
+   }
+   Shm.Header = (FAST_ShmHeader_t *)mmap(NULL, Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   close(fd);
+   if (Shm.Header == MAP_FAILED){
+      fprintf(stderr, "Error mapping the shared-memory object %s.\n", Name);
+      return 1;
+   }
+   Shm.Size = Size;
+
+   // the new object is zero-filled, so Magic stays 0 (not ready) until main() sets it
+   Shm.Header->Version = FAST_SHM_VERSION;
+   Shm.Header->NumTurbines = NumTurbines;
+   Shm.Header->RingDepth = RingDepth;
+   Shm.Header->NumInputs = NumInputs;
+   Shm.Header->MaxOutputs = MaxOutputs;
+   Shm.Header->AbortErrLev = AbortErrLev;
+   FAST_ShmSetPointers(&Shm);
+
+   return 0;
+}
+
+// Answers the requests for one turbine until the client disconnects, the simulation completes, or FAST returns an abort-level error.
+static void *
+serveTurbine(void *Arg){
+   ServerTurbine_t *T = (ServerTurbine_t *)Arg;
+   FAST_ShmTurbine_t *t = &Shm.Turbine[T->Index];
+   uint32_t Request = 0;
+   uint32_t Requested = 0;
+   double *InputAry;
+   double *OutputAry;
+
+   for (;;){
+      while (Requested == Request){
+         Requested = FAST_ShmWaitChange(&t->Requested, Requested, NULL);
+      }
+      if (__atomic_load_n(&Shm.Header->Shutdown, __ATOMIC_ACQUIRE)) break;
+
+      InputAry = FAST_ShmInputSlot(&Shm, T->Index, Request);
+      OutputAry = FAST_ShmOutputSlot(&Shm, T->Index, Request);
+
+      pthread_mutex_lock(&LibMutex);
+      if (Request == 0){
+         FAST_Start(&T->Handle, &NumInputs, &T->NumOutputs, InputAry, OutputAry, &t->ErrStat, t->ErrMsg);
+      }
+      else{
+         FAST_Update(&T->Handle, &NumInputs, &T->NumOutputs, InputAry, OutputAry, &t->ErrStat, t->ErrMsg);
+      }
+      pthread_mutex_unlock(&LibMutex);
+      Request++;
+
+      __atomic_store_n(&t->Completed, Request, __ATOMIC_RELEASE);
+      FAST_ShmWake(&t->Completed);
+
+      if (t->ErrStat >= AbortErrLev || t->ErrStat == ErrID_Info) break; // ErrID_Info: simulation completed
+   }
+
+   stopTurbine(t);
+   return NULL;
+}
+
+// Marks the turbine as no longer served and wakes a client that is waiting on it.
+static void
+stopTurbine(FAST_ShmTurbine_t *t){
+   __atomic_store_n(&t->Status, FAST_SHM_STOPPED, __ATOMIC_RELEASE);
+   FAST_ShmWake(&t->Completed);
+}
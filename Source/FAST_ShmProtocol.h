@@ -0,0 +1,240 @@
+// FAST_ShmProtocol.h
+//
+// Shared-memory protocol between FAST_Server (FAST_Server.c) and a client process, plus the small set of client routines.
+// The server hosts one or more turbines from FAST_Library; the client exchanges inputs and outputs with it through a POSIX
+// shared-memory object without linking FAST (or its Fortran runtime) into its own process. Linux only (uses futexes).
+//
+// Layout of the shared-memory object:
+//    FAST_ShmHeader_t
+//    FAST_ShmTurbine_t   Turbine[NumTurbines]
+//    double              Inputs [NumTurbines][RingDepth][NumInputs]
+//    double              Outputs[NumTurbines][RingDepth][MaxOutputs]
+//
+// For each turbine, request n uses ring slot n % RingDepth. The client writes Inputs for request n and calls FAST_ShmPost; the
+// server answers request 0 with FAST_Start and later requests with FAST_Update, writes Outputs into the same slot, and increments
+// Completed. The client may have up to RingDepth requests outstanding, and the outputs of request n stay valid until request
+// n + RingDepth is posted. Before a server thread stops serving its turbine (abort-level error, TMax reached, or shutdown), it
+// sets the turbine's Status to FAST_SHM_STOPPED, so a client waiting on that turbine returns instead of blocking forever.
+//
+// Increment FAST_SHM_VERSION whenever this layout changes.
+
+#ifndef FAST_SHM_PROTOCOL_H
+#define FAST_SHM_PROTOCOL_H
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define FAST_SHM_MAGIC    0x54534146u  // "FAST"
+#define FAST_SHM_VERSION  2
+#define FAST_SHM_MSG_LEN  1025         // keep this the same as INTERFACE_STRING_LENGTH in FAST_Library.h
+#define FAST_SHM_SPIN     20000        // polls of a counter before sleeping on it
+#define FAST_SHM_SLEEP_NS 10000000     // longest sleep on a counter before checking the turbine status again (10 ms)
+
+#define FAST_SHM_RUNNING  0            // values of FAST_ShmTurbine_t.Status
+#define FAST_SHM_STOPPED  1
+
+typedef struct {
+   uint32_t Magic;                     // FAST_SHM_MAGIC, set by the server after all turbines are initialized (0 before)
+   uint32_t Version;                   // FAST_SHM_VERSION
+   uint32_t Shutdown;                  // set to 1 by the client to stop the server
+   int32_t  NumTurbines;
+   int32_t  RingDepth;                 // number of request slots per turbine
+   int32_t  NumInputs;                 // inputs per request (see FAST_Update in FAST_Library.h)
+   int32_t  MaxOutputs;                // size of each output slot (the largest NumOutputs of all turbines)
+   int32_t  AbortErrLev;
+} FAST_ShmHeader_t;
+
+typedef struct {
+   uint32_t Requested;                 // number of requests posted by the client (futex word)
+   uint32_t Completed;                 // number of requests answered by the server (futex word)
+   uint32_t Status;                    // FAST_SHM_RUNNING, or FAST_SHM_STOPPED once the server no longer answers requests
+   int32_t  NumOutputs;                // number of outputs (including time) of this turbine
+   int32_t  ErrStat;                   // error status of the latest request
+   double   dt;                        // FAST time step of this turbine
+   char     ErrMsg[FAST_SHM_MSG_LEN];  // error message of the latest request
+   char     Pad[64];                   // keeps the counters of neighboring turbines out of the same cache line
+} FAST_ShmTurbine_t;
+
+typedef struct {
+   FAST_ShmHeader_t  *Header;
+   FAST_ShmTurbine_t *Turbine;
+   double            *Inputs;
+   double            *Outputs;
+   size_t             Size;
+} FAST_ShmClient_t;
+
+
+static inline size_t
+FAST_ShmSize(int NumTurbines, int RingDepth, int NumInputs, int MaxOutputs){
+   return sizeof(FAST_ShmHeader_t) + (size_t)NumTurbines * sizeof(FAST_ShmTurbine_t)
+        + (size_t)NumTurbines * RingDepth * (NumInputs + MaxOutputs) * sizeof(double);
+}
+
+static inline void
+FAST_ShmSetPointers(FAST_ShmClient_t *Shm){
+   FAST_ShmHeader_t *h = Shm->Header;
+   Shm->Turbine = (FAST_ShmTurbine_t *)(h + 1);
+   Shm->Inputs  = (double *)(Shm->Turbine + h->NumTurbines);
+   Shm->Outputs = Shm->Inputs + (size_t)h->NumTurbines * h->RingDepth * h->NumInputs;
+}
+
+static inline double *
+FAST_ShmInputSlot(const FAST_ShmClient_t *Shm, int Turbine, uint32_t Request){
+   const FAST_ShmHeader_t *h = Shm->Header;
+   return Shm->Inputs + ((size_t)Turbine * h->RingDepth + Request % (uint32_t)h->RingDepth) * h->NumInputs;
+}
+
+static inline double *
+FAST_ShmOutputSlot(const FAST_ShmClient_t *Shm, int Turbine, uint32_t Request){
+   const FAST_ShmHeader_t *h = Shm->Header;
+   return Shm->Outputs + ((size_t)Turbine * h->RingDepth + Request % (uint32_t)h->RingDepth) * h->MaxOutputs;
+}
+
+static inline void
+FAST_ShmWake(uint32_t *Word){
+   syscall(SYS_futex, Word, FUTEX_WAKE, INT32_MAX, NULL, NULL, 0);
+}
+
+// waits until *Word differs from Value or, if Status is not NULL, until *Status is FAST_SHM_STOPPED: spins first (for low latency)
+// and then sleeps on the futex. The sleep is bounded so a stop that happens between the status check and the sleep is still seen.
+static inline uint32_t
+FAST_ShmWaitChange(uint32_t *Word, uint32_t Value, const uint32_t *Status){
+   const struct timespec Timeout = { 0, FAST_SHM_SLEEP_NS };
+   uint32_t Current;
+   int i;
+
+   for (i = 0; i < FAST_SHM_SPIN; i++){
+      Current = __atomic_load_n(Word, __ATOMIC_ACQUIRE);
+      if (Current != Value) return Current;
+      if (Status != NULL && __atomic_load_n(Status, __ATOMIC_ACQUIRE) == FAST_SHM_STOPPED) return Current;
+   }
+   while ((Current = __atomic_load_n(Word, __ATOMIC_ACQUIRE)) == Value){
+      if (Status != NULL && __atomic_load_n(Status, __ATOMIC_ACQUIRE) == FAST_SHM_STOPPED) break;
+      syscall(SYS_futex, Word, FUTEX_WAIT, Value, Status != NULL ? &Timeout : NULL, NULL, 0);
+   }
+   return Current;
+}
+
+// whether the server has stopped serving this turbine
+static inline int
+FAST_ShmStopped(const FAST_ShmTurbine_t *t){
+   return __atomic_load_n(&t->Status, __ATOMIC_ACQUIRE) == FAST_SHM_STOPPED;
+}
+
+
+// Maps the shared-memory object created by FAST_Server. Returns 0 on success; 1 if the server hasn't finished initializing the
+// turbines yet (try again later); otherwise -1 (ErrMsg says why).
+static inline int
+FAST_ShmConnect(const char *Name, FAST_ShmClient_t *Shm, char *ErrMsg){
+   struct stat st;
+   int fd;
+
+   memset(Shm, 0, sizeof(*Shm));
+   fd = shm_open(Name, O_RDWR, 0);
+   if (fd < 0){
+      strcpy(ErrMsg, "FAST_ShmConnect: cannot open the shared-memory object.");
+      return errno == ENOENT ? 1 : -1;      // the server may not have created it yet
+   }
+   if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(FAST_ShmHeader_t)){
+      strcpy(ErrMsg, "FAST_ShmConnect: the server is still initializing.");
+      close(fd);
+      return 1;
+   }
+   Shm->Size = (size_t)st.st_size;
+   Shm->Header = (FAST_ShmHeader_t *)mmap(NULL, Shm->Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   close(fd);
+   if (Shm->Header == MAP_FAILED){
+      memset(Shm, 0, sizeof(*Shm));
+      strcpy(ErrMsg, "FAST_ShmConnect: cannot map the shared-memory object.");
+      return -1;
+   }
+   if (__atomic_load_n(&Shm->Header->Magic, __ATOMIC_ACQUIRE) != FAST_SHM_MAGIC){
+      munmap(Shm->Header, Shm->Size);
+      memset(Shm, 0, sizeof(*Shm));
+      strcpy(ErrMsg, "FAST_ShmConnect: the server is still initializing.");
+      return 1;
+   }
+   if (Shm->Header->Version != FAST_SHM_VERSION){
+      strcpy(ErrMsg, "FAST_ShmConnect: the server uses a different protocol version.");
+      munmap(Shm->Header, Shm->Size);
+      memset(Shm, 0, sizeof(*Shm));
+      return -1;
+   }
+
+   FAST_ShmSetPointers(Shm);
+   ErrMsg[0] = '\0';
+   return 0;
+}
+
+// Returns the input slot for the next request of this turbine, waiting if RingDepth requests are already outstanding. Returns
+// NULL if the server has stopped serving the turbine (see Turbine[].ErrStat and ErrMsg).
+static inline double *
+FAST_ShmNextInputs(FAST_ShmClient_t *Shm, int Turbine){
+   FAST_ShmTurbine_t *t = &Shm->Turbine[Turbine];
+   uint32_t Requested = t->Requested;           // only the client writes this
+   uint32_t Completed = __atomic_load_n(&t->Completed, __ATOMIC_ACQUIRE);
+
+   if (FAST_ShmStopped(t)) return NULL;
+   while (Requested - Completed >= (uint32_t)Shm->Header->RingDepth){
+      if (FAST_ShmStopped(t)) return NULL;
+      Completed = FAST_ShmWaitChange(&t->Completed, Completed, &t->Status);
+   }
+   return FAST_ShmInputSlot(Shm, Turbine, Requested);
+}
+
+// Posts the inputs written to the slot from FAST_ShmNextInputs; returns the request number.
+static inline uint32_t
+FAST_ShmPost(FAST_ShmClient_t *Shm, int Turbine){
+   FAST_ShmTurbine_t *t = &Shm->Turbine[Turbine];
+   uint32_t Request = t->Requested;
+
+   __atomic_store_n(&t->Requested, Request + 1, __ATOMIC_RELEASE);
+   FAST_ShmWake(&t->Requested);
+   return Request;
+}
+
+// Waits for the server to answer the request; returns the output slot (time, then the FAST output channels), or NULL if the
+// server stopped serving the turbine without answering it. Check Turbine[].ErrStat and ErrMsg afterwards: the server stops
+// serving a turbine after an abort-level error or at TMax.
+static inline double *
+FAST_ShmWait(FAST_ShmClient_t *Shm, int Turbine, uint32_t Request){
+   FAST_ShmTurbine_t *t = &Shm->Turbine[Turbine];
+   uint32_t Completed = __atomic_load_n(&t->Completed, __ATOMIC_ACQUIRE);
+
+   while ((int32_t)(Completed - Request) <= 0){
+      if (FAST_ShmStopped(t)){
+         Completed = __atomic_load_n(&t->Completed, __ATOMIC_ACQUIRE);   // the server updates Completed before Status
+         if ((int32_t)(Completed - Request) > 0) break;
+         return NULL;
+      }
+      Completed = FAST_ShmWaitChange(&t->Completed, Completed, &t->Status);
+   }
+   return FAST_ShmOutputSlot(Shm, Turbine, Request);
+}
+
+// Tells the server to end all turbines and exit, then unmaps the shared memory.
+static inline void
+FAST_ShmDisconnect(FAST_ShmClient_t *Shm){
+   int i;
+
+   if (Shm->Header == NULL) return;
+   if (Shm->Turbine != NULL){
+      __atomic_store_n(&Shm->Header->Shutdown, 1, __ATOMIC_RELEASE);
+      for (i = 0; i < Shm->Header->NumTurbines; i++){
+         __atomic_add_fetch(&Shm->Turbine[i].Requested, 1, __ATOMIC_RELEASE); // wakes a server thread that is waiting for a request
+         FAST_ShmWake(&Shm->Turbine[i].Requested);
+      }
+   }
+   munmap(Shm->Header, Shm->Size);
+   memset(Shm, 0, sizeof(*Shm));
+}
+
+#endif // FAST_SHM_PROTOCOL_H
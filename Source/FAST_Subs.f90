@@ -71,6 +71,99 @@ SUBROUTINE FAST_InitializeAll_T( t_initial, TurbID, Turbine, ErrStat, ErrMsg, In
          
 END SUBROUTINE FAST_InitializeAll_T
 !----------------------------------------------------------------------------------------------------------------------------------
+!> Routine that reads the input file for a multi-turbine (farm) simulation in the FAST driver program. The file contains the
+!! simulation length shared by all turbines, followed by a table with one row per turbine: the name of its primary FAST input
+!! file (relative to the farm input file) and the position of the turbine base in the global coordinate system.
+SUBROUTINE FAST_ReadFarmInputFile( InputFile, TMax, FSTFile, TurbinePos, ErrStat, ErrMsg )
+
+   CHARACTER(*),                 INTENT(IN   ) :: InputFile         !< Name of the farm input file
+   REAL(DbKi),                   INTENT(  OUT) :: TMax              !< Total run time, applied to every turbine (s)
+   CHARACTER(1024), ALLOCATABLE, INTENT(  OUT) :: FSTFile(:)        !< Primary FAST input file for each turbine
+   REAL(ReKi),      ALLOCATABLE, INTENT(  OUT) :: TurbinePos(:,:)   !< Initial position of each turbine base (3 x NumTurbines) (m)
+   INTEGER(IntKi),               INTENT(  OUT) :: ErrStat           !< Error status of the operation
+   CHARACTER(*),                 INTENT(  OUT) :: ErrMsg            !< Error message if ErrStat /= ErrID_None
+
+      ! local variables
+   INTEGER(IntKi)                              :: UnIn              ! Unit number for reading file
+   INTEGER(IntKi)                              :: NumTurbines       ! Number of turbines in the farm
+   INTEGER(IntKi)                              :: i_turb            ! turbine loop counter
+   INTEGER(IntKi)                              :: IOS               ! Temporary Error status
+   INTEGER(IntKi)                              :: ErrStat2          ! Temporary Error status
+   CHARACTER(ErrMsgLen)                        :: ErrMsg2           ! Temporary Error message
+   CHARACTER(1024)                             :: FarmPath          ! Path name of the farm input file
+   CHARACTER(*),   PARAMETER                   :: RoutineName = 'FAST_ReadFarmInputFile'
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   UnIn    = -1
+
+   CALL GetPath( InputFile, FarmPath )    ! FAST input files will be relative to the path where the farm input file is located.
+
+   CALL GetNewUnit( UnIn, ErrStat2, ErrMsg2 )
+   CALL OpenFInpFile ( UnIn, InputFile, ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      if ( ErrStat >= AbortErrLev ) then
+         call cleanup()
+         RETURN
+      end if
+
+   !-------------------------- HEADER ---------------------------------------------
+   CALL ReadCom( UnIn, InputFile, 'File header: Module Version (line 1)', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL ReadCom( UnIn, InputFile, 'File header: File Description (line 2)', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+
+   !---------------------- SIMULATION CONTROL --------------------------------------
+   CALL ReadCom( UnIn, InputFile, 'Section Header: Simulation Control', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL ReadVar( UnIn, InputFile, TMax, "TMax", "Total run time (s)", ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL ReadVar( UnIn, InputFile, NumTurbines, "NumTurbines", "Number of turbines in the farm (-)", ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      if ( ErrStat >= AbortErrLev ) then
+         call cleanup()
+         RETURN
+      end if
+
+   IF ( NumTurbines < 1 ) THEN
+      CALL SetErrStat( ErrID_Fatal, 'NumTurbines must be at least 1.', ErrStat, ErrMsg, RoutineName )
+      call cleanup()
+      RETURN
+   END IF
+
+   !---------------------- TURBINES -------------------------------------------------
+   CALL ReadCom( UnIn, InputFile, 'Section Header: Turbines', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL ReadCom( UnIn, InputFile, 'Turbine table: column names', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+
+   ALLOCATE( FSTFile(NumTurbines), TurbinePos(3,NumTurbines), STAT=ErrStat2 )
+      IF ( ErrStat2 /= 0 ) CALL SetErrStat( ErrID_Fatal, 'Error allocating turbine arrays.', ErrStat, ErrMsg, RoutineName )
+      if ( ErrStat >= AbortErrLev ) then
+         call cleanup()
+         RETURN
+      end if
+
+   DO i_turb = 1,NumTurbines
+      READ (UnIn, *, IOSTAT=IOS) FSTFile(i_turb), TurbinePos(:,i_turb)
+         CALL CheckIOS ( IOS, InputFile, 'turbine '//TRIM(Num2LStr(i_turb))//' (FSTFile, X, Y, Z)', NumType, ErrStat2, ErrMsg2 )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         if ( ErrStat >= AbortErrLev ) then
+            call cleanup()
+            RETURN
+         end if
+      IF ( PathIsRelative( FSTFile(i_turb) ) ) FSTFile(i_turb) = TRIM(FarmPath)//TRIM(FSTFile(i_turb))
+   END DO
+
+   call cleanup()
+
+contains
+   subroutine cleanup()
+      IF ( UnIn > 0 ) CLOSE ( UnIn )
+   end subroutine cleanup
+END SUBROUTINE FAST_ReadFarmInputFile
+!----------------------------------------------------------------------------------------------------------------------------------
 !> Routine to call Init routine for each module. This routine sets all of the init input data for each module.
 SUBROUTINE FAST_InitializeAll( t_initial, p_FAST, y_FAST, m_FAST, ED, BD, SrvD, AD14, AD, IfW, OpFM, HD, SD, ExtPtfm, &
                                MAPp, FEAM, MD, Orca, IceF, IceD, MeshMapData, ErrStat, ErrMsg, InFile, ExternInitData )
@@ -4163,6 +4256,12 @@ END SUBROUTINE FAST_Solution_T
 SUBROUTINE FAST_Solution(t_initial, n_t_global, p_FAST, y_FAST, m_FAST, ED, BD, SrvD, AD14, AD, IfW, OpFM, HD, SD, ExtPtfm, &
                          MAPp, FEAM, MD, Orca, IceF, IceD, MeshMapData, ErrStat, ErrMsg )
 
+#ifdef DEBUG_SCRATCH_ALLOC
+   USE ElastoDyn,    ONLY: ED_NumScratchAllocs
+   USE SS_Radiation, ONLY: SS_Rad_NumScratchAllocs
+   USE MoorDyn,      ONLY: MD_NumScratchAllocs
+#endif
+
    REAL(DbKi),               INTENT(IN   ) :: t_initial           !< initial time
    INTEGER(IntKi),           INTENT(IN   ) :: n_t_global          !< loop counter
 
@@ -4460,6 +4559,23 @@ SUBROUTINE FAST_Solution(t_initial, n_t_global, p_FAST, y_FAST, m_FAST, ED, BD,
                           SrvD, MAPp, FEAM, MD, Orca, IceF, IceD, MeshMapData, ErrStat2, ErrMsg2)
       CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
+#ifdef DEBUG_SCRATCH_ALLOC
+   !----------------------------------------------------------------------------------------
+   !! Check that the time step didn't allocate scratch storage for the state derivatives:
+   !!   it is allocated in the Init routines, so after the first time step, the counters must stay at zero
+   !----------------------------------------------------------------------------------------
+
+   IF ( n_t_global == 0 ) THEN
+      ED_NumScratchAllocs     = 0
+      SS_Rad_NumScratchAllocs = 0
+      MD_NumScratchAllocs     = 0
+   ELSEIF ( ED_NumScratchAllocs + SS_Rad_NumScratchAllocs + MD_NumScratchAllocs > 0 ) THEN
+      CALL SetErrStat( ErrID_Fatal, 'Scratch storage was allocated after the first time step (ElastoDyn: '// &
+                       TRIM(Num2LStr(ED_NumScratchAllocs))//', SS_Radiation: '//TRIM(Num2LStr(SS_Rad_NumScratchAllocs))// &
+                       ', MoorDyn: '//TRIM(Num2LStr(MD_NumScratchAllocs))//' allocations).', ErrStat, ErrMsg, RoutineName )
+   END IF
+#endif
+
    !----------------------------------------------------------------------------------------
    !! Display simulation status every SttsTime-seconds (i.e., n_SttsTime steps):
    !----------------------------------------------------------------------------------------   
@@ -6186,6 +6302,7 @@ SUBROUTINE FAST_CreateCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine,
 
    FileName    = TRIM(CheckpointRoot)//'.chkp'
    DLLFileName = TRIM(CheckpointRoot)//'.dll.chkp'
+   IF (NumTurbines > 1) DLLFileName = TRIM(CheckpointRoot)//'.T'//TRIM(Num2LStr(Turbine%TurbID))//'.dll.chkp' ! each turbine's controller needs its own file
 
    unOut=-1      
    IF (PRESENT(Unit)) unOut = Unit
@@ -6315,6 +6432,43 @@ SUBROUTINE FAST_RestoreFromCheckpoint_Tary(t_initial, n_t_global, Turbine, Check
    
 END SUBROUTINE FAST_RestoreFromCheckpoint_Tary
 !----------------------------------------------------------------------------------------------------------------------------------
+!> Routine that reads the number of turbines stored in a checkpoint file, so that a driver can allocate its Turbine array before
+!! calling FAST_RestoreFromCheckpoint_Tary.
+SUBROUTINE FAST_GetCheckpointNumTurbines(CheckpointRoot, NumTurbines, ErrStat, ErrMsg )
+
+   CHARACTER(*),             INTENT(IN   ) :: CheckpointRoot      !< Rootname of checkpoint file
+   INTEGER(IntKi),           INTENT(  OUT) :: NumTurbines         !< Number of turbines stored in the checkpoint file
+   INTEGER(IntKi),           INTENT(  OUT) :: ErrStat             !< Error status of the operation
+   CHARACTER(*),             INTENT(  OUT) :: ErrMsg              !< Error message if ErrStat /= ErrID_None
+
+      ! local variables
+   INTEGER(B4Ki)                           :: ArraySizes(3)
+   INTEGER(IntKi)                          :: AbortErrLev_out     ! abort error level stored in the file (not used here)
+   INTEGER(IntKi)                          :: unIn                ! unit number for input file
+   INTEGER(IntKi)                          :: ErrStat2            ! local error status
+   CHARACTER(1024)                         :: ErrMsg2             ! local error message
+   CHARACTER(*),             PARAMETER     :: RoutineName = 'FAST_GetCheckpointNumTurbines'
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   NumTurbines = 0
+
+   CALL GetNewUnit( unIn, ErrStat2, ErrMsg2 )
+   CALL OpenBInpFile ( unIn, TRIM(CheckpointRoot)//'.chkp', ErrStat2, ErrMsg2)
+      CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      IF (ErrStat >= AbortErrLev ) RETURN
+
+      ! checkpoint file header (see FAST_CreateCheckpoint_T):
+   READ (unIn, IOSTAT=ErrStat2)   ArraySizes                       ! bytes for reals, doubles, and integers
+   IF (ErrStat2 == 0) READ (unIn, IOSTAT=ErrStat2)   AbortErrLev_out
+   IF (ErrStat2 == 0) READ (unIn, IOSTAT=ErrStat2)   NumTurbines      ! Number of turbines
+      IF (ErrStat2 /= 0) CALL SetErrStat(ErrID_Fatal, "Could not read the number of turbines from "//TRIM(CheckpointRoot)//'.chkp', ErrStat, ErrMsg, RoutineName )
+
+   CLOSE(unIn)
+
+END SUBROUTINE FAST_GetCheckpointNumTurbines
+!----------------------------------------------------------------------------------------------------------------------------------
 !> This routine is the inverse of FAST_CreateCheckpoint_T. It reads data from a checkpoint file and populates data structures for 
 !! the turbine instance.
 SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine, CheckpointRoot, ErrStat, ErrMsg, Unit )
@@ -6440,6 +6594,7 @@ SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turb
    
    
       ! A hack to restore Bladed-style DLL data
+   IF (NumTurbines > 1) DLLFileName = TRIM(CheckpointRoot)//'.T'//TRIM(Num2LStr(Turbine%TurbID))//'.dll.chkp' ! see FAST_CreateCheckpoint_T
    if (Turbine%SrvD%p%UseBladedInterface) then
       if (Turbine%SrvD%m%dll_data%avrSWAP( 1) > 0   ) then ! this isn't allocated if UseBladedInterface is FALSE
             ! store value to be overwritten
@@ -399,6 +399,8 @@ IMPLICIT NONE
     REAL(ReKi)  :: Loss = 1 
     REAL(ReKi)  :: TipLoss = 1 
     REAL(ReKi)  :: TLpt7 
+    REAL(ReKi)  :: Dist2pt7 = 0.7 
+    INTEGER(IntKi)  :: Jpt7 = 0 
     LOGICAL  :: FirstPassGTL = .TRUE. 
     LOGICAL  :: SuperSonic = .FALSE. 
     LOGICAL  :: AFLAGVinderr = .FALSE. 
@@ -12772,6 +12774,8 @@ ENDIF
     DstMiscData%Loss = SrcMiscData%Loss
     DstMiscData%TipLoss = SrcMiscData%TipLoss
     DstMiscData%TLpt7 = SrcMiscData%TLpt7
+    DstMiscData%Dist2pt7 = SrcMiscData%Dist2pt7
+    DstMiscData%Jpt7 = SrcMiscData%Jpt7
     DstMiscData%FirstPassGTL = SrcMiscData%FirstPassGTL
     DstMiscData%SuperSonic = SrcMiscData%SuperSonic
     DstMiscData%AFLAGVinderr = SrcMiscData%AFLAGVinderr
@@ -12969,6 +12973,8 @@ ENDIF
       Re_BufSz   = Re_BufSz   + 1  ! Loss
       Re_BufSz   = Re_BufSz   + 1  ! TipLoss
       Re_BufSz   = Re_BufSz   + 1  ! TLpt7
+      Re_BufSz   = Re_BufSz   + 1  ! Dist2pt7
+      Int_BufSz  = Int_BufSz  + 1  ! Jpt7
       Int_BufSz  = Int_BufSz  + 1  ! FirstPassGTL
       Int_BufSz  = Int_BufSz  + 1  ! SuperSonic
       Int_BufSz  = Int_BufSz  + 1  ! AFLAGVinderr
@@ -13261,6 +13267,10 @@ ENDIF
       Re_Xferred   = Re_Xferred   + 1
       ReKiBuf ( Re_Xferred:Re_Xferred+(1)-1 ) = InData%TLpt7
       Re_Xferred   = Re_Xferred   + 1
+      ReKiBuf ( Re_Xferred:Re_Xferred+(1)-1 ) = InData%Dist2pt7
+      Re_Xferred   = Re_Xferred   + 1
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%Jpt7
+      Int_Xferred   = Int_Xferred   + 1
       IntKiBuf ( Int_Xferred:Int_Xferred+1-1 ) = TRANSFER( InData%FirstPassGTL , IntKiBuf(1), 1)
       Int_Xferred   = Int_Xferred   + 1
       IntKiBuf ( Int_Xferred:Int_Xferred+1-1 ) = TRANSFER( InData%SuperSonic , IntKiBuf(1), 1)
@@ -13735,6 +13745,10 @@ ENDIF
       Re_Xferred   = Re_Xferred + 1
       OutData%TLpt7 = ReKiBuf( Re_Xferred )
       Re_Xferred   = Re_Xferred + 1
+      OutData%Dist2pt7 = ReKiBuf( Re_Xferred )
+      Re_Xferred   = Re_Xferred + 1
+      OutData%Jpt7 = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
       OutData%FirstPassGTL = TRANSFER( IntKiBuf( Int_Xferred ), mask0 )
       Int_Xferred   = Int_Xferred + 1
       OutData%SuperSonic = TRANSFER( IntKiBuf( Int_Xferred ), mask0 )
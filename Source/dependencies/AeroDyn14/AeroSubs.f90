@@ -2203,12 +2203,9 @@ END FUNCTION GetReynolds
 
    ! Local Variables:
 
-   REAL(ReKi)                 :: Dist2pt7 = 0.7 ! current element distance to r/R = 0.7
    REAL(ReKi)                 :: OLDDist7       ! previous element distance to r/R = 0.7
    REAL(ReKi)                 :: percentR
 
-   INTEGER                    :: Jpt7 = 0 ! The element closest to r/R = 0.7
-
 
    ErrStat = ErrID_None
    ErrMess = ""
@@ -2224,10 +2221,10 @@ IF (p%InducedVel%GTECH) THEN
  ! Search for the element closest to r/R = 0.7
    IF (m%FirstPassGTL) THEN
     ! If the current element is closer than the previous, update values
-      IF ( ABS(percentR - 0.7) < Dist2pt7 ) THEN
-         OLDDist7 = Dist2pt7
-         Dist2pt7 = ABS(percentR - 0.7)
-         Jpt7 = J
+      IF ( ABS(percentR - 0.7) < m%Dist2pt7 ) THEN
+         OLDDist7 = m%Dist2pt7
+         m%Dist2pt7 = ABS(percentR - 0.7)
+         m%Jpt7 = J
          m%TLpt7 = TIPLOSS
       ENDIF
       IF (J == P%Element%NELM) THEN ! We're done after one pass through the blades
@@ -2237,7 +2234,7 @@ IF (p%InducedVel%GTECH) THEN
       ENDIF
    ENDIF
 
-   IF ( J == Jpt7 ) m%TLpt7 = TIPLOSS ! Update the value of TLpt7 at the proper element
+   IF ( J == m%Jpt7 ) m%TLpt7 = TIPLOSS ! Update the value of TLpt7 at the proper element
 
  ! Do the actual Georgia Tech correction to the Prandtl model
    IF (percentR >= 0.7) THEN
@@ -2799,8 +2799,8 @@ FUNCTION rotation_lateral_offset(x_spacing)
     REAL      ::       rotation_lateral_offset
     
     ! parameters
-    REAL      ::       ad = -4.5
-    REAL      ::       bd = -0.01
+    REAL, PARAMETER ::  ad = -4.5
+    REAL, PARAMETER ::  bd = -0.01
     
     rotation_lateral_offset = ad + bd*x_spacing
  
@@ -62,6 +62,10 @@ MODULE ElastoDyn
                                                !   states (z)
 
    PUBLIC :: ED_GetOP                          ! Routine to pack the operating point values (for linearization) into arrays
+
+#ifdef DEBUG_SCRATCH_ALLOC
+   INTEGER(IntKi), PUBLIC       :: ED_NumScratchAllocs = 0  ! number of times ED_CalcContStateDeriv allocated dxdt; should stay 0 after ED_Init
+#endif
    
 CONTAINS
 !----------------------------------------------------------------------------------------------------------------------------------
@@ -182,6 +186,11 @@ SUBROUTINE ED_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, InitOut
    CALL Init_u( u, p, x, InputFileData, m, ErrStat2, ErrMsg2 )      
       CALL CheckError( ErrStat2, ErrMsg2 )
       IF (ErrStat >= AbortErrLev) RETURN                  
+
+         ! the integrators interpolate the inputs into m%u_interp, so allocate its arrays and meshes once, here:
+   CALL ED_CopyInput( u, m%u_interp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
+      CALL CheckError( ErrStat2, ErrMsg2 )
+      IF (ErrStat >= AbortErrLev) RETURN
    
 
       !............................................................................................
@@ -336,6 +345,15 @@ SUBROUTINE ED_End( u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
          ! Place any last minute operations or calculations here:
 
+      IF ( p%MMTol > 0.0_ReKi .AND. NWTC_VerboseLevel == NWTC_Verbose ) THEN
+         CALL WrScr( ' ED_End: factored the mass matrix '//TRIM(Num2LStr(m%MM_NumFactor))//' times for '// &
+                     TRIM(Num2LStr(m%MM_NumSolve))//' solutions of the equations of motion.' )
+      END IF
+      IF ( p%method == Method_GA .AND. NWTC_VerboseLevel == NWTC_Verbose ) THEN
+         CALL WrScr( ' ED_End: computed the generalized-alpha iteration matrix '//TRIM(Num2LStr(m%GA_NumJac))//' times for '// &
+                     TRIM(Num2LStr(m%GA_NumIter))//' Newton iterations.' )
+      END IF
+
 
          ! Close files here:
 
@@ -365,6 +383,9 @@ SUBROUTINE ED_End( u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
       CALL ED_DestroyMisc( m, ErrStat, ErrMsg )
 
+#ifdef DEBUG_SCRATCH_ALLOC
+      CALL WrScr( ' ED_End: ED_CalcContStateDeriv allocated dxdt '//TRIM(Num2LStr(ED_NumScratchAllocs))//' time(s).' )
+#endif
 
 
 END SUBROUTINE ED_End
@@ -398,6 +419,8 @@ SUBROUTINE ED_UpdateStates( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat
       ErrStat = ErrID_None
       ErrMsg  = ""            
       
+         ! With MMTol > 0, the mass matrix is factored at the first evaluation in this step and reused after that (see SolveAugMat):
+      m%MM_FactorType = MMFactor_None
 
       SELECT CASE ( p%method )
          
@@ -413,10 +436,14 @@ SUBROUTINE ED_UpdateStates( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat
       
          CALL ED_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg )
          
+      CASE (Method_GA)
+      
+         CALL ED_GA( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg )
+         
       CASE DEFAULT  !bjj: we already checked this at initialization, but for completeness:
          
          ErrStat = ErrID_Fatal
-         ErrMsg  = ' Error in ElastoDyn_UpdateStates: p%method must be 1 (RK4), 2 (AB4), or 3 (ABM4)'
+         ErrMsg  = ' Error in ElastoDyn_UpdateStates: p%method must be 1 (RK4), 2 (AB4), 3 (ABM4), or 4 (generalized-alpha)'
          RETURN
          
       END SELECT
@@ -516,7 +543,6 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
    
 
    LOGICAL, PARAMETER           :: UpdateValues  = .TRUE.                          ! determines if the OtherState values need to be updated
-   TYPE(ED_ContinuousStateType) :: dxdt                                            ! Continuous state derivs at t
 
          ! Initialize some output values
       ErrStat = ErrID_None
@@ -527,8 +553,7 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
    IF ( UpdateValues ) THEN    
          ! Update the OtherState data by calculating the derivative...
       !OtherState%HSSBrTrqC = SIGN( u%HSSBrTrqC, x%QDT(DOF_GeAz) )
-      CALL ED_CalcContStateDeriv( t, u, p, x, xd, z, OtherState, m, dxdt, ErrStat, ErrMsg ) ! sets m%QD2T = dxdt%QDT
-      CALL ED_DestroyContState( dxdt, ErrStat2, ErrMsg2 )  
+      CALL ED_CalcContStateDeriv( t, u, p, x, xd, z, OtherState, m, m%xdot, ErrStat, ErrMsg ) ! sets m%QD2T = m%xdot%QDT
       IF (ErrStat >= AbortErrLev) RETURN
    END IF      
 
@@ -636,7 +661,7 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
          LinAccES(:,J,K) = m%RtHS%LinAccESt(:,K,J)
 
          DO I = 1,p%DOFs%NPSE(K)  ! Loop through all active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
-            LinAccES(:,J,K) = LinAccES(:,J,K) + m%RtHS%PLinVelES(K,J,p%DOFs%PSE(K,I),0,:)*m%QD2T(p%DOFs%PSE(K,I))
+            LinAccES(:,J,K) = LinAccES(:,J,K) + m%RtHS%PLinVelES(J,:,0,p%DOFs%PSE(K,I),K)*m%QD2T(p%DOFs%PSE(K,I))
          ENDDO             ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
 
       ENDDO             ! J - Blade nodes / elements
@@ -1815,19 +1840,7 @@ SUBROUTINE ED_CalcContStateDeriv( t, u, p, x, xd, z, OtherState, m, dxdt, ErrSta
    !   in INTENT(OUT) arguments.
 
    IF ( p%DOFs%NActvDOF > 0 ) THEN
-      m%AugMat_factor = m%AugMat( p%DOFs%SrtPS( 1:p%DOFs%NActvDOF ), p%DOFs%SrtPSNAUG(1:p%DOFs%NActvDOF) )
-      m%SolnVec       = m%AugMat( p%DOFs%SrtPS( 1:p%DOFs%NActvDOF ), p%DOFs%SrtPSNAUG(1+p%DOFs%NActvDOF) )
-   
-
-      CALL LAPACK_getrf( M=p%DOFs%NActvDOF, N=p%DOFs%NActvDOF, A=m%AugMat_factor, IPIV=m%AugMat_pivot, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)   
-         IF ( ErrStat >= AbortErrLev ) RETURN
-      
-      CALL LAPACK_getrs( TRANS='N',N=p%DOFs%NActvDOF, A=m%AugMat_factor,IPIV=m%AugMat_pivot, B=m%SolnVec, ErrStat=ErrStat2, ErrMsg=ErrMsg2)
-   
-      !CALL GaussElim( m%AugMat( p%DOFs%SrtPS(    1: p%DOFs%NActvDOF   ),     &
-      !                                   p%DOFs%SrtPSNAUG(1:(p%DOFs%NActvDOF+1)) ),   &
-      !                                   p%DOFs%NActvDOF,  SolnVec, ErrStat2, ErrMsg2 )
+      CALL SolveAugMat( p, m, ErrStat2, ErrMsg2 )
          CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
          IF ( ErrStat >= AbortErrLev ) RETURN
    END IF
@@ -1835,12 +1848,18 @@ SUBROUTINE ED_CalcContStateDeriv( t, u, p, x, xd, z, OtherState, m, dxdt, ErrSta
 
    !bjj: if the deriv is INTENT(OUT), this is reallocated each time:
 IF (.NOT. ALLOCATED(dxdt%qt) ) THEN
+#ifdef DEBUG_SCRATCH_ALLOC
+   ED_NumScratchAllocs = ED_NumScratchAllocs + 1
+#endif
    CALL AllocAry( dxdt%qt,  SIZE(x%qt),  'dxdt%qt',  ErrStat2, ErrMsg2 )
    CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
    IF ( ErrStat >= AbortErrLev ) RETURN
 END IF
 
 IF (.NOT. ALLOCATED(dxdt%qdt) ) THEN
+#ifdef DEBUG_SCRATCH_ALLOC
+   ED_NumScratchAllocs = ED_NumScratchAllocs + 1
+#endif
    CALL AllocAry( dxdt%qdt, SIZE(x%qdt), 'dxdt%qdt', ErrStat2, ErrMsg2 )
    CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
    IF ( ErrStat >= AbortErrLev ) RETURN
@@ -1955,6 +1974,12 @@ SUBROUTINE ED_SetParameters( InputFileData, p, ErrStat, ErrMsg )
 
    p%DT24 = p%DT/24.0_DbKi    ! Time-step parameter needed for Solver().
 
+      ! Coefficients of the generalized-alpha method from the spectral radius at infinite frequency (Chung and Hulbert, 1993):
+   p%GA_AlphaM = ( 2.0_R8Ki*p%RhoInf - 1.0_R8Ki ) / ( p%RhoInf + 1.0_R8Ki )
+   p%GA_AlphaF = p%RhoInf / ( p%RhoInf + 1.0_R8Ki )
+   p%GA_Gamma  = 0.5_R8Ki - p%GA_AlphaM + p%GA_AlphaF
+   p%GA_Beta   = 0.25_R8Ki*( p%GA_Gamma + 0.5_R8Ki )**2
+
 
       ! Set furling parameters
    CALL SetFurlParameters( p, InputFileData, ErrStat2, ErrMsg2 )
@@ -2798,6 +2823,7 @@ SUBROUTINE SetOtherParameters( p, InputFileData, ErrStat, ErrMsg )
    CALL AllocAry( p%rSAerCenn2,p%NumBl,p%BldNodes,  'rSAerCenn2',  ErrStat, ErrMsg ); IF ( ErrStat /= ErrID_None ) RETURN
    CALL AllocAry(p%BElmntMass, p%BldNodes, p%NumBl, 'BElmntMass', ErrStat, ErrMsg ); IF ( ErrStat /= ErrID_None ) RETURN
    CALL AllocAry(p%TElmntMass, p%TwrNodes,          'TElmntMass', ErrStat, ErrMsg ); IF ( ErrStat /= ErrID_None ) RETURN
+   CALL AllocAry(p%BldMassConst, p%NumBl, 3_IntKi, 3_IntKi, 'BldMassConst', ErrStat, ErrMsg ); IF ( ErrStat /= ErrID_None ) RETURN
 
    !CALL AllocAry( p%AxRedBld, p%NumBl, 3_IntKi, 3_IntKi, p%TipNode, 'AxRedBld',  ErrStat, ErrMsg ); IF ( ErrStat /= ErrID_None ) RETURN
    ALLOCATE ( p%AxRedBld(p%NumBl, 3_IntKi, 3_IntKi, 0:p%TipNode) , STAT=ErrStat )
@@ -2941,7 +2967,7 @@ SUBROUTINE Alloc_RtHS( RtHS, p, ErrStat, ErrMsg  )
       ErrMsg = ' Error allocating memory for the PAngVelEL array.'
       RETURN
    ENDIF
-   ALLOCATE ( RtHS%PAngVelEM(p%NumBl,p%TipNode,p%NDOF,0:1,Dims) , STAT=ErrStat )
+   ALLOCATE ( RtHS%PAngVelEM(p%TipNode,Dims,0:1,p%NDOF,p%NumBl) , STAT=ErrStat )  ! node index first (contiguous)
    IF ( ErrStat /= 0_IntKi )  THEN
       ErrStat = ErrID_Fatal
       ErrMsg = ' Error allocating memory for the PAngVelEM array.'
@@ -2984,7 +3010,7 @@ SUBROUTINE Alloc_RtHS( RtHS, p, ErrStat, ErrMsg  )
       RETURN
    ENDIF
 
-   ALLOCATE ( RtHS%PLinVelES(p%NumBl,0:p%TipNode,p%NDOF,0:1,Dims) , STAT=ErrStat )
+   ALLOCATE ( RtHS%PLinVelES(0:p%TipNode,Dims,0:1,p%NDOF,p%NumBl) , STAT=ErrStat )  ! node index first (contiguous)
    IF ( ErrStat /= 0_IntKi )  THEN
       ErrStat = ErrID_Fatal
       ErrMsg = ' Error allocating memory for the PLinVelES array.'
@@ -3387,6 +3413,9 @@ SUBROUTINE SetPrimaryParameters( p, InputFileData, ErrStat, ErrMsg  )
    p%TipRad    = InputFileData%TipRad
    p%HubRad    = InputFileData%HubRad
    p%method    = InputFileData%method
+   p%MMTol     = InputFileData%MMTol
+   p%LinJac    = InputFileData%LinJac
+   p%RhoInf    = InputFileData%RhoInf
    p%TwrNodes  = InputFileData%TwrNodes
 
    p%PtfmCMxt = InputFileData%PtfmCMxt
@@ -3779,6 +3808,34 @@ SUBROUTINE Init_MiscOtherStates( m, OtherState, p, x, InputFileData, ErrStat, Er
    CALL AllocAry( m%AugMat_factor,p%DOFs%NActvDOF, p%DOFs%NActvDOF, 'AugMat_factor',ErrStat, ErrMsg )
       IF ( ErrStat >= AbortErrLev ) RETURN
 
+   IF ( p%MMTol > 0.0_ReKi ) THEN  ! the factored mass matrix is reused across integrator stages
+      CALL AllocAry( m%MM_Factor,   p%DOFs%NActvDOF, p%DOFs%NActvDOF, 'MM_Factor',    ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      CALL AllocAry( m%MM_Pivot,    p%DOFs%NActvDOF,                  'MM_Pivot',     ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      CALL AllocAry( m%MM_Rhs,      p%DOFs%NActvDOF,                  'MM_Rhs',       ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      CALL AllocAry( m%MM_Resid,    p%DOFs%NActvDOF,                  'MM_Resid',     ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      CALL AllocAry( m%MM_KnownCol, p%DOFs%NActvDOF,                  'MM_KnownCol',  ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+   END IF
+   m%MM_FactorType = MMFactor_None
+
+   IF ( p%method == Method_GA ) THEN  ! iteration matrix and acceleration history of the generalized-alpha method
+      CALL AllocAry( m%GA_Jac,   p%DOFs%NActvDOF, p%DOFs%NActvDOF, 'GA_Jac',   ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      CALL AllocAry( m%GA_Pivot, p%DOFs%NActvDOF,                  'GA_Pivot', ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      CALL AllocAry( OtherState%GA_Acc, p%NDOF, 'GA_Acc', ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      CALL AllocAry( OtherState%GA_a,   p%NDOF, 'GA_a',   ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      OtherState%GA_Acc = 0.0_R8Ki
+      OtherState%GA_a   = 0.0_R8Ki
+   END IF
+   m%GA_JacValid = .FALSE.
+
    
       ! Now initialize the IC array = (/NMX, NMX-1, ... , 1 /)
       ! this keeps track of the position in the array of continuous states (stored in other states)
@@ -3794,12 +3851,28 @@ SUBROUTINE Init_MiscOtherStates( m, OtherState, p, x, InputFileData, ErrStat, Er
    !OtherState%QD2 = 0.0_ReKi
 
 
-   OtherState%n   = -1  ! we haven't updated OtherState%xdot, yet
+   OtherState%n   = -1  ! we haven't updated OtherState%xdot (or OtherState%GA_Acc), yet
    
    DO i = LBOUND(OtherState%xdot,1), UBOUND(OtherState%xdot,1)
       CALL ED_CopyContState( x, OtherState%xdot(i), MESH_NEWCOPY, ErrStat, ErrMsg)
          IF ( ErrStat >= AbortErrLev ) RETURN 
    ENDDO
+
+      ! scratch states for ED_CalcOutput and the integrators (allocated here so that they don't allocate memory every time step):
+   CALL ED_CopyContState( x, m%xdot,   MESH_NEWCOPY, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+   CALL ED_CopyContState( x, m%k1,     MESH_NEWCOPY, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+   CALL ED_CopyContState( x, m%k2,     MESH_NEWCOPY, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+   CALL ED_CopyContState( x, m%k3,     MESH_NEWCOPY, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+   CALL ED_CopyContState( x, m%k4,     MESH_NEWCOPY, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+   CALL ED_CopyContState( x, m%x_tmp,  MESH_NEWCOPY, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+   CALL ED_CopyContState( x, m%x_pred, MESH_NEWCOPY, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
    
       ! hacks for HSS brake function:
    
@@ -5233,6 +5306,34 @@ SUBROUTINE Coeff(p,InputFileData, ErrStat, ErrMsg)
    ENDDO
 
 
+      ! Calculate the configuration-independent portions of the mass matrix associated with purely blade DOFs and purely tower DOFs
+      !   (used in FillAugMat).  The partial linear velocity of a blade (tower) DOF at a node is the twisted (tower) shape function
+      !   along the orthonormal directions j1 and j2 (a1 or a3) plus the axial-reduction term along j3 (a2); only the axial-reduction
+      !   terms depend on the displacements, so the shape-function products can be integrated here once:
+
+   DO K = 1,p%NumBl       ! Loop through all blades
+      DO I = 1,3          ! Loop through all blade DOFs
+         DO L = 1,3       ! Loop through all blade DOFs
+            p%BldMassConst(K,I,L) = p%TipMass(K)*( p%TwistedSF(K,1,I,p%TipNode,0)*p%TwistedSF(K,1,L,p%TipNode,0)   &
+                                                 + p%TwistedSF(K,2,I,p%TipNode,0)*p%TwistedSF(K,2,L,p%TipNode,0) )
+            DO J = 1,p%BldNodes
+               p%BldMassConst(K,I,L) = p%BldMassConst(K,I,L) + p%BElmntMass(J,K)*( p%TwistedSF(K,1,I,J,0)*p%TwistedSF(K,1,L,J,0)   &
+                                                                                  + p%TwistedSF(K,2,I,J,0)*p%TwistedSF(K,2,L,J,0) )
+            ENDDO         ! J - Blade nodes / elements
+         ENDDO            ! L - All blade DOFs
+      ENDDO               ! I - All blade DOFs
+   ENDDO                  ! K - All blades
+
+   p%TwrMassConst = 0.0_ReKi
+   DO I = 1,2     ! Loop through all tower DOFs in one direction
+      DO L = 1,2  ! Loop through all tower DOFs in one direction
+            ! The partial linear velocities of the yaw bearing (point O) are a1 and a3 (i.e., shape functions equal to one):
+         p%TwrMassConst(2*I-1,2*L-1) = p%YawBrMass + SUM( p%TElmntMass*p%TwrFASF(I,1:p%TwrNodes,0)*p%TwrFASF(L,1:p%TwrNodes,0) )   ! fore-aft
+         p%TwrMassConst(2*I  ,2*L  ) = p%YawBrMass + SUM( p%TElmntMass*p%TwrSSSF(I,1:p%TwrNodes,0)*p%TwrSSSF(L,1:p%TwrNodes,0) )   ! side-to-side
+      ENDDO       ! L - All tower DOFs in one direction
+   ENDDO          ! I - All tower DOFs in one direction
+
+
       ! Calculate the turbine mass:
 
    p%TurbMass  = p%TwrTpMass + p%TwrMass
@@ -6729,6 +6830,37 @@ SUBROUTINE CalculatePositions( p, x, CoordSys, RtHSdat )
 
 END SUBROUTINE CalculatePositions
 !----------------------------------------------------------------------------------------------------------------------------------
+!> This routine computes the cross products of vector a with the vectors of a set of nodes, c(J,:) = a X b(J,:).
+!! b and c are stored node by node (the node index is first and contiguous), so each component is a single loop over the nodes
+!! that the compiler can vectorize.
+SUBROUTINE CrossProdNodes( a, b, c )
+!..................................................................................................................................
+
+   REAL(ReKi),                   INTENT(IN   )  :: a(3)        !< vector
+   REAL(ReKi),                   INTENT(IN   )  :: b(:,:)      !< vectors at the nodes, b(node,component)
+   REAL(ReKi),                   INTENT(  OUT)  :: c(:,:)      !< cross products at the nodes, c(node,component)
+
+   c(:,1) = a(2)*b(:,3) - a(3)*b(:,2)
+   c(:,2) = a(3)*b(:,1) - a(1)*b(:,3)
+   c(:,3) = a(1)*b(:,2) - a(2)*b(:,1)
+
+END SUBROUTINE CrossProdNodes
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine is the same as CrossProdNodes, but for double-precision position vectors b (the cross products are computed in
+!! double precision).
+SUBROUTINE CrossProdNodesR8( a, b, c )
+!..................................................................................................................................
+
+   REAL(ReKi),                   INTENT(IN   )  :: a(3)        !< vector
+   REAL(R8Ki),                   INTENT(IN   )  :: b(:,:)      !< position vectors at the nodes, b(node,component)
+   REAL(ReKi),                   INTENT(  OUT)  :: c(:,:)      !< cross products at the nodes, c(node,component)
+
+   c(:,1) = a(2)*b(:,3) - a(3)*b(:,2)
+   c(:,2) = a(3)*b(:,1) - a(1)*b(:,3)
+   c(:,3) = a(1)*b(:,2) - a(2)*b(:,1)
+
+END SUBROUTINE CrossProdNodesR8
+!----------------------------------------------------------------------------------------------------------------------------------
 !> This routine is used to calculate the angular positions, velocities, and partial accelerations stored in other states that are used in
 !! both the CalcOutput and CalcContStateDeriv routines.
 SUBROUTINE CalculateAngularPosVelPAcc( p, x, CoordSys, RtHSdat )
@@ -6743,8 +6875,10 @@ SUBROUTINE CalculateAngularPosVelPAcc( p, x, CoordSys, RtHSdat )
       !Local variables
 !   REAL(ReKi)                   :: AngVelEN  (3)                                   ! Angular velocity of the nacelle (body N) in the inertia frame (body E for earth).
    REAL(ReKi)                   :: AngAccELt (3)                                   ! Portion of the angular acceleration of the low-speed shaft (body L) in the inertia frame (body E for earth) associated with everything but the QD2T()'s.
+   INTEGER(IntKi)               :: I                                               ! Loops through all of the DOFs
    INTEGER(IntKi)               :: J                                               ! Counter for elements
    INTEGER(IntKi)               :: K                                               ! Counter for blades
+   INTEGER(IntKi)               :: L                                               ! Counter for vector components
 
    !-------------------------------------------------------------------------------------------------
    ! Angular and partial angular velocities
@@ -6860,71 +6994,48 @@ ENDIF
 
    DO K = 1,p%NumBl ! Loop through all blades
 
-      ! Define the partial angular velocities of the tip (body M(p%BldFlexL)) in the  inertia frame:
-      ! NOTE: PAngVelEM(K,J,I,D,:) = the Dth-derivative of the partial angular velocity of DOF I for body M of blade K, element J in body E.
-
-      RtHSdat%PAngVelEM(K,p%TipNode,          :,0,:) = RtHSdat%PAngVelEH(:,0,:)
-      RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,1),0,:) = - p%TwistedSF(K,2,1,p%TipNode,1)*CoordSys%j1(K,:) &
-                                                       + p%TwistedSF(K,1,1,p%TipNode,1)*CoordSys%j2(K,:)
-      RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,2),0,:) = - p%TwistedSF(K,2,2,p%TipNode,1)*CoordSys%j1(K,:) &
-                                                       + p%TwistedSF(K,1,2,p%TipNode,1)*CoordSys%j2(K,:)
-      RtHSdat%PAngVelEM(K,p%TipNode,DOF_BE(K,1),0,:) = - p%TwistedSF(K,2,3,p%TipNode,1)*CoordSys%j1(K,:) &
-                                                       + p%TwistedSF(K,1,3,p%TipNode,1)*CoordSys%j2(K,:)
-   !           AngVelHM(K,p%TipNode              ,:) =  RtHSdat%AngVelEH + x%QDT(DOF_BF(K,1))*RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,1),0,:) & ! Currently
-   !                                                                     + x%QDT(DOF_BF(K,2))*RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,2),0,:) & ! unused
-   !                                                                     + x%QDT(DOF_BE(K,1))*RtHSdat%PAngVelEM(K,p%TipNode,DOF_BE(K,1),0,:)   ! calculations
-       RtHSdat%AngPosHM(:,K,p%TipNode) =        x%QT (DOF_BF(K,1))*RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,1),0,:) &
-                                              + x%QT (DOF_BF(K,2))*RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,2),0,:) &
-                                              + x%QT (DOF_BE(K,1))*RtHSdat%PAngVelEM(K,p%TipNode,DOF_BE(K,1),0,:)
+      ! Define the partial angular velocities of the nodes (bodies M(RNodes(J))) and the tip (body M(p%BldFlexL), node p%TipNode)
+      !   in the inertia frame:
+      ! NOTE: PAngVelEM(J,:,D,I,K) = the Dth-derivative of the partial angular velocity of DOF I for body M of blade K, element J in body E.
+      !       The nodes J are stored contiguously, so each of the array statements below is a single loop over the nodes of blade K.
 
+      DO I = 1,p%NDOF
+         DO L = 1,3
+            RtHSdat%PAngVelEM(:,L,0,I,K) = RtHSdat%PAngVelEH(I,0,L)
+         END DO
+      END DO
 
-      ! Define the 1st derivatives of the partial angular velocities of the tip
-      !   (body M(p%BldFlexL)) in the inertia frame:
-
-   ! NOTE: These are currently unused by the code, therefore, they need not
-   !       be calculated.  Thus, they are currently commented out.  If it
-   !       turns out that they are ever needed (i.e., if inertias of the
-   !       blade elements are ever added, etc...) simply uncomment out these
-   !       computations:
-   !   RtHSdat%PAngVelEM(K,p%TipNode,          :,1,:) = RtHSdat%PAngVelEH(:,1,:)
-   !   RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,1),1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEH, RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,1),0,:)    )
-   !   RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,2),1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEH, RtHSdat%PAngVelEM(K,p%TipNode,DOF_BF(K,2),0,:)    )
-   !   RtHSdat%PAngVelEM(K,p%TipNode,DOF_BE(K,1),1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEH, RtHSdat%PAngVelEM(K,p%TipNode,DOF_BE(K,1),0,:)    )
+      DO L = 1,3
+         RtHSdat%PAngVelEM(:,L,0,DOF_BF(K,1),K) = - p%TwistedSF(K,2,1,1:p%TipNode,1)*CoordSys%j1(K,L) &
+                                                  + p%TwistedSF(K,1,1,1:p%TipNode,1)*CoordSys%j2(K,L)
+         RtHSdat%PAngVelEM(:,L,0,DOF_BF(K,2),K) = - p%TwistedSF(K,2,2,1:p%TipNode,1)*CoordSys%j1(K,L) &
+                                                  + p%TwistedSF(K,1,2,1:p%TipNode,1)*CoordSys%j2(K,L)
+         RtHSdat%PAngVelEM(:,L,0,DOF_BE(K,1),K) = - p%TwistedSF(K,2,3,1:p%TipNode,1)*CoordSys%j1(K,L) &
+                                                  + p%TwistedSF(K,1,3,1:p%TipNode,1)*CoordSys%j2(K,L)
+   !             AngVelHM(:,L) =  RtHSdat%AngVelEH(L) + x%QDT(DOF_BF(K,1))*RtHSdat%PAngVelEM(:,L,0,DOF_BF(K,1),K) & ! Currently
+   !                                                  + x%QDT(DOF_BF(K,2))*RtHSdat%PAngVelEM(:,L,0,DOF_BF(K,2),K) & ! unused
+   !                                                  + x%QDT(DOF_BE(K,1))*RtHSdat%PAngVelEM(:,L,0,DOF_BE(K,1),K)   ! calculations
+         RtHSdat%AngPosHM(L,K,:)                =   x%QT (DOF_BF(K,1))*RtHSdat%PAngVelEM(:,L,0,DOF_BF(K,1),K) &
+                                                  + x%QT (DOF_BF(K,2))*RtHSdat%PAngVelEM(:,L,0,DOF_BF(K,2),K) &
+                                                  + x%QT (DOF_BE(K,1))*RtHSdat%PAngVelEM(:,L,0,DOF_BE(K,1),K)
+      END DO
 
 
-      DO J = 1,p%BldNodes ! Loop through the blade nodes / elements
-      ! Define the partial angular velocities of the current node (body M(RNodes(J))) in the inertia frame:
-      ! NOTE: PAngVelEM(K,J,I,D,:) = the Dth-derivative of the partial angular velocity
-      !   of DOF I for body M of blade K, element J in body E.
-
-         RtHSdat%PAngVelEM(K,J,          :,0,:) = RtHSdat%PAngVelEH(:,0,:)
-         RtHSdat%PAngVelEM(K,J,DOF_BF(K,1),0,:) = - p%TwistedSF(K,2,1,J,1)*CoordSys%j1(K,:) &
-                                                + p%TwistedSF(K,1,1,J,1)*CoordSys%j2(K,:)
-         RtHSdat%PAngVelEM(K,J,DOF_BF(K,2),0,:) = - p%TwistedSF(K,2,2,J,1)*CoordSys%j1(K,:) &
-                                                + p%TwistedSF(K,1,2,J,1)*CoordSys%j2(K,:)
-         RtHSdat%PAngVelEM(K,J,DOF_BE(K,1),0,:) = - p%TwistedSF(K,2,3,J,1)*CoordSys%j1(K,:) &
-                                                + p%TwistedSF(K,1,3,J,1)*CoordSys%j2(K,:)
-!                 AngVelHM(K,J              ,:) =  RtHSdat%AngVelEH + x%QDT(DOF_BF(K,1))*RtHSdat%PAngVelEM(K,J,DOF_BF(K,1),0,:) & ! Currently
-!                                                                   + x%QDT(DOF_BF(K,2))*RtHSdat%PAngVelEM(K,J,DOF_BF(K,2),0,:) & ! unused
-!                                                                   + x%QDT(DOF_BE(K,1))*RtHSdat%PAngVelEM(K,J,DOF_BE(K,1),0,:)   ! calculations
-          RtHSdat%AngPosHM(:,K,J              ) =             x%QT (DOF_BF(K,1))*RtHSdat%PAngVelEM(K,J,DOF_BF(K,1),0,:) &
-                                                    + x%QT (DOF_BF(K,2))*RtHSdat%PAngVelEM(K,J,DOF_BF(K,2),0,:) &
-                                                    + x%QT (DOF_BE(K,1))*RtHSdat%PAngVelEM(K,J,DOF_BE(K,1),0,:)
-
-
-      ! Define the 1st derivatives of the partial angular velocities of the current node (body M(RNodes(J))) in the inertia frame:
+      ! Define the 1st derivatives of the partial angular velocities of the nodes and the tip in the inertia frame:
 
    ! NOTE: These are currently unused by the code, therefore, they need not
    !       be calculated.  Thus, they are currently commented out.  If it
    !       turns out that they are ever needed (i.e., if inertias of the
-   !       blade elements are ever added, etc...) simply uncomment out these computations:
-   !      RtHSdat%PAngVelEM(K,J,          :,1,:) = RtHSdat%PAngVelEH(:,1,:)
-   !      RtHSdat%PAngVelEM(K,J,DOF_BF(K,1),1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEH, PAngVelEM(K,J,DOF_BF(K,1),0,:) )
-   !      RtHSdat%PAngVelEM(K,J,DOF_BF(K,2),1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEH, PAngVelEM(K,J,DOF_BF(K,2),0,:) )
-   !      RtHSdat%PAngVelEM(K,J,DOF_BE(K,1),1,:) = CROSS_PRODUCT(   RtHSdat%AngVelEH, PAngVelEM(K,J,DOF_BE(K,1),0,:) )
-
-
-      END DO !J = 1,p%BldNodes ! Loop through the blade nodes / elements
+   !       blade elements are ever added, etc...) simply uncomment out these
+   !       computations (TmpNodeVec is a REAL(ReKi) array of size (p%TipNode,3)):
+   !   DO I = 1,p%NDOF
+   !      DO L = 1,3
+   !         RtHSdat%PAngVelEM(:,L,1,I,K) = RtHSdat%PAngVelEH(I,1,L)
+   !      END DO
+   !   END DO
+   !   CALL CrossProdNodes( RtHSdat%AngVelEH, RtHSdat%PAngVelEM(:,:,0,DOF_BF(K,1),K), TmpNodeVec );  RtHSdat%PAngVelEM(:,:,1,DOF_BF(K,1),K) = TmpNodeVec
+   !   CALL CrossProdNodes( RtHSdat%AngVelEH, RtHSdat%PAngVelEM(:,:,0,DOF_BF(K,2),K), TmpNodeVec );  RtHSdat%PAngVelEM(:,:,1,DOF_BF(K,2),K) = TmpNodeVec
+   !   CALL CrossProdNodes( RtHSdat%AngVelEH, RtHSdat%PAngVelEM(:,:,0,DOF_BE(K,1),K), TmpNodeVec );  RtHSdat%PAngVelEM(:,:,1,DOF_BE(K,1),K) = TmpNodeVec
 
    END DO !K = 1,p%NumBl
 
@@ -6995,7 +7106,7 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    REAL(ReKi)                   :: LinAccEVt (3)                                   ! "Portion of the linear acceleration of the selected point on the rotor-furl axis (point V) in the inertia frame (body E for earth) associated with everything but the QD2T()'s"
    REAL(ReKi)                   :: LinAccEWt (3)                                   ! "Portion of the linear acceleration of the selected point on the  tail-furl axis (point W) in the inertia frame (body E for earth) associated with everything but the QD2T()'s"
    REAL(ReKi)                   :: LinVelEK  (3)                                   ! "Linear velocity of tail fin center-of-pressure (point K) in the inertia frame"
-   REAL(ReKi)                   :: LinVelHS  (3)                                   ! "Relative linear velocity of the current point on the current blade (point S) in the hub frame (body H)"
+   REAL(ReKi)                   :: LinVelHS  (0:p%TipNode,3)                       ! "Relative linear velocity of the points on the current blade (points S) in the hub frame (body H)"
    REAL(ReKi)                   :: LinVelXO  (3)                                   ! "Relative linear velocity of the tower-top / base plate (point O) in the platform (body X)"
    REAL(ReKi)                   :: LinVelXT  (3)                                   ! "Relative linear velocity of the current point on the tower (point T) in the platform (body X)"
 
@@ -7004,7 +7115,7 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    REAL(ReKi)                   :: EwAXrWK   (3)                                   ! = AngVelEA X rWK
    REAL(ReKi)                   :: EwHXrPQ   (3)                                   ! = AngVelEH X rPQ
    REAL(ReKi)                   :: EwHXrQC   (3)                                   ! = AngVelEH X rQC
-   REAL(ReKi)                   :: EwHXrQS   (3)                                   ! = AngVelEH X rQS of the current blade point S.
+   REAL(ReKi)                   :: EwHXrQS   (0:p%TipNode,3)                       ! = AngVelEH X rQS of the points S on the current blade.
    REAL(ReKi)                   :: EwNXrOU   (3)                                   ! = AngVelEN X rOU
    REAL(ReKi)                   :: EwNXrOV   (3)                                   ! = AngVelEN X rOV
    REAL(ReKi)                   :: EwNXrOW   (3)                                   ! = AngVelEN X rOW
@@ -7021,9 +7132,21 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
    REAL(ReKi)                   :: TmpVec3   (3)                                   ! A temporary vector used in various computations.
    REAL(ReKi)                   :: TmpVec4   (3)                                   ! A temporary vector used in various computations.
 
+      ! Blade quantities stored node by node (node index first) so that the loops over the nodes vectorize:
+   REAL(R8Ki)                   :: rQS       (0:p%TipNode,3)                       ! Position vectors from the apex of rotation (point Q) to the points on the current blade (points S)
+   REAL(R8Ki)                   :: AxRedQ    (0:p%TipNode)                         ! Axial-reduction term of the partial linear velocity of a blade DOF at the nodes
+   REAL(R8Ki)                   :: AxRedQD   (0:p%TipNode)                         ! Axial-reduction term of the 1st derivative of the partial linear velocity of a blade DOF at the nodes
+   REAL(ReKi)                   :: LinVelES  (0:p%TipNode,3)                       ! Linear velocities of the points on the current blade in the inertia frame
+   REAL(ReKi)                   :: LinAccESt (0:p%TipNode,3)                       ! Portion of the linear accelerations of the points on the current blade associated with everything but the QD2T()'s
+   REAL(ReKi)                   :: TmpNodeVec0(0:p%TipNode,3)                      ! Temporary vectors at the nodes used in various computations.
+   REAL(ReKi)                   :: TmpNodeVec1(0:p%TipNode,3)                      ! Temporary vectors at the nodes used in various computations.
+   REAL(ReKi)                   :: TmpNodeVec2(0:p%TipNode,3)                      ! Temporary vectors at the nodes used in various computations.
+
+   INTEGER(IntKi)               :: D                                               ! Counter for the derivatives of the partial velocities
    INTEGER(IntKi)               :: I                                               ! Loops through some or all of the DOFs
    INTEGER(IntKi)               :: J                                               ! Counter for elements
    INTEGER(IntKi)               :: K                                               ! Counter for blades
+   INTEGER(IntKi)               :: L                                               ! Counter for vector components
 
 
       ! Initializations:
@@ -7258,73 +7381,87 @@ SUBROUTINE CalculateLinearVelPAcc( p, x, CoordSys, RtHSdat )
 
    DO K = 1,p%NumBl ! Loop through all blades
 
-      DO J = 0,p%TipNode ! Loop through the blade nodes / elements
-
       ! Define the partial linear velocities (and their 1st derivatives) of the
-      !   current node (point S(RNodes(J))) in the inertia frame.  Also define
-      !   the overall linear velocity of the current node in the inertia frame.
-      !   Also, define the portion of the linear acceleration of the current node
+      !   nodes (points S(RNodes(J))) in the inertia frame.  Also define
+      !   the overall linear velocities of the nodes in the inertia frame.
+      !   Also, define the portion of the linear accelerations of the nodes
       !   in the inertia frame associated with everything but the QD2T()'s:
+      ! NOTE: PLinVelES(J,:,D,I,K) = the Dth-derivative of the partial linear velocity of DOF I for point S(RNodes(J)) of blade K
+      !       in body E. The nodes J are stored contiguously, so each of the array statements below is a single loop over the nodes
+      !       of blade K (0 to p%TipNode).
+
+      rQS = TRANSPOSE( RtHSdat%rQS(:,K,:) )
+      CALL CrossProdNodesR8( RtHSdat%AngVelEH, rQS, EwHXrQS )
+
+      DO I = 1,p%NDOF
+         DO D = 0,1
+            DO L = 1,3
+               RtHSdat%PLinVelES(:,L,D,I,K) = RtHSdat%PLinVelEQ(I,D,L)
+            END DO
+         END DO
+      END DO
+
+         ! DOF_BF(K,1):
+      AxRedQ  = p%AxRedBld(K,1,1,:)*x%QT ( DOF_BF(K,1) ) + p%AxRedBld(K,1,2,:)*x%QT ( DOF_BF(K,2) ) + p%AxRedBld(K,1,3,:)*x%QT ( DOF_BE(K,1) )
+      AxRedQD = p%AxRedBld(K,1,1,:)*x%QDT( DOF_BF(K,1) ) + p%AxRedBld(K,1,2,:)*x%QDT( DOF_BF(K,2) ) + p%AxRedBld(K,1,3,:)*x%QDT( DOF_BE(K,1) )
+      DO L = 1,3
+         RtHSdat%PLinVelES(:,L,0,DOF_BF(K,1),K) = p%TwistedSF(K,1,1,:,0)*CoordSys%j1(K,L) + p%TwistedSF(K,2,1,:,0)*CoordSys%j2(K,L) - AxRedQ*CoordSys%j3(K,L)
+      END DO
+      CALL CrossProdNodes( RtHSdat%AngVelEH, RtHSdat%PLinVelES(:,:,0,DOF_BF(K,1),K), TmpNodeVec1 )
+      DO L = 1,3
+         RtHSdat%PLinVelES(:,L,1,DOF_BF(K,1),K) = TmpNodeVec1(:,L) - AxRedQD*CoordSys%j3(K,L)
+      END DO
+
+         ! DOF_BE(K,1):
+      AxRedQ  = p%AxRedBld(K,3,3,:)*x%QT ( DOF_BE(K,1) ) + p%AxRedBld(K,2,3,:)*x%QT ( DOF_BF(K,2) ) + p%AxRedBld(K,1,3,:)*x%QT ( DOF_BF(K,1) )
+      AxRedQD = p%AxRedBld(K,3,3,:)*x%QDT( DOF_BE(K,1) ) + p%AxRedBld(K,2,3,:)*x%QDT( DOF_BF(K,2) ) + p%AxRedBld(K,1,3,:)*x%QDT( DOF_BF(K,1) )
+      DO L = 1,3
+         RtHSdat%PLinVelES(:,L,0,DOF_BE(K,1),K) = p%TwistedSF(K,1,3,:,0)*CoordSys%j1(K,L) + p%TwistedSF(K,2,3,:,0)*CoordSys%j2(K,L) - AxRedQ*CoordSys%j3(K,L)
+      END DO
+      CALL CrossProdNodes( RtHSdat%AngVelEH, RtHSdat%PLinVelES(:,:,0,DOF_BE(K,1),K), TmpNodeVec1 )
+      DO L = 1,3
+         RtHSdat%PLinVelES(:,L,1,DOF_BE(K,1),K) = TmpNodeVec1(:,L) - AxRedQD*CoordSys%j3(K,L)
+      END DO
+
+         ! DOF_BF(K,2):
+      AxRedQ  = p%AxRedBld(K,2,2,:)*x%QT ( DOF_BF(K,2) ) + p%AxRedBld(K,1,2,:)*x%QT ( DOF_BF(K,1) ) + p%AxRedBld(K,2,3,:)*x%QT ( DOF_BE(K,1) )
+      AxRedQD = p%AxRedBld(K,2,2,:)*x%QDT( DOF_BF(K,2) ) + p%AxRedBld(K,1,2,:)*x%QDT( DOF_BF(K,1) ) + p%AxRedBld(K,2,3,:)*x%QDT( DOF_BE(K,1) )
+      DO L = 1,3
+         RtHSdat%PLinVelES(:,L,0,DOF_BF(K,2),K) = p%TwistedSF(K,1,2,:,0)*CoordSys%j1(K,L) + p%TwistedSF(K,2,2,:,0)*CoordSys%j2(K,L) - AxRedQ*CoordSys%j3(K,L)
+      END DO
+      CALL CrossProdNodes( RtHSdat%AngVelEH, RtHSdat%PLinVelES(:,:,0,DOF_BF(K,2),K), TmpNodeVec1 )
+      DO L = 1,3
+         RtHSdat%PLinVelES(:,L,1,DOF_BF(K,2),K) = TmpNodeVec1(:,L) - AxRedQD*CoordSys%j3(K,L)
+      END DO
+
+      LinVelHS  = x%QDT( DOF_BF(K,1) )*RtHSdat%PLinVelES(:,:,0,DOF_BF(K,1),K) &
+                + x%QDT( DOF_BE(K,1) )*RtHSdat%PLinVelES(:,:,0,DOF_BE(K,1),K) &
+                + x%QDT( DOF_BF(K,2) )*RtHSdat%PLinVelES(:,:,0,DOF_BF(K,2),K)
+      LinAccESt = x%QDT( DOF_BF(K,1) )*RtHSdat%PLinVelES(:,:,1,DOF_BF(K,1),K) &
+                + x%QDT( DOF_BE(K,1) )*RtHSdat%PLinVelES(:,:,1,DOF_BE(K,1),K) &
+                + x%QDT( DOF_BF(K,2) )*RtHSdat%PLinVelES(:,:,1,DOF_BF(K,2),K)
+
+      DO L = 1,3
+         LinVelES(:,L) = LinVelHS(:,L) + RtHSdat%LinVelEZ(L)
+      END DO
+
+      TmpNodeVec2 = EwHXrQS + LinVelHS
+      DO I = 1,p%NPH   ! Loop through all DOFs associated with the angular motion of the hub (body H)
+
+         CALL CrossProdNodesR8( RtHSdat%PAngVelEH(p%PH(I),0,:), rQS,         TmpNodeVec0 )
+         CALL CrossProdNodes(   RtHSdat%PAngVelEH(p%PH(I),0,:), TmpNodeVec2, TmpNodeVec1 )
+         RtHSdat%PLinVelES(:,:,0,p%PH(I),K) = RtHSdat%PLinVelES(:,:,0,p%PH(I),K) + TmpNodeVec0
+         RtHSdat%PLinVelES(:,:,1,p%PH(I),K) = RtHSdat%PLinVelES(:,:,1,p%PH(I),K) + TmpNodeVec1
+         CALL CrossProdNodesR8( RtHSdat%PAngVelEH(p%PH(I),1,:), rQS,         TmpNodeVec1 )
+         RtHSdat%PLinVelES(:,:,1,p%PH(I),K) = RtHSdat%PLinVelES(:,:,1,p%PH(I),K) + TmpNodeVec1
+
+         LinVelES  = LinVelES   + x%QDT(p%PH(I))*RtHSdat%PLinVelES(:,:,0,p%PH(I),K)
+         LinAccESt = LinAccESt  + x%QDT(p%PH(I))*RtHSdat%PLinVelES(:,:,1,p%PH(I),K)
 
-         EwHXrQS = CROSS_PRODUCT(  RtHSdat%AngVelEH, RtHSdat%rQS(:,K,J) )
-
-         RtHSdat%PLinVelES(K,J,          :,:,:) = RtHSdat%PLinVelEQ(:,:,:)
-         RtHSdat%PLinVelES(K,J,DOF_BF(K,1),0,:) = p%TwistedSF(K,1,1,J,0)                          *CoordSys%j1(K,:) &  !bjj: this line can be optimized
-                                                + p%TwistedSF(K,2,1,J,0)                          *CoordSys%j2(K,:) &
-                                                - (   p%AxRedBld(K,1,1,J)*x%QT ( DOF_BF(K,1) ) &
-                                                    + p%AxRedBld(K,1,2,J)*x%QT ( DOF_BF(K,2) ) &
-                                                    + p%AxRedBld(K,1,3,J)*x%QT ( DOF_BE(K,1) )   )*CoordSys%j3(K,:)
-         RtHSdat%PLinVelES(K,J,DOF_BE(K,1),0,:) = p%TwistedSF(K,1,3,J,0)                          *CoordSys%j1(K,:) &
-                                                + p%TwistedSF(K,2,3,J,0)                          *CoordSys%j2(K,:) &
-                                                - (   p%AxRedBld(K,3,3,J)*x%QT ( DOF_BE(K,1) ) &
-                                                    + p%AxRedBld(K,2,3,J)*x%QT ( DOF_BF(K,2) ) &
-                                                    + p%AxRedBld(K,1,3,J)*x%QT ( DOF_BF(K,1) )   )*CoordSys%j3(K,:)
-         RtHSdat%PLinVelES(K,J,DOF_BF(K,2),0,:) = p%TwistedSF(K,1,2,J,0)                          *CoordSys%j1(K,:) &
-                                                + p%TwistedSF(K,2,2,J,0)                          *CoordSys%j2(K,:) &
-                                                - (   p%AxRedBld(K,2,2,J)*x%QT ( DOF_BF(K,2) ) &
-                                                    + p%AxRedBld(K,1,2,J)*x%QT ( DOF_BF(K,1) ) &
-                                                    + p%AxRedBld(K,2,3,J)*x%QT ( DOF_BE(K,1) )   )*CoordSys%j3(K,:)
-
-         TmpVec1 = CROSS_PRODUCT( RtHSdat%AngVelEH, RtHSdat%PLinVelES(K,J,DOF_BF(K,1),0,:) )
-         TmpVec2 = CROSS_PRODUCT( RtHSdat%AngVelEH, RtHSdat%PLinVelES(K,J,DOF_BE(K,1),0,:) )
-         TmpVec3 = CROSS_PRODUCT( RtHSdat%AngVelEH, RtHSdat%PLinVelES(K,J,DOF_BF(K,2),0,:) )
-
-         RtHSdat%PLinVelES(K,J,DOF_BF(K,1),1,:) = TmpVec1 &
-                                                - (   p%AxRedBld(K,1,1,J)*x%QDT( DOF_BF(K,1) ) &
-                                                    + p%AxRedBld(K,1,2,J)*x%QDT( DOF_BF(K,2) ) &
-                                                    + p%AxRedBld(K,1,3,J)*x%QDT( DOF_BE(K,1) )   )*CoordSys%j3(K,:)
-         RtHSdat%PLinVelES(K,J,DOF_BE(K,1),1,:) = TmpVec2 &
-                                                - (   p%AxRedBld(K,3,3,J)*x%QDT( DOF_BE(K,1) ) &
-                                                    + p%AxRedBld(K,2,3,J)*x%QDT( DOF_BF(K,2) ) &
-                                                    + p%AxRedBld(K,1,3,J)*x%QDT( DOF_BF(K,1) )   )*CoordSys%j3(K,:)
-         RtHSdat%PLinVelES(K,J,DOF_BF(K,2),1,:) = TmpVec3 &
-                                                - (   p%AxRedBld(K,2,2,J)*x%QDT( DOF_BF(K,2) ) &
-                                                    + p%AxRedBld(K,1,2,J)*x%QDT( DOF_BF(K,1) ) &
-                                                    + p%AxRedBld(K,2,3,J)*x%QDT( DOF_BE(K,1) )   )*CoordSys%j3(K,:)
-
-         LinVelHS                 = x%QDT( DOF_BF(K,1) )*RtHSdat%PLinVelES(K,J,DOF_BF(K,1),0,:) &
-                                  + x%QDT( DOF_BE(K,1) )*RtHSdat%PLinVelES(K,J,DOF_BE(K,1),0,:) &
-                                  + x%QDT( DOF_BF(K,2) )*RtHSdat%PLinVelES(K,J,DOF_BF(K,2),0,:)
-         RtHSdat%LinAccESt(:,K,J) = x%QDT( DOF_BF(K,1) )*RtHSdat%PLinVelES(K,J,DOF_BF(K,1),1,:) &
-                                  + x%QDT( DOF_BE(K,1) )*RtHSdat%PLinVelES(K,J,DOF_BE(K,1),1,:) &
-                                  + x%QDT( DOF_BF(K,2) )*RtHSdat%PLinVelES(K,J,DOF_BF(K,2),1,:)
-
-         RtHSdat%LinVelES(:,J,K)  = LinVelHS + RtHSdat%LinVelEZ
-         DO I = 1,p%NPH   ! Loop through all DOFs associated with the angular motion of the hub (body H)
-
-            TmpVec0 = CROSS_PRODUCT(   RtHSdat%PAngVelEH(p%PH(I),0,:), RtHSdat%rQS(:,K,J)            )  !bjj: this line can be optimized
-            TmpVec1 = CROSS_PRODUCT(   RtHSdat%PAngVelEH(p%PH(I),0,:),     EwHXrQS        + LinVelHS )  !bjj: this line can be optimized
-            TmpVec2 = CROSS_PRODUCT(   RtHSdat%PAngVelEH(p%PH(I),1,:), RtHSdat%rQS(:,K,J)            )  !bjj: this line can be optimized
-
-            RtHSdat%PLinVelES(K,J,p%PH(I),0,:) = RtHSdat%PLinVelES(K,J,p%PH(I),0,:) + TmpVec0            !bjj: this line can be optimized
-            RtHSdat%PLinVelES(K,J,p%PH(I),1,:) = RtHSdat%PLinVelES(K,J,p%PH(I),1,:) + TmpVec1 + TmpVec2  !bjj: this line can be optimized
-
-            RtHSdat%LinVelES(:,J,K)          = RtHSdat%LinVelES(:,J,K)   + x%QDT(p%PH(I))*RtHSdat%PLinVelES(K,J,p%PH(I),0,:)  !bjj: this line can be optimized
-            RtHSdat%LinAccESt(:,K,J)         = RtHSdat%LinAccESt(:,K,J)  + x%QDT(p%PH(I))*RtHSdat%PLinVelES(K,J,p%PH(I),1,:)  !bjj: this line can be optimized
-
-         END DO ! I - all DOFs associated with the angular motion of the hub (body H)
-
-      END DO !J = 0,p%TipNodes ! Loop through the blade nodes / elements
+      END DO ! I - all DOFs associated with the angular motion of the hub (body H)
+
+      RtHSdat%LinVelES (:,:,K) = TRANSPOSE( LinVelES  )
+      RtHSdat%LinAccESt(:,K,:) = TRANSPOSE( LinAccESt )
       
       
    !JASON: USE TipNode HERE INSTEAD OF BldNodes IF YOU ALLOCATE AND DEFINE n1, n2, n3, m1, m2, AND m3 TO USE TipNode.  THIS WILL REQUIRE THAT THE AERODYNAMIC AND STRUCTURAL TWISTS, AeroTwst() AND ThetaS(), BE KNOWN AT THE TIP!!!
@@ -7479,6 +7616,8 @@ SUBROUTINE CalculateForcesMoments( p, x, CoordSys, u, RtHSdat )
    REAL(ReKi)                   :: TmpVec3   (3)                                   ! A temporary vector used in various computations.
    REAL(ReKi)                   :: TmpVec4   (3)                                   ! A temporary vector used in various computations.
    REAL(ReKi)                   :: TmpVec5   (3)                                   ! A temporary vector used in various computations.
+   REAL(R8Ki)                   :: rS0S      (p%BldNodes,3)                        ! Position vectors from the blade root (point S(0)) to the blade elements of the current blade, stored node by node
+   REAL(ReKi)                   :: PFrcSB    (p%BldNodes,3)                        ! Partial forces of the blade elements of the current blade for the current DOF, stored node by node
       
 !REAL(ReKi)                   :: rSAerCen  (3)                                   ! Position vector from a blade analysis node (point S) on the current blade to the aerodynamic center associated with the element.
    REAL(ReKi), PARAMETER        :: FKAero   (3) = 0.0                              ! The tail fin aerodynamic force acting at point K, the center-of-pressure of the tail fin. (bjj: should be an input)
@@ -7488,6 +7627,7 @@ SUBROUTINE CalculateForcesMoments( p, x, CoordSys, u, RtHSdat )
    INTEGER(IntKi)               :: I                                               ! Loops through some or all of the DOFs
    INTEGER(IntKi)               :: J                                               ! Counter for elements
    INTEGER(IntKi)               :: K                                               ! Counter for blades
+   INTEGER(IntKi)               :: L                                               ! Counter for vector components
    INTEGER(IntKi)               :: NodeNum                                         ! Node number for blade element (on a single mesh)
       
 !.....................................
@@ -7556,31 +7696,30 @@ DO K = 1,p%NumBl ! Loop through all blades
 
       RtHSdat%PFrcS0B(:,K,:) = 0.0 ! Initialize these partial
       RtHSdat%PMomH0B(:,K,:) = 0.0 ! forces and moments to zero
+
+      rS0S = TRANSPOSE( RtHSdat%rS0S(:,K,1:p%BldNodes) )
+
       DO I = 1,p%DOFs%NPSE(K)  ! Loop through all active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
 
-         TmpVec1 = -p%TipMass(K)*RtHSdat%PLinVelES(K,p%TipNode,p%DOFs%PSE(K,I),0,:)                            ! The portion of PFrcS0B associated with the tip brake
+         TmpVec1 = -p%TipMass(K)*RtHSdat%PLinVelES(p%TipNode,:,0,p%DOFs%PSE(K,I),K)                            ! The portion of PFrcS0B associated with the tip brake
 
          RtHSdat%PFrcS0B(:,K,p%DOFs%PSE(K,I)) = TmpVec1
          RtHSdat%PMomH0B(:,K,p%DOFs%PSE(K,I)) = CROSS_PRODUCT( RtHSdat%rS0S(:,K,p%TipNode), TmpVec1 )          ! The portion of PMomH0B associated with the tip brake
 
-      ENDDO             ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K  
-   
-   
-      DO J = 1,p%BldNodes ! Loop through the blade nodes / elements
-
       ! Integrate to find the partial forces and moments (including those associated
-      !   with the QD2T()'s and those that are not) at the blade root (point S(0)):
+      !   with the QD2T()'s and those that are not) at the blade root (point S(0)).
+      !   The sums over the blade nodes / elements are done a vector component at a time (the nodes are contiguous):
 
-         DO I = 1,p%DOFs%NPSE(K)  ! Loop through all active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
-
-            TmpVec1 = -p%BElmntMass(J,K)*RtHSdat%PLinVelES(K,J,p%DOFs%PSE(K,I),0,:)   ! The portion of PFrcS0B associated with blade element J
-
-            RtHSdat%PFrcS0B(:,K,p%DOFs%PSE(K,I)) = RtHSdat%PFrcS0B(:,K,p%DOFs%PSE(K,I)) + TmpVec1
-            RtHSdat%PMomH0B(:,K,p%DOFs%PSE(K,I)) = RtHSdat%PMomH0B(:,K,p%DOFs%PSE(K,I)) + &
-                                                    CROSS_PRODUCT( RtHSdat%rS0S(:,K,J), TmpVec1 )                   ! The portion of PMomH0B associated with blade element J
+         DO L = 1,3
+            PFrcSB(:,L) = -p%BElmntMass(:,K)*RtHSdat%PLinVelES(1:p%BldNodes,L,0,p%DOFs%PSE(K,I),K)          ! The portion of PFrcS0B associated with blade element J
+            RtHSdat%PFrcS0B(L,K,p%DOFs%PSE(K,I)) = RtHSdat%PFrcS0B(L,K,p%DOFs%PSE(K,I)) + SUM( PFrcSB(:,L) )
+         END DO
+                                                                                                              ! The portion of PMomH0B associated with blade element J
+         RtHSdat%PMomH0B(1,K,p%DOFs%PSE(K,I)) = RtHSdat%PMomH0B(1,K,p%DOFs%PSE(K,I)) + SUM( rS0S(:,2)*PFrcSB(:,3) - rS0S(:,3)*PFrcSB(:,2) )
+         RtHSdat%PMomH0B(2,K,p%DOFs%PSE(K,I)) = RtHSdat%PMomH0B(2,K,p%DOFs%PSE(K,I)) + SUM( rS0S(:,3)*PFrcSB(:,1) - rS0S(:,1)*PFrcSB(:,3) )
+         RtHSdat%PMomH0B(3,K,p%DOFs%PSE(K,I)) = RtHSdat%PMomH0B(3,K,p%DOFs%PSE(K,I)) + SUM( rS0S(:,1)*PFrcSB(:,2) - rS0S(:,2)*PFrcSB(:,1) )
 
-         ENDDO             ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
-      END DO
+      ENDDO             ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of blade K
       
       
    END DO     
@@ -8095,6 +8234,10 @@ DO K = 1,p%NumBl ! Loop through all blades
 END SUBROUTINE CalculateForcesMoments
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This routine is used to populate the AugMat matrix for RtHS (CalcContStateDeriv)
+!! Only the entries of the enabled DOFs are assembled (the loops run over p%DOFs%SrtPS, PSBE, and PTTE); the other entries are
+!! not used. Only the blade-blade and tower-tower blocks of the mass matrix start from the constants computed in Coeff
+!! (p%BldMassConst and p%TwrMassConst); all other blocks, the couplings of the blade and tower DOFs with the other DOFs, and the
+!! forcing vector are still assembled from the partial loads on every call.
 SUBROUTINE FillAugMat( p, x, CoordSys, u, HSSBrTrq, RtHSdat, AugMat )
 !..................................................................................................................................
 
@@ -8111,6 +8254,10 @@ SUBROUTINE FillAugMat( p, x, CoordSys, u, HSSBrTrq, RtHSdat, AugMat )
    REAL(ReKi)                   :: TmpVec    (3)                                   ! A temporary vector used in various computations.
    REAL(ReKi)                   :: TmpVec1   (3)                                   ! A temporary vector used in various computations.
    REAL(ReKi)                   :: TmpVec3   (3)                                   ! A temporary vector used in various computations.
+   REAL(ReKi)                   :: FrcSBt    (p%BldNodes,3)                        ! Portion of the forces of the blade elements of the current blade associated with everything but the QD2T()'s, stored node by node
+   REAL(ReKi)                   :: MomSB     (p%BldNodes,3)                        ! External moments applied to the blade elements of the current blade, stored node by node
+   REAL(R8Ki)                   :: AxRedQB   (p%TipNode,3)                         ! Axial-reduction terms (along j3) of the partial linear velocities of the blade DOFs of the current blade at the nodes and tip
+   REAL(R8Ki)                   :: AxRedQT   (p%TTopNode,4)                        ! Axial-reduction terms (along a2) of the partial linear velocities of the tower DOFs at the tower nodes and tower top
    REAL(ReKi)                   :: GBoxTrq                                         ! Gearbox torque on the LSS side in N-m (calculated from inputs and parameters).
    REAL(ReKi)                   :: GBoxEffFac2                                     ! A second gearbox efficiency factor = ( 1 / GBoxEff^SgnPrvLSTQ - 1 )
 
@@ -8118,6 +8265,8 @@ SUBROUTINE FillAugMat( p, x, CoordSys, u, HSSBrTrq, RtHSdat, AugMat )
    INTEGER(IntKi)               :: J                                               ! Counter for elements
    INTEGER(IntKi)               :: K                                               ! Counter for blades
    INTEGER(IntKi)               :: L                                               ! Generic index
+   INTEGER(IntKi)               :: BldMode   (3)                                   ! Index of the blade DOF p%DOFs%PSBE(K,I) in p%BldMassConst (1=BF1, 2=BF2, 3=BE1)
+   INTEGER(IntKi)               :: TwrMode   (4)                                   ! Index of the tower DOF p%DOFs%PTTE(I) in p%TwrMassConst (1=TFA1, 2=TSS1, 3=TFA2, 4=TSS2)
 
    
       ! Initialize the matrix:
@@ -8128,58 +8277,57 @@ SUBROUTINE FillAugMat( p, x, CoordSys, u, HSSBrTrq, RtHSdat, AugMat )
    DO K = 1,p%NumBl ! Loop through all blades
    
 
-      ! Initialize the portions of the mass matrix on and below the diagonal associated with purely blade DOFs (these portions can't
-      !   be calculated using partial loads) using the tip mass effects. 
+      ! Find the portions of the mass matrix on and below the diagonal associated with purely blade DOFs (these portions can't
+      !   be calculated using partial loads) by adding the integrals of the (configuration-dependent) axial-reduction terms of the
+      !   partial linear velocities of the tip mass and blade elements to the configuration-independent portions from Coeff():
       ! Also, initialize the portions of the forcing vector associated with purely blade DOFs (these portions can't be calculated 
       !   using partial loads) using the tip mass effects:
       ! NOTE: The vector subscript array, PSBE(), used in the following loops must be sorted from smallest to largest DOF index in 
       !       order for the loops to work to enter values only on and below the diagonal of AugMat():
 
+      AxRedQB(:,1) = p%AxRedBld(K,1,1,1:p%TipNode)*x%QT(DOF_BF(K,1)) + p%AxRedBld(K,1,2,1:p%TipNode)*x%QT(DOF_BF(K,2)) + p%AxRedBld(K,1,3,1:p%TipNode)*x%QT(DOF_BE(K,1))
+      AxRedQB(:,2) = p%AxRedBld(K,2,2,1:p%TipNode)*x%QT(DOF_BF(K,2)) + p%AxRedBld(K,1,2,1:p%TipNode)*x%QT(DOF_BF(K,1)) + p%AxRedBld(K,2,3,1:p%TipNode)*x%QT(DOF_BE(K,1))
+      AxRedQB(:,3) = p%AxRedBld(K,3,3,1:p%TipNode)*x%QT(DOF_BE(K,1)) + p%AxRedBld(K,2,3,1:p%TipNode)*x%QT(DOF_BF(K,2)) + p%AxRedBld(K,1,3,1:p%TipNode)*x%QT(DOF_BF(K,1))
+
+      DO I = 1,p%DOFs%NPSBE(K)    ! Loop through all active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
+         IF     ( p%DOFs%PSBE(K,I) == DOF_BF(K,1) )  THEN
+            BldMode(I) = 1
+         ELSEIF ( p%DOFs%PSBE(K,I) == DOF_BF(K,2) )  THEN
+            BldMode(I) = 2
+         ELSE
+            BldMode(I) = 3
+         ENDIF
+      ENDDO                ! I - All active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
    
-      DO L = 1,p%DOFs%NPSBE(K)    ! Loop through all active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the tip of blade K (point S(p%BldFlexL))
+      DO L = 1,p%DOFs%NPSBE(K)    ! Loop through all active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
          DO I = L,p%DOFs%NPSBE(K) ! Loop through all active (enabled) blade DOFs greater than or equal to L
-            AugMat(p%DOFs%PSBE(K,I),p%DOFs%PSBE(K,L)) = p%TipMass(K)*&
-                                        DOT_PRODUCT( RtHSdat%PLinVelES(K, p%TipNode, p%DOFs%PSBE(K,I),0,:), &   ! [C(q,t)]B
-                                                     RtHSdat%PLinVelES(K, p%TipNode, p%DOFs%PSBE(K,L),0,:)    )
+            AugMat(p%DOFs%PSBE(K,I),p%DOFs%PSBE(K,L)) = p%BldMassConst(K,BldMode(I),BldMode(L))                              &   ! [C(q,t)]B
+                                        + p%TipMass(K)*AxRedQB(p%TipNode,BldMode(I))*AxRedQB(p%TipNode,BldMode(L))           &
+                                        + SUM( p%BElmntMass(:,K)*AxRedQB(1:p%BldNodes,BldMode(I))*AxRedQB(1:p%BldNodes,BldMode(L)) )
          ENDDO             ! I - All active (enabled) blade DOFs greater than or equal to L
-      ENDDO                ! L - All active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the tip of blade K (point S(p%BldFlexL))
+      ENDDO                ! L - All active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
 
       TmpVec1 = RtHSdat%FSTipDrag(:,K) - p%TipMass(K)*( p%Gravity*CoordSys%z2 + RtHSdat%LinAccESt(:,K,p%TipNode) ) ! The portion of FrcS0Bt associated with the tip brake
       DO I = 1,p%DOFs%NPSBE(K)    ! Loop through all active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the tip of blade K (point S(p%BldFlexL))
-            AugMat(p%DOFs%PSBE(K,I), p%NAug) = DOT_PRODUCT( RtHSdat%PLinVelES(K,p%TipNode,p%DOFs%PSBE(K,I),0,:), &   ! {-f(qd,q,t)}B + {-f(qd,q,t)}GravB + {-f(qd,q,t)}AeroB
+            AugMat(p%DOFs%PSBE(K,I), p%NAug) = DOT_PRODUCT( RtHSdat%PLinVelES(p%TipNode,:,0,p%DOFs%PSBE(K,I),K), &   ! {-f(qd,q,t)}B + {-f(qd,q,t)}GravB + {-f(qd,q,t)}AeroB
                                                               TmpVec1                               ) ! NOTE: TmpVec1 is still the portion of FrcS0Bt associated with the tip brake
       ENDDO                ! I - All active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the tip of blade K (point S(p%BldFlexL))
    
       
 
-      DO J = 1,p%BldNodes ! Loop through the blade nodes / elements
-
+      ! Integrate to find the portions of the forcing vector associated with purely blade DOFs (these portions can't be calculated
+      !   using partial loads).  The integrals are sums over the blade nodes / elements J, which are contiguous in PLinVelES and
+      !   PAngVelEM:
 
-      ! Integrate to find the portions of the mass matrix on and below the diagonal associated with purely blade DOFs (these portions
-      !   can't be calculated using partial loads).  Also, integrate to find the portions of the forcing vector associated with
-      !    purely blade DOFs (these portions can't be calculated using partial loads):
-      ! NOTE: The vector subscript array, PSBE(), used in the following loops must
-      !       be sorted from smallest to largest DOF index in order for the loops
-      !       to work to enter values only on and below the diagonal of AugMat():
-  
-         DO L = 1,p%DOFs%NPSBE(K)    ! Loop through all active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
-            DO I = L,p%DOFs%NPSBE(K) ! Loop through all active (enabled) blade DOFs greater than or equal to L
-               AugMat(p%DOFs%PSBE(K,I),p%DOFs%PSBE(K,L)) = AugMat(p%DOFs%PSBE(K,I),p%DOFs%PSBE(K,L)) + p%BElmntMass(J,K)*&
-                                             DOT_PRODUCT( RtHSdat%PLinVelES(K,J,p%DOFs%PSBE(K,I),0,:), &           ! [C(q,t)]B
-                                                          RtHSdat%PLinVelES(K,J,p%DOFs%PSBE(K,L),0,:)   )
-            ENDDO             ! I - All active (enabled) blade DOFs greater than or equal to L
-         ENDDO                ! L - All active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
-      
-         TmpVec1 = RtHSdat%FSAero(:,K,J)*p%DRNodes(J) - p%BElmntMass(J,K)*( p%Gravity*CoordSys%z2 + RtHSdat%LinAccESt(:,K,J) ) ! The portion of FrcS0Bt associated with blade element J
-         TmpVec3 = RtHSdat%MMAero(:,K,J)*p%DRNodes(J)                                               ! The total external moment applied to blade element J
-         DO I = 1,p%DOFs%NPSBE(K)    ! Loop through all active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
-               AugMat(p%DOFs%PSBE(K,I), p%NAug) = AugMat(p%DOFs%PSBE(K,I),     p%NAug)                      & ! {-f(qd,q,t)}B + {-f(qd,q,t)}GravB + {-f(qd,q,t)}AeroB
-                                           + DOT_PRODUCT( RtHSdat%PLinVelES(K,J,p%DOFs%PSBE(K,I),0,:), TmpVec1 ) & ! NOTE: TmpVec1 is still the portion of FrcS0Bt associated with blade element J
-                                           + DOT_PRODUCT( RtHSdat%PAngVelEM(K,J,p%DOFs%PSBE(K,I),0,:), TmpVec3 )   !       and TmpVec3 is still the total external moment applied to blade element J
-         ENDDO                ! I - All active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
-
-
-      ENDDO ! J - Blade nodes / elements      
+      DO L = 1,3
+         FrcSBt(:,L) = RtHSdat%FSAero(L,K,1:p%BldNodes)*p%DRNodes - p%BElmntMass(:,K)*( p%Gravity*CoordSys%z2(L) + RtHSdat%LinAccESt(L,K,1:p%BldNodes) ) ! The portion of FrcS0Bt associated with blade element J
+         MomSB (:,L) = RtHSdat%MMAero(L,K,1:p%BldNodes)*p%DRNodes                                                                                   ! The total external moment applied to blade element J
+      END DO
+      DO I = 1,p%DOFs%NPSBE(K)    ! Loop through all active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
+            AugMat(p%DOFs%PSBE(K,I), p%NAug) = AugMat(p%DOFs%PSBE(K,I),     p%NAug)                                     & ! {-f(qd,q,t)}B + {-f(qd,q,t)}GravB + {-f(qd,q,t)}AeroB
+                                        + SUM( RtHSdat%PLinVelES(1:p%BldNodes,:,0,p%DOFs%PSBE(K,I),K)*FrcSBt ) &
+                                        + SUM( RtHSdat%PAngVelEM(1:p%BldNodes,:,0,p%DOFs%PSBE(K,I),K)*MomSB  )
+      ENDDO                ! I - All active (enabled) blade DOFs that contribute to the QD2T-related linear accelerations of the blade
       
       
       
@@ -8226,7 +8374,9 @@ SUBROUTINE FillAugMat( p, x, CoordSys, u, HSSBrTrq, RtHSdat, AugMat )
    
       ! Initialize the portions of the mass matrix on and below the diagonal
       !   associated with purely tower DOFs (these portions can't be calculated
-      !   using partial loads) using the yaw bearing mass effects.
+      !   using partial loads) using the yaw bearing and tower element mass effects:
+      !   the configuration-independent portions from Coeff() plus the integrals of
+      !   the (configuration-dependent) axial-reduction terms.
       !   Also, initialize the portions of the forcing vector associated with
       !   purely blade DOFs (these portions can't be calculated using partial
       !   loads) using the yaw bearing mass effects:
@@ -8234,12 +8384,30 @@ SUBROUTINE FillAugMat( p, x, CoordSys, u, HSSBrTrq, RtHSdat, AugMat )
       !       be sorted from smallest to largest DOF index in order for the loops
       !       to work to enter values only on and below the diagonal of AugMat():
 
-   DO L = 1,p%DOFs%NPTTE    ! Loop through all active (enabled) tower DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing (point O)
+   AxRedQT(:,1) = p%AxRedTFA(1,1,1:p%TTopNode)*x%QT(DOF_TFA1) + p%AxRedTFA(1,2,1:p%TTopNode)*x%QT(DOF_TFA2)
+   AxRedQT(:,2) = p%AxRedTSS(1,1,1:p%TTopNode)*x%QT(DOF_TSS1) + p%AxRedTSS(1,2,1:p%TTopNode)*x%QT(DOF_TSS2)
+   AxRedQT(:,3) = p%AxRedTFA(2,2,1:p%TTopNode)*x%QT(DOF_TFA2) + p%AxRedTFA(1,2,1:p%TTopNode)*x%QT(DOF_TFA1)
+   AxRedQT(:,4) = p%AxRedTSS(2,2,1:p%TTopNode)*x%QT(DOF_TSS2) + p%AxRedTSS(1,2,1:p%TTopNode)*x%QT(DOF_TSS1)
+
+   DO I = 1,p%DOFs%NPTTE    ! Loop through all active (enabled) tower DOFs that contribute to the QD2T-related linear accelerations of the tower
+      IF     ( p%DOFs%PTTE(I) == DOF_TFA1 )  THEN
+         TwrMode(I) = 1
+      ELSEIF ( p%DOFs%PTTE(I) == DOF_TSS1 )  THEN
+         TwrMode(I) = 2
+      ELSEIF ( p%DOFs%PTTE(I) == DOF_TFA2 )  THEN
+         TwrMode(I) = 3
+      ELSE
+         TwrMode(I) = 4
+      ENDIF
+   ENDDO                    ! I - All active (enabled) tower DOFs that contribute to the QD2T-related linear accelerations of the tower
+
+   DO L = 1,p%DOFs%NPTTE    ! Loop through all active (enabled) tower DOFs that contribute to the QD2T-related linear accelerations of the tower
       DO I = L,p%DOFs%NPTTE ! Loop through all active (enabled) tower DOFs greater than or equal to L
-         AugMat(p%DOFs%PTTE(I),p%DOFs%PTTE(L)) = p%YawBrMass*DOT_PRODUCT( RtHSdat%PLinVelEO(p%DOFs%PTTE(I),0,:), &     ! [C(q,t)]T of YawBrMass
-                                                      RtHSdat%PLinVelEO(p%DOFs%PTTE(L),0,:)    )
+         AugMat(p%DOFs%PTTE(I),p%DOFs%PTTE(L)) = p%TwrMassConst(TwrMode(I),TwrMode(L))                                           &   ! [C(q,t)]T of YawBrMass and the tower elements
+                                               + p%YawBrMass*AxRedQT(p%TTopNode,TwrMode(I))*AxRedQT(p%TTopNode,TwrMode(L))       &
+                                               + SUM( p%TElmntMass*AxRedQT(1:p%TwrNodes,TwrMode(I))*AxRedQT(1:p%TwrNodes,TwrMode(L)) )
       ENDDO          ! I - All active (enabled) tower DOFs greater than or equal to L
-   ENDDO             ! L - All active (enabled) tower DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing (point O)
+   ENDDO             ! L - All active (enabled) tower DOFs that contribute to the QD2T-related linear accelerations of the tower
 
    TmpVec1 = -p%YawBrMass*( p%Gravity*CoordSys%z2 + RtHSdat%LinAccEOt ) ! The portion of FrcT0Trbt associated with the YawBrMass
    DO I = 1,p%DOFs%NPTTE    ! Loop through all active (enabled) tower DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing (point O)
@@ -8254,18 +8422,16 @@ SUBROUTINE FillAugMat( p, x, CoordSys, u, HSSBrTrq, RtHSdat, AugMat )
    DO J = 1,p%TwrNodes
 
    !..................................................................................................................................
-   ! Integrate to find the portions of the mass matrix on and below the diagonal associated with purely tower DOFs (these portions
-   !   can't be calculated using partial loads).  Also, integrate to find the portions of the forcing vector associated with purely
-   !   tower DOFs (these portions can't be calculated using partial loads).
+   ! Integrate to find the hydrodynamic portions of the mass matrix on and below the diagonal associated with purely tower DOFs
+   !   (these portions can't be calculated using partial loads).  Also, integrate to find the portions of the forcing vector associated
+   !   with purely tower DOFs (these portions can't be calculated using partial loads).
    ! NOTE: The vector subscript array, PTTE(), used in the following loops must be sorted from smallest to largest DOF index in order
    !   for the loops to work to enter values only on and below the diagonal of AugMat():
    !..................................................................................................................................
 
       DO L = 1,p%DOFs%NPTTE    ! Loop through all active (enabled) tower DOFs that contribute to the QD2T-related linear accelerations of the tower
          DO I = L,p%DOFs%NPTTE ! Loop through all active (enabled) tower DOFs greater than or equal to L
-            AugMat(p%DOFs%PTTE(I),p%DOFs%PTTE(L)) = AugMat(p%DOFs%PTTE(I),p%DOFs%PTTE(L))  &
-                                                  + p%TElmntMass(J)   *DOT_PRODUCT( RtHSdat%PLinVelET(J,p%DOFs%PTTE(I),0,:),  &
-                                                                              RtHSdat%PLinVelET(J,p%DOFs%PTTE(L),0,:) ) &   ! [C(q,t)]T + [C(q,t)]HydroT
+            AugMat(p%DOFs%PTTE(I),p%DOFs%PTTE(L)) = AugMat(p%DOFs%PTTE(I),p%DOFs%PTTE(L))  &                                 ! [C(q,t)]HydroT
                                                   - p%DHNodes(J)*DOT_PRODUCT( RtHSdat%PLinVelET(J,p%DOFs%PTTE(I),0,:),  &
                                                                               RtHSdat%PFTHydro (:,J,p%DOFs%PTTE(L)  ) ) &
                                                   - p%DHNodes(J)*DOT_PRODUCT( RtHSdat%PAngVelEF(J,p%DOFs%PTTE(I),0,:),  &
@@ -8517,6 +8683,164 @@ SUBROUTINE FillAugMat( p, x, CoordSys, u, HSSBrTrq, RtHSdat, AugMat )
    
 END SUBROUTINE FillAugMat
 !----------------------------------------------------------------------------------------------------------------------------------
+!> This routine solves the equations of motion in m%AugMat for the accelerations of the active DOFs, which are returned in
+!! m%SolnVec (in the order of p%DOFs%SrtPS).
+!! If p%MMTol = 0, the mass matrix is factored (LU) at every call. If p%MMTol > 0, the mass matrix factored at an earlier call in
+!! this time step (m%MM_Factor; Cholesky, since it is symmetric positive definite unless there is gearbox friction) is reused: the
+!! solution is corrected with the residual of the current equations until the norm of the residual is less than p%MMTol times
+!! the norm of the forcing vector, and the mass matrix is refactored only if that doesn't happen within MMMaxCorr corrections.
+!! KnownDOF is used by FixHSSBrTq, which replaces the row and column of one DOF (index KnownDOF of p%DOFs%SrtPS) with those of
+!! the identity matrix; the reused factorization of the full mass matrix then gives the solution through the Schur complement
+!! and is not replaced.
+SUBROUTINE SolveAugMat( p, m, ErrStat, ErrMsg, KnownDOF )
+!..................................................................................................................................
+
+   TYPE(ED_ParameterType),       INTENT(IN   )  :: p           !< Parameters
+   TYPE(ED_MiscVarType),         INTENT(INOUT)  :: m           !< Misc variables (AugMat on input; SolnVec on output)
+   INTEGER(IntKi),               INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+   CHARACTER(*),                 INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+   INTEGER(IntKi), OPTIONAL,     INTENT(IN   )  :: KnownDOF    !< Index (in p%DOFs%SrtPS) of the DOF whose acceleration is known
+
+      ! Local variables
+   REAL(R8Ki)                                   :: RhsNorm     ! Norm of the forcing vector
+   INTEGER(IntKi)                               :: NActvDOF    ! Number of active DOFs (size of the equations)
+   INTEGER(IntKi)                               :: Iter        ! Counts the residual corrections
+   INTEGER(IntKi)                               :: ErrStat2    ! The error status code
+   CHARACTER(ErrMsgLen)                         :: ErrMsg2     ! The error message, if an error occurred
+   CHARACTER(*), PARAMETER                      :: RoutineName = 'SolveAugMat'
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   NActvDOF = p%DOFs%NActvDOF
+   IF ( NActvDOF < 1 ) RETURN
+
+   m%AugMat_factor = m%AugMat( p%DOFs%SrtPS( 1:NActvDOF ), p%DOFs%SrtPSNAUG(1:NActvDOF) )
+   m%SolnVec       = m%AugMat( p%DOFs%SrtPS( 1:NActvDOF ), p%DOFs%SrtPSNAUG(1+NActvDOF) )
+
+      ! The linearization perturbations (m%IgnoreMod) need the exact solution of each set of equations:
+   IF ( p%MMTol > 0.0_ReKi .AND. .NOT. m%IgnoreMod ) THEN
+
+      m%MM_NumSolve = m%MM_NumSolve + 1
+      m%MM_Rhs      = m%SolnVec
+      RhsNorm       = SQRT( DOT_PRODUCT( m%MM_Rhs, m%MM_Rhs ) )
+
+      IF ( m%MM_FactorType /= MMFactor_None ) THEN
+
+         IF ( PRESENT(KnownDOF) ) THEN
+               ! column KnownDOF of the inverse of the reused mass matrix (for the Schur complement in ApplyFactor):
+            m%MM_KnownCol           = 0.0_R8Ki
+            m%MM_KnownCol(KnownDOF) = 1.0_R8Ki
+            CALL SolveWithFactor( m%MM_KnownCol )
+               IF ( ErrStat >= AbortErrLev ) RETURN
+         END IF
+
+         CALL ApplyFactor( m%SolnVec )
+            IF ( ErrStat >= AbortErrLev ) RETURN
+
+         DO Iter = 0,MMMaxCorr
+            m%MM_Resid = m%MM_Rhs - MATMUL( m%AugMat_factor, m%SolnVec )
+            IF ( SQRT( DOT_PRODUCT( m%MM_Resid, m%MM_Resid ) ) <= p%MMTol*RhsNorm ) RETURN
+            IF ( Iter == MMMaxCorr ) EXIT
+
+            CALL ApplyFactor( m%MM_Resid )
+               IF ( ErrStat >= AbortErrLev ) RETURN
+            m%SolnVec = m%SolnVec + m%MM_Resid
+         END DO
+
+            ! the corrections didn't converge, so the equations are solved with a new factorization below:
+         m%SolnVec = m%MM_Rhs
+
+      END IF
+
+      IF ( .NOT. PRESENT(KnownDOF) ) THEN
+            ! factor the current mass matrix and keep it for the rest of this time step:
+         m%MM_Factor = m%AugMat_factor
+         CALL FactorMassMatrix()
+            IF ( ErrStat >= AbortErrLev ) RETURN
+         CALL SolveWithFactor( m%SolnVec )
+         RETURN
+      END IF
+
+   END IF
+
+      ! factor the current equations without keeping the factorization:
+   CALL LAPACK_getrf( M=NActvDOF, N=NActvDOF, A=m%AugMat_factor, IPIV=m%AugMat_pivot, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+   CALL LAPACK_getrs( TRANS='N', N=NActvDOF, A=m%AugMat_factor, IPIV=m%AugMat_pivot, B=m%SolnVec, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+
+CONTAINS
+   !...............................................................................................................................
+   SUBROUTINE FactorMassMatrix()
+   ! This subroutine factors m%MM_Factor in place: Cholesky if the mass matrix is symmetric (no gearbox friction) and positive
+   ! definite, LU otherwise.
+   !...............................................................................................................................
+      INTEGER                                   :: Info        ! LAPACK error code
+
+      m%MM_FactorType = MMFactor_None
+      m%MM_NumFactor  = m%MM_NumFactor + 1
+
+      IF ( EqualRealNos( m%RtHS%GBoxEffFac, 1.0_ReKi ) ) THEN
+         CALL dpotrf( 'L', NActvDOF, m%MM_Factor, NActvDOF, Info )
+         IF ( Info == 0 ) THEN
+            m%MM_FactorType = MMFactor_Chol
+            RETURN
+         ELSEIF ( Info < 0 ) THEN
+            CALL SetErrStat( ErrID_Fatal, 'Illegal value in argument '//TRIM(Num2LStr(-Info))//' of dpotrf.', ErrStat, ErrMsg, RoutineName )
+            RETURN
+         END IF
+         m%MM_Factor = m%AugMat_factor  ! not positive definite; dpotrf may have overwritten part of it
+      END IF
+
+      CALL LAPACK_getrf( M=NActvDOF, N=NActvDOF, A=m%MM_Factor, IPIV=m%MM_Pivot, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      m%MM_FactorType = MMFactor_LU
+
+   END SUBROUTINE FactorMassMatrix
+   !...............................................................................................................................
+   SUBROUTINE SolveWithFactor( b )
+   ! This subroutine overwrites b with the solution of MM_Factor x = b.
+   !...............................................................................................................................
+      REAL(R8Ki),                 INTENT(INOUT) :: b(:)        ! right-hand side on input; solution on output
+      INTEGER                                   :: Info        ! LAPACK error code
+
+      IF ( m%MM_FactorType == MMFactor_Chol ) THEN
+         CALL dpotrs( 'L', NActvDOF, 1, m%MM_Factor, NActvDOF, b, NActvDOF, Info )
+         IF ( Info /= 0 ) CALL SetErrStat( ErrID_Fatal, 'Illegal value in argument '//TRIM(Num2LStr(-Info))//' of dpotrs.', ErrStat, ErrMsg, RoutineName )
+      ELSE
+         CALL LAPACK_getrs( TRANS='N', N=NActvDOF, A=m%MM_Factor, IPIV=m%MM_Pivot, B=b, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      END IF
+
+   END SUBROUTINE SolveWithFactor
+   !...............................................................................................................................
+   SUBROUTINE ApplyFactor( b )
+   ! This subroutine overwrites b with the (approximate) solution of the current equations using the reused factorization.
+   ! For FixHSSBrTq's equations, [Caa 0; 0 I]{Qa; Qb} = {b_a; b_b}, with the inverse C^-1 of the full mass matrix:
+   !    Qa = y_a - (C^-1)_ab * y_b / (C^-1)_bb, where y = C^-1 {b_a; 0}, and Qb = b_b.
+   !...............................................................................................................................
+      REAL(R8Ki),                 INTENT(INOUT) :: b(:)        ! right-hand side on input; solution on output
+      REAL(R8Ki)                                :: bKnown      ! the known acceleration
+
+      IF ( PRESENT(KnownDOF) ) THEN
+         bKnown      = b(KnownDOF)
+         b(KnownDOF) = 0.0_R8Ki
+         CALL SolveWithFactor( b )
+         b           = b - m%MM_KnownCol*( b(KnownDOF)/m%MM_KnownCol(KnownDOF) )
+         b(KnownDOF) = bKnown
+      ELSE
+         CALL SolveWithFactor( b )
+      END IF
+
+   END SUBROUTINE ApplyFactor
+   !...............................................................................................................................
+END SUBROUTINE SolveAugMat
+!----------------------------------------------------------------------------------------------------------------------------------
 !> This routine allocates the arrays and meshes stored in the ED_OutputType data structure (y), based on the parameters (p). 
 !! Inputs (u) are included only so that output meshes can be siblings of the inputs.
 !! The routine assumes that the arrays/meshes are not currently allocated (It will produce a fatal error otherwise.)
@@ -9498,14 +9822,7 @@ SUBROUTINE ED_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
       CHARACTER(*),                 INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
 
       ! local variables
-         
-      TYPE(ED_ContinuousStateType)                 :: xdot        ! time derivatives of continuous states      
-      TYPE(ED_ContinuousStateType)                 :: k1          ! RK4 constant; see above
-      TYPE(ED_ContinuousStateType)                 :: k2          ! RK4 constant; see above 
-      TYPE(ED_ContinuousStateType)                 :: k3          ! RK4 constant; see above 
-      TYPE(ED_ContinuousStateType)                 :: k4          ! RK4 constant; see above 
-      TYPE(ED_ContinuousStateType)                 :: x_tmp       ! Holds temporary modification to x
-      TYPE(ED_InputType)                           :: u_interp    ! interpolated value of inputs 
+      ! (xdot, the RK4 constants k1-k4, x_tmp, and u_interp are scratch variables in m, allocated in ED_Init)
 
       INTEGER(IntKi)                               :: ErrStat2    ! local error status
       CHARACTER(ErrMsgLen)                         :: ErrMsg2     ! local error message (ErrMsg)
@@ -9516,25 +9833,8 @@ SUBROUTINE ED_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
       ErrStat = ErrID_None
       ErrMsg  = "" 
 
-      CALL ED_CopyContState( x, k1, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-      CALL ED_CopyContState( x, k2, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-      CALL ED_CopyContState( x, k3, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-      CALL ED_CopyContState( x, k4,    MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-      CALL ED_CopyContState( x, x_tmp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-         IF ( ErrStat >= AbortErrLev ) RETURN
-
-
-      CALL ED_CopyInput( u(1), u_interp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-         IF ( ErrStat >= AbortErrLev ) RETURN
-                     
       ! interpolate u to find u_interp = u(t)
-      CALL ED_Input_ExtrapInterp( u, utimes, u_interp, t, ErrStat2, ErrMsg2 )
+      CALL ED_Input_ExtrapInterp( u, utimes, m%u_interp, t, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 !      HSSBrTrq_at_t = u_interp%HSSBrTrqC
@@ -9542,18 +9842,18 @@ SUBROUTINE ED_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
 !      OtherState%HSSBrTrq  = OtherState%HSSBrTrqC         
 
       ! find xdot at t
-      CALL ED_CalcContStateDeriv( t, u_interp, p, x, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL ED_CalcContStateDeriv( t, m%u_interp, p, x, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      k1%qt  = p%dt * xdot%qt
-      k1%qdt = p%dt * xdot%qdt
+      m%k1%qt  = p%dt * m%xdot%qt
+      m%k1%qdt = p%dt * m%xdot%qdt
   
-      x_tmp%qt  = x%qt  + 0.5 * k1%qt
-      x_tmp%qdt = x%qdt + 0.5 * k1%qdt
+      m%x_tmp%qt  = x%qt  + 0.5 * m%k1%qt
+      m%x_tmp%qdt = x%qdt + 0.5 * m%k1%qdt
 
       ! interpolate u to find u_interp = u(t + dt/2)
-      CALL ED_Input_ExtrapInterp(u, utimes, u_interp, t+0.5*p%dt, ErrStat2, ErrMsg2)
+      CALL ED_Input_ExtrapInterp(u, utimes, m%u_interp, t+0.5*p%dt, ErrStat2, ErrMsg2)
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 !      u_interp%HSSBrTrqC = max(0.0_ReKi, min(u_interp%HSSBrTrqC, HSSBrTrq_at_t )) ! hack for extrapolation of limits       
@@ -9561,32 +9861,32 @@ SUBROUTINE ED_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
 !      OtherState%HSSBrTrq  = OtherState%HSSBrTrqC         
 
       ! find xdot at t + dt/2
-      CALL ED_CalcContStateDeriv( t + 0.5*p%dt, u_interp, p, x_tmp, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL ED_CalcContStateDeriv( t + 0.5*p%dt, m%u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      k2%qt  = p%dt * xdot%qt
-      k2%qdt = p%dt * xdot%qdt
+      m%k2%qt  = p%dt * m%xdot%qt
+      m%k2%qdt = p%dt * m%xdot%qdt
 
-      x_tmp%qt  = x%qt  + 0.5 * k2%qt
-      x_tmp%qdt = x%qdt + 0.5 * k2%qdt
+      m%x_tmp%qt  = x%qt  + 0.5 * m%k2%qt
+      m%x_tmp%qdt = x%qdt + 0.5 * m%k2%qdt
 
       ! find xdot at t + dt/2
 !      u_interp%HSSBrTrqC = max(0.0_ReKi, min(u_interp%HSSBrTrqC, HSSBrTrq_at_t )) ! hack for extrapolation of limits       
 !      OtherState%HSSBrTrqC = SIGN( u_interp%HSSBrTrqC, x_tmp%QDT(DOF_GeAz) )         
 !      OtherState%HSSBrTrq  = OtherState%HSSBrTrqC         
-      CALL ED_CalcContStateDeriv( t + 0.5*p%dt, u_interp, p, x_tmp, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL ED_CalcContStateDeriv( t + 0.5*p%dt, m%u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      k3%qt  = p%dt * xdot%qt
-      k3%qdt = p%dt * xdot%qdt
+      m%k3%qt  = p%dt * m%xdot%qt
+      m%k3%qdt = p%dt * m%xdot%qdt
 
-      x_tmp%qt  = x%qt  + k3%qt
-      x_tmp%qdt = x%qdt + k3%qdt
+      m%x_tmp%qt  = x%qt  + m%k3%qt
+      m%x_tmp%qdt = x%qdt + m%k3%qdt
 
       ! interpolate u to find u_interp = u(t + dt)
-      CALL ED_Input_ExtrapInterp(u, utimes, u_interp, t + p%dt, ErrStat2, ErrMsg2)
+      CALL ED_Input_ExtrapInterp(u, utimes, m%u_interp, t + p%dt, ErrStat2, ErrMsg2)
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 !      u_interp%HSSBrTrqC = max(0.0_ReKi, min(u_interp%HSSBrTrqC, HSSBrTrq_at_t )) ! hack for extrapolation of limits       
@@ -9594,43 +9894,20 @@ SUBROUTINE ED_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
 !      OtherState%HSSBrTrq  = OtherState%HSSBrTrqC         
 
       ! find xdot at t + dt
-      CALL ED_CalcContStateDeriv( t + p%dt, u_interp, p, x_tmp, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL ED_CalcContStateDeriv( t + p%dt, m%u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      k4%qt  = p%dt * xdot%qt
-      k4%qdt = p%dt * xdot%qdt
+      m%k4%qt  = p%dt * m%xdot%qt
+      m%k4%qdt = p%dt * m%xdot%qdt
 
-      x%qt  = x%qt  +  ( k1%qt  + 2. * k2%qt  + 2. * k3%qt  + k4%qt  ) / 6.      
-      x%qdt = x%qdt +  ( k1%qdt + 2. * k2%qdt + 2. * k3%qdt + k4%qdt ) / 6.      
+      x%qt  = x%qt  +  ( m%k1%qt  + 2. * m%k2%qt  + 2. * m%k3%qt  + m%k4%qt  ) / 6.      
+      x%qdt = x%qdt +  ( m%k1%qdt + 2. * m%k2%qdt + 2. * m%k3%qdt + m%k4%qdt ) / 6.      
 
-         ! clean up local variables:
-      CALL ExitThisRoutine(  )
-         
 CONTAINS      
-   !...............................................................................................................................
-   SUBROUTINE ExitThisRoutine()
-   ! This subroutine destroys all the local variables
-   !...............................................................................................................................
-
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(1024)            :: ErrMsg3     ! The error message (ErrMsg)
-   
-   
-      CALL ED_DestroyContState( xdot,     ErrStat3, ErrMsg3 )
-      CALL ED_DestroyContState( k1,       ErrStat3, ErrMsg3 )
-      CALL ED_DestroyContState( k2,       ErrStat3, ErrMsg3 )
-      CALL ED_DestroyContState( k3,       ErrStat3, ErrMsg3 )
-      CALL ED_DestroyContState( k4,       ErrStat3, ErrMsg3 )
-      CALL ED_DestroyContState( x_tmp,    ErrStat3, ErrMsg3 )
-
-      CALL ED_DestroyInput(     u_interp, ErrStat3, ErrMsg3 )
-         
-   END SUBROUTINE ExitThisRoutine      
    !...............................................................................................................................
    SUBROUTINE CheckError(ErrID,Msg)
-   ! This subroutine sets the error message and level and cleans up if the error is >= AbortErrLev
+   ! This subroutine sets the error message and level
    !...............................................................................................................................
 
          ! Passed arguments
@@ -9651,13 +9928,6 @@ CONTAINS
          ErrMsg = TRIM(ErrMsg)//'ED_RK4:'//TRIM(Msg)         
          ErrStat = MAX(ErrStat,ErrID)
          
-         !.........................................................................................................................
-         ! Clean up if we're going to return on error: close files, deallocate local arrays
-         !.........................................................................................................................
-         
-         IF ( ErrStat >= AbortErrLev ) CALL ExitThisRoutine( )                  
-                  
-         
       END IF
 
    END SUBROUTINE CheckError                    
@@ -9695,8 +9965,7 @@ SUBROUTINE ED_AB4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
 
 
       ! local variables
-      TYPE(ED_InputType)                             :: u_interp
-      TYPE(ED_ContinuousStateType)                   :: xdot
+      ! (xdot and u_interp are scratch variables in m, allocated in ED_Init)
          
       INTEGER(IntKi)                                 :: ErrStat2    ! local error status
       CHARACTER(ErrMsgLen)                           :: ErrMsg2     ! local error message (ErrMsg)
@@ -9724,28 +9993,22 @@ SUBROUTINE ED_AB4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
       endif        
       
       
-      ! Allocate the input arrays
-      CALL ED_CopyInput( u(1), u_interp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-         IF ( ErrStat >= AbortErrLev ) RETURN
-
-      
       ! need xdot at t
-      CALL ED_Input_ExtrapInterp(u, utimes, u_interp, t, ErrStat2, ErrMsg2)
+      CALL ED_Input_ExtrapInterp(u, utimes, m%u_interp, t, ErrStat2, ErrMsg2)
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN                  
       IF (EqualRealNos( x%qdt(DOF_GeAz) ,0.0_R8Ki ) ) THEN
-         OtherState%HSSBrTrqC = u_interp%HSSBrTrqC
+         OtherState%HSSBrTrqC = m%u_interp%HSSBrTrqC
       ELSE
-         OtherState%HSSBrTrqC  = SIGN( u_interp%HSSBrTrqC, real(x%qdt(DOF_GeAz),ReKi) ) ! hack for HSS brake (need correct sign)
+         OtherState%HSSBrTrqC  = SIGN( m%u_interp%HSSBrTrqC, real(x%qdt(DOF_GeAz),ReKi) ) ! hack for HSS brake (need correct sign)
       END IF
       OtherState%HSSBrTrq   = OtherState%HSSBrTrqC
       OtherState%SgnPrvLSTQ = OtherState%SgnLSTQ(OtherState%IC(2))
       
-      CALL ED_CalcContStateDeriv( t, u_interp, p, x, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL ED_CalcContStateDeriv( t, m%u_interp, p, x, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          
-         CALL ED_CopyContState(xdot, OtherState%xdot ( OtherState%IC(1) ), MESH_NEWCOPY, ErrStat2, ErrMsg2)
+         CALL ED_CopyContState(m%xdot, OtherState%xdot ( OtherState%IC(1) ), MESH_UPDATECOPY, ErrStat2, ErrMsg2)
             CALL CheckError(ErrStat2,ErrMsg2)
             IF ( ErrStat >= AbortErrLev ) RETURN
 
@@ -9782,27 +10045,10 @@ SUBROUTINE ED_AB4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
       OtherState%SgnLSTQ(OtherState%IC(1)) = OtherState%SgnPrvLSTQ 
       
       
-         ! clean up local variables:
-      CALL ExitThisRoutine()
-      
 CONTAINS      
-   !...............................................................................................................................
-   SUBROUTINE ExitThisRoutine()
-   ! This subroutine destroys all the local variables
-   !...............................................................................................................................
-
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(1024)            :: ErrMsg3     ! The error message (ErrMsg)
-   
-   
-      CALL ED_DestroyInput(     u_interp, ErrStat3, ErrMsg3 )
-      CALL ED_DestroyContState( xdot,     ErrStat2, ErrMsg3 )
-      
-   END SUBROUTINE ExitThisRoutine    
    !...............................................................................................................................
    SUBROUTINE CheckError(ErrID,Msg)
-   ! This subroutine sets the error message and level and cleans up if the error is >= AbortErrLev
+   ! This subroutine sets the error message and level
    !...............................................................................................................................
 
          ! Passed arguments
@@ -9823,12 +10069,6 @@ CONTAINS
          ErrMsg = TRIM(ErrMsg)//'ED_AB4:'//TRIM(Msg)
          ErrStat = MAX(ErrStat, ErrID)
 
-         !.........................................................................................................................
-         ! Clean up if we're going to return on error: close files, deallocate local arrays
-         !.........................................................................................................................
-         
-         IF ( ErrStat >= AbortErrLev ) CALL ExitThisRoutine( )                  
-         
       END IF
 
    END SUBROUTINE CheckError            
@@ -9869,10 +10109,8 @@ SUBROUTINE ED_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
       CHARACTER(*),                   INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
 
       ! local variables
-
-      TYPE(ED_InputType)                             :: u_interp    ! Inputs at t
-      TYPE(ED_ContinuousStateType)                   :: x_pred      ! Continuous states at t
-      TYPE(ED_ContinuousStateType)                   :: xdot_pred   ! Derivative of continuous states at t
+      ! (the predicted states, their derivatives, and the interpolated inputs are the scratch variables m%x_pred, m%xdot, and
+      !  m%u_interp, allocated in ED_Init)
 
       INTEGER(IntKi)                                 :: ErrStat2    ! local error status
       CHARACTER(ErrMsgLen)                           :: ErrMsg2     ! local error message (ErrMsg)
@@ -9885,11 +10123,11 @@ SUBROUTINE ED_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
       
          ! predict:
 
-      CALL ED_CopyContState(x, x_pred, MESH_NEWCOPY, ErrStat2, ErrMsg2)
+      CALL ED_CopyContState(x, m%x_pred, MESH_UPDATECOPY, ErrStat2, ErrMsg2)
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      CALL ED_AB4( t, n, u, utimes, p, x_pred, xd, z, OtherState, m, ErrStat2, ErrMsg2 )
+      CALL ED_AB4( t, n, u, utimes, p, m%x_pred, xd, z, OtherState, m, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
@@ -9898,33 +10136,28 @@ SUBROUTINE ED_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
          
             ! correct:
          
-            ! allocate the arrays in u_interp
-         CALL ED_CopyInput( u(1), u_interp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-            CALL CheckError(ErrStat2,ErrMsg2)
-            IF ( ErrStat >= AbortErrLev ) RETURN
-         
-         CALL ED_Input_ExtrapInterp(u, utimes, u_interp, t + p%dt, ErrStat2, ErrMsg2)
+         CALL ED_Input_ExtrapInterp(u, utimes, m%u_interp, t + p%dt, ErrStat2, ErrMsg2)
             CALL CheckError(ErrStat2,ErrMsg2)
             IF ( ErrStat >= AbortErrLev ) RETURN
             
-         u_interp%HSSBrTrqC = max(0.0_ReKi, min(u_interp%HSSBrTrqC, ABS( OtherState%HSSBrTrqC) )) ! hack for extrapolation of limits  (OtherState%HSSBrTrqC is HSSBrTrqC at t)     
-         IF (EqualRealNos( x_pred%qdt(DOF_GeAz) ,0.0_R8Ki ) ) THEN
-            OtherState%HSSBrTrqC = u_interp%HSSBrTrqC
+         m%u_interp%HSSBrTrqC = max(0.0_ReKi, min(m%u_interp%HSSBrTrqC, ABS( OtherState%HSSBrTrqC) )) ! hack for extrapolation of limits  (OtherState%HSSBrTrqC is HSSBrTrqC at t)     
+         IF (EqualRealNos( m%x_pred%qdt(DOF_GeAz) ,0.0_R8Ki ) ) THEN
+            OtherState%HSSBrTrqC = m%u_interp%HSSBrTrqC
          ELSE
-            OtherState%HSSBrTrqC  = SIGN( u_interp%HSSBrTrqC, real(x_pred%qdt(DOF_GeAz),ReKi) ) ! hack for HSS brake (need correct sign)
+            OtherState%HSSBrTrqC  = SIGN( m%u_interp%HSSBrTrqC, real(m%x_pred%qdt(DOF_GeAz),ReKi) ) ! hack for HSS brake (need correct sign)
          END IF
          OtherState%HSSBrTrq  = OtherState%HSSBrTrqC
 
-         CALL ED_CalcContStateDeriv(t + p%dt, u_interp, p, x_pred, xd, z, OtherState, m, xdot_pred, ErrStat2, ErrMsg2 )
+         CALL ED_CalcContStateDeriv(t + p%dt, m%u_interp, p, m%x_pred, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
             CALL CheckError(ErrStat2,ErrMsg2)
             IF ( ErrStat >= AbortErrLev ) RETURN
 
          
-         x%qt  = x%qt  + p%DT24 * ( 9. * xdot_pred%qt +  19. * OtherState%xdot(OtherState%IC(1))%qt &
+         x%qt  = x%qt  + p%DT24 * ( 9. * m%xdot%qt +  19. * OtherState%xdot(OtherState%IC(1))%qt &
                                                         - 5. * OtherState%xdot(OtherState%IC(2))%qt &
                                                         + 1. * OtherState%xdot(OtherState%IC(3))%qt )
 
-         x%qdt = x%qdt + p%DT24 * ( 9. * xdot_pred%qdt + 19. * OtherState%xdot(OtherState%IC(1))%qdt &
+         x%qdt = x%qdt + p%DT24 * ( 9. * m%xdot%qdt + 19. * OtherState%xdot(OtherState%IC(1))%qdt &
                                                        -  5. * OtherState%xdot(OtherState%IC(2))%qdt &
                                                        +  1. * OtherState%xdot(OtherState%IC(3))%qdt )
          
@@ -9939,34 +10172,16 @@ SUBROUTINE ED_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg
                                                                     
       else
 
-         x%qt  = x_pred%qt
-         x%qdt = x_pred%qdt
+         x%qt  = m%x_pred%qt
+         x%qdt = m%x_pred%qdt
 
       endif
       
       
-         ! clean up local variables:
-      CALL ExitThisRoutine()
-      
 CONTAINS      
-   !...............................................................................................................................
-   SUBROUTINE ExitThisRoutine()
-   ! This subroutine destroys all the local variables
-   !...............................................................................................................................
-
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(1024)            :: ErrMsg3     ! The error message (ErrMsg)
-   
-   
-      CALL ED_DestroyContState( xdot_pred,  ErrStat3, ErrMsg3 )
-      CALL ED_DestroyContState( x_pred,     ErrStat3, ErrMsg3 )
-      CALL ED_DestroyInput(     u_interp,   ErrStat3, ErrMsg3 )               
-      
-   END SUBROUTINE ExitThisRoutine    
    !...............................................................................................................................
    SUBROUTINE CheckError(ErrID,Msg)
-   ! This subroutine sets the error message and level and cleans up if the error is >= AbortErrLev
+   ! This subroutine sets the error message and level
    !...............................................................................................................................
 
          ! Passed arguments
@@ -9987,17 +10202,293 @@ CONTAINS
          ErrMsg = TRIM(ErrMsg)//'ED_ABM4:'//TRIM(Msg)
          ErrStat = MAX(ErrStat, ErrID)
 
-         !.........................................................................................................................
-         ! Clean up if we're going to return on error: close files, deallocate local arrays
-         !.........................................................................................................................
-         IF ( ErrStat >= AbortErrLev ) CALL ExitThisRoutine( )                  
-         
       END IF
 
    END SUBROUTINE CheckError                 
 
 END SUBROUTINE ED_ABM4
 !----------------------------------------------------------------------------------------------------------------------------------
+!> This subroutine implements the generalized-alpha method for numerically integrating the equations of motion, 
+!! M(q,t) * qdd = f(q,qd,t), where q = x%qt and qd = x%qdt. Unlike RK4, AB4, and ABM4, the method is implicit and its numerical
+!! damping of the high-frequency modes is set with RhoInf, so the time step isn't limited by the stiffest enabled DOF.
+!!
+!!   Let qdd_t (OtherState%GA_Acc) be the accelerations at t and a_t (OtherState%GA_a) the algorithmic accelerations at t.
+!!   The states at t + dt are
+!!        q_(t+dt)  = q_t  + dt * qd_t + dt^2 * ( (0.5 - beta) * a_t + beta * a_(t+dt) )
+!!        qd_(t+dt) = qd_t + dt * ( (1 - gamma) * a_t + gamma * a_(t+dt) ), with
+!!        (1 - alpha_m) * a_(t+dt) + alpha_m * a_t = (1 - alpha_f) * qdd_(t+dt) + alpha_f * qdd_t,
+!!   where qdd_(t+dt) satisfies the equations of motion at t + dt (solved with AugMat in ED_CalcContStateDeriv). The residual
+!!   R(qdd) = qdd - qdd_EOM( q(qdd), qd(qdd) ) is driven to zero with Newton iterations. The iteration matrix
+!!        J = I - beta' * dt^2 * d(qdd_EOM)/dq - gamma' * dt * d(qdd_EOM)/dqd,
+!!   with beta' = beta*(1-alpha_f)/(1-alpha_m) and gamma' = gamma*(1-alpha_f)/(1-alpha_m), is found with finite differences and
+!!   reused in later time steps until the iterations converge slowly. If the iterations do not converge, this routine returns
+!!   ErrID_Fatal and leaves the states at t. When the HSS brake is on, FixHSSBrTq is applied to the converged accelerations, as
+!!   the Adams-Bashforth-Moulton corrector does.
+!!
+!! For details, see:
+!! Chung, J. and Hulbert, G. M. "A Time Integration Algorithm for Structural Dynamics With Improved Numerical Dissipation: The 
+!!   Generalized-alpha Method." Journal of Applied Mechanics, Vol. 60, pp. 371-375, 1993.
+!! Arnold, M. and Bruls, O. "Convergence of the generalized-alpha scheme for constrained mechanical systems." Multibody System 
+!!   Dynamics, Vol. 18, pp. 185-202, 2007.
+SUBROUTINE ED_GA( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, ErrMsg )
+!..................................................................................................................................
+
+      REAL(DbKi),                   INTENT(IN   )  :: t           !< Current simulation time in seconds
+      INTEGER(IntKi),               INTENT(IN   )  :: n           !< time step number
+      TYPE(ED_InputType),           INTENT(INOUT)  :: u(:)        !< Inputs at t (out only for mesh record-keeping in ExtrapInterp routine)
+      REAL(DbKi),                   INTENT(IN   )  :: utimes(:)   !< times of input
+      TYPE(ED_ParameterType),       INTENT(IN   )  :: p           !< Parameters
+      TYPE(ED_ContinuousStateType), INTENT(INOUT)  :: x           !< Continuous states at t on input at t + dt on output
+      TYPE(ED_DiscreteStateType),   INTENT(IN   )  :: xd          !< Discrete states at t
+      TYPE(ED_ConstraintStateType), INTENT(IN   )  :: z           !< Constraint states at t (possibly a guess)
+      TYPE(ED_OtherStateType),      INTENT(INOUT)  :: OtherState  !< Other states
+      TYPE(ED_MiscVarType),         INTENT(INOUT)  :: m           !< misc/optimization variables
+      INTEGER(IntKi),               INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+      CHARACTER(*),                 INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+      ! local variables
+      ! (the states at the Newton iterates, their derivatives, and the interpolated inputs are the scratch variables m%x_tmp, 
+      !  m%xdot, and m%u_interp, allocated in ED_Init)
+
+      REAL(R8Ki)                                   :: Acc   (p%NDOF)           ! Newton iterate of the accelerations at t + dt
+      REAL(R8Ki)                                   :: a_new (p%NDOF)           ! Algorithmic accelerations at t + dt
+      REAL(R8Ki)                                   :: Acc0  (p%NDOF)           ! Accelerations from the equations of motion at the unperturbed iterate
+      REAL(R8Ki)                                   :: dAcc  (p%DOFs%NActvDOF)  ! Newton correction of the accelerations of the active DOFs
+      REAL(R8Ki)                                   :: AccNorm                  ! Norm of the accelerations of the active DOFs
+      REAL(R8Ki)                                   :: CoefAcc                  ! d(a_new)/d(Acc) = (1-alpha_f)/(1-alpha_m)
+      INTEGER(IntKi)                               :: I                        ! Loops through the active DOFs
+      INTEGER(IntKi)                               :: Iter                     ! Newton iteration number
+      INTEGER(IntKi)                               :: Attempt                  ! 1: iteration matrix from an earlier step; 2: new iteration matrix
+      LOGICAL                                      :: Converged                ! Whether the Newton iterations converged
+      LOGICAL                                      :: NewJac                   ! Whether the iteration matrix was computed in this step
+
+      INTEGER(IntKi)                               :: ErrStat2                 ! local error status
+      CHARACTER(ErrMsgLen)                         :: ErrMsg2                  ! local error message (ErrMsg)
+      
+      
+      ! Initialize ErrStat
+
+      ErrStat = ErrID_None
+      ErrMsg  = "" 
+
+         ! At the first step, find the accelerations at t from the equations of motion:
+
+      IF ( OtherState%n < 0 ) THEN
+
+         CALL ED_Input_ExtrapInterp( u, utimes, m%u_interp, t, ErrStat2, ErrMsg2 )
+            CALL CheckError(ErrStat2,ErrMsg2)
+            IF ( ErrStat >= AbortErrLev ) RETURN
+
+         CALL ED_CalcContStateDeriv( t, m%u_interp, p, x, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
+            CALL CheckError(ErrStat2,ErrMsg2)
+            IF ( ErrStat >= AbortErrLev ) RETURN
+
+         OtherState%GA_Acc = m%xdot%qdt
+         OtherState%GA_a   = m%xdot%qdt
+
+      END IF
+
+         ! interpolate u to find u_interp = u(t + dt); all of the Newton iterations use these inputs
+
+      CALL ED_Input_ExtrapInterp( u, utimes, m%u_interp, t + p%dt, ErrStat2, ErrMsg2 )
+         CALL CheckError(ErrStat2,ErrMsg2)
+         IF ( ErrStat >= AbortErrLev ) RETURN
+
+      IF (EqualRealNos( x%qdt(DOF_GeAz) ,0.0_R8Ki ) ) THEN
+         OtherState%HSSBrTrqC = m%u_interp%HSSBrTrqC
+      ELSE
+         OtherState%HSSBrTrqC = SIGN( m%u_interp%HSSBrTrqC, real(x%qdt(DOF_GeAz),ReKi) ) ! hack for HSS brake (need correct sign)
+      END IF
+      OtherState%HSSBrTrq = OtherState%HSSBrTrqC
+
+         ! Newton iterations, starting from constant accelerations:
+
+      CoefAcc   = ( 1.0_R8Ki - p%GA_AlphaF ) / ( 1.0_R8Ki - p%GA_AlphaM )
+      Converged = .FALSE.
+      NewJac    = .FALSE.
+
+      DO Attempt = 1,2
+
+         Acc = OtherState%GA_Acc
+
+         DO Iter = 1,GA_MaxIter
+
+            CALL SetIterateStates()
+
+            CALL ED_CalcContStateDeriv( t + p%dt, m%u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
+               CALL CheckError(ErrStat2,ErrMsg2)
+               IF ( ErrStat >= AbortErrLev ) RETURN
+
+            IF ( .NOT. m%GA_JacValid ) THEN
+               CALL SetIterationMatrix()
+                  IF ( ErrStat >= AbortErrLev ) RETURN
+               NewJac = .TRUE.
+            END IF
+
+            DO I = 1,p%DOFs%NActvDOF
+               dAcc(I) = m%xdot%qdt(p%DOFs%SrtPS(I)) - Acc(p%DOFs%SrtPS(I))   ! -R(Acc)
+            END DO
+
+            CALL LAPACK_getrs( TRANS='N', N=p%DOFs%NActvDOF, A=m%GA_Jac, IPIV=m%GA_Pivot, B=dAcc, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
+               CALL CheckError(ErrStat2,ErrMsg2)
+               IF ( ErrStat >= AbortErrLev ) RETURN
+
+            AccNorm = 0.0_R8Ki
+            DO I = 1,p%DOFs%NActvDOF
+               Acc(p%DOFs%SrtPS(I)) = Acc(p%DOFs%SrtPS(I)) + dAcc(I)
+               AccNorm = AccNorm + Acc(p%DOFs%SrtPS(I))**2
+            END DO
+            m%GA_NumIter = m%GA_NumIter + 1
+
+            IF ( SQRT( DOT_PRODUCT( dAcc, dAcc ) ) <= GA_Tol*MAX( SQRT( AccNorm ), 1.0_R8Ki ) ) THEN
+               Converged = .TRUE.
+               EXIT
+            END IF
+
+         END DO
+
+            ! refresh the iteration matrix at the next step if it is getting stale:
+         IF ( Iter > GA_SlowIter ) m%GA_JacValid = .FALSE.
+
+         IF ( Converged .OR. NewJac ) EXIT
+         
+      END DO
+
+      IF ( .NOT. Converged ) THEN   ! the states are left at t
+         CALL CheckError( ErrID_Fatal, 'Newton iterations did not converge in '//TRIM(Num2LStr(GA_MaxIter))// &
+                                       ' iterations at time '//TRIM(Num2LStr(t + p%dt))//' s. Reduce DT.' )
+         RETURN
+      END IF
+
+         ! Make sure the HSS brake has not reversed the direction of the HSS. With the equations of motion evaluated at the 
+         ! converged states, FixHSSBrTq replaces the generator-azimuth acceleration with the one that stops the HSS at t + dt
+         ! (if the brake torque is large enough to do so) and solves for the others with SolveAugMat's known-DOF handling:
+
+      IF ( p%DOF_Flag(DOF_GeAz) .AND. .NOT. EqualRealNos( OtherState%HSSBrTrqC, 0.0_ReKi ) ) THEN
+
+         CALL SetIterateStates()
+         CALL ED_CalcContStateDeriv( t + p%dt, m%u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
+            CALL CheckError(ErrStat2,ErrMsg2)
+            IF ( ErrStat >= AbortErrLev ) RETURN
+
+         m%QD2T = Acc   ! FixHSSBrTq overwrites m%QD2T only if it changes the brake torque
+         CALL FixHSSBrTq ( 'G', p, x, OtherState, m, ErrStat2, ErrMsg2 )
+            CALL CheckError(ErrStat2,ErrMsg2)
+            IF ( ErrStat >= AbortErrLev ) RETURN
+         Acc = m%QD2T
+
+      END IF
+
+         ! update the states and the acceleration history with the final iterate:
+
+      CALL SetIterateStates()
+
+      x%qt  = m%x_tmp%qt
+      x%qdt = m%x_tmp%qdt
+
+      OtherState%GA_Acc = Acc
+      OtherState%GA_a   = a_new
+      OtherState%n      = n
+
+      OtherState%SgnPrvLSTQ = SignLSSTrq(p, m)
+      
+CONTAINS      
+   !...............................................................................................................................
+   SUBROUTINE SetIterateStates()
+   ! This subroutine sets the algorithmic accelerations and the states (m%x_tmp) at t + dt from the acceleration iterate, Acc
+   !...............................................................................................................................
+
+      a_new = ( ( 1.0_R8Ki - p%GA_AlphaF )*Acc + p%GA_AlphaF*OtherState%GA_Acc - p%GA_AlphaM*OtherState%GA_a ) &
+              / ( 1.0_R8Ki - p%GA_AlphaM )
+
+      m%x_tmp%qt  = x%qt  + p%dt*x%qdt + p%dt**2*( ( 0.5_R8Ki - p%GA_Beta )*OtherState%GA_a + p%GA_Beta*a_new )
+      m%x_tmp%qdt = x%qdt + p%dt*( ( 1.0_R8Ki - p%GA_Gamma )*OtherState%GA_a + p%GA_Gamma*a_new )
+
+   END SUBROUTINE SetIterateStates
+   !...............................................................................................................................
+   SUBROUTINE SetIterationMatrix()
+   ! This subroutine computes the iteration matrix at the current iterate with (forward) finite differences and factors it;
+   ! on entry, m%xdot holds the derivatives at the unperturbed iterate (m%x_tmp), and these are restored on exit
+   !...............................................................................................................................
+
+      INTEGER(IntKi)             :: J              ! Loops through the active DOFs (columns)
+      REAL(R8Ki)                 :: Delta          ! Perturbation of q or qd
+      REAL(R8Ki)                 :: Coef           ! beta'*dt^2 or gamma'*dt
+      REAL(R8Ki)                 :: QSave          ! Unperturbed value of q or qd
+      REAL(R8Ki)                 :: RelPerturb     ! Relative size of the perturbations
+
+      RelPerturb = SQRT( EPSILON( 1.0_ReKi ) )   ! the equations of motion are evaluated with ReKi precision
+      Acc0 = m%xdot%qdt
+
+      DO J = 1,p%DOFs%NActvDOF
+
+            ! d(qdd_EOM)/dq:
+         QSave = m%x_tmp%qt(p%DOFs%SrtPS(J))
+         Delta = RelPerturb*MAX( ABS( QSave ), 1.0_R8Ki )
+         m%x_tmp%qt(p%DOFs%SrtPS(J)) = QSave + Delta
+         CALL ED_CalcContStateDeriv( t + p%dt, m%u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
+            CALL CheckError(ErrStat2,ErrMsg2)
+            IF ( ErrStat >= AbortErrLev ) RETURN
+         m%x_tmp%qt(p%DOFs%SrtPS(J)) = QSave
+
+         Coef = p%GA_Beta*CoefAcc*p%dt**2/Delta
+         DO I = 1,p%DOFs%NActvDOF
+            m%GA_Jac(I,J) = -Coef*( m%xdot%qdt(p%DOFs%SrtPS(I)) - Acc0(p%DOFs%SrtPS(I)) )
+         END DO
+
+            ! d(qdd_EOM)/dqd:
+         QSave = m%x_tmp%qdt(p%DOFs%SrtPS(J))
+         Delta = RelPerturb*MAX( ABS( QSave ), 1.0_R8Ki )
+         m%x_tmp%qdt(p%DOFs%SrtPS(J)) = QSave + Delta
+         CALL ED_CalcContStateDeriv( t + p%dt, m%u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
+            CALL CheckError(ErrStat2,ErrMsg2)
+            IF ( ErrStat >= AbortErrLev ) RETURN
+         m%x_tmp%qdt(p%DOFs%SrtPS(J)) = QSave
+
+         Coef = p%GA_Gamma*CoefAcc*p%dt/Delta
+         DO I = 1,p%DOFs%NActvDOF
+            m%GA_Jac(I,J) = m%GA_Jac(I,J) - Coef*( m%xdot%qdt(p%DOFs%SrtPS(I)) - Acc0(p%DOFs%SrtPS(I)) )
+         END DO
+
+         m%GA_Jac(J,J) = m%GA_Jac(J,J) + 1.0_R8Ki
+
+      END DO
+
+      m%xdot%qdt = Acc0
+
+      CALL LAPACK_getrf( M=p%DOFs%NActvDOF, N=p%DOFs%NActvDOF, A=m%GA_Jac, IPIV=m%GA_Pivot, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
+         CALL CheckError(ErrStat2,ErrMsg2)
+         IF ( ErrStat >= AbortErrLev ) RETURN
+
+      m%GA_JacValid = .TRUE.
+      m%GA_NumJac   = m%GA_NumJac + 1
+
+   END SUBROUTINE SetIterationMatrix
+   !...............................................................................................................................
+   SUBROUTINE CheckError(ErrID,Msg)
+   ! This subroutine sets the error message and level
+   !...............................................................................................................................
+
+         ! Passed arguments
+      INTEGER(IntKi), INTENT(IN) :: ErrID       ! The error identifier (ErrStat)
+      CHARACTER(*),   INTENT(IN) :: Msg         ! The error message (ErrMsg)
+
+      !............................................................................................................................
+      ! Set error status/message;
+      !............................................................................................................................
+
+      IF ( ErrID /= ErrID_None ) THEN
+
+         IF (ErrStat /= ErrID_None) ErrMsg = TRIM(ErrMsg)//NewLine
+         ErrMsg = TRIM(ErrMsg)//'ED_GA:'//TRIM(Msg)
+         ErrStat = MAX(ErrStat, ErrID)
+
+      END IF
+
+   END SUBROUTINE CheckError                 
+
+END SUBROUTINE ED_GA
+!----------------------------------------------------------------------------------------------------------------------------------
 !> This routine generates the summary file, which contains a regurgitation of  the input data and interpolated flexible body data.
 SUBROUTINE ED_PrintSum( p, OtherState, GenerateAdamsModel, ErrStat, ErrMsg )
 
@@ -10246,6 +10737,7 @@ SUBROUTINE FixHSSBrTq ( Integrator, p, x, OtherState, m, ErrStat, ErrMsg )
    REAL(ReKi)                             :: RqdQD2GeAz                           ! The required QD2T(DOF_GeAz) to cause the HSS to stop rotating.
 
    INTEGER                                :: I                                    ! Loops through all DOFs.
+   INTEGER(IntKi)                         :: KnownDOF                             ! Index of DOF_GeAz in p%DOFs%SrtPS
    INTEGER(IntKi)                         :: ErrStat2
    CHARACTER(ErrMsgLen)                   :: ErrMsg2
    CHARACTER(*), PARAMETER                :: RoutineName = 'FixHSSBrTq'
@@ -10290,6 +10782,16 @@ SUBROUTINE FixHSSBrTq ( Integrator, p, x, OtherState, m, ErrStat, ErrMsg )
                      - 37.0*OtherState%xdot(OtherState%IC(3))%qdt(DOF_GeAz) &
                      +  9.0*OtherState%xdot(OtherState%IC(4))%qdt(DOF_GeAz)   )/55.0
             
+   CASE ('G')   ! Generalized-alpha
+
+      ! Find the required QD2T(DOF_GeAz) to cause the HSS to stop rotating (RqdQD2GeAz).
+      ! This is found by solving the generalized-alpha velocity update for the algorithmic acceleration at t + dt
+      !   when QD(DOF_GeAz) at t + dt equals zero (x holds the states at t), then converting it to the acceleration.
+
+      RqdQD2GeAz = -( x%qdt(DOF_GeAz)/p%dt + ( 1.0_R8Ki - p%GA_Gamma )*OtherState%GA_a(DOF_GeAz) ) / p%GA_Gamma
+      RqdQD2GeAz = ( ( 1.0_R8Ki - p%GA_AlphaM )*RqdQD2GeAz - p%GA_AlphaF*OtherState%GA_Acc(DOF_GeAz) &
+                   + p%GA_AlphaM*OtherState%GA_a(DOF_GeAz) ) / ( 1.0_R8Ki - p%GA_AlphaF )
+
    END SELECT
 
 
@@ -10339,15 +10841,12 @@ SUBROUTINE FixHSSBrTq ( Integrator, p, x, OtherState, m, ErrStat, ErrMsg )
    !   of the solution vector, SolnVec(). These are transfered to the proper index locations of the acceleration vector QD2T()
    !   using the vector subscript array SrtPS(), after Gauss() has been called:
 
-      m%AugMat_factor = m%AugMat( p%DOFs%SrtPS( 1:p%DOFs%NActvDOF ), p%DOFs%SrtPSNAUG(1:p%DOFs%NActvDOF) )
-      m%SolnVec       = m%AugMat( p%DOFs%SrtPS( 1:p%DOFs%NActvDOF ), p%DOFs%SrtPSNAUG(1+p%DOFs%NActvDOF) )
-   
-      CALL LAPACK_getrf( M=p%DOFs%NActvDOF, N=p%DOFs%NActvDOF, A=m%AugMat_factor, IPIV=m%AugMat_pivot, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)   
-         IF ( ErrStat >= AbortErrLev ) RETURN
-      
-      CALL LAPACK_getrs( TRANS='N',N=p%DOFs%NActvDOF, A=m%AugMat_factor,IPIV=m%AugMat_pivot, B=m%SolnVec, ErrStat=ErrStat2, ErrMsg=ErrMsg2)
-   
+      KnownDOF = 1
+      DO I = 1,p%DOFs%NActvDOF
+         IF ( p%DOFs%SrtPS(I) == DOF_GeAz ) KnownDOF = I
+      ENDDO
+
+      CALL SolveAugMat( p, m, ErrStat2, ErrMsg2, KnownDOF )
          CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
          IF ( ErrStat >= AbortErrLev ) RETURN
    
@@ -10426,6 +10925,10 @@ SUBROUTINE FixHSSBrTq ( Integrator, p, x, OtherState, m, ErrStat, ErrMsg )
          OtherState%xdot ( OtherState%IC(1) )%qdt = m%QD2T        ! fix the history
 
          
+      CASE ('G')  ! Generalized-alpha
+
+      ! ED_GA updates the states and the acceleration history from the new accelerations in m%QD2T.
+
       END SELECT
       
    ENDIF
@@ -10474,6 +10977,12 @@ SUBROUTINE ED_JacobianPInput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrM
    TYPE(ED_ContinuousStateType)                      :: x_m
    TYPE(ED_InputType)                                :: u_perturb
    REAL(ReKi)                                        :: delta        ! delta change in input or state
+   REAL(ReKi), ALLOCATABLE                           :: dXdu_FD(:)   ! column of dXdu from central differences
+   REAL(ReKi)                                        :: RelDiff      ! relative difference between the analytic and finite-difference columns of dXdu
+   REAL(ReKi)                                        :: MaxRelDiff   ! largest RelDiff
+   LOGICAL, ALLOCATABLE                              :: IsAnalytic(:) ! whether each column of dXdu was computed analytically
+   LOGICAL                                           :: NeedAnalytic ! whether the analytic columns of dXdu still have to be computed
+   INTEGER(IntKi)                                    :: iMaxDiff     ! column of dXdu with the largest RelDiff
    INTEGER(IntKi)                                    :: i, j   
    
    INTEGER(IntKi)                                    :: ErrStat2
@@ -10495,6 +11004,19 @@ SUBROUTINE ED_JacobianPInput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrM
          return
       end if
       
+   NeedAnalytic = .false.
+   IF ( PRESENT( dXdu ) ) THEN
+      ! allocate dXdu if necessary (here, because the analytic columns may be computed in the dYdu loop)
+      if (.not. allocated(dXdu)) then
+         call AllocAry(dXdu, p%DOFs%NActvDOF * 2, size(p%Jac_u_indx,1)+1, 'dXdu', ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+         if (ErrStat>=AbortErrLev) then
+            call cleanup()
+            return
+         end if
+      end if
+      NeedAnalytic = p%LinJac /= LinJac_FD
+   END IF
    
 
    IF ( PRESENT( dYdu ) ) THEN
@@ -10542,6 +11064,13 @@ SUBROUTINE ED_JacobianPInput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrM
          call ED_CalcOutput( t, u_perturb, p, x, xd, z, OtherState, y_m, m, ErrStat2, ErrMsg2 ) 
             call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName) ! we shouldn't have any errors about allocating memory here so I'm not going to return-on-error until later            
          
+            ! a perturbed load changes neither the configuration nor the mass matrix, so the partial velocities and factored
+            ! mass matrix left by this evaluation are those at the operating point; use them for the analytic columns of dXdu:
+         if ( NeedAnalytic .and. p%Jac_u_indx(i,1) /= 15 .and. ErrStat < AbortErrLev ) then
+            call ED_JacobianPInput_dXdu( p, m, dXdu, IsAnalytic, ErrStat2, ErrMsg2 )
+               call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+            NeedAnalytic = .false.
+         end if
             
             ! get central difference:            
          call Compute_dY( p, y_p, y_m, delta, dYdu(:,i) )
@@ -10570,19 +11099,39 @@ SUBROUTINE ED_JacobianPInput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrM
 
       ! Calculate the partial derivative of the continuous state functions (X) with respect to the inputs (u) here:
 
-      ! allocate dXdu if necessary
-      if (.not. allocated(dXdu)) then
-         call AllocAry(dXdu, p%DOFs%NActvDOF * 2, size(p%Jac_u_indx,1)+1, 'dXdu', ErrStat2, ErrMsg2)
+      call AllocAry(dXdu_FD, p%DOFs%NActvDOF * 2, 'dXdu_FD', ErrStat2, ErrMsg2)
          call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
          if (ErrStat>=AbortErrLev) then
             call cleanup()
             return
          end if
-      end if
       
+      MaxRelDiff = 0.0_ReKi
+      iMaxDiff   = 0
+      if ( NeedAnalytic .and. p%LinJac == LinJac_Analytic ) then
+            ! dYdu wasn't requested, so there has been no evaluation at the operating configuration (and the loop below only
+            ! perturbs the blade pitch in this mode):
+         call ED_CalcContStateDeriv( t, u, p, x, xd, z, OtherState, m, x_p, ErrStat2, ErrMsg2 ) 
+            call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+            if (ErrStat>=AbortErrLev) then
+               call cleanup()
+               return
+            end if
+         call ED_JacobianPInput_dXdu( p, m, dXdu, IsAnalytic, ErrStat2, ErrMsg2 )
+            call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+         NeedAnalytic = .false.
+      end if
+      if (ErrStat>=AbortErrLev) then
+         call cleanup()
+         return
+      end if
          
       do i=1,size(p%Jac_u_indx,1)
          
+         if ( p%LinJac == LinJac_Analytic ) then
+            if ( IsAnalytic(i) ) cycle
+         end if
+         
             ! get u_op + delta u
          call ED_CopyInput( u, u_perturb, MESH_UPDATECOPY, ErrStat2, ErrMsg2 )
             call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName) ! we shouldn't have any errors about allocating memory here so I'm not going to return-on-error until later            
@@ -10612,16 +11161,53 @@ SUBROUTINE ED_JacobianPInput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrM
             return
          end if         
          
+            ! (p%LinJac == LinJac_Check without dYdu) the evaluation at a perturbed load leaves the operating-point partial
+            ! velocities and factored mass matrix:
+         if ( NeedAnalytic .and. p%Jac_u_indx(i,1) /= 15 ) then
+            call ED_JacobianPInput_dXdu( p, m, dXdu, IsAnalytic, ErrStat2, ErrMsg2 )
+               call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+               if (ErrStat>=AbortErrLev) then
+                  call cleanup()
+                  return
+               end if
+            NeedAnalytic = .false.
+         end if
+         
          do j=1,p%DOFs%NActvDOF ! Loop through all active (enabled) DOFs
-            dXdu(j, i) = x_p%QT( p%DOFs%PS(j) ) - x_m%QT( p%DOFs%PS(j) )
+            dXdu_FD(j) = x_p%QT( p%DOFs%PS(j) ) - x_m%QT( p%DOFs%PS(j) )
          end do
          do j=1,p%DOFs%NActvDOF ! Loop through all active (enabled) DOFs
-            dXdu(j+p%DOFs%NActvDOF, i) = x_p%QDT( p%DOFs%PS(j) ) - x_m%QDT( p%DOFs%PS(j) )
+            dXdu_FD(j+p%DOFs%NActvDOF) = x_p%QDT( p%DOFs%PS(j) ) - x_m%QDT( p%DOFs%PS(j) )
          end do              
-         dXdu(:,i) = dXdu(:,i) / (2*delta) 
+         dXdu_FD = dXdu_FD / (2*delta) 
+         
+         if ( p%LinJac == LinJac_FD ) then
+            dXdu(:,i) = dXdu_FD
+         elseif ( .not. IsAnalytic(i) ) then
+            dXdu(:,i) = dXdu_FD
+         else
+               ! keep the analytic column, but compare it with the finite-difference one:
+            RelDiff = MAXVAL( ABS( dXdu(:,i) - dXdu_FD ) ) / MAX( MAXVAL( ABS( dXdu_FD ) ), EPSILON( dXdu_FD ) )
+            if ( RelDiff > MaxRelDiff ) then
+               MaxRelDiff = RelDiff
+               iMaxDiff   = i
+            end if
+         end if
          
       end do
       
+      if ( iMaxDiff > 0 ) then  ! p%LinJac == LinJac_Check
+         call WrScr( ' ElastoDyn dX/du at t = '//trim(num2lstr(t))//' s: the largest relative difference between the analytic and'// &
+                     ' finite-difference columns is '//trim(num2lstr(MaxRelDiff))//' (input '//trim(num2lstr(iMaxDiff))//').' )
+         if ( MaxRelDiff > LinJac_CheckTol ) then
+            call SetErrStat( ErrID_Fatal, 'The analytic column of dX/du for input '//trim(num2lstr(iMaxDiff))//' differs from the '// &
+                             'finite-difference column by '//trim(num2lstr(MaxRelDiff))//' (relative), more than the tolerance of '// &
+                             trim(num2lstr(LinJac_CheckTol))//'.', ErrStat, ErrMsg, RoutineName )
+            call cleanup()
+            return
+         end if
+      end if
+      
       
       ! now do the extended input: sum the p%NumBl blade pitch columns
       dXdu(:,size(p%Jac_u_indx,1)+1) = dXdu(:,size(p%Jac_u_indx,1)-p%NumBl-1) ! last NumBl+2 columns are: GenTrq, YawMom, and BlPitchCom   
@@ -10661,6 +11247,139 @@ contains
    
 END SUBROUTINE ED_JacobianPInput
 !----------------------------------------------------------------------------------------------------------------------------------
+!> Routine to compute the columns of dX/du associated with the load inputs analytically (p%LinJac /= LinJac_FD).
+!! The loads enter the equations of motion only through the forcing vector: a force F applied at a point (a moment M applied to a
+!! body) adds the generalized active force PLinVel(r) . F (PAngVel(r) . M) to the equation of DOF r. The mass matrix does not
+!! depend on the loads, so d(QD2T)/du is the solution of the equations of motion with these generalized forces per unit load as
+!! the right-hand sides; d(QDT)/du is zero. The partial velocities (m%RtHS) and the factored mass matrix (m%AugMat_factor) are
+!! taken from the caller's latest evaluation, which must be at the operating point or at a load perturbation of it (with
+!! m%IgnoreMod set, so SolveAugMat factors the mass matrix exactly); this routine makes no evaluation of its own.
+!! IsAnalytic is false for the columns that are not computed here: the blade-pitch commands, which change the configuration, and
+!! the blade loads when AeroDyn v14 is used (they are applied at the aerodynamic centers).
+SUBROUTINE ED_JacobianPInput_dXdu( p, m, dXdu, IsAnalytic, ErrStat, ErrMsg )
+!..................................................................................................................................
+
+   TYPE(ED_ParameterType),               INTENT(IN   )           :: p             !< Parameters
+   TYPE(ED_MiscVarType),                 INTENT(INOUT)           :: m             !< Misc/optimization variables (partial velocities and factored mass matrix at the operating point)
+   REAL(ReKi),                           INTENT(INOUT)           :: dXdu(:,:)     !< Partial derivatives of continuous state functions (X) with 
+                                                                                  !!   respect to the inputs (u); only the analytic columns are set
+   LOGICAL, ALLOCATABLE,                 INTENT(INOUT)           :: IsAnalytic(:) !< Whether each column of dXdu was computed here
+   INTEGER(IntKi),                       INTENT(  OUT)           :: ErrStat       !< Error status of the operation
+   CHARACTER(*),                         INTENT(  OUT)           :: ErrMsg        !< Error message if ErrStat /= ErrID_None
+
+      ! local variables
+   REAL(R8Ki)                                        :: GenFrc(p%DOFs%NActvDOF) ! generalized active forces per unit input (in the order of p%DOFs%SrtPS); the accelerations on output
+   REAL(R8Ki)                                        :: LoadDir(3)   ! direction (in the inertia frame) of the perturbed load component
+   INTEGER(IntKi)                                    :: i, j, r
+   INTEGER(IntKi)                                    :: Field        ! mesh and field of the input (see ED_Init_Jacobian)
+   INTEGER(IntKi)                                    :: Node         ! node of the input
+   INTEGER(IntKi)                                    :: K            ! blade number
+   INTEGER(IntKi)                                    :: NActvDOF     ! number of active DOFs
+   
+   INTEGER(IntKi)                                    :: ErrStat2
+   CHARACTER(ErrMsgLen)                              :: ErrMsg2
+   CHARACTER(*), PARAMETER                           :: RoutineName = 'ED_JacobianPInput_dXdu'
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   NActvDOF = p%DOFs%NActvDOF
+
+   if (.not. allocated(IsAnalytic)) then
+      allocate( IsAnalytic(size(p%Jac_u_indx,1)), STAT=ErrStat2 )
+      if (ErrStat2 /= 0) then
+         call SetErrStat(ErrID_Fatal,'Error allocating IsAnalytic.',ErrStat,ErrMsg,RoutineName)
+         return
+      end if
+   end if
+   IsAnalytic = .false.
+
+   do i=1,size(p%Jac_u_indx,1)
+
+      Field = p%Jac_u_indx(i,1)
+      Node  = p%Jac_u_indx(i,3)
+
+         ! the inertia-frame direction of the global X, Y, or Z component of a load (see CalculateForcesMoments):
+      select case ( p%Jac_u_indx(i,2) )
+      case (1)
+         LoadDir =  m%CoordSys%z1
+      case (2)
+         LoadDir = -m%CoordSys%z3
+      case default
+         LoadDir =  m%CoordSys%z2
+      end select
+
+      GenFrc = 0.0_R8Ki
+
+      select case ( Field )
+      case (1:6) ! u%BladePtLoads(K)%Force (odd Field) and u%BladePtLoads(K)%Moment (even Field), at node Node of blade K
+         if ( p%UseAD14 ) cycle
+         K = (Field + 1)/2
+         if ( MOD(Field,2) == 1 ) then
+            do r = 1,NActvDOF
+               GenFrc(r) = DOT_PRODUCT( m%RtHS%PLinVelES(Node,:,0,p%DOFs%SrtPS(r),K), LoadDir )
+            end do
+         else
+            do r = 1,NActvDOF
+               GenFrc(r) = DOT_PRODUCT( m%RtHS%PAngVelEM(Node,:,0,p%DOFs%SrtPS(r),K), LoadDir )
+            end do
+         end if
+      case (7)   ! u%PlatformPtMesh%Force, applied at the platform reference point (point Z)
+         do r = 1,NActvDOF
+            GenFrc(r) = DOT_PRODUCT( m%RtHS%PLinVelEZ(p%DOFs%SrtPS(r),0,:), LoadDir )
+         end do
+      case (8)   ! u%PlatformPtMesh%Moment, applied to the platform (body X)
+         do r = 1,NActvDOF
+            GenFrc(r) = DOT_PRODUCT( m%RtHS%PAngVelEX(p%DOFs%SrtPS(r),0,:), LoadDir )
+         end do
+      case (9)   ! u%TowerPtLoads%Force, applied at tower node Node (point T)
+         do r = 1,NActvDOF
+            GenFrc(r) = DOT_PRODUCT( m%RtHS%PLinVelET(Node,p%DOFs%SrtPS(r),0,:), LoadDir )
+         end do
+      case (10)  ! u%TowerPtLoads%Moment, applied to tower element Node (body F)
+         do r = 1,NActvDOF
+            GenFrc(r) = DOT_PRODUCT( m%RtHS%PAngVelEF(Node,p%DOFs%SrtPS(r),0,:), LoadDir )
+         end do
+      case (11)  ! u%HubPtLoad%Force, applied at the teeter pin (point P)
+         do r = 1,NActvDOF
+            GenFrc(r) = DOT_PRODUCT( m%RtHS%PLinVelEP(p%DOFs%SrtPS(r),0,:), LoadDir )
+         end do
+      case (12)  ! u%HubPtLoad%Moment, applied to the hub (body H)
+         do r = 1,NActvDOF
+            GenFrc(r) = DOT_PRODUCT( m%RtHS%PAngVelEH(p%DOFs%SrtPS(r),0,:), LoadDir )
+         end do
+      case (13)  ! u%NacelleLoads%Force, applied at the yaw bearing (point O)
+         do r = 1,NActvDOF
+            GenFrc(r) = DOT_PRODUCT( m%RtHS%PLinVelEO(p%DOFs%SrtPS(r),0,:), LoadDir )
+         end do
+      case (14)  ! u%NacelleLoads%Moment, applied to the nacelle (body N)
+         do r = 1,NActvDOF
+            GenFrc(r) = DOT_PRODUCT( m%RtHS%PAngVelEN(p%DOFs%SrtPS(r),0,:), LoadDir )
+         end do
+      case (16)  ! u%YawMom, added to the forcing of DOF_Yaw
+         if ( p%DOF_Flag(DOF_Yaw) ) GenFrc( p%DOFs%Diag(DOF_Yaw) ) = 1.0_R8Ki
+      case (17)  ! u%GenTrq, which enters the forcing of DOF_GeAz as -GBoxTrq*( 1 + GBoxEffFac2 ) (see FillAugMat)
+         if ( p%DOF_Flag(DOF_GeAz) ) GenFrc( p%DOFs%Diag(DOF_GeAz) ) = -ABS(p%GBRatio)/m%RtHS%GBoxEffFac
+      case default ! u%BlPitchCom
+         cycle
+      end select
+
+      IsAnalytic(i) = .true.
+      if ( NActvDOF < 1 ) cycle
+
+      call LAPACK_getrs( TRANS='N', N=NActvDOF, A=m%AugMat_factor, IPIV=m%AugMat_pivot, B=GenFrc, ErrStat=ErrStat2, ErrMsg=ErrMsg2 )
+         call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+         if (ErrStat>=AbortErrLev) return
+
+      do j=1,NActvDOF ! Loop through all active (enabled) DOFs
+         dXdu(j,          i) = 0.0_ReKi                                 ! d(QDT)/du
+         dXdu(j+NActvDOF, i) = GenFrc( p%DOFs%Diag( p%DOFs%PS(j) ) )    ! d(QD2T)/du; SrtPS(Diag(I)) = I
+      end do
+
+   end do
+
+END SUBROUTINE ED_JacobianPInput_dXdu
+!----------------------------------------------------------------------------------------------------------------------------------
 !> Routine to compute the Jacobians of the output (Y), continuous- (X), discrete- (Xd), and constraint-state (Z) functions
 !! with respect to the continuous states (x). The partial derivatives dY/dx, dX/dx, dXd/dx, and DZ/dx are returned.
 SUBROUTINE ED_JacobianPContState( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg, dYdx, dXdx, dXddx, dZdx )
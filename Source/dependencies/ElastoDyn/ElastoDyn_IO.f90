@@ -88,6 +88,27 @@ MODULE ElastoDyn_Parameters
    INTEGER(IntKi), PARAMETER        :: Method_RK4  = 1                                 
    INTEGER(IntKi), PARAMETER        :: Method_AB4  = 2                                 
    INTEGER(IntKi), PARAMETER        :: Method_ABM4 = 3
+   INTEGER(IntKi), PARAMETER        :: Method_GA   = 4                                 ! generalized-alpha (implicit)
+
+      ! Parameters related to the generalized-alpha method (Method_GA)
+
+   INTEGER(IntKi), PARAMETER        :: GA_MaxIter  = 10                                ! Maximum number of Newton iterations per time step
+   INTEGER(IntKi), PARAMETER        :: GA_SlowIter = 4                                 ! Number of Newton iterations after which the iteration matrix is recomputed at the next step
+   REAL(R8Ki),     PARAMETER        :: GA_Tol      = 1.0E-5_R8Ki                       ! Relative tolerance on the Newton corrections of the accelerations
+
+      ! Parameters related to reusing the factored mass matrix (MMTol > 0)
+
+   INTEGER(IntKi), PARAMETER        :: MMFactor_None = 0                               ! m%MM_Factor doesn't hold a factorization
+   INTEGER(IntKi), PARAMETER        :: MMFactor_Chol = 1                               ! m%MM_Factor holds the Cholesky factor (lower triangle)
+   INTEGER(IntKi), PARAMETER        :: MMFactor_LU   = 2                               ! m%MM_Factor holds the LU factors (pivots in m%MM_Pivot)
+   INTEGER(IntKi), PARAMETER        :: MMMaxCorr     = 3                               ! Maximum number of residual corrections before the mass matrix is refactored
+
+      ! Methods for the Jacobians used in linearization (LinJac)
+
+   INTEGER(IntKi), PARAMETER        :: LinJac_FD       = 1                             ! Central finite differences
+   INTEGER(IntKi), PARAMETER        :: LinJac_Analytic = 2                             ! Analytic for the load columns of dX/du, finite differences otherwise
+   INTEGER(IntKi), PARAMETER        :: LinJac_Check    = 3                             ! Analytic, checked column-by-column against finite differences
+   REAL(ReKi),     PARAMETER        :: LinJac_CheckTol = 1.0E-2_ReKi                   ! Largest relative difference allowed by LinJac_Check (allows for the round-off of the central differences)
 
 
    INTEGER(IntKi), PARAMETER        :: PolyOrd  =  6                                    ! Order of the polynomial describing the mode shape
@@ -3367,7 +3388,7 @@ SUBROUTINE ReadPrimaryFile( InputFile, InputFileData, BldFile, FurlFile, TwrFile
    END IF
 
       ! Method - Integration method for loose coupling
-   CALL ReadVar( UnIn, InputFile, InputFileData%method, "Method", "Requested integration method for ElastoDyn {1: RK4, 2: AB4, or 3: ABM4}", ErrStat2, ErrMsg2, UnEc)
+   CALL ReadVar( UnIn, InputFile, InputFileData%method, "Method", "Requested integration method for ElastoDyn {1: RK4, 2: AB4, 3: ABM4, or 4: generalized-alpha}", ErrStat2, ErrMsg2, UnEc)
       CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
       IF ( ErrStat >= AbortErrLev ) THEN
          CALL Cleanup()
@@ -3396,6 +3417,30 @@ SUBROUTINE ReadPrimaryFile( InputFile, InputFileData, BldFile, FurlFile, TwrFile
          END IF
       END IF
 
+      ! MMTol - Relative residual tolerance for reusing the factored mass matrix across integrator stages (-):
+   CALL ReadVar( UnIn, InputFile, InputFileData%MMTol, "MMTol", "Relative residual tolerance for reusing the factored mass matrix across integrator stages (-)", ErrStat2, ErrMsg2, UnEc)
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      IF ( ErrStat >= AbortErrLev ) THEN
+         CALL Cleanup()
+         RETURN
+      END IF
+
+      ! LinJac - Method for the Jacobians in linearization (switch):
+   CALL ReadVar( UnIn, InputFile, InputFileData%LinJac, "LinJac", "Method for the Jacobians in linearization {1: finite differences, 2: analytic for the load columns of dX/du, 3: analytic, checked against finite differences} (switch)", ErrStat2, ErrMsg2, UnEc)
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      IF ( ErrStat >= AbortErrLev ) THEN
+         CALL Cleanup()
+         RETURN
+      END IF
+
+      ! RhoInf - Spectral radius at infinite frequency for the generalized-alpha method (-):
+   CALL ReadVar( UnIn, InputFile, InputFileData%RhoInf, "RhoInf", "Spectral radius at infinite frequency for the generalized-alpha method (Method = 4) {0: maximum numerical damping, 1: none} (-)", ErrStat2, ErrMsg2, UnEc)
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      IF ( ErrStat >= AbortErrLev ) THEN
+         CALL Cleanup()
+         RETURN
+      END IF
+
    !---------------------- ENVIRONMENTAL CONDITION ---------------------------------
       CALL ReadCom( UnIn, InputFile, 'Section Header: Environmental Condition', ErrStat2, ErrMsg2, UnEc )
          CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
@@ -4969,7 +5014,9 @@ SUBROUTINE ValidatePrimaryData( InputFileData, BD4Blades, ErrStat, ErrMsg )
    IF ( InputFileData%method .ne. Method_RK4) THEN
       IF ( InputFileData%method .ne. Method_AB4) THEN
          IF ( InputFileData%method .ne. Method_ABM4) THEN
-            CALL SetErrStat( ErrID_Fatal, 'Integration method must be 1 (RK4), 2 (AB4), or 3 (ABM4)',ErrStat,ErrMsg,RoutineName )
+            IF ( InputFileData%method .ne. Method_GA) THEN
+               CALL SetErrStat( ErrID_Fatal, 'Integration method must be 1 (RK4), 2 (AB4), 3 (ABM4), or 4 (generalized-alpha)',ErrStat,ErrMsg,RoutineName )
+            END IF
          END IF
       END IF
    END IF
@@ -4978,11 +5025,18 @@ SUBROUTINE ValidatePrimaryData( InputFileData, BD4Blades, ErrStat, ErrMsg )
       ! make sure GBoxEff is 100% for now
    IF ( .NOT. EqualRealNos( InputFileData%GBoxEff, 1.0_ReKi ) .and. InputFileData%method == method_rk4 ) &
       CALL SetErrStat( ErrID_Fatal, 'GBoxEff must be 1 (i.e., 100%) when using RK4.',ErrStat,ErrMsg,RoutineName)
+
+      ! Make sure the specified Jacobian method makes sense:
+   IF ( InputFileData%LinJac < LinJac_FD .OR. InputFileData%LinJac > LinJac_Check ) &
+      CALL SetErrStat( ErrID_Fatal, 'LinJac must be 1 (finite differences), 2 (analytic), or 3 (analytic, checked).',ErrStat,ErrMsg,RoutineName)
       
    
       ! Don't allow these parameters to be negative (i.e., they must be in the range (0,inf)):
    IF ( InputFileData%Gravity < 0.0_ReKi) call SetErrStat(ErrID_Fatal,'Gravity must not be negative.',ErrStat,ErrMsg,RoutineName)
    IF ( InputFileData%RotSpeed < 0.0_ReKi) call SetErrStat(ErrID_Fatal,'RotSpeed must not be negative.',ErrStat,ErrMsg,RoutineName)
+   IF ( InputFileData%MMTol < 0.0_ReKi) call SetErrStat(ErrID_Fatal,'MMTol must not be negative.',ErrStat,ErrMsg,RoutineName)
+   IF ( InputFileData%RhoInf < 0.0_ReKi .OR. InputFileData%RhoInf > 1.0_ReKi ) &
+      CALL SetErrStat(ErrID_Fatal,'RhoInf must be between 0 and 1 (inclusive).',ErrStat,ErrMsg,RoutineName)
    
    IF (.NOT. BD4Blades .and. InputFileData%TipRad < 0.0_ReKi) CALL SetErrStat(ErrID_Fatal,'TipRad must not be negative.',ErrStat,ErrMsg,RoutineName)
    IF ( InputFileData%HubRad < 0.0_ReKi) call SetErrStat(ErrID_Fatal,'HubRad must not be negative.',ErrStat,ErrMsg,RoutineName)
@@ -38,6 +38,7 @@ MODULE Conv_Radiation
    PRIVATE
    
    REAL(DbKi), PARAMETER, PRIVATE       :: OnePlusEps  = 1.0 + EPSILON(OnePlusEps)   !< The number slighty greater than unity in the precision of DbKi.
+   REAL(ReKi), PARAMETER, PRIVATE       :: RdtnBlkChkTol = 1.0E-3_ReKi                  !< Largest difference between the partitioned and direct convolutions in Conv_Rdtn_CheckBlocks, relative to the largest radiation load
 
 
    TYPE(ProgDesc), PARAMETER            :: Conv_Rdtn_ProgDesc = ProgDesc( 'Conv_Radiation', 'v1.01.00', '23-Dec-2015' )
@@ -55,52 +56,205 @@ MODULE Conv_Radiation
    PUBLIC :: Conv_Rdtn_CalcConstrStateResidual        ! Tight coupling routine for returning the constraint state residual
    PUBLIC :: Conv_Rdtn_CalcContStateDeriv             ! Tight coupling routine for computing derivatives of continuous states
    PUBLIC :: Conv_Rdtn_UpdateDiscState                ! Tight coupling routine for updating discrete states
+
+   PUBLIC :: Conv_Rdtn_CalcKrnl                       ! Routine for computing the wave radiation kernel (also used for the fitted state-space model)
          
    
 CONTAINS
 
-SUBROUTINE ShiftValuesLeft(XDHistory, NSteps)
-! This routine shifts every entry in XDHistory such that XDHistory(K+1,I) is now stored in XDHistory(K,I)
-!
-      REAL(ReKi),      INTENT(INOUT)  :: XDHistory (:,:)                        ! The time history of the 3 components of the translational velocity        (in m/s)        of the WAMIT reference and the 3 components of the rotational (angular) velocity  (in rad/s)        of the platform relative to the inertial frame
-      INTEGER(IntKi),  INTENT(IN   )  :: NSteps                                 ! Number of elements in the array
-      
-      INTEGER(IntKi)                  :: I
-!      INTEGER(IntKi)                  :: J
-      INTEGER(IntKi)                  :: K
-      
-      DO K = 0,NSteps-2
-         DO I = 1,6                 ! Loop through all DOFs
-               XDHistory(K,I) = XDHistory(K+1,I)
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine sets up the partitioned convolution used by Conv_Rdtn_CalcOutput when p%NBlkRdtn > 0: the kernel is split into
+!! partitions of NBlkRdtn radiation time steps, and the FFT of each partition (zero-padded to 2*NBlkRdtn) is stored in
+!! p%RdtnKrnlFFT.  Partition D holds the kernel values at lags D*NBlkRdtn-(NBlkRdtn-1) through D*NBlkRdtn+(NBlkRdtn-1), which
+!! are the lags between the radiation time steps of a block and those of the block D blocks earlier.
+SUBROUTINE Conv_Rdtn_InitBlocks( p, m, ErrStat, ErrMsg )
+
+      TYPE(Conv_Rdtn_ParameterType),       INTENT(INOUT)  :: p           !< Parameters (RdtnKrnl must be set)
+      TYPE(Conv_Rdtn_MiscVarType),         INTENT(INOUT)  :: m           !< Misc/optimization variables
+      INTEGER(IntKi),                      INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+      CHARACTER(*),                        INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+         ! Local variables
+      REAL(SiKi)                           :: KrnlPart(2*p%NBlkRdtn)     ! One partition of the kernel, in the time domain and then in the frequency domain
+      INTEGER(IntKi)                       :: NFFT                       ! Size of the FFTs (2*NBlkRdtn)
+      INTEGER(IntKi)                       :: D                          ! Partition number
+      INTEGER(IntKi)                       :: I                          ! Generic index
+      INTEGER(IntKi)                       :: J                          ! Generic index
+      INTEGER(IntKi)                       :: K                          ! Lag within the partition
+      TYPE(FFT_DataType)                   :: FFT_Data                   ! Data for the FFTs of size NFFT
+      INTEGER(IntKi)                       :: ErrStat2                   ! Temporary error status
+      CHARACTER(*), PARAMETER              :: RoutineName = 'Conv_Rdtn_InitBlocks'
+
+
+      ErrStat = ErrID_None
+      ErrMsg  = ""
+
+      m%TailBlock = -1
+      IF ( p%NBlkRdtn == 0 ) RETURN
+
+      NFFT = 2*p%NBlkRdtn
+
+      ALLOCATE ( p%RdtnKrnlFFT(NFFT,p%NumBlkRdtn,6,6), m%RdtnTail(0:p%NBlkRdtn-1,6), m%HistFFT(NFFT,0:p%NumBlkRdtn-1,6), &
+                 m%HistFFTBlock(0:p%NumBlkRdtn-1), STAT=ErrStat2 )
+      IF ( ErrStat2 /= 0 ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Error allocating memory for the partitioned radiation convolution.', ErrStat, ErrMsg, RoutineName )
+         RETURN
+      END IF
+      m%RdtnTail     = 0.0
+      m%HistFFT      = 0.0
+      m%HistFFTBlock = -1
+
+      CALL InitFFT ( NFFT, FFT_Data, .FALSE., ErrStat2 )
+      IF ( ErrStat2 /= ErrID_None ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Error initializing the FFTs of the radiation kernel partitions.', ErrStat, ErrMsg, RoutineName )
+         RETURN
+      END IF
+
+      DO J = 1,6                 ! Loop through all wave radiation damping forces and moments
+         DO I = 1,6              ! Loop through all platform DOFs
+            DO D = 1,p%NumBlkRdtn
+
+                  ! Place the lags D*NBlkRdtn+K at KrnlPart(K+1), wrapping the negative values of K around to the end of the
+                  !   array, so that the circular convolution with a zero-padded block gives the linear convolution:
+               KrnlPart = 0.0
+               DO K = -(p%NBlkRdtn-1),p%NBlkRdtn-1
+                  IF ( D*p%NBlkRdtn+K <= p%NStepRdtn-1 ) KrnlPart( MODULO( K, NFFT ) + 1 ) = p%RdtnKrnl(D*p%NBlkRdtn+K,J,I)
+               END DO
+
+               CALL ApplyFFT_f( KrnlPart, FFT_Data, ErrStat2 )
+               IF ( ErrStat2 /= ErrID_None ) THEN
+                  CALL SetErrStat( ErrID_Fatal, 'Error applying the FFT to a radiation kernel partition.', ErrStat, ErrMsg, RoutineName )
+                  CALL ExitFFT( FFT_Data, ErrStat2 )
+                  RETURN
+               END IF
+
+               p%RdtnKrnlFFT(:,D,J,I) = KrnlPart/NFFT   ! The FFTs aren't normalized
+            END DO
          END DO
       END DO
-      
-END SUBROUTINE ShiftValuesLeft
 
+      CALL ExitFFT( FFT_Data, ErrStat2 )
+
+END SUBROUTINE Conv_Rdtn_InitBlocks
 !----------------------------------------------------------------------------------------------------------------------------------
-!> This routine is called at the start of the simulation to perform initialization steps. 
-!! The parameters are set here and not changed during the simulation.
-!! The initial states and initial guess for the input are defined.
-SUBROUTINE Conv_Rdtn_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, InitOut, ErrStat, ErrMsg )
+!> This routine computes m%RdtnTail: the part of the convolution integral at each radiation time step of block Blk that comes from
+!! the velocities of the earlier blocks.  The FFT of the velocity history of each block is computed once and kept in m%HistFFT,
+!! so each new block costs one FFT and one inverse FFT per DOF plus the products of the spectra with the kernel partitions.  The
+!! velocities of a block can't change once the radiation time steps have moved past it, so the FFTs are only recomputed when
+!! the block number decreases (e.g., the simulation is restarted at an earlier time).  The FFT data are set up on each call, i.e.,
+!! once per block, so nothing but the parameters and misc variables is needed to continue a copied or restarted instance.
+SUBROUTINE Conv_Rdtn_CalcTail( Blk, p, xd, m, ErrStat, ErrMsg )
+
+      INTEGER(IntKi),                      INTENT(IN   )  :: Blk         !< Block number of the newest velocity in the history
+      TYPE(Conv_Rdtn_ParameterType),       INTENT(IN   )  :: p           !< Parameters
+      TYPE(Conv_Rdtn_DiscreteStateType),   INTENT(IN   )  :: xd          !< Discrete states (velocity history)
+      TYPE(Conv_Rdtn_MiscVarType),         INTENT(INOUT)  :: m           !< Misc/optimization variables
+      INTEGER(IntKi),                      INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+      CHARACTER(*),                        INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+         ! Local variables
+      REAL(SiKi)                           :: Spectrum(2*p%NBlkRdtn)     ! Sum of the products of the spectra, then its inverse FFT
+      TYPE(FFT_DataType)                   :: FFT_Data                   ! Data for the FFTs of size NFFT
+      INTEGER(IntKi)                       :: NFFT                       ! Size of the FFTs (2*NBlkRdtn)
+      INTEGER(IntKi)                       :: D                          ! Number of blocks between block Blk and an earlier block
+      INTEGER(IntKi)                       :: Slot                       ! Index of an earlier block in m%HistFFT
+      INTEGER(IntKi)                       :: I                          ! Generic index
+      INTEGER(IntKi)                       :: J                          ! Generic index
+      INTEGER(IntKi)                       :: K                          ! Generic index
+      INTEGER(IntKi)                       :: ErrStat2                   ! Temporary error status
+      CHARACTER(*), PARAMETER              :: RoutineName = 'Conv_Rdtn_CalcTail'
+
+
+      ErrStat = ErrID_None
+      ErrMsg  = ""
+
+      NFFT = 2*p%NBlkRdtn
+      IF ( Blk < m%TailBlock ) m%HistFFTBlock = -1
+
+      CALL InitFFT ( NFFT, FFT_Data, .FALSE., ErrStat2 )
+      IF ( ErrStat2 /= ErrID_None ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Error initializing the FFTs of the radiation convolution.', ErrStat, ErrMsg, RoutineName )
+         RETURN
+      END IF
+
+         ! Compute the FFTs of the (zero-padded) velocity history of the earlier blocks that aren't stored yet:
+      DO D = 1,MIN( p%NumBlkRdtn, Blk )
+         Slot = MOD( Blk-D, p%NumBlkRdtn )
+         IF ( m%HistFFTBlock(Slot) == Blk-D ) CYCLE
+
+         DO J = 1,6              ! Loop through all platform DOFs
+            m%HistFFT(:,Slot,J) = 0.0
+            DO K = 0,p%NBlkRdtn-1
+               m%HistFFT(K+1,Slot,J) = xd%XDHistory( MOD( (Blk-D)*p%NBlkRdtn+K, p%NStepHist ), J )
+            END DO
+            CALL ApplyFFT_f( m%HistFFT(:,Slot,J), FFT_Data, ErrStat2 )
+            IF ( ErrStat2 /= ErrID_None ) THEN
+               CALL SetErrStat( ErrID_Fatal, 'Error applying the FFT to the velocity history.', ErrStat, ErrMsg, RoutineName )
+               m%HistFFTBlock(Slot) = -1
+               CALL ExitFFT( FFT_Data, ErrStat2 )
+               RETURN
+            END IF
+         END DO
+         m%HistFFTBlock(Slot) = Blk-D
+      END DO
+
+         ! Sum the products of the spectra and transform back to the time domain:
+      DO I = 1,6                 ! Loop through all wave radiation damping forces and moments
+         Spectrum = 0.0
+         DO D = 1,MIN( p%NumBlkRdtn, Blk )
+            Slot = MOD( Blk-D, p%NumBlkRdtn )
+            DO J = 1,6           ! Loop through all platform DOFs
+               CALL AddSpectraProduct( p%RdtnKrnlFFT(:,D,I,J), m%HistFFT(:,Slot,J), Spectrum )
+            END DO
+         END DO
+
+         CALL ApplyFFT( Spectrum, FFT_Data, ErrStat2 )
+         IF ( ErrStat2 /= ErrID_None ) THEN
+            CALL SetErrStat( ErrID_Fatal, 'Error applying the inverse FFT to the radiation convolution.', ErrStat, ErrMsg, RoutineName )
+            CALL ExitFFT( FFT_Data, ErrStat2 )
+            RETURN
+         END IF
+         m%RdtnTail(:,I) = Spectrum(1:p%NBlkRdtn)
+      END DO
+
+      CALL ExitFFT( FFT_Data, ErrStat2 )
+      m%TailBlock = Blk
+
+END SUBROUTINE Conv_Rdtn_CalcTail
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine adds the product of two spectra in the halfcomplex format of the real FFTs (the zero-frequency term, the real and
+!! imaginary parts of the other terms, then the Nyquist term) to Total.
+SUBROUTINE AddSpectraProduct( A, B, Total )
+
+      REAL(SiKi),                          INTENT(IN   )  :: A(:)        !< First  spectrum
+      REAL(SiKi),                          INTENT(IN   )  :: B(:)        !< Second spectrum
+      REAL(SiKi),                          INTENT(INOUT)  :: Total(:)    !< Sum of the products (same size as A and B, which is even)
+
+      INTEGER(IntKi)                       :: K                          ! Index of the real part of a term
+      INTEGER(IntKi)                       :: N                          ! Size of the arrays
+
+
+      N = SIZE(Total)
+
+      Total(1) = Total(1) + A(1)*B(1)
+      DO K = 2,N-2,2
+         Total(K  ) = Total(K  ) + A(K)*B(K  ) - A(K+1)*B(K+1)
+         Total(K+1) = Total(K+1) + A(K)*B(K+1) + A(K+1)*B(K  )
+      END DO
+      Total(N) = Total(N) + A(N)*B(N)
+
+END SUBROUTINE AddSpectraProduct
+
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine computes the wave radiation kernel at the radiation time steps 0 through NStepRdtn-1 from the frequency-dependent
+!! hydrodynamic damping matrix.  NStepRdtn is the smallest odd integer with NStepRdtn-1 an even product of small factors and
+!! (NStepRdtn-1)*RdtnDT >= RdtnTMax.  Conv_Rdtn_Init convolves the velocity history with this kernel; SS_Radiation can fit a
+!! state-space model to it.
+SUBROUTINE Conv_Rdtn_CalcKrnl( InitInp, RdtnKrnl, ErrStat, ErrMsg )
 !..................................................................................................................................
 
       TYPE(Conv_Rdtn_InitInputType),       INTENT(IN   )  :: InitInp     !< Input data for initialization routine
-      TYPE(Conv_Rdtn_InputType),           INTENT(  OUT)  :: u           !< An initial guess for the input; input mesh must be defined
-      TYPE(Conv_Rdtn_ParameterType),       INTENT(  OUT)  :: p           !< Parameters      
-      TYPE(Conv_Rdtn_ContinuousStateType), INTENT(  OUT)  :: x           !< Initial continuous states
-      TYPE(Conv_Rdtn_DiscreteStateType),   INTENT(  OUT)  :: xd          !< Initial discrete states
-      TYPE(Conv_Rdtn_ConstraintStateType), INTENT(  OUT)  :: z           !< Initial guess of the constraint states
-      TYPE(Conv_Rdtn_OtherStateType),      INTENT(  OUT)  :: OtherState  !< Initial other states            
-      TYPE(Conv_Rdtn_OutputType),          INTENT(  OUT)  :: y           !< Initial system outputs (outputs are not calculated; 
-                                                                         !!   only the output mesh is initialized)
-      TYPE(Conv_Rdtn_MiscVarType),         INTENT(  OUT)  :: m           !< Initial misc/optimization variables            
-      REAL(DbKi),                          INTENT(INOUT)  :: Interval    !< Coupling interval in seconds: the rate that 
-                                                                         !!   (1) Conv_Rdtn_UpdateStates() is called in loose coupling &
-                                                                         !!   (2) Conv_Rdtn_UpdateDiscState() is called in tight coupling.
-                                                                         !!   Input is the suggested time from the glue code; 
-                                                                         !!   Output is the actual coupling interval that will be used 
-                                                                         !!   by the glue code.
-      TYPE(Conv_Rdtn_InitOutputType),      INTENT(  OUT)  :: InitOut     !< Output for initialization routine
+      REAL(SiKi), ALLOCATABLE,             INTENT(  OUT)  :: RdtnKrnl(:,:,:) !< Wave radiation kernel, (0:NStepRdtn-1,6,6) (kg/s^2, kg-m/s^2, kg-m^2/s^2)
       INTEGER(IntKi),                      INTENT(  OUT)  :: ErrStat     !< Error status of the operation
       CHARACTER(*),                        INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
 
@@ -114,6 +268,7 @@ SUBROUTINE Conv_Rdtn_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval,
       REAL(ReKi)                             :: RdtnOmegaMax                         ! Maximum frequency used in the (co)sine transform to fine the radiation impulse response functions (rad/s)
       REAL(DbKi), ALLOCATABLE                :: RdtnTime  (:)                        ! Simulation times at which the instantaneous values of the wave radiation kernel are determined (sec)
       LOGICAL                                :: RdtnFrmAM                            ! Determine the wave radiation kernel from the frequency-dependent hydrodynamic added mass matrix? (.TRUE = yes, .FALSE. = determine the wave radiation kernel from the frequency-dependent hydrodynamic damping matrix) !JASON: SHOULD YOU MAKE THIS AN INPUT???<--JASON: IT IS NOT WISE TO COMPUTE THE RADIATION KERNEL FROM THE FREQUENCY-DEPENDENT ADDED MASS MATRIX, UNLESS A CORRECTION IS APPLIED.  THIS IS DESCRIBED IN THE WAMIT USER'S GUIDE!!!!
+      INTEGER                                :: NStepRdtn                            ! Number of radiation time steps in the kernel
       INTEGER                                :: NStepRdtn2                           ! ( NStepRdtn-1 )/2
       INTEGER                                :: Indx                                 ! Cycles through the upper-triangular portion (diagonal and above) of the frequency-dependent hydrodynamic added mass and damping matrices from the radiation problem
       INTEGER                                :: I                                    ! Generic index
@@ -133,18 +288,14 @@ SUBROUTINE Conv_Rdtn_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval,
 !PRINT *, 'Greg, please initialize this variable:RdtnFrmA' 
 RdtnFrmAM = .FALSE.      
 !<<<      
-         ! Initialize the NWTC Subroutine Library
-         
-      CALL NWTC_Init(  )
 
 
-      
+
          !    If HighFreq is greater than
          !   RdtnOmegaMax, Abort because RdtnDT must be reduced in order to have
          !   sufficient accuracy in the computation of the radiation impulse response
          !   functions:
          
-      p%RdtnDT     = InitInp%RdtnDT   
       RdtnOmegaMax = Pi / InitInp%RdtnDT   
       
       IF ( InitInp%HighFreq > RdtnOmegaMax      )  THEN   ! .TRUE. if the highest frequency component (not counting infinity) in the WAMIT file is greater than RdtnOmegaMax
@@ -154,13 +305,8 @@ RdtnFrmAM = .FALSE.
          ErrStat = ErrID_Fatal
          RETURN
       END IF
-      
-      
-      
 
-      u%Velocity = 0.0 !this is an initial guess;  
-      
-   
+
          ! Perform some initialization computations including calculating the total
          !   number of frequency components = total number of time steps in the wave,
          !   radiation kernel, calculating the frequency step, and ALLOCATing the
@@ -175,45 +321,31 @@ RdtnFrmAM = .FALSE.
          !          RdtnDOmega = Pi/((NStepRdtn-1)*RdtnDT)
          !                     = Pi/RdtnTMax
 
-      p%NStepRdtn  = CEILING ( InitInp%RdtnTMax/p%RdtnDT )                 ! Set NStepRdtn to an odd integer
+      NStepRdtn  = CEILING ( InitInp%RdtnTMax/InitInp%RdtnDT )                 ! Set NStepRdtn to an odd integer
       
-      IF ( MOD(p%NStepRdtn,2) == 0 )  p%NStepRdtn = p%NStepRdtn + 1  !   larger or equal to RdtnTMax/RdtnDT.
+      IF ( MOD(NStepRdtn,2) == 0 )  NStepRdtn = NStepRdtn + 1  !   larger or equal to RdtnTMax/RdtnDT.
       
-      NStepRdtn2   = MAX( ( p%NStepRdtn-1 )/2, 1 )                                 ! Make sure that NStepRdtn-1 is an even product of small factors (PSF) that is greater
-      p%NStepRdtn  = 2*PSF ( NStepRdtn2, 9 ) + 1                                 !   or equal to RdtnTMax/RdtnDT to ensure that the (co)sine transform is efficient.
+      NStepRdtn2   = MAX( ( NStepRdtn-1 )/2, 1 )                                 ! Make sure that NStepRdtn-1 is an even product of small factors (PSF) that is greater
+      NStepRdtn  = 2*PSF ( NStepRdtn2, 9 ) + 1                                 !   or equal to RdtnTMax/RdtnDT to ensure that the (co)sine transform is efficient.
 
-      p%NStepRdtn1 = p%NStepRdtn + 1                                       ! Save the value of NStepRdtn + 1 for future use.
-      !NStepRdtn2   = ( p%NStepRdtn-1 )/2                                           ! Update the value of NStepRdtn2 based on the value needed for NStepRdtn.
-      RdtnTMax     = ( p%NStepRdtn-1 )*p%RdtnDT                      ! Update the value of RdtnTMax   based on the value needed for NStepRdtn.
+      !NStepRdtn2   = ( NStepRdtn-1 )/2                                           ! Update the value of NStepRdtn2 based on the value needed for NStepRdtn.
+      RdtnTMax     = ( NStepRdtn-1 )*InitInp%RdtnDT                      ! Update the value of RdtnTMax   based on the value needed for NStepRdtn.
       RdtnDOmega   = Pi/RdtnTMax                                                 ! Compute the frequency step for wave radiation kernel calculations.
 
-      ALLOCATE ( RdtnTime (0:p%NStepRdtn-1    ) , STAT=ErrStat )
+      ALLOCATE ( RdtnTime (0:NStepRdtn-1    ) , STAT=ErrStat )
       IF ( ErrStat /= ErrID_None )  THEN
          ErrMsg = ' Error allocating memory for the RdtnTime array.'
          ErrStat = ErrID_Fatal
          RETURN
       END IF
 
-      ALLOCATE ( p%RdtnKrnl (0:p%NStepRdtn-1,6,6) , STAT=ErrStat )
+      ALLOCATE ( RdtnKrnl (0:NStepRdtn-1,6,6) , STAT=ErrStat )
       IF ( ErrStat /= ErrID_None )  THEN
          ErrMsg = ' Error allocating memory for the RdtnKrnl array.'
          ErrStat = ErrID_Fatal
          RETURN
       END IF
 
-      ALLOCATE ( xd%XDHistory(0:p%NStepRdtn  ,6  ) , STAT=ErrStat )   ! In the numerical convolution we must have NStepRdtn1 elements within the XDHistory array, which is one more than the NStepRdtn elements that are in the RdtnKrnl array
-      IF ( ErrStat /= ErrID_None )  THEN
-         ErrMsg = ' Error allocating memory for the XDHistory array.'
-         ErrStat = ErrID_Fatal
-         RETURN
-      END IF
-
-         ! Initialize all elements of the xd%XDHistory array with the intial values of u%Velocity
-      DO K = 0,p%NStepRdtn-1
-         DO J = 1,6                 ! Loop through all DOFs
-            xd%XDHistory(K,J) = u%Velocity(J)
-         END DO
-      END DO
 
       LastInd = 1
       IF ( RdtnFrmAM )  THEN  ! .TRUE. if we will determine the wave radiation kernel from the frequency-dependent hydrodynamic added mass matrix
@@ -223,20 +355,20 @@ RdtnFrmAM = .FALSE.
          ! Calculate the factor needed by the discrete sine transform in the
          !   calculation of the wave radiation kernel:
 
-         Krnl_Fact = -1.0_DbKi/p%RdtnDT ! This factor is needed by the discrete time sine transform
+         Krnl_Fact = -1.0_DbKi/InitInp%RdtnDT ! This factor is needed by the discrete time sine transform
 
 
 
          ! Compute all frequency components (including zero) of the sine transform
          !   of the wave radiation kernel:
 
-         DO I = 0,p%NStepRdtn-1 ! Loop through all frequency components (including zero) of the sine transform
+         DO I = 0,NStepRdtn-1 ! Loop through all frequency components (including zero) of the sine transform
 
 
          ! Calculate the array of simulation times at which the instantaneous values
          !   of the wave radiation kernel are to be determined:
 
-            RdtnTime(I) = I*p%RdtnDT
+            RdtnTime(I) = I*InitInp%RdtnDT
 
 
          ! Compute the frequency of this component:
@@ -251,7 +383,7 @@ RdtnFrmAM = .FALSE.
             DO J = 1,6        ! Loop through all rows    of RdtnKrnl
                DO K = J,6     ! Loop through all columns of RdtnKrnl above and including the diagonal
                   Indx = Indx + 1
-                  p%RdtnKrnl(I,J,K) = Krnl_Fact*Omega*( InterpStp( Omega, InitInp%HdroFreq(:), &
+                  RdtnKrnl(I,J,K) = Krnl_Fact*Omega*( InterpStp( Omega, InitInp%HdroFreq(:), &
                                                                                 InitInp%HdroAddMs(:       ,Indx), LastInd, InitInp%NInpFreq ) &
                                                       -                         InitInp%HdroAddMs(InitInp%NInpFreq,Indx)                      )
                END DO          ! K - All columns of RdtnKrnl above and including the diagonal
@@ -265,7 +397,7 @@ RdtnFrmAM = .FALSE.
          ! Compute the sine transforms to find the time-domain representation of
          !   the wave radiation kernel:
 
-         CALL InitSINT ( p%NStepRdtn, FFT_Data, .TRUE., ErrStat )
+         CALL InitSINT ( NStepRdtn, FFT_Data, .TRUE., ErrStat )
          
          IF ( ErrStat /= ErrID_None ) THEN
             ErrMsg  = 'Error Initializating Sine Transforms'
@@ -275,12 +407,12 @@ RdtnFrmAM = .FALSE.
       
          DO J = 1,6                 ! Loop through all rows    of RdtnKrnl
             DO K = J,6              ! Loop through all columns of RdtnKrnl above and including the diagonal
-               CALL ApplySINT( p%RdtnKrnl(:,J,K), FFT_Data, ErrStat )
+               CALL ApplySINT( RdtnKrnl(:,J,K), FFT_Data, ErrStat )
                IF ( ErrStat /= ErrID_None ) RETURN
             END DO                   ! K - All columns of RdtnKrnl above and including the diagonal
             DO K = J+1,6            ! Loop through all rows    of RdtnKrnl below the diagonal
-               DO I = 0,p%NStepRdtn-1 ! Loop through all frequency components (including zero) of the sine transform
-                  p%RdtnKrnl(I,K,J) = p%RdtnKrnl(I,J,K)
+               DO I = 0,NStepRdtn-1 ! Loop through all frequency components (including zero) of the sine transform
+                  RdtnKrnl(I,K,J) = RdtnKrnl(I,J,K)
                END DO                ! I - All frequency components (including zero) of the sine transform
             END DO                   ! K - All rows    of RdtnKrnl below the diagonal
          END DO                      ! J - All rows    of RdtnKrnl
@@ -300,20 +432,20 @@ RdtnFrmAM = .FALSE.
          ! Calculate the factor needed by the discrete cosine transform in the
          !   calculation of the wave radiation kernel:
 
-         Krnl_Fact = 1.0/p%RdtnDT  ! This factor is needed by the discrete time cosine transform
+         Krnl_Fact = 1.0/InitInp%RdtnDT  ! This factor is needed by the discrete time cosine transform
 
 
 
          ! Compute all frequency components (including zero) of the cosine transform
          !   of the wave radiation kernel:
 
-         DO I = 0,p%NStepRdtn-1 ! Loop through all frequency components (including zero) of the cosine transform
+         DO I = 0,NStepRdtn-1 ! Loop through all frequency components (including zero) of the cosine transform
 
 
          ! Calculate the array of simulation times at which the instantaneous values
          !   of the wave radiation kernel are to be determined:
 
-            RdtnTime(I) = I*p%RdtnDT
+            RdtnTime(I) = I*InitInp%RdtnDT
 
 
          ! Compute the frequency of this component:
@@ -328,7 +460,7 @@ RdtnFrmAM = .FALSE.
             DO J = 1,6        ! Loop through all rows    of RdtnKrnl
                DO K = J,6     ! Loop through all columns of RdtnKrnl above and including the diagonal
                   Indx = Indx + 1
-                  p%RdtnKrnl(I,J,K) = Krnl_Fact*InterpStp ( Omega, InitInp%HdroFreq(:), InitInp%HdroDmpng(:,Indx), LastInd, InitInp%NInpFreq )
+                  RdtnKrnl(I,J,K) = Krnl_Fact*InterpStp ( Omega, InitInp%HdroFreq(:), InitInp%HdroDmpng(:,Indx), LastInd, InitInp%NInpFreq )
                END DO          ! K - All columns of RdtnKrnl above and including the diagonal
             END DO             ! J - All rows    of RdtnKrnl
 
@@ -340,7 +472,7 @@ RdtnFrmAM = .FALSE.
          ! Compute the cosine transforms to find the time-domain representation of
          !   the wave radiation kernel:
 
-         CALL InitCOST ( p%NStepRdtn, FFT_Data, .TRUE., ErrStat )
+         CALL InitCOST ( NStepRdtn, FFT_Data, .TRUE., ErrStat )
          IF ( ErrStat /= ErrID_None ) THEN
             ErrMsg  = 'Error Initializating Cosine Transforms'
             ErrStat = ErrID_Fatal
@@ -349,7 +481,7 @@ RdtnFrmAM = .FALSE.
 
          DO J = 1,6                          ! Loop through all rows    of RdtnKrnl
             DO K = J,6                       ! Loop through all columns of RdtnKrnl above and including the diagonal
-               CALL ApplyCOST( p%RdtnKrnl(:,J,K), FFT_Data, ErrStat )
+               CALL ApplyCOST( RdtnKrnl(:,J,K), FFT_Data, ErrStat )
                IF ( ErrStat /= ErrID_None ) THEN
                   ErrMsg  = 'Error applying Cosine Transform'
                   ErrStat = ErrID_Fatal
@@ -357,8 +489,8 @@ RdtnFrmAM = .FALSE.
                END IF
             END DO                            ! K - All columns of RdtnKrnl above and including the diagonal
             DO K = J+1,6                     ! Loop through all rows    of RdtnKrnl below the diagonal
-               DO I = 0,p%NStepRdtn-1  ! Loop through all radiation time steps
-                  p%RdtnKrnl(I,K,J) = p%RdtnKrnl(I,J,K)
+               DO I = 0,NStepRdtn-1  ! Loop through all radiation time steps
+                  RdtnKrnl(I,K,J) = RdtnKrnl(I,J,K)
                END DO                         ! I - All radiation time steps
             END DO                            ! K - All rows    of RdtnKrnl below the diagonal
          END DO                               ! J - All rows    of RdtnKrnl
@@ -372,7 +504,99 @@ RdtnFrmAM = .FALSE.
 
 
       END IF
-     
+
+
+      IF ( ALLOCATED( RdtnTime     ) ) DEALLOCATE( RdtnTime     )
+
+END SUBROUTINE Conv_Rdtn_CalcKrnl
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine is called at the start of the simulation to perform initialization steps. 
+!! The parameters are set here and not changed during the simulation.
+!! The initial states and initial guess for the input are defined.
+SUBROUTINE Conv_Rdtn_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, InitOut, ErrStat, ErrMsg )
+!..................................................................................................................................
+
+      TYPE(Conv_Rdtn_InitInputType),       INTENT(IN   )  :: InitInp     !< Input data for initialization routine
+      TYPE(Conv_Rdtn_InputType),           INTENT(  OUT)  :: u           !< An initial guess for the input; input mesh must be defined
+      TYPE(Conv_Rdtn_ParameterType),       INTENT(  OUT)  :: p           !< Parameters      
+      TYPE(Conv_Rdtn_ContinuousStateType), INTENT(  OUT)  :: x           !< Initial continuous states
+      TYPE(Conv_Rdtn_DiscreteStateType),   INTENT(  OUT)  :: xd          !< Initial discrete states
+      TYPE(Conv_Rdtn_ConstraintStateType), INTENT(  OUT)  :: z           !< Initial guess of the constraint states
+      TYPE(Conv_Rdtn_OtherStateType),      INTENT(  OUT)  :: OtherState  !< Initial other states            
+      TYPE(Conv_Rdtn_OutputType),          INTENT(  OUT)  :: y           !< Initial system outputs (outputs are not calculated; 
+                                                                         !!   only the output mesh is initialized)
+      TYPE(Conv_Rdtn_MiscVarType),         INTENT(  OUT)  :: m           !< Initial misc/optimization variables            
+      REAL(DbKi),                          INTENT(INOUT)  :: Interval    !< Coupling interval in seconds: the rate that 
+                                                                         !!   (1) Conv_Rdtn_UpdateStates() is called in loose coupling &
+                                                                         !!   (2) Conv_Rdtn_UpdateDiscState() is called in tight coupling.
+                                                                         !!   Input is the suggested time from the glue code; 
+                                                                         !!   Output is the actual coupling interval that will be used 
+                                                                         !!   by the glue code.
+      TYPE(Conv_Rdtn_InitOutputType),      INTENT(  OUT)  :: InitOut     !< Output for initialization routine
+      INTEGER(IntKi),                      INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+      CHARACTER(*),                        INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+      
+         ! Local variables
+             
+      INTEGER                                :: J                                    ! Generic index
+      INTEGER                                :: K                                    ! Generic index
+
+      
+         ! Initialize ErrStat
+         
+      ErrStat = ErrID_None         
+      ErrMsg  = ""      
+
+         ! Initialize the NWTC Subroutine Library
+         
+      CALL NWTC_Init(  )
+
+
+         ! Compute the wave radiation kernel:
+
+      p%RdtnDT     = InitInp%RdtnDT
+
+      CALL Conv_Rdtn_CalcKrnl( InitInp, p%RdtnKrnl, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+      p%NStepRdtn  = SIZE( p%RdtnKrnl, 1 )
+      p%NStepRdtn1 = p%NStepRdtn + 1                                       ! Save the value of NStepRdtn + 1 for future use.
+
+      u%Velocity = 0.0 !this is an initial guess;  
+
+         ! Use the partitioned convolution (see Conv_Rdtn_CalcOutput) when the kernel is long enough for it to be faster than the
+         !   direct convolution.  A block size near SQRT(2*NStepRdtn) balances the direct convolution within the current block
+         !   against the products of the spectra of the earlier blocks.  The velocity history is a circular buffer; the
+         !   partitioned convolution needs two more blocks of it for the FFTs of the earliest blocks.
+
+      p%NBlkRdtn   = 2**MAX( NINT( LOG( SQRT( 2.0*p%NStepRdtn ) )/LOG( 2.0 ) ), 1 )
+      p%NumBlkRdtn = ( p%NStepRdtn + p%NBlkRdtn - 2 )/p%NBlkRdtn          ! Number of partitions with lags up to NStepRdtn-1.
+
+      IF ( p%NumBlkRdtn < 4 ) THEN
+         p%NBlkRdtn   = 0
+         p%NumBlkRdtn = 0
+         p%NStepHist  = p%NStepRdtn
+      ELSE
+         p%NStepHist  = p%NStepRdtn + 2*p%NBlkRdtn
+      END IF
+
+
+      ALLOCATE ( xd%XDHistory(0:p%NStepHist-1,6  ) , STAT=ErrStat )   ! Circular buffer: the newest velocity is stored in XDHistory(MOD(OtherState%IndHist,NStepHist),:)
+      IF ( ErrStat /= ErrID_None )  THEN
+         ErrMsg = ' Error allocating memory for the XDHistory array.'
+         ErrStat = ErrID_Fatal
+         RETURN
+      END IF
+
+         ! Initialize all elements of the xd%XDHistory array with the intial values of u%Velocity
+      DO K = 0,p%NStepHist-1
+         DO J = 1,6                 ! Loop through all DOFs
+            xd%XDHistory(K,J) = u%Velocity(J)
+         END DO
+      END DO
+
+
    !   IF ( InitInp%UnSum > 0 ) THEN
    !   
    !      ! Write the header for this section
@@ -390,9 +614,10 @@ RdtnFrmAM = .FALSE.
    !   END DO
    !
    !END IF
-                
-                                                  
-      IF ( ALLOCATED( RdtnTime     ) ) DEALLOCATE( RdtnTime     )
+
+
+      CALL Conv_Rdtn_InitBlocks( p, m, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
 
    
       
@@ -403,6 +628,7 @@ RdtnFrmAM = .FALSE.
 
    m%LastIndRdtn = 0
    OtherState%IndRdtn = 0
+   OtherState%IndHist = 0
    
       ! bjj: these initializations don't matter, but I don't like seeing the compilation warning in IVF:
    x%DummyContState = 0.0
@@ -410,8 +636,113 @@ RdtnFrmAM = .FALSE.
    y%F_Rdtn = 0.0  
    InitOut%DummyInitOut = 0   
 
+      ! Make sure the partitioned convolution gives the same loads as the direct convolution:
+   IF ( p%NBlkRdtn > 0 ) THEN
+      CALL Conv_Rdtn_CheckBlocks( u, p, x, xd, z, OtherState, m, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+   END IF
+
 END SUBROUTINE Conv_Rdtn_Init
 !----------------------------------------------------------------------------------------------------------------------------------
+!> This routine checks the partitioned convolution set up by Conv_Rdtn_InitBlocks.  It fills copies of the velocity history with a
+!! test signal and computes y%F_Rdtn with Conv_Rdtn_CalcOutput at each radiation time step of the first four blocks (crossing
+!! four block boundaries), once with the parameters and once with a copy of them with NBlkRdtn = 0 (the direct convolution).  It
+!! is a fatal error if the two differ by more than RdtnBlkChkTol of the largest load.  The states of the simulation aren't changed.
+SUBROUTINE Conv_Rdtn_CheckBlocks( u, p, x, xd, z, OtherState, m, ErrStat, ErrMsg )
+
+      TYPE(Conv_Rdtn_InputType),           INTENT(IN   )  :: u           !< Inputs
+      TYPE(Conv_Rdtn_ParameterType),       INTENT(IN   )  :: p           !< Parameters (with NBlkRdtn > 0)
+      TYPE(Conv_Rdtn_ContinuousStateType), INTENT(IN   )  :: x           !< Continuous states
+      TYPE(Conv_Rdtn_DiscreteStateType),   INTENT(IN   )  :: xd          !< Discrete states
+      TYPE(Conv_Rdtn_ConstraintStateType), INTENT(IN   )  :: z           !< Constraint states
+      TYPE(Conv_Rdtn_OtherStateType),      INTENT(IN   )  :: OtherState  !< Other states
+      TYPE(Conv_Rdtn_MiscVarType),         INTENT(IN   )  :: m           !< Misc/optimization variables
+      INTEGER(IntKi),                      INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+      CHARACTER(*),                        INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+         ! Local variables
+      TYPE(Conv_Rdtn_ParameterType)        :: pDirect                    ! Copy of the parameters with NBlkRdtn = 0
+      TYPE(Conv_Rdtn_DiscreteStateType)    :: xdChk                      ! Copy of the discrete states holding the test signal
+      TYPE(Conv_Rdtn_OtherStateType)       :: OtherStateChk              ! Copy of the other states with the current radiation time step
+      TYPE(Conv_Rdtn_MiscVarType)          :: mChk                       ! Copy of the misc variables
+      TYPE(Conv_Rdtn_OutputType)           :: yBlk                       ! Outputs of the partitioned convolution
+      TYPE(Conv_Rdtn_OutputType)           :: yDirect                    ! Outputs of the direct convolution
+      REAL(ReKi)                           :: MaxDiff                    ! Largest difference between the two convolutions (N, N-m)
+      REAL(ReKi)                           :: MaxLoad                    ! Largest load of the direct convolution (N, N-m)
+      INTEGER(IntKi)                       :: N                          ! Radiation time step
+      INTEGER(IntKi)                       :: J                          ! Generic index
+      INTEGER(IntKi)                       :: ErrStat2                   ! Temporary error status
+      CHARACTER(ErrMsgLen)                 :: ErrMsg2                    ! Temporary error message
+      CHARACTER(*), PARAMETER              :: RoutineName = 'Conv_Rdtn_CheckBlocks'
+
+
+      ErrStat = ErrID_None
+      ErrMsg  = ""
+
+      CALL Conv_Rdtn_CopyParam( p, pDirect, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      CALL Conv_Rdtn_CopyDiscState( xd, xdChk, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      CALL Conv_Rdtn_CopyOtherState( OtherState, OtherStateChk, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      CALL Conv_Rdtn_CopyMisc( m, mChk, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      IF ( ErrStat >= AbortErrLev ) THEN
+         CALL Cleanup()
+         RETURN
+      END IF
+
+      pDirect%NBlkRdtn   = 0
+      pDirect%NumBlkRdtn = 0
+      xdChk%XDHistory    = 0.0
+      MaxDiff            = 0.0
+      MaxLoad            = 0.0
+
+      DO N = 0,4*p%NBlkRdtn
+
+            ! Store the velocities of this radiation time step, as Conv_Rdtn_UpdateDiscState does:
+         DO J = 1,6
+            xdChk%XDHistory( MOD( N, p%NStepHist ), J ) = SIN( 0.37*N + J ) + 0.5*COS( 0.011*N*J )
+         END DO
+         OtherStateChk%IndRdtn = N
+         OtherStateChk%IndHist = N
+
+         CALL Conv_Rdtn_CalcOutput( 0.0_DbKi, u, p,       x, xdChk, z, OtherStateChk, yBlk,    mChk, ErrStat2, ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         CALL Conv_Rdtn_CalcOutput( 0.0_DbKi, u, pDirect, x, xdChk, z, OtherStateChk, yDirect, mChk, ErrStat2, ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL Cleanup()
+            RETURN
+         END IF
+
+         MaxDiff = MAX( MaxDiff, MAXVAL( ABS( yBlk%F_Rdtn - yDirect%F_Rdtn ) ) )
+         MaxLoad = MAX( MaxLoad, MAXVAL( ABS( yDirect%F_Rdtn ) ) )
+
+      END DO
+
+      IF ( MaxDiff > RdtnBlkChkTol*MaxLoad ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'The partitioned radiation convolution (blocks of '//TRIM(Num2LStr(p%NBlkRdtn))//          &
+                          ' radiation time steps) differs from the direct convolution by '//TRIM(Num2LStr(MaxDiff))//            &
+                          ', more than '//TRIM(Num2LStr(RdtnBlkChkTol))//' of the largest radiation load ('//TRIM(Num2LStr(MaxLoad))//').', &
+                          ErrStat, ErrMsg, RoutineName )
+      END IF
+
+      CALL Cleanup()
+
+   CONTAINS
+
+      SUBROUTINE Cleanup()
+         CALL Conv_Rdtn_DestroyParam(      pDirect,       ErrStat2, ErrMsg2 )
+         CALL Conv_Rdtn_DestroyDiscState(  xdChk,         ErrStat2, ErrMsg2 )
+         CALL Conv_Rdtn_DestroyOtherState( OtherStateChk, ErrStat2, ErrMsg2 )
+         CALL Conv_Rdtn_DestroyMisc(       mChk,          ErrStat2, ErrMsg2 )
+         CALL Conv_Rdtn_DestroyOutput(     yBlk,          ErrStat2, ErrMsg2 )
+         CALL Conv_Rdtn_DestroyOutput(     yDirect,       ErrStat2, ErrMsg2 )
+      END SUBROUTINE Cleanup
+
+END SUBROUTINE Conv_Rdtn_CheckBlocks
+!----------------------------------------------------------------------------------------------------------------------------------
 !> This routine is called at the end of the simulation.
 SUBROUTINE Conv_Rdtn_End( u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 !..................................................................................................................................
@@ -438,6 +769,7 @@ SUBROUTINE Conv_Rdtn_End( u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
          ! Place any last minute operations or calculations here:
 
 
+
          ! Close files here:     
                   
                   
@@ -560,7 +892,10 @@ SUBROUTINE Conv_Rdtn_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat
       INTEGER                              :: J                                       ! Generic index
       INTEGER                              :: K                                       ! Generic index
       
-      INTEGER(IntKi)                       :: MaxInd
+      INTEGER(IntKi)                       :: MaxInd                                  ! Largest lag (in radiation time steps) in the direct convolution
+      INTEGER(IntKi)                       :: IndHist                                 ! Index of the newest velocity in the circular XDHistory array
+      INTEGER(IntKi)                       :: NNoWrap                                 ! Largest lag whose velocity is stored at or before IndHist in XDHistory
+      INTEGER(IntKi)                       :: Blk                                     ! Block number of the newest velocity (partitioned convolution)
          ! Initialize ErrStat
          
       ErrStat = ErrID_None         
@@ -568,19 +903,38 @@ SUBROUTINE Conv_Rdtn_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat
       
       
       ! Perform numerical convolution to determine the load contribution from wave
-      !   radiation damping:
+      !   radiation damping.  With the partitioned convolution, the velocities of the
+      !   earlier blocks are convolved by FFT once per block (m%RdtnTail), and only the
+      !   velocities of the current block are convolved directly:
+      
+      IF ( p%NBlkRdtn > 0 ) THEN
+         Blk = OtherState%IndHist/p%NBlkRdtn
+         IF ( Blk /= m%TailBlock ) THEN
+            CALL Conv_Rdtn_CalcTail( Blk, p, xd, m, ErrStat, ErrMsg )
+            IF ( ErrStat >= AbortErrLev ) RETURN
+         END IF
+         MaxInd   = OtherState%IndHist - Blk*p%NBlkRdtn
+         F_RdtnDT = -m%RdtnTail(MaxInd,:)
+      ELSE
+         MaxInd   = MIN(p%NStepRdtn-1,OtherState%IndHist)  ! Note: xd%IndRdtn index is from the previous time-step since this state was for the previous time-step
+         F_RdtnDT = 0.0
+      END IF
       
-      MaxInd = MIN(p%NStepRdtn-1,OtherState%IndRdtn)  ! Note: xd%IndRdtn index is from the previous time-step since this state was for the previous time-step
+      IndHist = MOD( OtherState%IndHist, p%NStepHist )
+      NNoWrap = MIN( MaxInd, IndHist )
       
       DO I = 1,6                 ! Loop through all wave radiation damping forces and moments
 
-         F_RdtnDT   (I) = 0.0
        !  F_RdtnRmndr(I) = 0.0
 
          DO J = 1,6              ! Loop through all platform DOFs
             
-            DO K = 0, MaxInd ! Loop through all NStepRdtn time steps in the radiation Kernel (less than NStepRdtn time steps are used when ZTime < RdtnTmax)
-               F_RdtnDT(I) = F_RdtnDT(I) - p%RdtnKrnl(MaxInd-K,I,J)*xd%XDHistory(K,J)
+               ! Sum from the oldest velocity to the newest (the largest lag to the smallest), as before the history was circular:
+            DO K = MaxInd, NNoWrap+1, -1 ! Loop through the lags whose velocities are stored at the end of the circular XDHistory array
+               F_RdtnDT(I) = F_RdtnDT(I) - p%RdtnKrnl(K,I,J)*xd%XDHistory(IndHist-K+p%NStepHist,J)
+            END DO  
+            DO K = NNoWrap, 0, -1    ! Loop through the lags (less than NStepRdtn time steps are used when ZTime < RdtnTmax)
+               F_RdtnDT(I) = F_RdtnDT(I) - p%RdtnKrnl(K,I,J)*xd%XDHistory(IndHist-K,J)
             END DO  
             !DO K = MAX(0,xd%IndRdtn-p%NStepRdtn  ),xd%IndRdtn-1  ! Loop through all NStepRdtn time steps in the radiation Kernel (less than NStepRdtn time steps are used when ZTime < RdtnTmax)
             !   F_RdtnDT   (I) = F_RdtnDT   (I) - p%RdtnKrnl(xd%IndRdtn-1-K,I,J)*xd%XDHistory(MOD(K,p%NStepRdtn1),J)
@@ -653,7 +1007,6 @@ SUBROUTINE Conv_Rdtn_UpdateDiscState( Time, n, u, p, x, xd, z, OtherState, m, Er
       REAL(ReKi)                           :: IncrmntUD                  ! Incremental change in UD over a single radiation time step (m/s, rad/s)
       REAL(ReKi)                           :: RdtnRmndr                  ! Fractional amount of the p%RdtnDT timestep
       INTEGER(IntKi)                       :: J                          ! Generic index
-      INTEGER(IntKi)                       :: K                          ! Generic index
             
          ! Initialize ErrStat
          
@@ -686,28 +1039,25 @@ SUBROUTINE Conv_Rdtn_UpdateDiscState( Time, n, u, p, x, xd, z, OtherState, m, Er
          !       time by at least RdtnDT (i.e., on a call to the corrector)
          !   When saving the new values, interpolate to find all of the values
          !   between index LastIndRdtn and index IndRdtn.  Also, if the XDHistory
-         !   array is full, use MOD(Index,NStepRdtn1) to replace the oldest values
+         !   array is full, use MOD(Index,NStepHist) to replace the oldest values
          !   with the newest values:
          ! NOTE: When IndRdtn > LastIndRdtn, IndRdtn will equal           LastIndRdtn + 1 if DT <= RdtnDT;
          !       When IndRdtn > LastIndRdtn, IndRdtn will be greater than LastIndRdtn + 1 if DT >  RdtnDT.
    !BJJ: this needs a better check so that it is ALWAYS done (MATLAB/Simulink could possibly avoid this step by starting at Time>0, OR there may be some numerical issues where this is NOT EXACTLY zero)
          
-      IF ( OtherState%IndRdtn < (p%NStepRdtn) )  THEN 
-         DO J = 1,6  ! Loop through all platform DOFs
-            xd%XDHistory(OtherState%IndRdtn,J) = u%Velocity(J)  ! XDHistory was allocated as a zero-based array!
-         END DO       ! J - All platform DOFs
+         ! XDHistory is a circular buffer: until the kernel is full, the velocity is stored at radiation time step IndRdtn; after
+         !   that, each call adds a new velocity and drops the oldest one (as shifting the array to the left did), so the sequence
+         !   number IndHist of the newest velocity may run ahead of IndRdtn:
+         
+      IF ( OtherState%IndRdtn < p%NStepRdtn )  THEN
+         OtherState%IndHist = OtherState%IndRdtn
       ELSE
-         !CALL ShiftValuesLeft( xd%XDHistory, p%NStepRdtn )  ! This is NOT to be used GJH
-         ! Shift the stored history by one index
-         DO K = 0,p%NStepRdtn-2
-            DO J = 1,6                 ! Loop through all DOFs
-               xd%XDHistory(K,J) = xd%XDHistory(K+1,J)
-            END DO
-         END DO
-         DO J = 1,6  ! Loop through all platform DOFs
-            xd%XDHistory(p%NStepRdtn-1,J) = u%Velocity(J) ! Set the last array element to the current velocity
-         END DO       ! J - All platform DOFs
+         OtherState%IndHist = OtherState%IndHist + 1
       END IF
+         
+      DO J = 1,6  ! Loop through all platform DOFs
+         xd%XDHistory(MOD(OtherState%IndHist,p%NStepHist),J) = u%Velocity(J)  ! XDHistory was allocated as a zero-based array!
+      END DO       ! J - All platform DOFs
    
    !      IF ( Time == 0.0_DbKi )  THEN              ! (1) .TRUE. if we are on the initialization pass where Time = 0.0 (and IndRdtn = 0)
    !
@@ -71,11 +71,16 @@ IMPLICIT NONE
 ! =========  Conv_Rdtn_OtherStateType  =======
   TYPE, PUBLIC :: Conv_Rdtn_OtherStateType
     INTEGER(IntKi)  :: IndRdtn      !<  [-]
+    INTEGER(IntKi)  :: IndHist      !< Sequence number of the newest velocity in XDHistory (stored in XDHistory(MOD(IndHist,NStepHist),:)) [-]
   END TYPE Conv_Rdtn_OtherStateType
 ! =======================
 ! =========  Conv_Rdtn_MiscVarType  =======
   TYPE, PUBLIC :: Conv_Rdtn_MiscVarType
     INTEGER(IntKi)  :: LastIndRdtn      !<  [-]
+    REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: RdtnTail      !< Convolution of the kernel with the velocity history before the current block, for each radiation time step in the block (partitioned convolution) [N/N-m]
+    INTEGER(IntKi)  :: TailBlock      !< Block number of the time steps in RdtnTail (-1 if not computed) [-]
+    REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: HistFFT      !< FFTs of the blocks of the velocity history (halfcomplex format), stored in the order of the block numbers modulo NumBlkRdtn [-]
+    INTEGER(IntKi) , DIMENSION(:), ALLOCATABLE  :: HistFFTBlock      !< Block number of the velocity history in each element of HistFFT (-1 if not computed) [-]
   END TYPE Conv_Rdtn_MiscVarType
 ! =======================
 ! =========  Conv_Rdtn_ParameterType  =======
@@ -85,6 +90,10 @@ IMPLICIT NONE
     REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: RdtnKrnl      !<  [-]
     INTEGER(IntKi)  :: NStepRdtn      !<  [-]
     INTEGER(IntKi)  :: NStepRdtn1      !<  [-]
+    INTEGER(IntKi)  :: NStepHist      !< Number of radiation time steps in the circular velocity history XDHistory [-]
+    INTEGER(IntKi)  :: NBlkRdtn      !< Number of radiation time steps in each block of the partitioned convolution (0 for the direct convolution) [-]
+    INTEGER(IntKi)  :: NumBlkRdtn      !< Number of kernel partitions used by the partitioned convolution [-]
+    REAL(SiKi) , DIMENSION(:,:,:,:), ALLOCATABLE  :: RdtnKrnlFFT      !< FFTs of the kernel partitions (halfcomplex format, 2*NBlkRdtn by NumBlkRdtn by 6 by 6) [-]
   END TYPE Conv_Rdtn_ParameterType
 ! =======================
 ! =========  Conv_Rdtn_InputType  =======
@@ -109,6 +118,7 @@ CONTAINS
    INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
    INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
    INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
+   INTEGER(IntKi)                 :: i4, i4_l, i4_u  !  bounds (upper/lower) for an array dimension 4
    INTEGER(IntKi)                 :: ErrStat2
    CHARACTER(ErrMsgLen)           :: ErrMsg2
    CHARACTER(*), PARAMETER        :: RoutineName = 'Conv_Rdtn_CopyInitInput'
@@ -355,6 +365,7 @@ ENDIF
   INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
   INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
   INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
+  INTEGER(IntKi)                 :: i4, i4_l, i4_u  !  bounds (upper/lower) for an array dimension 4
   INTEGER(IntKi)                 :: ErrStat2
   CHARACTER(ErrMsgLen)           :: ErrMsg2
   CHARACTER(*), PARAMETER        :: RoutineName = 'Conv_Rdtn_UnPackInitInput'
@@ -1070,6 +1081,7 @@ ENDIF
    ErrStat = ErrID_None
    ErrMsg  = ""
     DstOtherStateData%IndRdtn = SrcOtherStateData%IndRdtn
+    DstOtherStateData%IndHist = SrcOtherStateData%IndHist
  END SUBROUTINE Conv_Rdtn_CopyOtherState
 
  SUBROUTINE Conv_Rdtn_DestroyOtherState( OtherStateData, ErrStat, ErrMsg )
@@ -1119,6 +1131,7 @@ ENDIF
   Db_BufSz  = 0
   Int_BufSz  = 0
       Int_BufSz  = Int_BufSz  + 1  ! IndRdtn
+      Int_BufSz  = Int_BufSz  + 1  ! IndHist
   IF ( Re_BufSz  .GT. 0 ) THEN 
      ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
      IF (ErrStat2 /= 0) THEN 
@@ -1148,6 +1161,8 @@ ENDIF
 
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%IndRdtn
       Int_Xferred   = Int_Xferred   + 1
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%IndHist
+      Int_Xferred   = Int_Xferred   + 1
  END SUBROUTINE Conv_Rdtn_PackOtherState
 
  SUBROUTINE Conv_Rdtn_UnPackOtherState( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
@@ -1184,6 +1199,8 @@ ENDIF
   Int_Xferred  = 1
       OutData%IndRdtn = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
+      OutData%IndHist = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
  END SUBROUTINE Conv_Rdtn_UnPackOtherState
 
  SUBROUTINE Conv_Rdtn_CopyMisc( SrcMiscData, DstMiscData, CtrlCode, ErrStat, ErrMsg )
@@ -1194,6 +1211,9 @@ ENDIF
    CHARACTER(*),    INTENT(  OUT) :: ErrMsg
 ! Local 
    INTEGER(IntKi)                 :: i,j,k
+   INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
+   INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
+   INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
    INTEGER(IntKi)                 :: ErrStat2
    CHARACTER(ErrMsgLen)           :: ErrMsg2
    CHARACTER(*), PARAMETER        :: RoutineName = 'Conv_Rdtn_CopyMisc'
@@ -1201,6 +1221,49 @@ ENDIF
    ErrStat = ErrID_None
    ErrMsg  = ""
     DstMiscData%LastIndRdtn = SrcMiscData%LastIndRdtn
+IF (ALLOCATED(SrcMiscData%RdtnTail)) THEN
+  i1_l = LBOUND(SrcMiscData%RdtnTail,1)
+  i1_u = UBOUND(SrcMiscData%RdtnTail,1)
+  i2_l = LBOUND(SrcMiscData%RdtnTail,2)
+  i2_u = UBOUND(SrcMiscData%RdtnTail,2)
+  IF (.NOT. ALLOCATED(DstMiscData%RdtnTail)) THEN 
+    ALLOCATE(DstMiscData%RdtnTail(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%RdtnTail.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstMiscData%RdtnTail = SrcMiscData%RdtnTail
+ENDIF
+    DstMiscData%TailBlock = SrcMiscData%TailBlock
+IF (ALLOCATED(SrcMiscData%HistFFT)) THEN
+  i1_l = LBOUND(SrcMiscData%HistFFT,1)
+  i1_u = UBOUND(SrcMiscData%HistFFT,1)
+  i2_l = LBOUND(SrcMiscData%HistFFT,2)
+  i2_u = UBOUND(SrcMiscData%HistFFT,2)
+  i3_l = LBOUND(SrcMiscData%HistFFT,3)
+  i3_u = UBOUND(SrcMiscData%HistFFT,3)
+  IF (.NOT. ALLOCATED(DstMiscData%HistFFT)) THEN 
+    ALLOCATE(DstMiscData%HistFFT(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%HistFFT.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstMiscData%HistFFT = SrcMiscData%HistFFT
+ENDIF
+IF (ALLOCATED(SrcMiscData%HistFFTBlock)) THEN
+  i1_l = LBOUND(SrcMiscData%HistFFTBlock,1)
+  i1_u = UBOUND(SrcMiscData%HistFFTBlock,1)
+  IF (.NOT. ALLOCATED(DstMiscData%HistFFTBlock)) THEN 
+    ALLOCATE(DstMiscData%HistFFTBlock(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%HistFFTBlock.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstMiscData%HistFFTBlock = SrcMiscData%HistFFTBlock
+ENDIF
  END SUBROUTINE Conv_Rdtn_CopyMisc
 
  SUBROUTINE Conv_Rdtn_DestroyMisc( MiscData, ErrStat, ErrMsg )
@@ -1212,6 +1275,15 @@ ENDIF
 ! 
   ErrStat = ErrID_None
   ErrMsg  = ""
+IF (ALLOCATED(MiscData%RdtnTail)) THEN
+  DEALLOCATE(MiscData%RdtnTail)
+ENDIF
+IF (ALLOCATED(MiscData%HistFFT)) THEN
+  DEALLOCATE(MiscData%HistFFT)
+ENDIF
+IF (ALLOCATED(MiscData%HistFFTBlock)) THEN
+  DEALLOCATE(MiscData%HistFFTBlock)
+ENDIF
  END SUBROUTINE Conv_Rdtn_DestroyMisc
 
  SUBROUTINE Conv_Rdtn_PackMisc( ReKiBuf, DbKiBuf, IntKiBuf, Indata, ErrStat, ErrMsg, SizeOnly )
@@ -1250,6 +1322,22 @@ ENDIF
   Db_BufSz  = 0
   Int_BufSz  = 0
       Int_BufSz  = Int_BufSz  + 1  ! LastIndRdtn
+  Int_BufSz   = Int_BufSz   + 1     ! RdtnTail allocated yes/no
+  IF ( ALLOCATED(InData%RdtnTail) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! RdtnTail upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%RdtnTail)  ! RdtnTail
+  END IF
+      Int_BufSz  = Int_BufSz  + 1  ! TailBlock
+  Int_BufSz   = Int_BufSz   + 1     ! HistFFT allocated yes/no
+  IF ( ALLOCATED(InData%HistFFT) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*3  ! HistFFT upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%HistFFT)  ! HistFFT
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! HistFFTBlock allocated yes/no
+  IF ( ALLOCATED(InData%HistFFTBlock) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! HistFFTBlock upper/lower bounds for each dimension
+      Int_BufSz  = Int_BufSz  + SIZE(InData%HistFFTBlock)  ! HistFFTBlock
+  END IF
   IF ( Re_BufSz  .GT. 0 ) THEN 
      ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
      IF (ErrStat2 /= 0) THEN 
@@ -1279,6 +1367,56 @@ ENDIF
 
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%LastIndRdtn
       Int_Xferred   = Int_Xferred   + 1
+  IF ( .NOT. ALLOCATED(InData%RdtnTail) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%RdtnTail,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%RdtnTail,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%RdtnTail,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%RdtnTail,2)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%RdtnTail)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%RdtnTail))-1 ) = PACK(InData%RdtnTail,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%RdtnTail)
+  END IF
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%TailBlock
+      Int_Xferred   = Int_Xferred   + 1
+  IF ( .NOT. ALLOCATED(InData%HistFFT) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%HistFFT,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%HistFFT,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%HistFFT,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%HistFFT,2)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%HistFFT,3)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%HistFFT,3)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%HistFFT)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%HistFFT))-1 ) = PACK(InData%HistFFT,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%HistFFT)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%HistFFTBlock) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%HistFFTBlock,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%HistFFTBlock,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%HistFFTBlock)>0) IntKiBuf ( Int_Xferred:Int_Xferred+(SIZE(InData%HistFFTBlock))-1 ) = PACK(InData%HistFFTBlock,.TRUE.)
+      Int_Xferred   = Int_Xferred   + SIZE(InData%HistFFTBlock)
+  END IF
  END SUBROUTINE Conv_Rdtn_PackMisc
 
  SUBROUTINE Conv_Rdtn_UnPackMisc( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
@@ -1300,6 +1438,9 @@ ENDIF
   LOGICAL, ALLOCATABLE           :: mask3(:,:,:)
   LOGICAL, ALLOCATABLE           :: mask4(:,:,:,:)
   LOGICAL, ALLOCATABLE           :: mask5(:,:,:,:,:)
+  INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
+  INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
+  INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
   INTEGER(IntKi)                 :: ErrStat2
   CHARACTER(ErrMsgLen)           :: ErrMsg2
   CHARACTER(*), PARAMETER        :: RoutineName = 'Conv_Rdtn_UnPackMisc'
@@ -1315,6 +1456,86 @@ ENDIF
   Int_Xferred  = 1
       OutData%LastIndRdtn = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RdtnTail not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%RdtnTail)) DEALLOCATE(OutData%RdtnTail)
+    ALLOCATE(OutData%RdtnTail(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RdtnTail.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%RdtnTail)>0) OutData%RdtnTail = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%RdtnTail))-1 ), mask2, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%RdtnTail)
+    DEALLOCATE(mask2)
+  END IF
+      OutData%TailBlock = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! HistFFT not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%HistFFT)) DEALLOCATE(OutData%HistFFT)
+    ALLOCATE(OutData%HistFFT(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%HistFFT.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask3(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask3.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask3 = .TRUE. 
+      IF (SIZE(OutData%HistFFT)>0) OutData%HistFFT = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%HistFFT))-1 ), mask3, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%HistFFT)
+    DEALLOCATE(mask3)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! HistFFTBlock not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%HistFFTBlock)) DEALLOCATE(OutData%HistFFTBlock)
+    ALLOCATE(OutData%HistFFTBlock(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%HistFFTBlock.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%HistFFTBlock)>0) OutData%HistFFTBlock = UNPACK( IntKiBuf ( Int_Xferred:Int_Xferred+(SIZE(OutData%HistFFTBlock))-1 ), mask1, 0_IntKi )
+      Int_Xferred   = Int_Xferred   + SIZE(OutData%HistFFTBlock)
+    DEALLOCATE(mask1)
+  END IF
  END SUBROUTINE Conv_Rdtn_UnPackMisc
 
  SUBROUTINE Conv_Rdtn_CopyParam( SrcParamData, DstParamData, CtrlCode, ErrStat, ErrMsg )
@@ -1328,6 +1549,7 @@ ENDIF
    INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
    INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
    INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
+   INTEGER(IntKi)                 :: i4, i4_l, i4_u  !  bounds (upper/lower) for an array dimension 4
    INTEGER(IntKi)                 :: ErrStat2
    CHARACTER(ErrMsgLen)           :: ErrMsg2
    CHARACTER(*), PARAMETER        :: RoutineName = 'Conv_Rdtn_CopyParam'
@@ -1354,6 +1576,27 @@ IF (ALLOCATED(SrcParamData%RdtnKrnl)) THEN
 ENDIF
     DstParamData%NStepRdtn = SrcParamData%NStepRdtn
     DstParamData%NStepRdtn1 = SrcParamData%NStepRdtn1
+    DstParamData%NStepHist = SrcParamData%NStepHist
+    DstParamData%NBlkRdtn = SrcParamData%NBlkRdtn
+    DstParamData%NumBlkRdtn = SrcParamData%NumBlkRdtn
+IF (ALLOCATED(SrcParamData%RdtnKrnlFFT)) THEN
+  i1_l = LBOUND(SrcParamData%RdtnKrnlFFT,1)
+  i1_u = UBOUND(SrcParamData%RdtnKrnlFFT,1)
+  i2_l = LBOUND(SrcParamData%RdtnKrnlFFT,2)
+  i2_u = UBOUND(SrcParamData%RdtnKrnlFFT,2)
+  i3_l = LBOUND(SrcParamData%RdtnKrnlFFT,3)
+  i3_u = UBOUND(SrcParamData%RdtnKrnlFFT,3)
+  i4_l = LBOUND(SrcParamData%RdtnKrnlFFT,4)
+  i4_u = UBOUND(SrcParamData%RdtnKrnlFFT,4)
+  IF (.NOT. ALLOCATED(DstParamData%RdtnKrnlFFT)) THEN 
+    ALLOCATE(DstParamData%RdtnKrnlFFT(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u,i4_l:i4_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%RdtnKrnlFFT.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstParamData%RdtnKrnlFFT = SrcParamData%RdtnKrnlFFT
+ENDIF
  END SUBROUTINE Conv_Rdtn_CopyParam
 
  SUBROUTINE Conv_Rdtn_DestroyParam( ParamData, ErrStat, ErrMsg )
@@ -1367,6 +1610,9 @@ ENDIF
   ErrMsg  = ""
 IF (ALLOCATED(ParamData%RdtnKrnl)) THEN
   DEALLOCATE(ParamData%RdtnKrnl)
+ENDIF
+IF (ALLOCATED(ParamData%RdtnKrnlFFT)) THEN
+  DEALLOCATE(ParamData%RdtnKrnlFFT)
 ENDIF
  END SUBROUTINE Conv_Rdtn_DestroyParam
 
@@ -1414,6 +1660,14 @@ ENDIF
   END IF
       Int_BufSz  = Int_BufSz  + 1  ! NStepRdtn
       Int_BufSz  = Int_BufSz  + 1  ! NStepRdtn1
+      Int_BufSz  = Int_BufSz  + 1  ! NStepHist
+      Int_BufSz  = Int_BufSz  + 1  ! NBlkRdtn
+      Int_BufSz  = Int_BufSz  + 1  ! NumBlkRdtn
+  Int_BufSz   = Int_BufSz   + 1     ! RdtnKrnlFFT allocated yes/no
+  IF ( ALLOCATED(InData%RdtnKrnlFFT) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*4  ! RdtnKrnlFFT upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%RdtnKrnlFFT)  ! RdtnKrnlFFT
+  END IF
   IF ( Re_BufSz  .GT. 0 ) THEN 
      ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
      IF (ErrStat2 /= 0) THEN 
@@ -1468,6 +1722,34 @@ ENDIF
       Int_Xferred   = Int_Xferred   + 1
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NStepRdtn1
       Int_Xferred   = Int_Xferred   + 1
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NStepHist
+      Int_Xferred   = Int_Xferred   + 1
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NBlkRdtn
+      Int_Xferred   = Int_Xferred   + 1
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NumBlkRdtn
+      Int_Xferred   = Int_Xferred   + 1
+  IF ( .NOT. ALLOCATED(InData%RdtnKrnlFFT) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%RdtnKrnlFFT,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%RdtnKrnlFFT,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%RdtnKrnlFFT,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%RdtnKrnlFFT,2)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%RdtnKrnlFFT,3)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%RdtnKrnlFFT,3)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%RdtnKrnlFFT,4)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%RdtnKrnlFFT,4)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%RdtnKrnlFFT)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%RdtnKrnlFFT))-1 ) = PACK(InData%RdtnKrnlFFT,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%RdtnKrnlFFT)
+  END IF
  END SUBROUTINE Conv_Rdtn_PackParam
 
  SUBROUTINE Conv_Rdtn_UnPackParam( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
@@ -1492,6 +1774,7 @@ ENDIF
   INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
   INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
   INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
+  INTEGER(IntKi)                 :: i4, i4_l, i4_u  !  bounds (upper/lower) for an array dimension 4
   INTEGER(IntKi)                 :: ErrStat2
   CHARACTER(ErrMsgLen)           :: ErrMsg2
   CHARACTER(*), PARAMETER        :: RoutineName = 'Conv_Rdtn_UnPackParam'
@@ -1542,6 +1825,44 @@ ENDIF
       Int_Xferred   = Int_Xferred + 1
       OutData%NStepRdtn1 = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
+      OutData%NStepHist = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
+      OutData%NBlkRdtn = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
+      OutData%NumBlkRdtn = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! RdtnKrnlFFT not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i4_l = IntKiBuf( Int_Xferred    )
+    i4_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%RdtnKrnlFFT)) DEALLOCATE(OutData%RdtnKrnlFFT)
+    ALLOCATE(OutData%RdtnKrnlFFT(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u,i4_l:i4_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%RdtnKrnlFFT.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask4(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u,i4_l:i4_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask4.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask4 = .TRUE. 
+      IF (SIZE(OutData%RdtnKrnlFFT)>0) OutData%RdtnKrnlFFT = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%RdtnKrnlFFT))-1 ), mask4, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%RdtnKrnlFFT)
+    DEALLOCATE(mask4)
+  END IF
  END SUBROUTINE Conv_Rdtn_UnPackParam
 
  SUBROUTINE Conv_Rdtn_CopyInput( SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg )
@@ -0,0 +1,524 @@
+!**********************************************************************************************************************************
+! The HydroDyn_Cache module holds the file cache shared by the HydroDyn modules (Waves, Waves2, WAMIT, WAMIT2, and SS_Radiation):
+! each cached calculation is stored in its own file, named by a hash of its packed inputs (the key), in the directory WvCacheDir.
+!..................................................................................................................................
+! LICENSING
+! Copyright (C) 2016  National Renewable Energy Laboratory
+!
+!    This file is part of HydroDyn.
+!
+! Licensed under the Apache License, Version 2.0 (the "License");
+! you may not use this file except in compliance with the License.
+! You may obtain a copy of the License at
+!
+!     http://www.apache.org/licenses/LICENSE-2.0
+!
+! Unless required by applicable law or agreed to in writing, software
+! distributed under the License is distributed on an "AS IS" BASIS,
+! WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+! See the License for the specific language governing permissions and
+! limitations under the License.
+!    
+!**********************************************************************************************************************************
+MODULE HydroDyn_Cache
+
+   USE NWTC_Library
+      
+   IMPLICIT NONE
+   
+   PRIVATE
+
+   INTEGER(B4Ki),  PARAMETER            :: HDCacheVersion = 2                    ! Version of the cache files; increment it when the cached calculations or the packed types change
+   INTEGER(B4Ki),  PARAMETER            :: HDCacheHeader(4) = (/ HDCacheVersion, INT(ReKi,B4Ki), INT(DbKi,B4Ki), INT(IntKi,B4Ki) /)  ! Header of the cache files
+
+   
+      ! ..... Public Subroutines ...................................................................................................
+
+   PUBLIC :: HDCache_FileName                     ! Return the name of the cache file for a set of inputs
+   PUBLIC :: HDCache_Read                         ! Read results from the cache
+   PUBLIC :: HDCache_ReadBegin                    ! Start reading large results from the cache in sections
+   PUBLIC :: HDCache_ReadEnd                      ! Finish reading results started with HDCache_ReadBegin
+   PUBLIC :: HDCache_Write                        ! Write results to the cache
+   PUBLIC :: HDCache_WriteBegin                   ! Start writing large results to the cache in sections
+   PUBLIC :: HDCache_WriteEnd                     ! Finish writing results started with HDCache_WriteBegin
+   PUBLIC :: HDCache_PackMsg                      ! Pack the warnings of a cached calculation for the cache file
+   PUBLIC :: HDCache_UnPackMsg                    ! Unpack the warnings of a cached calculation from the cache file
+   PUBLIC :: HDCache_FileChecksum                 ! Return a checksum of the contents of a file (for the keys of cached file data)
+
+   PRIVATE:: HDCache_HashWords
+   PRIVATE:: HDCache_DeleteFile
+
+CONTAINS
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This function returns the name of the HydroDyn cache file for a key (the packed inputs of the cached calculation).  The
+!! name holds a 62-bit hash of the key, so a change in any of the inputs selects another file.  The code of the cached calculation
+!! (e.g., UserWaveSpctrm) isn't part of the key: increment HDCacheVersion or empty the cache directory when it changes.
+FUNCTION HDCache_FileName ( CacheDir, Prefix, KeyRe, KeyDb, KeyInt )
+
+   CHARACTER(*),                    INTENT(IN   )  :: CacheDir    !< Directory of the cache files
+   CHARACTER(*),                    INTENT(IN   )  :: Prefix      !< Name of the cached calculation
+   REAL(ReKi),         ALLOCATABLE, INTENT(IN   )  :: KeyRe(:)    !< Packed reals of the key
+   REAL(DbKi),         ALLOCATABLE, INTENT(IN   )  :: KeyDb(:)    !< Packed doubles of the key
+   INTEGER(IntKi),     ALLOCATABLE, INTENT(IN   )  :: KeyInt(:)   !< Packed integers of the key
+   CHARACTER(1024)                                 :: HDCache_FileName
+
+      ! Local Variables
+   INTEGER(B8Ki)                                   :: Hash(2)     ! Two polynomial hashes (with different multipliers) of the key
+   CHARACTER(16)                                   :: HashStr     ! Hash in hexadecimal
+
+
+   Hash = HDCacheVersion
+   IF ( ALLOCATED(KeyRe)  ) CALL HDCache_HashWords( Hash, TRANSFER( KeyRe,  (/ 0_B4Ki /) ) )
+   IF ( ALLOCATED(KeyDb)  ) CALL HDCache_HashWords( Hash, TRANSFER( KeyDb,  (/ 0_B4Ki /) ) )
+   IF ( ALLOCATED(KeyInt) ) CALL HDCache_HashWords( Hash, TRANSFER( KeyInt, (/ 0_B4Ki /) ) )
+
+   WRITE (HashStr,'(2Z8.8)') INT( Hash, B4Ki )
+   HDCache_FileName = TRIM(CacheDir)//PathSep//TRIM(Prefix)//'_'//HashStr//'.wvc'
+
+END FUNCTION HDCache_FileName
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine adds a block of words (and its length) to the two polynomial hashes used by the cache.
+SUBROUTINE HDCache_HashWords ( Hash, Words )
+
+   INTEGER(B8Ki),                   INTENT(INOUT)  :: Hash(2)     !< Two polynomial hashes (with different multipliers)
+   INTEGER(B4Ki),                   INTENT(IN   )  :: Words(:)    !< Words to add to the hashes
+
+      ! Local Variables
+   INTEGER(B8Ki),      PARAMETER                   :: HashMod = 2147483647_B8Ki     ! Modulus of the polynomial hashes (2^31-1)
+   INTEGER(B8Ki)                                   :: W           ! Current word as an unsigned value
+   INTEGER(IntKi)                                  :: I           ! Generic index
+
+
+      ! Both hashes stay below 2^31, so the products fit in 64 bits
+   Hash = MOD( Hash + SIZE(Words), HashMod )
+   DO I = 1,SIZE(Words)
+      W       = IAND( INT( Words(I), B8Ki ), 4294967295_B8Ki )
+      Hash(1) = MOD( Hash(1)*65599_B8Ki + W, HashMod )
+      Hash(2) = MOD( Hash(2)*92821_B8Ki + W, HashMod )
+   END DO
+
+END SUBROUTINE HDCache_HashWords
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine returns a checksum of the contents of a file: the two 31-bit cache hashes of its bytes.  Calculations that read
+!! input files (e.g., the WAMIT output files) put the checksums of those files in their cache key, so an edited file selects
+!! another cache file.  Reading the bytes is much faster than parsing the text.  Found is .FALSE. if the file can't be read.
+SUBROUTINE HDCache_FileChecksum ( FileName, Checksum, Found )
+
+   CHARACTER(*),                    INTENT(IN   )  :: FileName    !< Name of the file
+   INTEGER(IntKi),                  INTENT(  OUT)  :: Checksum(2) !< Checksum of the contents of the file
+   LOGICAL,                         INTENT(  OUT)  :: Found       !< Whether the file was read
+
+      ! Local Variables
+   INTEGER(B8Ki),      PARAMETER                   :: ChunkWords = 1048576_B8Ki     ! Number of words read at a time (4 MB)
+   INTEGER(B4Ki),      ALLOCATABLE                 :: Words(:)    ! One chunk of the file
+   INTEGER(B1Ki)                                   :: Tail(4)     ! Bytes at the end of the file that don't fill a word
+   INTEGER(B8Ki)                                   :: Hash(2)     ! Two polynomial hashes (with different multipliers) of the file
+   INTEGER(B8Ki)                                   :: FileSize    ! Size of the file (bytes)
+   INTEGER(B8Ki)                                   :: NumLeft     ! Number of words still to be read
+   INTEGER(IntKi)                                  :: NumRead     ! Number of words read in this chunk
+   INTEGER(IntKi)                                  :: UnIn        ! Unit number of the file
+   INTEGER(IntKi)                                  :: IOS         ! I/O status
+   INTEGER(IntKi)                                  :: ErrStat2    ! Temporary error status
+   CHARACTER(ErrMsgLen)                            :: ErrMsg2     ! Temporary error message
+
+
+   Found    = .FALSE.
+   Checksum = 0
+
+   CALL GetNewUnit( UnIn, ErrStat2, ErrMsg2 )
+   CALL OpenBInpFile( UnIn, TRIM(FileName), ErrStat2, ErrMsg2 )
+   IF ( ErrStat2 >= AbortErrLev ) RETURN
+
+   INQUIRE ( UNIT=UnIn, SIZE=FileSize, IOSTAT=IOS )
+   IF ( IOS == 0 .AND. FileSize >= 0 ) THEN
+      ALLOCATE ( Words( MAX( 1_B8Ki, MIN( ChunkWords, FileSize/4 ) ) ), STAT=IOS )
+   ELSE
+      IOS = 1
+   END IF
+
+   Hash    = 0
+   NumLeft = FileSize/4
+   DO WHILE ( IOS == 0 .AND. NumLeft > 0 )
+      NumRead = INT( MIN( ChunkWords, NumLeft ), IntKi )
+      READ (UnIn, IOSTAT=IOS)  Words(1:NumRead)
+      IF ( IOS == 0 ) CALL HDCache_HashWords( Hash, Words(1:NumRead) )
+      NumLeft = NumLeft - NumRead
+   END DO
+
+   IF ( IOS == 0 .AND. MOD( FileSize, 4_B8Ki ) > 0 ) THEN
+      Tail = 0
+      READ (UnIn, IOSTAT=IOS)  Tail(1:MOD( FileSize, 4_B8Ki ))
+      IF ( IOS == 0 ) CALL HDCache_HashWords( Hash, TRANSFER( Tail, (/ 0_B4Ki /) ) )
+   END IF
+
+   CLOSE ( UnIn )
+
+   Found = IOS == 0
+   IF ( Found ) Checksum = INT( Hash, IntKi )
+
+END SUBROUTINE HDCache_FileChecksum
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine reads the packed results of a cached calculation from a file written by HDCache_Write.  The key is stored in
+!! the file and compared with the one given, so a hash collision can't return the results of other inputs.  Found is .FALSE. if
+!! the file doesn't exist, was written by another version or build, or can't be read; this isn't an error.
+SUBROUTINE HDCache_Read ( FileName, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, Found )
+
+   CHARACTER(*),                    INTENT(IN   )  :: FileName    !< Name of the cache file (from HDCache_FileName)
+   REAL(ReKi),         ALLOCATABLE, INTENT(IN   )  :: KeyRe(:)    !< Packed reals of the key
+   REAL(DbKi),         ALLOCATABLE, INTENT(IN   )  :: KeyDb(:)    !< Packed doubles of the key
+   INTEGER(IntKi),     ALLOCATABLE, INTENT(IN   )  :: KeyInt(:)   !< Packed integers of the key
+   REAL(ReKi),         ALLOCATABLE, INTENT(  OUT)  :: ValRe(:)    !< Packed reals of the results
+   REAL(DbKi),         ALLOCATABLE, INTENT(  OUT)  :: ValDb(:)    !< Packed doubles of the results
+   INTEGER(IntKi),     ALLOCATABLE, INTENT(  OUT)  :: ValInt(:)   !< Packed integers of the results
+   LOGICAL,                         INTENT(  OUT)  :: Found       !< Whether the results were read
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: NumVal(3)   ! Numbers of reals, doubles, and integers of the results
+   INTEGER(B8Ki)                                   :: PosVal(3)   ! File positions of the reals, doubles, and integers of the results
+   INTEGER(IntKi)                                  :: UnIn        ! Unit number of the file
+   INTEGER(IntKi)                                  :: IOS         ! I/O status
+
+
+   CALL HDCache_ReadBegin( FileName, KeyRe, KeyDb, KeyInt, NumVal, UnIn, PosVal, Found )
+   IF ( .NOT. Found ) RETURN
+
+   ALLOCATE ( ValRe(NumVal(1)), ValDb(NumVal(2)), ValInt(NumVal(3)), STAT=IOS )
+   IF ( IOS == 0 .AND. NumVal(1) > 0 ) READ (UnIn, IOSTAT=IOS)  ValRe
+   IF ( IOS == 0 .AND. NumVal(2) > 0 ) READ (UnIn, IOSTAT=IOS)  ValDb
+   IF ( IOS == 0 .AND. NumVal(3) > 0 ) READ (UnIn, IOSTAT=IOS)  ValInt
+
+   CALL HDCache_ReadEnd( UnIn )
+
+   Found = IOS == 0
+   IF ( .NOT. Found ) THEN
+      IF ( ALLOCATED(ValRe)  ) DEALLOCATE(ValRe)
+      IF ( ALLOCATED(ValDb)  ) DEALLOCATE(ValDb)
+      IF ( ALLOCATED(ValInt) ) DEALLOCATE(ValInt)
+   END IF
+
+END SUBROUTINE HDCache_Read
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine opens a HydroDyn cache file to read results too large to unpack from one more copy (see HDCache_Read), the
+!! inverse of HDCache_WriteBegin.  It checks the header and the key and returns the numbers of reals (ReKi), doubles (DbKi), and
+!! integers (IntKi) of the results, and their positions in the file.  The file is left at the first real; the caller reads the
+!! results from unit UnIn with unformatted READ statements (with POS=PosVal(i) to skip to a kind), in as many sections as it
+!! likes, and calls HDCache_ReadEnd.  Found is .FALSE., and the file is closed, as in HDCache_Read.
+SUBROUTINE HDCache_ReadBegin ( FileName, KeyRe, KeyDb, KeyInt, NumVal, UnIn, PosVal, Found )
+
+   CHARACTER(*),                    INTENT(IN   )  :: FileName    !< Name of the cache file (from HDCache_FileName)
+   REAL(ReKi),         ALLOCATABLE, INTENT(IN   )  :: KeyRe(:)    !< Packed reals of the key
+   REAL(DbKi),         ALLOCATABLE, INTENT(IN   )  :: KeyDb(:)    !< Packed doubles of the key
+   INTEGER(IntKi),     ALLOCATABLE, INTENT(IN   )  :: KeyInt(:)   !< Packed integers of the key
+   INTEGER(IntKi),                  INTENT(  OUT)  :: NumVal(3)   !< Numbers of reals, doubles, and integers of the results
+   INTEGER(IntKi),                  INTENT(  OUT)  :: UnIn        !< Unit number of the file; -1 if it wasn't opened
+   INTEGER(B8Ki),                   INTENT(  OUT)  :: PosVal(3)   !< File positions of the reals, doubles, and integers of the results
+   LOGICAL,                         INTENT(  OUT)  :: Found       !< Whether the file holds results for this key
+
+      ! Local Variables
+   REAL(ReKi),         ALLOCATABLE                 :: FileRe(:)   ! Packed reals of the key in the file
+   REAL(DbKi),         ALLOCATABLE                 :: FileDb(:)   ! Packed doubles of the key in the file
+   INTEGER(IntKi),     ALLOCATABLE                 :: FileInt(:)  ! Packed integers of the key in the file
+   INTEGER(B4Ki)                                   :: Header(SIZE(HDCacheHeader))  ! Header of the file
+   INTEGER(B4Ki)                                   :: ArraySizes(6)                ! Sizes of the key and result arrays in the file
+   INTEGER(B4Ki)                                   :: KeySizes(3)                  ! Sizes of the key arrays
+   INTEGER(IntKi)                                  :: IOS         ! I/O status
+   INTEGER(IntKi)                                  :: ErrStat2    ! Temporary error status
+   CHARACTER(ErrMsgLen)                            :: ErrMsg2     ! Temporary error message
+   LOGICAL                                         :: Exists      ! Whether the file exists
+
+
+   Found  = .FALSE.
+   NumVal = 0
+   PosVal = 0
+   UnIn   = -1
+
+   KeySizes = 0
+   IF ( ALLOCATED(KeyRe)  ) KeySizes(1) = SIZE(KeyRe)
+   IF ( ALLOCATED(KeyDb)  ) KeySizes(2) = SIZE(KeyDb)
+   IF ( ALLOCATED(KeyInt) ) KeySizes(3) = SIZE(KeyInt)
+
+   INQUIRE ( FILE=TRIM(FileName), EXIST=Exists )
+   IF ( .NOT. Exists ) RETURN
+
+   CALL GetNewUnit( UnIn, ErrStat2, ErrMsg2 )
+   OPEN ( UnIn, FILE=TRIM(FileName), STATUS='OLD', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='READ', IOSTAT=IOS )
+   IF ( IOS /= 0 ) THEN
+      UnIn = -1
+      RETURN
+   END IF
+
+   READ (UnIn, IOSTAT=IOS)  Header
+   IF ( IOS == 0 ) THEN
+      IF ( ANY( Header /= HDCacheHeader ) ) IOS = 1
+   END IF
+   IF ( IOS == 0 ) READ (UnIn, IOSTAT=IOS)  ArraySizes
+   IF ( IOS == 0 ) THEN
+      IF ( ANY( ArraySizes(1:3) /= KeySizes ) .OR. ANY( ArraySizes(4:6) < 0 ) ) IOS = 1
+   END IF
+
+   IF ( IOS == 0 ) THEN
+      ALLOCATE ( FileRe(ArraySizes(1)), FileDb(ArraySizes(2)), FileInt(ArraySizes(3)), STAT=IOS )
+   END IF
+   IF ( IOS == 0 .AND. ArraySizes(1) > 0 ) READ (UnIn, IOSTAT=IOS)  FileRe
+   IF ( IOS == 0 .AND. ArraySizes(2) > 0 ) READ (UnIn, IOSTAT=IOS)  FileDb
+   IF ( IOS == 0 .AND. ArraySizes(3) > 0 ) READ (UnIn, IOSTAT=IOS)  FileInt
+   IF ( IOS == 0 .AND. ArraySizes(1) > 0 ) THEN
+      IF ( ANY( FileRe  /= KeyRe  ) ) IOS = 1
+   END IF
+   IF ( IOS == 0 .AND. ArraySizes(2) > 0 ) THEN
+      IF ( ANY( FileDb  /= KeyDb  ) ) IOS = 1
+   END IF
+   IF ( IOS == 0 .AND. ArraySizes(3) > 0 ) THEN
+      IF ( ANY( FileInt /= KeyInt ) ) IOS = 1
+   END IF
+
+      ! the results follow the key: the reals, then the doubles, then the integers
+   IF ( IOS == 0 ) INQUIRE ( UnIn, POS=PosVal(1), IOSTAT=IOS )
+   IF ( IOS == 0 ) THEN
+      NumVal    = ArraySizes(4:6)
+      PosVal(2) = PosVal(1) + INT(NumVal(1),B8Ki)*(STORAGE_SIZE(0.0_ReKi)/8)
+      PosVal(3) = PosVal(2) + INT(NumVal(2),B8Ki)*(STORAGE_SIZE(0.0_DbKi)/8)
+   END IF
+
+   Found = IOS == 0
+   IF ( .NOT. Found ) THEN
+      NumVal = 0
+      CALL HDCache_ReadEnd( UnIn )
+   END IF
+
+END SUBROUTINE HDCache_ReadBegin
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine closes a cache file opened by HDCache_ReadBegin.
+SUBROUTINE HDCache_ReadEnd ( UnIn )
+
+   INTEGER(IntKi),                  INTENT(INOUT)  :: UnIn        !< Unit number of the file (from HDCache_ReadBegin); -1 on return
+
+   IF ( UnIn > 0 ) CLOSE ( UnIn )
+   UnIn = -1
+
+END SUBROUTINE HDCache_ReadEnd
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine writes the key and the packed results of a calculation to a HydroDyn cache file.  A file that can't be
+!! written only gives a warning: the simulation doesn't need the cache.
+SUBROUTINE HDCache_Write ( FileName, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, ErrStat, ErrMsg )
+
+   CHARACTER(*),                    INTENT(IN   )  :: FileName    !< Name of the cache file (from HDCache_FileName)
+   REAL(ReKi),         ALLOCATABLE, INTENT(IN   )  :: KeyRe(:)    !< Packed reals of the key
+   REAL(DbKi),         ALLOCATABLE, INTENT(IN   )  :: KeyDb(:)    !< Packed doubles of the key
+   INTEGER(IntKi),     ALLOCATABLE, INTENT(IN   )  :: KeyInt(:)   !< Packed integers of the key
+   REAL(ReKi),         ALLOCATABLE, INTENT(IN   )  :: ValRe(:)    !< Packed reals of the results
+   REAL(DbKi),         ALLOCATABLE, INTENT(IN   )  :: ValDb(:)    !< Packed doubles of the results
+   INTEGER(IntKi),     ALLOCATABLE, INTENT(IN   )  :: ValInt(:)   !< Packed integers of the results
+   INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+   CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: NumVal(3)   ! Sizes of the result arrays
+   INTEGER(IntKi)                                  :: UnOut       ! Unit number of the file
+   INTEGER(IntKi)                                  :: IOS         ! I/O status
+   INTEGER(IntKi)                                  :: ErrStat2    ! Temporary error status
+   CHARACTER(ErrMsgLen)                            :: ErrMsg2     ! Temporary error message
+   CHARACTER(1024)                                 :: TmpFile     ! Name of the temporary file
+
+
+   NumVal = 0
+   IF ( ALLOCATED(ValRe)  ) NumVal(1) = SIZE(ValRe)
+   IF ( ALLOCATED(ValDb)  ) NumVal(2) = SIZE(ValDb)
+   IF ( ALLOCATED(ValInt) ) NumVal(3) = SIZE(ValInt)
+
+   CALL HDCache_WriteBegin( FileName, KeyRe, KeyDb, KeyInt, NumVal, UnOut, TmpFile, ErrStat, ErrMsg )
+   IF ( UnOut < 0 ) RETURN
+
+   IOS = 0
+   IF ( IOS == 0 .AND. NumVal(1) > 0 )  WRITE (UnOut, IOSTAT=IOS)  ValRe
+   IF ( IOS == 0 .AND. NumVal(2) > 0 )  WRITE (UnOut, IOSTAT=IOS)  ValDb
+   IF ( IOS == 0 .AND. NumVal(3) > 0 )  WRITE (UnOut, IOSTAT=IOS)  ValInt
+
+   CALL HDCache_WriteEnd( FileName, UnOut, TmpFile, IOS, ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'HDCache_Write' )
+
+END SUBROUTINE HDCache_Write
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine starts a HydroDyn cache file for results too large to pack into one more copy (see HDCache_Write).  It
+!! creates a new temporary file in the cache directory and writes the header, the sizes, and the key.  The caller then writes the
+!! NumVal(1) reals (ReKi), NumVal(2) doubles (DbKi), and NumVal(3) integers (IntKi) of the results to unit UnOut with unformatted
+!! WRITE statements, in as many sections as it likes, and calls HDCache_WriteEnd.  UnOut is -1, with a warning, if the file
+!! couldn't be started.
+SUBROUTINE HDCache_WriteBegin ( FileName, KeyRe, KeyDb, KeyInt, NumVal, UnOut, TmpFile, ErrStat, ErrMsg )
+
+   CHARACTER(*),                    INTENT(IN   )  :: FileName    !< Name of the cache file (from HDCache_FileName)
+   REAL(ReKi),         ALLOCATABLE, INTENT(IN   )  :: KeyRe(:)    !< Packed reals of the key
+   REAL(DbKi),         ALLOCATABLE, INTENT(IN   )  :: KeyDb(:)    !< Packed doubles of the key
+   INTEGER(IntKi),     ALLOCATABLE, INTENT(IN   )  :: KeyInt(:)   !< Packed integers of the key
+   INTEGER(IntKi),                  INTENT(IN   )  :: NumVal(3)   !< Numbers of reals, doubles, and integers of the results
+   INTEGER(IntKi),                  INTENT(  OUT)  :: UnOut       !< Unit number of the temporary file; -1 if it couldn't be started
+   CHARACTER(*),                    INTENT(  OUT)  :: TmpFile     !< Name of the temporary file
+   INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+   CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+      ! Local Variables
+   INTEGER(IntKi),     PARAMETER                   :: MaxTries = 16                ! Number of temporary file names tried
+   INTEGER(B4Ki)                                   :: ArraySizes(6)                ! Sizes of the key and result arrays
+   INTEGER(B8Ki)                                   :: ClockCount  ! Current value of the system clock
+   INTEGER(IntKi)                                  :: IOS         ! I/O status
+   INTEGER(IntKi)                                  :: I           ! Generic index
+   INTEGER(IntKi)                                  :: ErrStat2    ! Temporary error status
+   CHARACTER(ErrMsgLen)                            :: ErrMsg2     ! Temporary error message
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   ArraySizes = 0
+   IF ( ALLOCATED(KeyRe)  ) ArraySizes(1) = SIZE(KeyRe)
+   IF ( ALLOCATED(KeyDb)  ) ArraySizes(2) = SIZE(KeyDb)
+   IF ( ALLOCATED(KeyInt) ) ArraySizes(3) = SIZE(KeyInt)
+   ArraySizes(4:6) = NumVal
+
+      ! STATUS='NEW' fails if the file exists, so each simulation writes to its own temporary file.  The name holds the system
+      ! clock, which differs between simulations that finish the same calculation at about the same time.
+   CALL GetNewUnit( UnOut, ErrStat2, ErrMsg2 )
+   IOS = 1
+   DO I = 1,MaxTries
+      CALL SYSTEM_CLOCK ( ClockCount )
+      WRITE (TmpFile,'(A,".",Z16.16,"_",I0,".tmp")')  TRIM(FileName), ClockCount, I
+      OPEN ( UnOut, FILE=TRIM(TmpFile), STATUS='NEW', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='WRITE', IOSTAT=IOS )
+      IF ( IOS == 0 ) EXIT
+   END DO
+   IF ( IOS /= 0 ) THEN
+      UnOut = -1
+      CALL SetErrStat( ErrID_Warn, 'Could not create a temporary file for the HydroDyn cache file "'//TRIM(FileName)//'".', ErrStat, ErrMsg, 'HDCache_WriteBegin' )
+      RETURN
+   END IF
+
+                                            WRITE (UnOut, IOSTAT=IOS)  HDCacheHeader
+   IF ( IOS == 0 )                          WRITE (UnOut, IOSTAT=IOS)  ArraySizes
+   IF ( IOS == 0 .AND. ArraySizes(1) > 0 )  WRITE (UnOut, IOSTAT=IOS)  KeyRe
+   IF ( IOS == 0 .AND. ArraySizes(2) > 0 )  WRITE (UnOut, IOSTAT=IOS)  KeyDb
+   IF ( IOS == 0 .AND. ArraySizes(3) > 0 )  WRITE (UnOut, IOSTAT=IOS)  KeyInt
+
+   IF ( IOS /= 0 ) THEN
+      CLOSE ( UnOut, STATUS='DELETE' )
+      UnOut = -1
+      CALL SetErrStat( ErrID_Warn, 'Could not write the HydroDyn cache file "'//TRIM(FileName)//'".', ErrStat, ErrMsg, 'HDCache_WriteBegin' )
+   END IF
+
+END SUBROUTINE HDCache_WriteBegin
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine finishes a cache file started by HDCache_WriteBegin.  The temporary file is renamed to FileName, so other
+!! simulations sharing the cache directory never read a partly written file.  If IOS shows that a WRITE of the results failed, or
+!! the file can't be renamed, the temporary file is deleted with a warning.
+SUBROUTINE HDCache_WriteEnd ( FileName, UnOut, TmpFile, IOS, ErrStat, ErrMsg )
+
+   USE, INTRINSIC :: ISO_C_BINDING, ONLY : C_INT, C_NULL_CHAR
+
+   INTERFACE
+         ! rename() of the C runtime library: it replaces an existing file atomically on POSIX systems, but fails on Windows
+      FUNCTION HDCache_Rename ( OldName, NewName ) BIND(C, NAME='rename')
+         USE, INTRINSIC :: ISO_C_BINDING, ONLY : C_INT, C_CHAR
+         CHARACTER(KIND=C_CHAR),       INTENT(IN   )  :: OldName(*)  !< Null-terminated name of the existing file
+         CHARACTER(KIND=C_CHAR),       INTENT(IN   )  :: NewName(*)  !< Null-terminated new name of the file
+         INTEGER(C_INT)                               :: HDCache_Rename
+      END FUNCTION HDCache_Rename
+   END INTERFACE
+
+   CHARACTER(*),                    INTENT(IN   )  :: FileName    !< Name of the cache file (from HDCache_FileName)
+   INTEGER(IntKi),                  INTENT(IN   )  :: UnOut       !< Unit number of the temporary file (from HDCache_WriteBegin)
+   CHARACTER(*),                    INTENT(IN   )  :: TmpFile     !< Name of the temporary file (from HDCache_WriteBegin)
+   INTEGER(IntKi),                  INTENT(IN   )  :: IOS         !< I/O status of the last WRITE of the results
+   INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+   CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: IOS2        ! I/O status of closing and renaming the file
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   IF ( IOS /= 0 ) THEN
+         ! Don't leave a truncated file behind
+      CLOSE ( UnOut, STATUS='DELETE' )
+      CALL SetErrStat( ErrID_Warn, 'Could not write the HydroDyn cache file "'//TRIM(FileName)//'".', ErrStat, ErrMsg, 'HDCache_WriteEnd' )
+      RETURN
+   END IF
+   CLOSE ( UnOut, IOSTAT=IOS2 )
+
+      ! On Windows, rename() doesn't replace an existing file (a corrupted one, or one just written by another simulation with the
+      ! same key), so delete that file and try again.
+   IF ( IOS2 == 0 ) THEN
+      IF ( HDCache_Rename( TRIM(TmpFile)//C_NULL_CHAR, TRIM(FileName)//C_NULL_CHAR ) /= 0_C_INT ) THEN
+         CALL HDCache_DeleteFile( FileName )
+         IF ( HDCache_Rename( TRIM(TmpFile)//C_NULL_CHAR, TRIM(FileName)//C_NULL_CHAR ) /= 0_C_INT ) IOS2 = 1
+      END IF
+   END IF
+
+   IF ( IOS2 /= 0 ) THEN
+      CALL HDCache_DeleteFile( TmpFile )
+      CALL SetErrStat( ErrID_Warn, 'Could not move the new HydroDyn cache file to "'//TRIM(FileName)//'".', ErrStat, ErrMsg, 'HDCache_WriteEnd' )
+   END IF
+
+END SUBROUTINE HDCache_WriteEnd
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This function packs an error status and message into integers, so a calculation can store the warnings it gave in its cache
+!! file and give them again when the results are read from the cache.  HDCache_UnPackMsg unpacks them.
+FUNCTION HDCache_PackMsg ( ErrStat, ErrMsg )
+
+   INTEGER(IntKi),                  INTENT(IN   )  :: ErrStat     !< Error status of the cached calculation
+   CHARACTER(*),                    INTENT(IN   )  :: ErrMsg      !< Error message of the cached calculation
+   INTEGER(IntKi),     ALLOCATABLE                 :: HDCache_PackMsg(:)
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: I           ! Generic index
+
+
+   HDCache_PackMsg = (/ ErrStat, LEN_TRIM(ErrMsg), ( ICHAR( ErrMsg(I:I) ), I = 1,LEN_TRIM(ErrMsg) ) /)
+
+END FUNCTION HDCache_PackMsg
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine unpacks an error status and message packed by HDCache_PackMsg.  Found is .FALSE. if Words doesn't hold exactly
+!! one packed message.
+SUBROUTINE HDCache_UnPackMsg ( Words, ErrStat, ErrMsg, Found )
+
+   INTEGER(IntKi),                  INTENT(IN   )  :: Words(:)    !< Packed error status and message
+   INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat     !< Error status of the cached calculation
+   CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg      !< Error message of the cached calculation
+   LOGICAL,                         INTENT(  OUT)  :: Found       !< Whether Words held a packed message
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: I           ! Generic index
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   Found = SIZE(Words) >= 2
+   IF ( Found ) Found = Words(2) >= 0 .AND. SIZE(Words) == 2 + Words(2)
+   IF ( .NOT. Found ) RETURN
+
+   ErrStat = Words(1)
+   DO I = 1,MIN( Words(2), LEN(ErrMsg) )
+      ErrMsg(I:I) = CHAR( Words(2+I) )
+   END DO
+
+END SUBROUTINE HDCache_UnPackMsg
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine deletes a file, if it exists and can be opened; it doesn't return an error.
+SUBROUTINE HDCache_DeleteFile ( FileName )
+
+   CHARACTER(*),                    INTENT(IN   )  :: FileName    !< Name of the file
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: UnDel       ! Unit number of the file
+   INTEGER(IntKi)                                  :: IOS         ! I/O status
+   INTEGER(IntKi)                                  :: ErrStat2    ! Temporary error status
+   CHARACTER(ErrMsgLen)                            :: ErrMsg2     ! Temporary error message
+
+
+   CALL GetNewUnit( UnDel, ErrStat2, ErrMsg2 )
+   OPEN ( UnDel, FILE=TRIM(FileName), STATUS='OLD', IOSTAT=IOS )
+   IF ( IOS == 0 ) CLOSE ( UnDel, STATUS='DELETE', IOSTAT=IOS )
+
+END SUBROUTINE HDCache_DeleteFile
+
+END MODULE HydroDyn_Cache
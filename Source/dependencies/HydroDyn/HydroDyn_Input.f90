@@ -563,6 +563,28 @@ SUBROUTINE HydroDynInput_GetInput( InitInp, ErrStat, ErrMsg )
       END IF
 
 
+      ! WvKinMod - Wave kinematics evaluation model.
+
+   CALL ReadVar ( UnIn, FileName, InitInp%Waves%WvKinMod, 'WvKinMod', &
+                                    'Wave kinematics evaluation model', ErrStat2, ErrMsg2, UnEchoLocal )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'HydroDynInput_GetInput' )
+      IF (ErrStat >= AbortErrLev) THEN
+         CALL CleanUp()
+         RETURN
+      END IF
+
+
+      ! WvCacheDir - Directory of the cache files (wave kinematics, processed WAMIT output, and fitted radiation model).
+
+   CALL ReadVar ( UnIn, FileName, InitInp%Waves%WvCacheDir, 'WvCacheDir', &
+                                    'Directory of the cache files', ErrStat2, ErrMsg2, UnEchoLocal )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'HydroDynInput_GetInput' )
+      IF (ErrStat >= AbortErrLev) THEN
+         CALL CleanUp()
+         RETURN
+      END IF
+
+
 
 
       ! NWaveElev
@@ -878,8 +900,8 @@ SUBROUTINE HydroDynInput_GetInput( InitInp, ErrStat, ErrMsg )
       END IF
 
 
-      ! RdtnMod  - Radiation memory-effect model {1: convolution, 2: state-space} (switch)
-      ! [STATE-SPACE REQUIRES *.ss INPUT FILE]
+      ! RdtnMod  - Radiation memory-effect model {1: convolution, 2: state-space, 3: state-space fitted to the radiation kernels at initialization} (switch)
+      ! [RdtnMod=2 REQUIRES *.ss INPUT FILE]
 
   CALL ReadVar ( UnIn, FileName, InitInp%WAMIT%RdtnMod, 'RdtnMod', &
                                  'Radiation memory-effect model', ErrStat2, ErrMsg2, UnEchoLocal )
@@ -914,6 +936,28 @@ SUBROUTINE HydroDynInput_GetInput( InitInp, ErrStat, ErrMsg )
          RETURN
       END IF
 
+
+      ! RdtnSSOrd - Maximum number of states of the state-space model fitted to each radiation kernel
+
+   CALL ReadVar ( UnIn, FileName, InitInp%WAMIT%SS_Rdtn%FitOrd, 'RdtnSSOrd', 'Maximum number of states of the state-space model fitted to each radiation kernel', ErrStat2, ErrMsg2, UnEchoLocal )
+
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'HydroDynInput_GetInput' )
+      IF (ErrStat >= AbortErrLev) THEN
+         CALL CleanUp()
+         RETURN
+      END IF
+
+
+      ! RdtnSSTol - Relative error tolerance of the fitted radiation kernels
+
+   CALL ReadVar ( UnIn, FileName, InitInp%WAMIT%SS_Rdtn%FitTol, 'RdtnSSTol', 'Relative error tolerance of the fitted radiation kernels', ErrStat2, ErrMsg2, UnEchoLocal )
+
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'HydroDynInput_GetInput' )
+      IF (ErrStat >= AbortErrLev) THEN
+         CALL CleanUp()
+         RETURN
+      END IF
+
    
 !bjj: should we add this?
 !test for numerical stability
@@ -2708,6 +2752,42 @@ SUBROUTINE HydroDynInput_ProcessInitData( InitInp, ErrStat, ErrMsg )
    END IF
 
 
+      ! WvKinMod
+
+   IF ( ( InitInp%Waves%WvKinMod /= 0 ) .AND. ( InitInp%Waves%WvKinMod /= 1 ) ) THEN
+      CALL SetErrStat( ErrID_Fatal,'WvKinMod must be 0 or 1.',ErrStat,ErrMsg,RoutineName)
+      RETURN
+   END IF
+
+   IF ( InitInp%Waves%WvKinMod == 1 ) THEN
+
+      IF ( ( InitInp%Waves%WaveMod == 0 ) .OR. ( InitInp%Waves%WaveMod == 6 ) ) THEN
+            ! There is no wave spectrum to evaluate the kinematics from
+         InitInp%Waves%WvKinMod = 0
+      ELSE IF ( InitInp%Waves2%WvDiffQTFF .OR. InitInp%Waves2%WvSumQTFF ) THEN
+         CALL SetErrStat( ErrID_Fatal,'WvKinMod must be 0 when WvDiffQTF or WvSumQTF is TRUE.',ErrStat,ErrMsg,RoutineName)
+         RETURN
+      ELSE IF ( InitInp%Waves%WaveStMod /= 0 ) THEN
+         CALL SetErrStat( ErrID_Fatal,'WvKinMod must be 0 when WaveStMod is not 0.',ErrStat,ErrMsg,RoutineName)
+         RETURN
+      ELSE IF ( InitInp%Waves%WriteWvKin ) THEN
+         CALL SetErrStat( ErrID_Fatal,'WvKinMod must be 0 when the wave kinematics are written to WvKinFile.',ErrStat,ErrMsg,RoutineName)
+         RETURN
+      END IF
+
+   END IF
+
+
+      ! WvCacheDir
+
+   IF ( LEN_TRIM( InitInp%Waves%WvCacheDir ) > 0 ) THEN
+      IF ( PathIsRelative( InitInp%Waves%WvCacheDir ) ) THEN
+         CALL GetPath( TRIM(InitInp%InputFile), TmpPath )
+         InitInp%Waves%WvCacheDir   = TRIM(TmpPath)//TRIM(InitInp%Waves%WvCacheDir)
+      END IF
+   END IF
+
+
       ! NWaveElev
 
    IF ( InitInp%Waves%NWaveElev < 0 ) THEN
@@ -2929,6 +3009,10 @@ SUBROUTINE HydroDynInput_ProcessInitData( InitInp, ErrStat, ErrMsg )
       END IF
       InitInp%WAMIT%WAMITFile    = InitInp%PotFile
       InitInp%WAMIT2%WAMITFile   = InitInp%PotFile
+
+         ! The processed WAMIT output is cached in the same directory as the wave kinematics
+      InitInp%WAMIT%WvCacheDir   = InitInp%Waves%WvCacheDir
+      InitInp%WAMIT2%WvCacheDir  = InitInp%Waves%WvCacheDir
       
          ! Set the flag for multidirectional waves for WAMIT2 module.  It needs to know since the Newman approximation
          ! can only use uni-directional waves.
@@ -3020,6 +3104,31 @@ SUBROUTINE HydroDynInput_ProcessInitData( InitInp, ErrStat, ErrMsg )
 
       InitInp%WAMIT%Conv_Rdtn%RdtnDT = 0.0
 
+   END IF
+
+       ! RdtnMod, RdtnSSOrd, RdtnSSTol - Radiation memory-effect model and the settings of the fitted state-space model
+
+   IF ( InitInp%PotMod == 1 ) THEN
+
+      IF ( InitInp%WAMIT%RdtnMod < 0 .OR. InitInp%WAMIT%RdtnMod > 3 ) THEN
+         CALL SetErrStat( ErrID_Fatal,'RdtnMod must be 0, 1, 2, or 3.',ErrStat,ErrMsg,RoutineName)
+         RETURN
+      END IF
+
+      IF ( InitInp%WAMIT%RdtnMod == 3 ) THEN
+
+         IF ( InitInp%WAMIT%SS_Rdtn%FitOrd < 1 ) THEN
+            CALL SetErrStat( ErrID_Fatal,'RdtnSSOrd must be at least 1 when RdtnMod = 3.',ErrStat,ErrMsg,RoutineName)
+            RETURN
+         END IF
+
+         IF ( InitInp%WAMIT%SS_Rdtn%FitTol < 0.0 ) THEN
+            CALL SetErrStat( ErrID_Fatal,'RdtnSSTol must not be negative.',ErrStat,ErrMsg,RoutineName)
+            RETURN
+         END IF
+
+      END IF
+
    END IF
 
    !-------------------------------------------------------------------------------------------------
@@ -4071,6 +4180,7 @@ SUBROUTINE HydroDynInput_ProcessInitData( InitInp, ErrStat, ErrMsg )
          InitInp%Waves2%WtrDens     = InitInp%Waves%WtrDens
          InitInp%Waves2%Gravity     = InitInp%Gravity
          InitInp%Waves2%UnSum       = InitInp%UnSum
+         InitInp%Waves2%WvCacheDir  = InitInp%Waves%WvCacheDir
          InitInp%Waves2%WtrDpth     = InitInp%Waves%WtrDpth
          InitInp%Waves2%WaveStMod   = InitInp%Waves%WaveStMod
          InitInp%Waves2%NWaveElev   = InitInp%Waves%NWaveElev
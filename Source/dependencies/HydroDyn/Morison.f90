@@ -273,6 +273,87 @@ FUNCTION InterpWrappedStpInt( XValIn, XAry, YAry, Ind, AryLen )
 END FUNCTION InterpWrappedStpInt ! ( XVal, XAry, YAry, Ind, AryLen )
    
    
+!=======================================================================
+SUBROUTINE FindWrappedStpIndx( XValIn, XAry, Ind, AryLen, Ind1, Ind2, Frac )
+
+
+      ! This routine finds the bracketing indices and the interpolation weight for an input x-value which is wrapped back
+      ! into the range [1-XAry(AryLen)], using the same search as InterpWrappedStpInt.  The search is done once for all of the
+      ! arrays that share XAry:  the interpolated value of a REAL array is YAry(Ind1) + Frac*( YAry(Ind2) - YAry(Ind1) ), and
+      ! the value of an INTEGER array (as returned by InterpWrappedStpInt) is YAry(Ind1).
+      ! It is assumed that XAry is sorted in ascending order.
+
+
+      ! Argument declarations.
+
+   INTEGER, INTENT(IN)          :: AryLen                                          ! Length of the arrays.
+   INTEGER, INTENT(INOUT)       :: Ind                                             ! Initial and final index into the arrays.
+
+   REAL(SiKi), INTENT(IN)       :: XAry    (AryLen)                                ! Array of X values to be interpolated.
+   REAL(SiKi), INTENT(IN)       :: XValIn                                          ! X value to be interpolated.
+   INTEGER, INTENT(OUT)         :: Ind1                                            ! Index of the lower bracketing value.
+   INTEGER, INTENT(OUT)         :: Ind2                                            ! Index of the upper bracketing value.
+   REAL(SiKi), INTENT(OUT)      :: Frac                                            ! Interpolation weight of the upper bracketing value.
+
+   REAL(SiKi)                   :: XVal                                            ! X value to be interpolated.
+   
+   
+   
+      ! Wrap XValIn into the range XAry(1) to XAry(AryLen)
+   XVal = MOD(XValIn, XAry(AryLen))
+
+      ! Set the Ind to the first index if we are at the beginning of XAry
+   IF ( XVal <= XAry(2) )  THEN  
+      Ind           = 1
+   END IF
+   
+   
+        ! Let's check the limits first.
+
+   IF ( XVal <= XAry(1) )  THEN
+      Ind           = 1
+      Ind1          = 1
+      Ind2          = 1
+      Frac          = 0.0_SiKi
+      RETURN
+   ELSE IF ( XVal >= XAry(AryLen) )  THEN
+      Ind           = MAX(AryLen - 1, 1)
+      Ind1          = AryLen
+      Ind2          = AryLen
+      Frac          = 0.0_SiKi
+      RETURN
+   END IF
+
+
+     ! Let's find the bracketing indices!
+
+   Ind = MAX( MIN( Ind, AryLen-1 ), 1 )
+
+   DO
+
+      IF ( XVal < XAry(Ind) )  THEN
+
+         Ind = Ind - 1
+
+      ELSE IF ( XVal >= XAry(Ind+1) )  THEN
+
+         Ind = Ind + 1
+
+      ELSE
+
+         Ind1 = Ind
+         Ind2 = Ind + 1
+         Frac = ( XVal - XAry(Ind) ) / ( XAry(Ind+1) - XAry(Ind) )
+         RETURN
+
+      END IF
+
+   END DO
+
+   RETURN
+END SUBROUTINE FindWrappedStpIndx ! ( XValIn, XAry, Ind, AryLen, Ind1, Ind2, Frac )
+   
+   
 !=======================================================================
 FUNCTION InterpWrappedStpLogical( XValIn, XAry, YAry, Ind, AryLen )
 
@@ -394,9 +475,12 @@ SUBROUTINE DistrBuoyancy( densWater, R, tMG, dRdz, Z, C, g, F_B  )
 END SUBROUTINE DistrBuoyancy
 
 
-SUBROUTINE DistrInertialLoads( nodeIndx, densWater, Ca, Cp, AxCa, AxCp, R, tMG, dRdZ, k, NStepWave, WaveAcc0, WaveDynP0, F_I, ErrStat, ErrMsg  )
+SUBROUTINE DistrInertialLoads( densWater, Ca, Cp, AxCa, AxCp, R, tMG, dRdZ, F_I )
+
+      ! The distributed inertial load on a member with local z axis k (= R_LToG(:,3)), for fluid acceleration a and dynamic pressure p, is
+      !    F_I = F_I(1)*( a - (a.k)*k ) + ( F_I(2)*(a.k) + F_I(3)*p )*k,
+      ! so only the coefficients are stored; see Morison_CalcOutput for their product with the fluid kinematics.
 
-   INTEGER,            INTENT ( IN    )  :: nodeIndx
    REAL(ReKi),         INTENT ( IN    )  :: densWater
    REAL(ReKi),         INTENT ( IN    )  :: Ca
    REAL(ReKi),         INTENT ( IN    )  :: Cp
@@ -405,58 +489,11 @@ SUBROUTINE DistrInertialLoads( nodeIndx, densWater, Ca, Cp, AxCa, AxCp, R, tMG,
    REAL(ReKi),         INTENT ( IN    )  :: R
    REAL(ReKi),         INTENT ( IN    )  :: tMG
    REAL(ReKi),         INTENT ( IN    )  :: dRdZ
-   REAL(ReKi),         INTENT ( IN    )  :: k(3)
-   INTEGER,            INTENT ( IN    )  :: NStepWave
-   REAL(SiKi),         INTENT ( IN    )  :: WaveAcc0(0:,:,:)
-   REAL(SiKi),         INTENT ( IN    )  :: WaveDynP0(0:,:)
-   REAL(ReKi),ALLOCATABLE,  INTENT (   OUT )  :: F_I(:,:)
-   INTEGER,            INTENT (   OUT )  :: ErrStat              ! returns a non-zero value when an error occurs  
-   CHARACTER(*),       INTENT (   OUT )  :: ErrMsg               ! Error message if ErrStat /= ErrID_None
-
-   INTEGER                               :: I
-   REAL(ReKi)                            :: f, f1, f2, f3, adotk !, v_len
-   REAL(ReKi)                            :: v(3), af(3) !p0(3), m(3), 
+   REAL(ReKi),         INTENT (   OUT )  :: F_I(3)         ! transverse (1), axial acceleration (2), and axial dynamic pressure (3) coefficients
    
-      ! Initialize ErrStat
-         
-   ErrStat = ErrID_None         
-   ErrMsg  = "" 
-      
-      ! Allocate F_I
-   ALLOCATE ( F_I(0:NStepWave, 6), STAT = ErrStat )
-   IF ( ErrStat /= ErrID_None ) THEN
-      ErrMsg  = ' Error allocating distributed inertial loads array.'
-      ErrStat = ErrID_Fatal
-      RETURN
-   END IF  
-   
-   f  = (Ca + Cp)*densWater*Pi*(R+tMG)*(R+tMG) 
-   f2 = AxCa*densWater*2.0*Pi*(R+tMG)*(R+tMG)*abs(dRdZ)       
-   f1 = AxCp*2.0*Pi*(R+tMG)*dRdz
-   
-   DO I=0,NStepWave
-      
-      af    =  WaveAcc0(I,nodeIndx,:)       
-      adotk = af(1)*k(1) + af(2)*k(2) + af(3)*k(3)   
-      v     =  af - adotk*k
-    
-      ! NOTE: (k cross l) x k = l - (l dot k)k
-      
-      f3 = f1*WaveDynP0(I,nodeIndx)
-      
-      !CALL GetDistance( p0, v, v_len )  
-      !TODO What about multiplying by the magnitude?
-      
-      
-      
-      F_I(I,1) = f*v(1) + (f3 + f2*adotk)*k(1)
-      F_I(I,2) = f*v(2) + (f3 + f2*adotk)*k(2) 
-      F_I(I,3) = f*v(3) + (f3 + f2*adotk)*k(3)
-      F_I(I,4) = 0.0
-      F_I(I,5) = 0.0
-      F_I(I,6) = 0.0
-      
-   END DO
+   F_I(1) = (Ca + Cp)*densWater*Pi*(R+tMG)*(R+tMG) 
+   F_I(2) = AxCa*densWater*2.0*Pi*(R+tMG)*(R+tMG)*abs(dRdZ)       
+   F_I(3) = AxCp*2.0*Pi*(R+tMG)*dRdz
    
 END SUBROUTINE DistrInertialLoads
 
@@ -585,33 +622,27 @@ SUBROUTINE DistrFloodedBuoyancy( densFluid, Z_f, R, t, dRdz, Z, C, g, F_B  )
    
 END SUBROUTINE DistrFloodedBuoyancy
 
-SUBROUTINE DistrAddedMass( densWater, Ca, AxCa, C, R, tMG, dRdZ, AM_M)
+SUBROUTINE DistrAddedMass( densWater, Ca, AxCa, R, tMG, dRdZ, AM_M)
+
+      ! The distributed added mass matrix of a member with local z axis k (= R_LToG(:,3)) is
+      !    AM = AM_M(1)*( I - k*k^T ) + AM_M(2)*k*k^T,
+      ! so only the transverse and axial coefficients are stored; see Morison_CalcOutput for its product with an acceleration.
 
    REAL(ReKi),         INTENT ( IN    )  :: densWater
    REAL(ReKi),         INTENT ( IN    )  :: Ca
    REAL(ReKi),         INTENT ( IN    )  :: AxCa
-   REAL(ReKi),         INTENT ( IN    )  :: C(3,3)
    REAL(ReKi),         INTENT ( IN    )  :: R
    REAL(ReKi),         INTENT ( IN    )  :: tMG
    REAL(ReKi),         INTENT ( IN    )  :: dRdZ
-   REAL(ReKi),         INTENT (   OUT )  :: AM_M(3,3)
+   REAL(ReKi),         INTENT (   OUT )  :: AM_M(2)        ! transverse (1) and axial (2) added mass coefficients
    
    REAL(ReKi)                            :: f,f2
    
    f         = Ca*densWater*Pi*(R+tMG)*(R+tMG)
    f2        = AxCa*2.0*densWater*Pi*abs(dRdZ)*(R+tMG)*(R+tMG)
-   !AM_M      = 0.0
-   AM_M(1,1) = f*(  C(2,3)*C(2,3) + C(3,3)*C(3,3) ) -f2*C(1,3)*C(1,3)
-   AM_M(1,2) = f*( -C(1,3)*C(2,3)                 ) -f2*C(1,3)*C(2,3)
-   AM_M(1,3) = f*( -C(1,3)*C(3,3)                 ) -f2*C(1,3)*C(3,3)
    
-   AM_M(2,1) = f*( -C(1,3)*C(2,3)                 ) -f2*C(2,3)*C(1,3)
-   AM_M(2,2) = f*(  C(1,3)*C(1,3) + C(3,3)*C(3,3) ) -f2*C(2,3)*C(2,3)
-   AM_M(2,3) = f*( -C(2,3)*C(3,3)                 ) -f2*C(2,3)*C(3,3)
-   
-   AM_M(3,1) = f*( -C(1,3)*C(3,3)                 ) -f2*C(3,3)*C(1,3)
-   AM_M(3,2) = f*( -C(2,3)*C(3,3)                 ) -f2*C(3,3)*C(2,3)
-   AM_M(3,3) = f*(  C(1,3)*C(1,3) + C(2,3)*C(2,3) ) -f2*C(3,3)*C(3,3)
+   AM_M(1)   =  f
+   AM_M(2)   = -f2
 
 
 END SUBROUTINE DistrAddedMass
@@ -659,45 +690,17 @@ SUBROUTINE LumpDragConst( densWater, Cd, R, tMG, DragConst  )
 END SUBROUTINE LumpDragConst
 
          
-SUBROUTINE LumpDynPressure( nodeIndx, Cp, k, R, tMG, NStepWave, WaveDynP, F_DP, ErrStat, ErrMsg )
+SUBROUTINE LumpDynPressure( Cp, k, R, tMG, F_DP )
 
+      ! The lumped dynamic pressure load is F_DP*p for the fluid dynamic pressure p at the node.
 
-   INTEGER,            INTENT ( IN    )  :: nodeIndx
    REAL(ReKi),         INTENT ( IN    )  :: Cp
    REAL(ReKi),         INTENT ( IN    )  :: k(3)
    REAL(ReKi),         INTENT ( IN    )  :: R
    REAL(ReKi),         INTENT ( IN    )  :: tMG
-   INTEGER,            INTENT ( IN    )  :: NStepWave
-   REAL(SiKi),         INTENT ( IN    )  :: WaveDynP(0:,:)
-   REAL(ReKi),ALLOCATABLE,         INTENT (   OUT )  :: F_DP(:,:)
-   INTEGER,            INTENT (   OUT )  :: ErrStat              ! returns a non-zero value when an error occurs  
-   CHARACTER(*),       INTENT (   OUT )  :: ErrMsg               ! Error message if ErrStat /= ErrID_None
-
-   INTEGER                               :: I
+   REAL(ReKi),         INTENT (   OUT )  :: F_DP(3)
    
-      ! Initialize ErrStat
-         
-   ErrStat = ErrID_None         
-   ErrMsg  = "" 
-   
-   
-      ! Allocate F_DP
-      
-   ALLOCATE ( F_DP(0:NStepWave,6), STAT = ErrStat )
-   IF ( ErrStat /= ErrID_None ) THEN
-      ErrMsg  = ' Error allocating distributed dynamic pressure loads array.'
-      ErrStat = ErrID_Fatal
-      RETURN
-   END IF  
-   
-   DO I=0,NStepWave
-      F_DP(I,1) = Cp*k(1)*Pi*(R+tMG)*(R+tMG)*WaveDynP(I,nodeIndx) 
-      F_DP(I,2) = Cp*k(2)*Pi*(R+tMG)*(R+tMG)*WaveDynP(I,nodeIndx) 
-      F_DP(I,3) = Cp*k(3)*Pi*(R+tMG)*(R+tMG)*WaveDynP(I,nodeIndx) 
-      F_DP(I,4) = 0.0
-      F_DP(I,5) = 0.0
-      F_DP(I,6) = 0.0
-   END DO
+   F_DP = Cp*k*Pi*(R+tMG)*(R+tMG)
    
    
 END SUBROUTINE LumpDynPressure
@@ -2648,17 +2651,14 @@ END SUBROUTINE SplitMeshNodes
 
 
 
-SUBROUTINE GenerateLumpedLoads( nodeIndx, sgn, node, gravity, MSL2SWL, densWater, NStepWave, WaveDynP, dragConst, F_DP, F_B,  ErrStat, ErrMsg )
+SUBROUTINE GenerateLumpedLoads( sgn, node, gravity, MSL2SWL, densWater, dragConst, F_DP, F_B,  ErrStat, ErrMsg )
 
-   INTEGER,                 INTENT( IN    )     ::  nodeIndx
    REAL(ReKi),              INTENT( IN    )     ::  sgn
    TYPE(Morison_NodeType),  INTENT( IN    )     ::  node
    REAL(ReKi),              INTENT( IN    )     ::  gravity
    REAL(ReKi),              INTENT( IN    )     ::  MSL2SWL
    REAL(ReKi),              INTENT( IN    )     ::  densWater
-   INTEGER,                 INTENT( IN    )     ::  NStepWave
-   REAL(SiKi),              INTENT( IN    )     ::  WaveDynP(:,:) ! TODO:  Verify it is ok to use (:,:) for the  zero-based  first array index GJH 2/5/14
-   REAL(ReKi),ALLOCATABLE,  INTENT(   OUT )     ::  F_DP(:,:)
+   REAL(ReKi),              INTENT(   OUT )     ::  F_DP(3)               ! dynamic pressure load per unit dynamic pressure
    REAL(ReKi),              INTENT(   OUT )     ::  F_B(6)
    REAL(ReKi),              INTENT(   OUT )     ::  dragConst
    INTEGER,                 INTENT(   OUT )     ::  ErrStat              ! returns a non-zero value when an error occurs  
@@ -2677,7 +2677,7 @@ SUBROUTINE GenerateLumpedLoads( nodeIndx, sgn, node, gravity, MSL2SWL, densWater
    
       k =  sgn * node%R_LToG(:,3)
       
-      CALL LumpDynPressure( nodeIndx, node%JAxCp, k, node%R, node%tMG, NStepWave, WaveDynP, F_DP, ErrStat, ErrMsg)
+      CALL LumpDynPressure( node%JAxCp, k, node%R, node%tMG, F_DP )
       
          ! For buoyancy calculations we need to adjust the Z-location based on MSL2SWL. If MSL2SWL > 0 then SWL above MSL, and so we need to place the Z value at a deeper position.  
          !   SWL is at Z=0 for buoyancy calcs, but geometry was specified relative to MSL (MSL2SWL = 0) 
@@ -2690,12 +2690,6 @@ SUBROUTINE GenerateLumpedLoads( nodeIndx, sgn, node, gravity, MSL2SWL, densWater
    
    ELSE
       
-      ALLOCATE ( F_DP(0:NStepWave, 6), STAT = ErrStat )
-      IF ( ErrStat /= ErrID_None ) THEN
-         ErrMsg  = ' Error allocating distributed dynamic pressure loads array.'
-         ErrStat = ErrID_Fatal
-         RETURN
-      END IF  
       F_DP = 0.0
       F_B  = 0.0
    END IF
@@ -2710,18 +2704,15 @@ END SUBROUTINE GenerateLumpedLoads
 
 
 
-SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, WaveDynP, WaveAcc, numNodes, nodes, numElements, elements, &
+SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, numNodes, nodes, numElements, elements, &
                                   numLumpedMarkers, lumpedMeshIn, lumpedMeshOut, lumpedToNodeIndx, L_An,        &
-                                  L_F_B, L_F_I, L_F_BF, L_AM_M, L_dragConst, &
+                                  L_F_B, L_F_DP, L_F_BF, L_AM_M, L_dragConst, &
                                   ErrStat, ErrMsg )
 
    REAL(ReKi),                             INTENT( IN    )  ::  densWater
    REAL(ReKi),                             INTENT( IN    )  ::  gravity
    REAL(ReKi),                             INTENT( IN    )  ::  MSL2SWL
    REAL(ReKi),                             INTENT( IN    )  ::  wtrDpth
-   INTEGER,                                INTENT( IN    )  ::  NStepWave
-   REAL(SiKi),                             INTENT( IN    )  ::  WaveDynP(0:,:)
-   REAL(SiKi),                             INTENT( IN    )  ::  WaveAcc(0:,:,:)
    INTEGER,                                INTENT( IN    )  ::  numNodes
    INTEGER,                                INTENT( IN    )  ::  numElements
    TYPE(Morison_MemberType),               INTENT( IN    )  ::  elements(:)
@@ -2733,25 +2724,24 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
    INTEGER, ALLOCATABLE,                   INTENT(   OUT )  ::  lumpedToNodeIndx(:)
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  L_An(:,:)                         ! The signed/summed end cap Area x k of all connected members at a common joint
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  L_F_B(:,:)                      ! Buoyancy force associated with the member
-   REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  L_F_I(:,:,:)                     ! Inertial force.  TODO:  Eventually the dynamic pressure will be included in this force! GJH 4/15/14
-   !REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  L_F_DP(:,:,:)                     ! Dynamic pressure force
+   REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  L_F_DP(:,:)                     ! Dynamic pressure force per unit dynamic pressure (the inertial force comes from L_AM_M)
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  L_F_BF(:,:)                     ! Flooded buoyancy force
-   REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  L_AM_M(:,:,:)                   ! Added mass of member
+   REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  L_AM_M(:,:)                     ! Added mass of member
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  L_dragConst(:)                   ! 
    INTEGER,                                INTENT(   OUT )  ::  ErrStat              ! returns a non-zero value when an error occurs  
    CHARACTER(*),                           INTENT(   OUT )  ::  ErrMsg               ! Error message if ErrStat /= ErrID_None
    
              
-   INTEGER                    ::  I, J, M, count
+   INTEGER                    ::  I, J, count
    TYPE(Morison_MemberType)   ::  element
    TYPE(Morison_NodeType)     ::  node, node1, node2
    REAL(ReKi)                 ::  L, sgn
 !   REAL(ReKi)                 ::  k(3)
    REAL(ReKi)                 ::  z0
-   REAL(ReKi),ALLOCATABLE     ::  F_DP(:,:)
+   REAL(ReKi)                 ::  F_DP(3)
    REAL(ReKi)                 ::  F_B(6)
    REAL(ReKi)                 ::  F_BF(6)
-   REAL(ReKi)                 ::  Vmat(3,1), F_I(6), AM_M(6,6) !AM(6,6), 
+   REAL(ReKi)                 ::  AM_M(4) !AM(6,6), 
    REAL(ReKi)                 ::  dragConst
    
    
@@ -2761,9 +2751,9 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
    INTEGER                    :: nCommon
 !   REAL(ReKi)                 :: CA
    REAL(ReKi)                 :: AMfactor
-   REAL(ReKi)                 :: An(3), Vn(3), af(3)
+   REAL(ReKi)                 :: An(3), Vn(3)
 !   REAL(ReKi)                 :: AM11, AM22, AM33
-   REAL(ReKi)                 :: f1, VnDotAf, Vmag !f2, 
+   REAL(ReKi)                 :: f1, Vmag !f2, 
    
    
       ! Initialize ErrStat
@@ -2865,22 +2855,13 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
    END IF
    L_An = 0.0
    
-   ! This is 
-   ALLOCATE ( L_F_I( 0:NStepWave, 6, numLumpedMarkers ), STAT = ErrStat )
+   ALLOCATE ( L_F_DP( 3, numLumpedMarkers ), STAT = ErrStat )
    IF ( ErrStat /= ErrID_None ) THEN
-      ErrMsg  = ' Error allocating space for the lumped inertial forces/moments array.'
+      ErrMsg  = ' Error allocating space for the lumped dynamic pressure forces array.'
       ErrStat = ErrID_Fatal
       RETURN
    END IF
-    L_F_I = 0.0
-    
-   !ALLOCATE ( L_F_DP( 0:NStepWave, 6, numLumpedMarkers ), STAT = ErrStat )
-   !IF ( ErrStat /= ErrID_None ) THEN
-   !   ErrMsg  = ' Error allocating space for the lumped dynamic pressure forces/moments array.'
-   !   ErrStat = ErrID_Fatal
-   !   RETURN
-   !END IF
-   ! L_F_DP = 0.0
+   L_F_DP = 0.0
    
    ALLOCATE ( L_F_BF( 6, numLumpedMarkers ), STAT = ErrStat )
    IF ( ErrStat /= ErrID_None ) THEN
@@ -2890,7 +2871,7 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
    END IF
    L_F_BF = 0.0
    
-   ALLOCATE ( L_AM_M( 6, 6, numLumpedMarkers ), STAT = ErrStat )
+   ALLOCATE ( L_AM_M( 4, numLumpedMarkers ), STAT = ErrStat )  ! the added mass matrix is L_AM_M(4)*Vn*Vn^T, with Vn = L_AM_M(1:3)
    IF ( ErrStat /= ErrID_None ) THEN
       ErrMsg  = ' Error allocating space for the lumped member added mass.'
       ErrStat = ErrID_Fatal
@@ -3037,10 +3018,11 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
                      
                      
                      
+                        ! The added mass matrix (upper-left 3x3) is rank one, AM_M(4)*Vn*Vn^T, so only Vn and the coefficient are stored:
                      AM_M = 0.0
                      IF ( (Vmag > 0.0) .AND. (.NOT. nodes(I)%PropPot) ) THEN
-                        Vmat = RESHAPE(Vn,(/3,1/))
-                        AM_M(1:3,1:3) = (nodes(I)%JAxCa*AMfactor/(REAL( nCommon, ReKi)*Vmag) )*MatMul(Vmat,TRANSPOSE(Vmat))
+                        AM_M(1:3) = Vn
+                        AM_M(4)   = nodes(I)%JAxCa*AMfactor/(REAL( nCommon, ReKi)*Vmag)
                      END IF
                      
                      DO J=1,nCommon
@@ -3048,27 +3030,12 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
                         IF ( nodes(I)%JointPos(3) >= z0 ) THEN
                         
                            L_An  (:,  nodeToLumpedIndx(commonNodeLst(J)))    =  An / nCommon   
-                           L_AM_M(:,:,nodeToLumpedIndx(commonNodeLst(J)))    =  AM_M
-                           
-                           DO M=0,NStepWave
-                              ! The WaveAcc array has indices of (timeIndx, nodeIndx, vectorIndx), the nodeIndx needs to correspond to the total list of nodes for which
-                              ! the wave kinematics were generated.  We can use the nodeToLumpedIndx however for L_F_I and it's indices are (timeIndx, nodeIndx, vectorIndx)
-                              
-                              
-                              F_I      = 0.0
-                              IF ( (Vmag > 0.0) .AND. (.NOT. nodes(I)%PropPot) ) THEN
-                                 af =  WaveAcc(M,commonNodeLst(J),:)
-                                 VnDotAf = Dot_Product(Vn,af)
-                                 F_I(1:3) = ( nodes(I)%JAxCa*AMfactor*VnDotAf / ( REAL( nCommon, ReKi ) * Vmag ) ) * Vn
-                              END IF
-                              L_F_I(M, :,nodeToLumpedIndx(commonNodeLst(J)))   =  F_I
-                           END DO
+                           L_AM_M(:,  nodeToLumpedIndx(commonNodeLst(J)))    =  AM_M    ! the joint inertial force, L_AM_M(4)*(Vn.a)*Vn, is also computed from this in Morison_CalcOutput
                            
                         ELSE
                            ! Should we ever land in here?
                            L_An(:,nodeToLumpedIndx(commonNodeLst(J))) = 0.0
-                           L_AM_M(:,:,nodeToLumpedIndx(commonNodeLst(J))) = 0.0
-                           L_F_I(:,:,nodeToLumpedIndx(commonNodeLst(J)))   = 0.0
+                           L_AM_M(:,  nodeToLumpedIndx(commonNodeLst(J))) = 0.0
                         END IF
                      
                      END DO
@@ -3105,9 +3072,8 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
          node = node1
          sgn = 1.0
          IF (  ( node%JointPos(3) >= z0 ) .AND. (.NOT. node%PropPot) )THEN
-            CALL GenerateLumpedLoads( element%Node1Indx, sgn, node, gravity, MSL2SWL, densWater, NStepWave, WaveDynP, dragConst, F_DP, F_B,  ErrStat, ErrMsg )
-            L_F_I(:, :, nodeToLumpedIndx(element%Node1Indx))  = L_F_I(:, :, nodeToLumpedIndx(element%Node1Indx)) + F_DP
-           ! L_F_DP(:, :, nodeToLumpedIndx(element%Node1Indx)) = F_DP
+            CALL GenerateLumpedLoads( sgn, node, gravity, MSL2SWL, densWater, dragConst, F_DP, F_B,  ErrStat, ErrMsg )
+            L_F_DP(:, nodeToLumpedIndx(element%Node1Indx))  = L_F_DP(:, nodeToLumpedIndx(element%Node1Indx)) + F_DP
             
             L_dragConst(nodeToLumpedIndx(element%Node1Indx))  = dragConst
          IF ( ( node%JointPos(3) >= z0 ) .AND. (.NOT. node%PropPot) )THEN
@@ -3116,7 +3082,7 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
             
          ELSE
             F_BF                                              = 0.0
-            !L_F_DP(:, :, nodeToLumpedIndx(element%Node1Indx)) = 0.0
+            L_F_DP(:, nodeToLumpedIndx(element%Node1Indx))    = 0.0
             L_F_B (:, nodeToLumpedIndx(element%Node1Indx))    = 0.0
             L_dragConst(nodeToLumpedIndx(element%Node1Indx))  = 0.0
             
@@ -3144,10 +3110,9 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
          sgn = -1.0
          
             ! Generate the loads regardless of node location, and then make the bounds check per load type because the range is different
-         CALL GenerateLumpedLoads( element%Node2Indx, sgn, node, gravity, MSL2SWL, densWater, NStepWave, WaveDynP, dragConst, F_DP, F_B, ErrStat, ErrMsg )
+         CALL GenerateLumpedLoads( sgn, node, gravity, MSL2SWL, densWater, dragConst, F_DP, F_B, ErrStat, ErrMsg )
          IF ( ( node%JointPos(3) >= z0 ) .AND. (.NOT. node%PropPot) ) THEN
-            L_F_I(:, :, nodeToLumpedIndx(element%Node2Indx))  = L_F_I(:, :, nodeToLumpedIndx(element%Node2Indx)) + F_DP
-            !L_F_DP(:, :, nodeToLumpedIndx(element%Node2Indx)) = F_DP
+            L_F_DP(:, nodeToLumpedIndx(element%Node2Indx))  = L_F_DP(:, nodeToLumpedIndx(element%Node2Indx)) + F_DP
             
             L_dragConst(nodeToLumpedIndx(element%Node2Indx))  = dragConst
             
@@ -3157,7 +3122,7 @@ SUBROUTINE CreateLumpedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, Wa
            
          ELSE
             F_BF                                              = 0.0
-            !L_F_DP(:, :, nodeToLumpedIndx(element%Node2Indx)) = 0.0
+            L_F_DP(:, nodeToLumpedIndx(element%Node2Indx))    = 0.0
             L_F_B (:, nodeToLumpedIndx(element%Node2Indx))    = 0.0
             L_dragConst(nodeToLumpedIndx(element%Node2Indx))  = 0.0
             
@@ -3285,18 +3250,16 @@ END SUBROUTINE CreateLumpedMesh
 !end subroutine ComputeDistributedLoadsAtNode
                                           
                                   
-SUBROUTINE CreateDistributedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, WaveAcc, WaveDynP, numNodes, nodes, nodeInWater, numElements, elements, &
+SUBROUTINE CreateDistributedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWave, numNodes, nodes, nodeInWater, numElements, elements, &
                                   numDistribMarkers,  distribMeshIn, distribMeshOut, distribToNodeIndx,  D_F_I,      &
-                                  D_F_B, D_F_DP, D_F_MG, D_F_BF, D_AM_M, D_AM_MG, D_AM_F, D_dragConst, elementWaterStateArr, &
+                                  D_F_B, D_F_MG, D_F_BF, D_AM_M, D_AM_MG, D_AM_F, D_dragConst, elementWaterStateArr, &
                                   Morison_Rad, ErrStat, ErrMsg )
 
    REAL(ReKi),                             INTENT( IN    )  ::  densWater
    REAL(ReKi),                             INTENT( IN    )  ::  gravity
    REAL(ReKi),                             INTENT( IN    )  ::  MSL2SWL
    REAL(ReKi),                             INTENT( IN    )  ::  wtrDpth
-   INTEGER,                                INTENT( IN    )  ::  NStepWave
-   REAL(SiKi),                             INTENT( IN    )  ::  WaveAcc(0:,:,:)
-   REAL(SiKi),                             INTENT( IN    )  ::  WaveDynP(0:,:)
+   INTEGER,                                INTENT( IN    )  ::  NStepWave            ! last wave time step in nodeInWater (0 when the wave kinematics are evaluated on demand)
    INTEGER,                                INTENT( IN    )  ::  numNodes
    INTEGER,                                INTENT( IN    )  ::  numElements
    TYPE(Morison_MemberType),               INTENT( IN    )  ::  elements(:)
@@ -3307,12 +3270,11 @@ SUBROUTINE CreateDistributedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWav
    TYPE(MeshType),                         INTENT(   OUT )  ::  distribMeshIn
    TYPE(MeshType),                         INTENT(   OUT )  ::  distribMeshOut 
    INTEGER, ALLOCATABLE,                   INTENT(   OUT )  ::  distribToNodeIndx(:)
-   REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_F_I(:,:,:) 
+   REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_F_I(:,:)                      ! Inertial load coefficients (see DistrInertialLoads)
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_F_B(:,:)                      ! Buoyancy force associated with the member
-   REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_F_DP(:,:,:)                   ! Dynamic pressure force
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_F_MG(:,:)                     ! Marine growth weight
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_F_BF(:,:)                     ! Flooded buoyancy force
-   REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_AM_M(:,:,:)                   ! Added mass of member
+   REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_AM_M(:,:)                     ! Added mass of member
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_AM_MG(:)                      ! Added mass of marine growth   
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_AM_F(:)                   ! Added mass of flooded fluid
    REAL(ReKi),ALLOCATABLE,                 INTENT(   OUT)   ::  D_dragConst(:)                   ! 
@@ -3334,7 +3296,6 @@ SUBROUTINE CreateDistributedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWav
   ! REAL(ReKi),ALLOCATABLE     ::  F_DP(:,:)
    REAL(ReKi)                 ::  F_B(6)
    REAL(ReKi)                 ::  F_BF(6)
-   REAL(ReKi),ALLOCATABLE     :: F_I(:,:)
    REAL(ReKi)                 ::  z0
    INTEGER, ALLOCATABLE       :: nodeToDistribIndx(:)
    
@@ -3407,9 +3368,9 @@ SUBROUTINE CreateDistributedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWav
    END IF
    elementWaterStateArr = 0 ! out of the water
    
-   ALLOCATE ( D_F_I( 0:NStepWave, 6, numDistribMarkers ), STAT = ErrStat )
+   ALLOCATE ( D_F_I( 3, numDistribMarkers ), STAT = ErrStat )
    IF ( ErrStat /= ErrID_None ) THEN
-      ErrMsg  = ' Error allocating space for the distributed inertial forces/moments array.'
+      ErrMsg  = ' Error allocating space for the distributed inertial load coefficients array.'
       ErrStat = ErrID_Fatal
       RETURN
    END IF
@@ -3423,14 +3384,6 @@ SUBROUTINE CreateDistributedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWav
    END IF
    D_F_B = 0.0
    
-   ALLOCATE ( D_F_DP( 0:NStepWave, 6, numDistribMarkers ), STAT = ErrStat )
-   IF ( ErrStat /= ErrID_None ) THEN
-      ErrMsg  = ' Error allocating space for the distributed dynamic pressure forces/moments array.'
-      ErrStat = ErrID_Fatal
-      RETURN
-   END IF
-   D_F_DP = 0.0
-   
    ALLOCATE ( D_F_MG( 6, numDistribMarkers ), STAT = ErrStat )
    IF ( ErrStat /= ErrID_None ) THEN
       ErrMsg  = ' Error allocating space for the distributed marine growth weight forces/moments array.'
@@ -3448,7 +3401,7 @@ SUBROUTINE CreateDistributedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWav
    D_F_BF = 0.0
    
   
-    ALLOCATE ( D_AM_M( 3, 3, numDistribMarkers ), STAT = ErrStat )
+    ALLOCATE ( D_AM_M( 2, numDistribMarkers ), STAT = ErrStat )  ! transverse and axial coefficients (see DistrAddedMass)
    IF ( ErrStat /= ErrID_None ) THEN
       ErrMsg  = ' Error allocating space for the distributed added mass of flooded fluid.'
       ErrStat = ErrID_Fatal
@@ -3531,7 +3484,7 @@ SUBROUTINE CreateDistributedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWav
           !  IF ( nodes(I)%JointPos(3) <= MSL2SWL .AND. nodes(I)%JointPos(3) >= z0 ) THEN
                
                
-               CALL DistrAddedMass( densWater, nodes(I)%Ca, nodes(I)%AxCa, nodes(I)%R_LToG, nodes(I)%R, nodes(I)%tMG, nodes(I)%dRdZ, D_AM_M(:,:,count) )  
+               CALL DistrAddedMass( densWater, nodes(I)%Ca, nodes(I)%AxCa, nodes(I)%R, nodes(I)%tMG, nodes(I)%dRdZ, D_AM_M(:,count) )  
              !  IF ( secondNodeWaterState == 0 ) THEN
                      ! Element is in the water
                      
@@ -3546,8 +3499,7 @@ SUBROUTINE CreateDistributedMesh( densWater, gravity, MSL2SWL, wtrDpth, NStepWav
          !   
        ! IF ( ( .NOT. nodes(J)%PropPot ) .AND. ( nodes(J)%JointPos(3) >= z0 ) ) THEN
        !    k =  nodes(J)%R_LToG(:,3)
-            CALL DistrInertialLoads( I, densWater, nodes(I)%Ca, nodes(I)%Cp, nodes(I)%AxCa, nodes(I)%AxCp, nodes(I)%R, nodes(I)%tMG, nodes(I)%dRdZ, k, NStepWave, WaveAcc, WaveDynP, F_I, ErrStat, ErrMsg  )              
-            D_F_I(:,:,count)  = F_I     
+            CALL DistrInertialLoads( densWater, nodes(I)%Ca, nodes(I)%Cp, nodes(I)%AxCa, nodes(I)%AxCp, nodes(I)%R, nodes(I)%tMG, nodes(I)%dRdZ, D_F_I(:,count) )
             
        ! END IF 
                   
@@ -4057,6 +4009,10 @@ SUBROUTINE Morison_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, In
      ! TYPE(Morison_InitInputType)                       :: InitLocal   ! Local version of the input data for the geometry processing routine
 !      INTEGER, ALLOCATABLE                                          :: distribToNodeIndx(:)
 !      INTEGER, ALLOCATABLE                                          :: lumpedToNodeIndx(:)
+      INTEGER,    ALLOCATABLE                           :: WaterState_Tmp(:,:) ! In/out of water flags, stored time-major
+      INTEGER                                           :: NStepKin            ! Last time step of the in/out of water flags (0 when the wave kinematics are evaluated on demand)
+      INTEGER(IntKi)                                    :: ErrStat2
+      CHARACTER(ErrMsgLen)                              :: ErrMsg2
       
          ! Initialize ErrStat
          
@@ -4111,30 +4067,42 @@ IF (ALLOCATED(InitInp%JOutLst) ) &
       
       
       p%NStepWave= InitInp%NStepWave
+      p%WvKinMod = InitInp%WvKinMod
       
-      ALLOCATE ( p%WaveVel(0:p%NStepWave, p%NNodes, 3), STAT = ErrStat )
-      IF ( ErrStat /= ErrID_None ) THEN
-         ErrMsg  = ' Error allocating space for wave velocities array.'
-         ErrStat = ErrID_Fatal
-         RETURN
-      END IF
-      p%WaveVel = InitInp%WaveVel      
+      IF ( p%WvKinMod == 1 ) THEN
+         
+            ! The wave kinematics are synthesized from the wave spectrum at the wave time steps needed by Morison_CalcOutput:
+         CALL Waves_MoveKinProvider( InitInp%WaveKin, m%WaveKin )
+         
+      ELSE
       
-      ALLOCATE ( p%WaveAcc(0:p%NStepWave, p%NNodes, 3), STAT = ErrStat )
-      IF ( ErrStat /= ErrID_None ) THEN
-         ErrMsg  = ' Error allocating space for wave accelerations array.'
-         ErrStat = ErrID_Fatal
-         RETURN
-      END IF
-      p%WaveAcc = InitInp%WaveAcc
+            ! The wave kinematics are stored time-slice-major (all nodes of one wave time step are contiguous) so that 
+            ! Morison_CalcOutput can interpolate all of the nodes at once:
+         ALLOCATE ( p%WaveVel(3, p%NNodes, 0:p%NStepWave), STAT = ErrStat )
+         IF ( ErrStat /= ErrID_None ) THEN
+            ErrMsg  = ' Error allocating space for wave velocities array.'
+            ErrStat = ErrID_Fatal
+            RETURN
+         END IF
+         p%WaveVel = RESHAPE( InitInp%WaveVel, (/ 3, p%NNodes, p%NStepWave+1 /), ORDER = (/ 3, 2, 1 /) )
+      
+         ALLOCATE ( p%WaveAcc(3, p%NNodes, 0:p%NStepWave), STAT = ErrStat )
+         IF ( ErrStat /= ErrID_None ) THEN
+            ErrMsg  = ' Error allocating space for wave accelerations array.'
+            ErrStat = ErrID_Fatal
+            RETURN
+         END IF
+         p%WaveAcc = RESHAPE( InitInp%WaveAcc, (/ 3, p%NNodes, p%NStepWave+1 /), ORDER = (/ 3, 2, 1 /) )
+      
+         ALLOCATE ( p%WaveDynP(p%NNodes, 0:p%NStepWave), STAT = ErrStat )
+         IF ( ErrStat /= ErrID_None ) THEN
+            ErrMsg  = ' Error allocating space for wave dynamic pressure array.'
+            ErrStat = ErrID_Fatal
+            RETURN
+         END IF
+         p%WaveDynP = TRANSPOSE( InitInp%WaveDynP )
       
-       ALLOCATE ( p%WaveDynP(0:p%NStepWave, p%NNodes), STAT = ErrStat )
-      IF ( ErrStat /= ErrID_None ) THEN
-         ErrMsg  = ' Error allocating space for wave dynamic pressure array.'
-         ErrStat = ErrID_Fatal
-         RETURN
       END IF
-      p%WaveDynP = InitInp%WaveDynP
       
       
       
@@ -4148,6 +4116,7 @@ IF (ALLOCATED(InitInp%JOutLst) ) &
 
       
       CALL MOVE_ALLOC( InitInp%nodeInWater, p%nodeInWater )   
+      NStepKin = UBOUND( p%nodeInWater, 1 )
       
       
       
@@ -4156,10 +4125,10 @@ IF (ALLOCATED(InitInp%JOutLst) ) &
          ! We are storing the parameters in the DistribMarkers data structure instead of trying to hold this information within the DistribMesh.  But these two data structures
          ! must always be in sync.  For example, the 5th element of the DistribMarkers array must correspond to the 5th node in the DistribMesh data structure.
        
-      CALL CreateDistributedMesh( InitInp%WtrDens, InitInp%Gravity, InitInp%MSL2SWL, InitInp%WtrDpth, InitInp%NStepWave, InitInp%WaveAcc, InitInp%WaveDynP, &
+      CALL CreateDistributedMesh( InitInp%WtrDens, InitInp%Gravity, InitInp%MSL2SWL, InitInp%WtrDpth, NStepKin, &
                                   p%NNodes, p%Nodes, p%nodeInWater, InitInp%NElements, InitInp%Elements, &
                                   p%NDistribMarkers, u%DistribMesh, y%DistribMesh, p%distribToNodeIndx, p%D_F_I, &
-                                  p%D_F_B, p%D_F_DP, p%D_F_MG, p%D_F_BF, p%D_AM_M, p%D_AM_MG, p%D_AM_F, p%D_dragConst, p%elementWaterState, &                 ! 
+                                  p%D_F_B, p%D_F_MG, p%D_F_BF, p%D_AM_M, p%D_AM_MG, p%D_AM_F, p%D_dragConst, p%elementWaterState, &                 ! 
                                   InitOut%Morison_Rad,  ErrStat, ErrMsg )
                                     
                                  
@@ -4169,12 +4138,33 @@ IF (ALLOCATED(InitInp%JOutLst) ) &
      IF ( ErrStat > ErrID_None ) RETURN
      
          
-     CALL CreateLumpedMesh( InitInp%WtrDens, InitInp%Gravity, InitInp%MSL2SWL, InitInp%WtrDpth, InitInp%NStepWave, InitInp%WaveDynP, InitInp%WaveAcc,p%NNodes, p%Nodes, InitInp%NElements, InitInp%Elements, &
+     CALL CreateLumpedMesh( InitInp%WtrDens, InitInp%Gravity, InitInp%MSL2SWL, InitInp%WtrDpth, p%NNodes, p%Nodes, InitInp%NElements, InitInp%Elements, &
                                   p%NLumpedMarkers,  u%LumpedMesh, y%LumpedMesh, p%lumpedToNodeIndx,   p%L_An,     &
-                                  p%L_F_B, p%L_F_I, p%L_F_BF, p%L_AM_M, p%L_dragConst, &
+                                  p%L_F_B, p%L_F_DP, p%L_F_BF, p%L_AM_M, p%L_dragConst, &
                                   ErrStat, ErrMsg )
      IF ( ErrStat > ErrID_None ) RETURN
      
+         ! Store the in/out of water flags time-slice-major, too:
+     
+     CALL MOVE_ALLOC( p%elementWaterState, WaterState_Tmp )
+     ALLOCATE ( p%elementWaterState(p%NDistribMarkers, 0:NStepKin), STAT = ErrStat )
+     IF ( ErrStat /= ErrID_None ) THEN
+        ErrMsg  = ' Error allocating space for the elementWaterState array.'
+        ErrStat = ErrID_Fatal
+        RETURN
+     END IF
+     p%elementWaterState = TRANSPOSE( WaterState_Tmp )
+     DEALLOCATE( WaterState_Tmp )
+     
+     CALL MOVE_ALLOC( p%nodeInWater, WaterState_Tmp )
+     ALLOCATE ( p%nodeInWater(p%NNodes, 0:NStepKin), STAT = ErrStat )
+     IF ( ErrStat /= ErrID_None ) THEN
+        ErrMsg  = ' Error allocating space for the nodeInWater array.'
+        ErrStat = ErrID_Fatal
+        RETURN
+     END IF
+     p%nodeInWater = TRANSPOSE( WaterState_Tmp )
+     DEALLOCATE( WaterState_Tmp )
       
       
      ! CALL CreateSuperMesh( InitInp%NNodes, InitInp%Nodes, InitInp%NElements, InitInp%Elements, p%NSuperMarkers, p%SuperMarkers, InitOut%LumpedMesh, ErrStat, ErrMsg )
@@ -4197,6 +4187,16 @@ IF (ALLOCATED(InitInp%JOutLst) ) &
       OtherState%DummyOtherState = 0
       m%LastIndWave              = 1
 
+      ALLOCATE ( m%FV(3,p%NNodes), m%FA(3,p%NNodes), m%FDynP(p%NNodes), STAT = ErrStat )
+      IF ( ErrStat /= ErrID_None ) THEN
+         ErrMsg  = ' Error allocating space for the fluid kinematics at the nodes.'
+         ErrStat = ErrID_Fatal
+         RETURN
+      END IF
+      m%FV    = 0.0_ReKi
+      m%FA    = 0.0_ReKi
+      m%FDynP = 0.0_ReKi
+
    IF ( p%OutSwtch > 0 ) THEN
       ALLOCATE ( m%D_F_D(3,y%DistribMesh%Nnodes), STAT = ErrStat )
       IF ( ErrStat /= ErrID_None ) THEN
@@ -4495,12 +4495,20 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat,
       !REAL(ReKi)                                        :: accel_fluid(6) ! Acceleration of fluid at the mesh node
       REAL(ReKi)                                        :: dragFactor     ! The lumped drag factor
       REAL(ReKi)                                        :: AnProd         ! Dot product of the directional area of the joint
+      REAL(ReKi)                                        :: adotk          ! Component of the structural acceleration along the member axis
+      REAL(ReKi)                                        :: FAdotk         ! Component of the fluid acceleration along the member axis
       REAL(ReKi)                                        :: F_B(6)
       REAL(ReKi)                                        :: C(3,3)
       REAL(ReKi)                                        :: sgn
       REAL(ReKi)                                        :: D_AM_M(6,6)
       REAL(ReKi)                                        :: nodeInWater
       REAL(ReKi)                                        :: D_dragConst     ! The distributed drag factor
+      INTEGER                                           :: iT1, iT2        ! Wave time steps bracketing Time
+      REAL(SiKi)                                        :: WaveFrac        ! Interpolation weight of wave time step iT2
+      INTEGER                                           :: iS1, iS2        ! Slots of wave time steps iT1 and iT2 in the window of synthesized wave kinematics (WvKinMod = 1)
+      INTEGER                                           :: iTW             ! Wave time step of the in/out of water states
+      INTEGER(IntKi)                                    :: ErrStat2
+      CHARACTER(ErrMsgLen)                              :: ErrMsg2
          ! Initialize ErrStat
          
       ErrStat = ErrID_None         
@@ -4512,39 +4520,74 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat,
       ! We need to attach the distributed drag force (D_F_D), distributed inertial force (D_F_I), and distributed dynamic pressure force (D_F_DP) to the Misc type so that we don't need to
       ! allocate their data storage at each time step!  If we could make them static local variables (like in C) then we could avoid adding them to the OtherState datatype.  
       ! The same is true for the lumped drag (L_F_D) and the lumped dynamic pressure (L_F_DP)
+      
+         ! Find the wave time steps bracketing Time once for all of the nodes, then interpolate the fluid kinematics at all nodes 
+         ! at once (the wave kinematics are stored time-slice-major).  p%WaveTime starts at index 0, so iT1 and iT2 are shifted by 1.
+         ! NOTE: For the in/out of water states, this finds the closest WaveTime index (iT1) which has waveTime(iT1) <= Time (as 
+         ! InterpWrappedStpInt does).
+      CALL FindWrappedStpIndx( REAL(Time, SiKi), p%WaveTime(:), m%LastIndWave, p%NStepWave + 1, iT1, iT2, WaveFrac )
+      iT1 = iT1 - 1
+      iT2 = iT2 - 1
+      
+      IF ( p%WvKinMod == 1 ) THEN
+         
+            ! Synthesize the two bracketing wave time steps from the wave spectrum (unless they are still in the window from an
+            ! earlier call); the in/out of water states don't vary in time in this mode.
+         CALL Waves_GetKinSlice( iT1, m%WaveKin, iS1, ErrStat2, ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'Morison_CalcOutput' )
+         CALL Waves_GetKinSlice( iT2, m%WaveKin, iS2, ErrStat2, ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'Morison_CalcOutput' )
+            IF ( ErrStat >= AbortErrLev ) RETURN
+         
+         m%FV    = m%WaveKin%WinVel (:,:,iS1) + WaveFrac*( m%WaveKin%WinVel (:,:,iS2) - m%WaveKin%WinVel (:,:,iS1) )
+         m%FA    = m%WaveKin%WinAcc (:,:,iS1) + WaveFrac*( m%WaveKin%WinAcc (:,:,iS2) - m%WaveKin%WinAcc (:,:,iS1) )
+         m%FDynP = m%WaveKin%WinDynP(:,  iS1) + WaveFrac*( m%WaveKin%WinDynP(:,  iS2) - m%WaveKin%WinDynP(:,  iS1) )
+         iTW     = 0
          
+      ELSE
+         
+         m%FV    = p%WaveVel (:,:,iT1) + WaveFrac*( p%WaveVel (:,:,iT2) - p%WaveVel (:,:,iT1) )
+         m%FA    = p%WaveAcc (:,:,iT1) + WaveFrac*( p%WaveAcc (:,:,iT2) - p%WaveAcc (:,:,iT1) )
+         m%FDynP = p%WaveDynP(:,  iT1) + WaveFrac*( p%WaveDynP(:,  iT2) - p%WaveDynP(:,  iT1) )
+         iTW     = iT1
+         
+      END IF
+      
+         ! The loads at each marker depend only on that marker's data and are written to that marker's entries (column J) of the 
+         ! misc arrays and output mesh, so the markers are computed in parallel when compiled with OpenMP. There are no reductions
+         ! across markers, so the results don't depend on the number of threads.
+         
+      !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(J, I, nodeIndx, elementWaterState, vrel, kvec, v, vmag, qdotdot2, adotk, FAdotk) SCHEDULE(STATIC)
       DO J = 1, y%DistribMesh%Nnodes
          
             ! Obtain the node index because WaveVel, WaveAcc, and WaveDynP are defined in the node indexing scheme, not the markers
          nodeIndx = p%distribToNodeIndx(J)
           
             ! Determine in or out of water status for the element which this node is a part of.        
-            ! NOTE: This will find the closest WaveTime index (wvIndx) which is has waveTime(wvIndx) > = Time.  If WaveDT = DT then waveTime(wvIndx) will equal Time
             ! For WaveMod = 6 or WaveMod = 5 WaveDT must equal DT for the returned value of elementWaterState to be meaningful, for other WaveMod, 
             ! elementWaterState is the same for all time for a given node, J.
-        elementWaterState = REAL( InterpWrappedStpInt( REAL(Time, SiKi), p%WaveTime(:), p%elementWaterState(:,J), m%LastIndWave, p%NStepWave + 1 ), ReKi )
+         elementWaterState = REAL( p%elementWaterState(J,iTW), ReKi )
        
          
          ! Determine the dynamic pressure at the marker
-         m%D_FDynP(J) = InterpWrappedStpReal ( REAL(Time, SiKi), p%WaveTime(:), p%WaveDynP(:,nodeIndx), &
-                                    m%LastIndWave, p%NStepWave + 1 )
+         m%D_FDynP(J) = m%FDynP(nodeIndx)
          
             
          DO I=1,3
                ! Determine the fluid acceleration and velocity at the marker
-            m%D_FA(I,J) = InterpWrappedStpReal ( REAL(Time, SiKi), p%WaveTime(:), p%WaveAcc(:,nodeIndx,I), &
-                                    m%LastIndWave, p%NStepWave + 1       )
-            m%D_FV(I,J) = InterpWrappedStpReal ( REAL(Time, SiKi), p%WaveTime(:), p%WaveVel(:,nodeIndx,I), &
-                                    m%LastIndWave, p%NStepWave + 1       )
+            m%D_FA(I,J) = m%FA(I,nodeIndx)
+            m%D_FV(I,J) = m%FV(I,nodeIndx)
             
             vrel(I) =  m%D_FV(I,J) - u%DistribMesh%TranslationVel(I,J)
-            
-            m%D_F_I(I,J) = elementWaterState * InterpWrappedStpReal ( REAL(Time, SiKi), p%WaveTime(:), p%D_F_I(:,I,J), &
-                                    m%LastIndWave, p%NStepWave + 1       )
          END DO
          
+            ! Distributed inertial loads (including the axial dynamic pressure term; see DistrInertialLoads)
+         kvec   = p%Nodes(nodeIndx)%R_LToG(:,3)
+         FAdotk = Dot_Product( kvec, m%FA(:,nodeIndx) )
+         m%D_F_I(:,J) = elementWaterState * ( p%D_F_I(1,J)*m%FA(:,nodeIndx) &
+                                            + ( ( p%D_F_I(2,J) - p%D_F_I(1,J) )*FAdotk + p%D_F_I(3,J)*m%FDynP(nodeIndx) )*kvec )
+         
             ! (k x vrel x k)
-         kvec =  p%Nodes(nodeIndx)%R_LToG(:,3)
          v = vrel - Dot_Product(kvec,vrel)*kvec
          vmag = sqrt( v(1)*v(1) + v(2)*v(2) + v(3)*v(3)  )
          
@@ -4554,7 +4597,9 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat,
          qdotdot2(1)    =       elementWaterState *u%DistribMesh%TranslationAcc(1,J)
          qdotdot2(2)    =       elementWaterState *u%DistribMesh%TranslationAcc(2,J)
          qdotdot2(3)    =       elementWaterState *u%DistribMesh%TranslationAcc(3,J)
-         m%D_F_AM_M(:,J)  = -matmul( p%D_AM_M (:,:,J) , qdotdot2 )  !bjj: these lines take up a lot of time. are the matrices sparse?
+            ! -( D_AM_M(1)*( I - k*k^T ) + D_AM_M(2)*k*k^T )*qdotdot2 (see DistrAddedMass)
+         adotk            = Dot_Product( kvec, qdotdot2 )
+         m%D_F_AM_M(1:3,J) = -( p%D_AM_M(1,J)*qdotdot2 + ( p%D_AM_M(2,J) - p%D_AM_M(1,J) )*adotk*kvec )
 
          DO I=1,6
             IF (I < 4 ) THEN
@@ -4574,29 +4619,28 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat,
          
          
       ENDDO
+      !$OMP END PARALLEL DO
 
       
       ! NOTE:  All wave kinematics have already been zeroed out above the SWL or instantaneous wave height (for WaveStMod > 0), so loads derived from the kinematics will be correct
       !        without the use of a nodeInWater value, but other loads need to be multiplied by nodeInWater to zero them out above the SWL or instantaneous wave height.
       
+      !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(J, I, nodeIndx, nodeInWater, vrel, vmag, AnProd, dragFactor, qdotdot) SCHEDULE(STATIC)
       DO J = 1, y%LumpedMesh%Nnodes
          
             ! Obtain the node index because WaveVel, WaveAcc, and WaveDynP are defined in the node indexing scheme, not the markers
 
          nodeIndx = p%lumpedToNodeIndx(J)
-         nodeInWater = REAL( InterpWrappedStpInt( REAL(Time, SiKi), p%WaveTime(:), p%nodeInWater(:,nodeIndx), m%LastIndWave, p%NStepWave + 1 ), ReKi )
+         nodeInWater = REAL( p%nodeInWater(nodeIndx,iTW), ReKi )
             ! Determine the dynamic pressure at the marker
-         m%L_FDynP(J) = InterpWrappedStpReal ( REAL(Time, SiKi), p%WaveTime(:), p%WaveDynP(:,nodeIndx), &
-                                    m%LastIndWave, p%NStepWave + 1       )
+         m%L_FDynP(J) = m%FDynP(nodeIndx)
          
          
          DO I=1,3
                ! Determine the fluid acceleration and velocity at the marker
-            m%L_FA(I,J) = InterpWrappedStpReal ( REAL(Time, SiKi), p%WaveTime(:), p%WaveAcc(:,nodeIndx,I), &
-                                    m%LastIndWave, p%NStepWave + 1       )
+            m%L_FA(I,J) = m%FA(I,nodeIndx)
                
-            m%L_FV(I,J) = InterpWrappedStpReal ( REAL(Time, SiKi), p%WaveTime(:), p%WaveVel(:,nodeIndx,I), &
-                                    m%LastIndWave, p%NStepWave + 1       )
+            m%L_FV(I,J) = m%FV(I,nodeIndx)
             vrel(I)     = m%L_FV(I,J) - u%LumpedMesh%TranslationVel(I,J)
          END DO
          
@@ -4613,17 +4657,18 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat,
          
  
             ! Lumped added mass loads
-         qdotdot                 = reshape((/u%LumpedMesh%TranslationAcc(:,J),u%LumpedMesh%RotationAcc(:,J)/),(/6/))   
-         m%L_F_AM(:,J)           = matmul( p%L_AM_M(:,:,J) , ( - qdotdot) )
-         DO I=1,3
-            m%L_F_AM(I,J) = nodeInWater * m%L_F_AM(I,J)  ! Note that the rotational components are zero because L_AM_M is populated with only the upper-left 3x3
-         END DO
+            ! -L_AM_M(4)*Vn*Vn^T*qdotdot, with Vn = L_AM_M(1:3); the rotational components are zero (see CreateLumpedMesh)
+         qdotdot(1:3)            = u%LumpedMesh%TranslationAcc(:,J)
+         m%L_F_AM(1:3,J)         = -nodeInWater * p%L_AM_M(4,J) * Dot_Product( p%L_AM_M(1:3,J), qdotdot(1:3) ) * p%L_AM_M(1:3,J)
+         m%L_F_AM(4:6,J)         = 0.0_ReKi
+         
+            ! Lumped inertial loads: L_AM_M(4)*Vn*Vn^T*a at the joints plus the end-cap dynamic pressure load
+         m%L_F_I(1:3,J)          = p%L_AM_M(4,J) * Dot_Product( p%L_AM_M(1:3,J), m%L_FA(:,J) ) * p%L_AM_M(1:3,J) + p%L_F_DP(:,J)*m%L_FDynP(J)
+         m%L_F_I(4:6,J)          = 0.0_ReKi
          
          DO I=1,6
                         
             ! We are now combining the dynamic pressure term into the inertia term
-            m%L_F_I(I,J) = InterpWrappedStpReal ( REAL(Time, SiKi), p%WaveTime(:), p%L_F_I(:,I,J), &
-                                    m%LastIndWave, p%NStepWave + 1       ) 
             
             IF (I < 4 ) THEN
       
@@ -4638,6 +4683,7 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat,
             
          END DO      
       ENDDO
+      !$OMP END PARALLEL DO
      
          ! OutSwtch determines whether or not to actually output results via the WriteOutput array
          ! 1 = Morison will generate an output file of its own.  2 = the caller will handle the outputs, but
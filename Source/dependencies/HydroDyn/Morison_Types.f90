@@ -31,6 +31,7 @@
 !! unpack routines associated with each defined data type. This code is automatically generated by the FAST Registry.
 MODULE Morison_Types
 !---------------------------------------------------------------------------------------------------------------------------------
+USE Waves_Types
 USE NWTC_Library
 IMPLICIT NONE
     INTEGER(IntKi), PUBLIC, PARAMETER  :: MaxMrsnOutputs = 4032      !  [-]
@@ -292,6 +293,8 @@ IMPLICIT NONE
     INTEGER(IntKi)  :: UnOutFile      !<  [-]
     INTEGER(IntKi)  :: UnSum      !<  [-]
     INTEGER(IntKi)  :: NStepWave      !<  [-]
+    INTEGER(IntKi)  :: WvKinMod      !< Wave kinematics evaluation model {0: precomputed over the wave period, 1: on demand from the wave spectrum} [-]
+    TYPE(Waves_KinProviderType)  :: WaveKin      !< Wave kinematics provider (used when WvKinMod = 1) [-]
     REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: WaveAcc      !<  [-]
     REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveTime      !<  [-]
     REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: WaveDynP      !<  [-]
@@ -348,7 +351,11 @@ IMPLICIT NONE
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: L_FV      !< Fluid velocity at point element node [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: L_FA      !< Fluid acceleration at point element node [-]
     REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: L_FDynP      !< Fluid dynamic pressure at point element node [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: FV      !< Fluid velocity at the nodes at the current time [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: FA      !< Fluid acceleration at the nodes at the current time [-]
+    REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: FDynP      !< Fluid dynamic pressure at the nodes at the current time [-]
     INTEGER(IntKi)  :: LastIndWave      !< Last time index used in the wave kinematics arrays [-]
+    TYPE(Waves_KinProviderType)  :: WaveKin      !< Wave kinematics provider and its window of synthesized time slices (used when WvKinMod = 1) [-]
   END TYPE Morison_MiscVarType
 ! =======================
 ! =========  Morison_ParameterType  =======
@@ -357,34 +364,33 @@ IMPLICIT NONE
     REAL(ReKi)  :: WtrDens      !<  [-]
     INTEGER(IntKi)  :: NNodes      !<  [-]
     TYPE(Morison_NodeType) , DIMENSION(:), ALLOCATABLE  :: Nodes      !<  [-]
-    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: D_F_I      !<  [-]
-    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: D_F_DP      !<  [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: D_F_I      !< Distributed inertial load coefficients: transverse (1,:), axial acceleration (2,:), and axial dynamic pressure (3,:), applied to the fluid kinematics at each marker [-]
     REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: D_dragConst      !<  [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: L_An      !<  [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: L_F_B      !<  [-]
-    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: L_F_I      !<  [-]
-    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: L_F_DP      !<  [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: L_F_DP      !< Lumped dynamic pressure load per unit dynamic pressure (component, marker) [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: L_F_BF      !<  [-]
-    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: L_AM_M      !<  [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: L_AM_M      !< Lumped added mass matrix, L_AM_M(4,:)*Vn*Vn^T with Vn = L_AM_M(1:3,:) [-]
     REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: L_dragConst      !<  [-]
     INTEGER(IntKi)  :: NDistribMarkers      !<  [-]
     INTEGER(IntKi) , DIMENSION(:), ALLOCATABLE  :: distribToNodeIndx      !<  [-]
     INTEGER(IntKi)  :: NLumpedMarkers      !<  [-]
     INTEGER(IntKi) , DIMENSION(:), ALLOCATABLE  :: lumpedToNodeIndx      !<  [-]
-    REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: WaveVel      !<  [-]
-    REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: WaveAcc      !<  [-]
-    REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: WaveDynP      !<  [-]
+    REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: WaveVel      !< Fluid velocity at the wave time steps (component, node, time step) [-]
+    REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: WaveAcc      !< Fluid acceleration at the wave time steps (component, node, time step) [-]
+    REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: WaveDynP      !< Fluid dynamic pressure at the wave time steps (node, time step) [-]
     REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveTime      !<  [-]
-    INTEGER(IntKi) , DIMENSION(:,:), ALLOCATABLE  :: elementWaterState      !< State indicating if the element a node is attached to at the given time step is in the water [0], above the water [1], or in the seabed [2] [-]
+    INTEGER(IntKi) , DIMENSION(:,:), ALLOCATABLE  :: elementWaterState      !< State indicating if the element a node is attached to at the given time step is in the water [0], above the water [1], or in the seabed [2] (marker, time step) [-]
     INTEGER(IntKi) , DIMENSION(:), ALLOCATABLE  :: elementFillState      !< State indicating if the element a node is attached to is in the filled fluid [0], above the fluid [1], or in the seabed [2] [-]
-    INTEGER(IntKi) , DIMENSION(:,:), ALLOCATABLE  :: nodeInWater      !< Logical flag indicating if the node at the given time step is in the water, and hence needs to have hydrodynamic forces calculated [-]
+    INTEGER(IntKi) , DIMENSION(:,:), ALLOCATABLE  :: nodeInWater      !< Logical flag indicating if the node at the given time step is in the water, and hence needs to have hydrodynamic forces calculated (node, time step) [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: D_F_B      !< Distributed buoyancy loads [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: D_F_BF      !< Distributed filled buoyancy loads [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: D_F_MG      !< Distributed marine growth loads [-]
-    REAL(ReKi) , DIMENSION(:,:,:), ALLOCATABLE  :: D_AM_M      !< Distributed member added mass matrix [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: D_AM_M      !< Distributed member added mass matrix, as transverse (1,:) and axial (2,:) coefficients along the member axis [-]
     REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: D_AM_MG      !< Distributed marine growth added mass matrix (weight) [-]
     REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: D_AM_F      !< Distributed added mass matrix due to flooding/filled fluid [-]
     INTEGER(IntKi)  :: NStepWave      !<  [-]
+    INTEGER(IntKi)  :: WvKinMod      !< Wave kinematics evaluation model {0: precomputed over the wave period, 1: on demand from the wave spectrum} [-]
     INTEGER(IntKi)  :: NMOutputs      !<  [-]
     TYPE(Morison_MOutput) , DIMENSION(:), ALLOCATABLE  :: MOutLst      !<  [-]
     INTEGER(IntKi)  :: NJOutputs      !<  [-]
@@ -3511,6 +3517,10 @@ ENDIF
     DstInitInputData%UnOutFile = SrcInitInputData%UnOutFile
     DstInitInputData%UnSum = SrcInitInputData%UnSum
     DstInitInputData%NStepWave = SrcInitInputData%NStepWave
+    DstInitInputData%WvKinMod = SrcInitInputData%WvKinMod
+      CALL Waves_Copykinprovidertype( SrcInitInputData%WaveKin, DstInitInputData%WaveKin, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
 IF (ALLOCATED(SrcInitInputData%WaveAcc)) THEN
   i1_l = LBOUND(SrcInitInputData%WaveAcc,1)
   i1_u = UBOUND(SrcInitInputData%WaveAcc,1)
@@ -3669,6 +3679,7 @@ ENDIF
 IF (ALLOCATED(InitInputData%ValidOutList)) THEN
   DEALLOCATE(InitInputData%ValidOutList)
 ENDIF
+  CALL Waves_Destroykinprovidertype( InitInputData%WaveKin, ErrStat, ErrMsg )
 IF (ALLOCATED(InitInputData%WaveAcc)) THEN
   DEALLOCATE(InitInputData%WaveAcc)
 ENDIF
@@ -4040,6 +4051,24 @@ ENDIF
       Int_BufSz  = Int_BufSz  + 1  ! UnOutFile
       Int_BufSz  = Int_BufSz  + 1  ! UnSum
       Int_BufSz  = Int_BufSz  + 1  ! NStepWave
+      Int_BufSz  = Int_BufSz  + 1  ! WvKinMod
+      Int_BufSz   = Int_BufSz + 3  ! WaveKin: size of buffers for each call to pack subtype
+      CALL Waves_Packkinprovidertype( Re_Buf, Db_Buf, Int_Buf, InData%WaveKin, ErrStat2, ErrMsg2, .TRUE. ) ! WaveKin 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! WaveKin
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! WaveKin
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! WaveKin
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
   Int_BufSz   = Int_BufSz   + 1     ! WaveAcc allocated yes/no
   IF ( ALLOCATED(InData%WaveAcc) ) THEN
     Int_BufSz   = Int_BufSz   + 2*3  ! WaveAcc upper/lower bounds for each dimension
@@ -4677,6 +4706,36 @@ ENDIF
       Int_Xferred   = Int_Xferred   + 1
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NStepWave
       Int_Xferred   = Int_Xferred   + 1
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%WvKinMod
+      Int_Xferred   = Int_Xferred   + 1
+      CALL Waves_Packkinprovidertype( Re_Buf, Db_Buf, Int_Buf, InData%WaveKin, ErrStat2, ErrMsg2, OnlySize ) ! WaveKin 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
   IF ( .NOT. ALLOCATED(InData%WaveAcc) ) THEN
     IntKiBuf( Int_Xferred ) = 0
     Int_Xferred = Int_Xferred + 1
@@ -5581,6 +5640,48 @@ ENDIF
       Int_Xferred   = Int_Xferred + 1
       OutData%NStepWave = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
+      OutData%WvKinMod = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL Waves_Unpackkinprovidertype( Re_Buf, Db_Buf, Int_Buf, OutData%WaveKin, ErrStat2, ErrMsg2 ) ! WaveKin 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
   IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WaveAcc not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
@@ -6993,8 +7094,51 @@ IF (ALLOCATED(SrcMiscData%L_FDynP)) THEN
     END IF
   END IF
     DstMiscData%L_FDynP = SrcMiscData%L_FDynP
+ENDIF
+IF (ALLOCATED(SrcMiscData%FV)) THEN
+  i1_l = LBOUND(SrcMiscData%FV,1)
+  i1_u = UBOUND(SrcMiscData%FV,1)
+  i2_l = LBOUND(SrcMiscData%FV,2)
+  i2_u = UBOUND(SrcMiscData%FV,2)
+  IF (.NOT. ALLOCATED(DstMiscData%FV)) THEN 
+    ALLOCATE(DstMiscData%FV(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%FV.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstMiscData%FV = SrcMiscData%FV
+ENDIF
+IF (ALLOCATED(SrcMiscData%FA)) THEN
+  i1_l = LBOUND(SrcMiscData%FA,1)
+  i1_u = UBOUND(SrcMiscData%FA,1)
+  i2_l = LBOUND(SrcMiscData%FA,2)
+  i2_u = UBOUND(SrcMiscData%FA,2)
+  IF (.NOT. ALLOCATED(DstMiscData%FA)) THEN 
+    ALLOCATE(DstMiscData%FA(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%FA.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstMiscData%FA = SrcMiscData%FA
+ENDIF
+IF (ALLOCATED(SrcMiscData%FDynP)) THEN
+  i1_l = LBOUND(SrcMiscData%FDynP,1)
+  i1_u = UBOUND(SrcMiscData%FDynP,1)
+  IF (.NOT. ALLOCATED(DstMiscData%FDynP)) THEN 
+    ALLOCATE(DstMiscData%FDynP(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%FDynP.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstMiscData%FDynP = SrcMiscData%FDynP
 ENDIF
     DstMiscData%LastIndWave = SrcMiscData%LastIndWave
+      CALL Waves_Copykinprovidertype( SrcMiscData%WaveKin, DstMiscData%WaveKin, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
  END SUBROUTINE Morison_CopyMisc
 
  SUBROUTINE Morison_DestroyMisc( MiscData, ErrStat, ErrMsg )
@@ -7060,6 +7204,16 @@ ENDIF
 IF (ALLOCATED(MiscData%L_FDynP)) THEN
   DEALLOCATE(MiscData%L_FDynP)
 ENDIF
+IF (ALLOCATED(MiscData%FV)) THEN
+  DEALLOCATE(MiscData%FV)
+ENDIF
+IF (ALLOCATED(MiscData%FA)) THEN
+  DEALLOCATE(MiscData%FA)
+ENDIF
+IF (ALLOCATED(MiscData%FDynP)) THEN
+  DEALLOCATE(MiscData%FDynP)
+ENDIF
+  CALL Waves_Destroykinprovidertype( MiscData%WaveKin, ErrStat, ErrMsg )
  END SUBROUTINE Morison_DestroyMisc
 
  SUBROUTINE Morison_PackMisc( ReKiBuf, DbKiBuf, IntKiBuf, Indata, ErrStat, ErrMsg, SizeOnly )
@@ -7186,8 +7340,41 @@ ENDIF
   IF ( ALLOCATED(InData%L_FDynP) ) THEN
     Int_BufSz   = Int_BufSz   + 2*1  ! L_FDynP upper/lower bounds for each dimension
       Re_BufSz   = Re_BufSz   + SIZE(InData%L_FDynP)  ! L_FDynP
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! FV allocated yes/no
+  IF ( ALLOCATED(InData%FV) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! FV upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%FV)  ! FV
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! FA allocated yes/no
+  IF ( ALLOCATED(InData%FA) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! FA upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%FA)  ! FA
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! FDynP allocated yes/no
+  IF ( ALLOCATED(InData%FDynP) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! FDynP upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%FDynP)  ! FDynP
   END IF
       Int_BufSz  = Int_BufSz  + 1  ! LastIndWave
+   ! Allocate buffers for subtypes, if any (we'll get sizes from these) 
+      Int_BufSz   = Int_BufSz + 3  ! WaveKin: size of buffers for each call to pack subtype
+      CALL Waves_Packkinprovidertype( Re_Buf, Db_Buf, Int_Buf, InData%WaveKin, ErrStat2, ErrMsg2, .TRUE. ) ! WaveKin 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! WaveKin
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! WaveKin
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! WaveKin
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
   IF ( Re_BufSz  .GT. 0 ) THEN 
      ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
      IF (ErrStat2 /= 0) THEN 
@@ -7496,9 +7683,82 @@ ENDIF
 
       IF (SIZE(InData%L_FDynP)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%L_FDynP))-1 ) = PACK(InData%L_FDynP,.TRUE.)
       Re_Xferred   = Re_Xferred   + SIZE(InData%L_FDynP)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%FV) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FV,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FV,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FV,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FV,2)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%FV)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%FV))-1 ) = PACK(InData%FV,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%FV)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%FA) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FA,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FA,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FA,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FA,2)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%FA)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%FA))-1 ) = PACK(InData%FA,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%FA)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%FDynP) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FDynP,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FDynP,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%FDynP)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%FDynP))-1 ) = PACK(InData%FDynP,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%FDynP)
   END IF
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%LastIndWave
       Int_Xferred   = Int_Xferred   + 1
+      CALL Waves_Packkinprovidertype( Re_Buf, Db_Buf, Int_Buf, InData%WaveKin, ErrStat2, ErrMsg2, OnlySize ) ! WaveKin 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
  END SUBROUTINE Morison_PackMisc
 
  SUBROUTINE Morison_UnPackMisc( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
@@ -7996,9 +8256,124 @@ ENDIF
       IF (SIZE(OutData%L_FDynP)>0) OutData%L_FDynP = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%L_FDynP))-1 ), mask1, 0.0_ReKi )
       Re_Xferred   = Re_Xferred   + SIZE(OutData%L_FDynP)
     DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FV not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%FV)) DEALLOCATE(OutData%FV)
+    ALLOCATE(OutData%FV(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FV.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%FV)>0) OutData%FV = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%FV))-1 ), mask2, 0.0_ReKi )
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%FV)
+    DEALLOCATE(mask2)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FA not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%FA)) DEALLOCATE(OutData%FA)
+    ALLOCATE(OutData%FA(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FA.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%FA)>0) OutData%FA = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%FA))-1 ), mask2, 0.0_ReKi )
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%FA)
+    DEALLOCATE(mask2)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FDynP not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%FDynP)) DEALLOCATE(OutData%FDynP)
+    ALLOCATE(OutData%FDynP(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FDynP.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%FDynP)>0) OutData%FDynP = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%FDynP))-1 ), mask1, 0.0_ReKi )
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%FDynP)
+    DEALLOCATE(mask1)
   END IF
       OutData%LastIndWave = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL Waves_Unpackkinprovidertype( Re_Buf, Db_Buf, Int_Buf, OutData%WaveKin, ErrStat2, ErrMsg2 ) ! WaveKin 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
  END SUBROUTINE Morison_UnPackMisc
 
  SUBROUTINE Morison_CopyParam( SrcParamData, DstParamData, CtrlCode, ErrStat, ErrMsg )
@@ -8042,10 +8417,8 @@ IF (ALLOCATED(SrcParamData%D_F_I)) THEN
   i1_u = UBOUND(SrcParamData%D_F_I,1)
   i2_l = LBOUND(SrcParamData%D_F_I,2)
   i2_u = UBOUND(SrcParamData%D_F_I,2)
-  i3_l = LBOUND(SrcParamData%D_F_I,3)
-  i3_u = UBOUND(SrcParamData%D_F_I,3)
   IF (.NOT. ALLOCATED(DstParamData%D_F_I)) THEN 
-    ALLOCATE(DstParamData%D_F_I(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(DstParamData%D_F_I(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
       CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%D_F_I.', ErrStat, ErrMsg,RoutineName)
       RETURN
@@ -8053,22 +8426,6 @@ IF (ALLOCATED(SrcParamData%D_F_I)) THEN
   END IF
     DstParamData%D_F_I = SrcParamData%D_F_I
 ENDIF
-IF (ALLOCATED(SrcParamData%D_F_DP)) THEN
-  i1_l = LBOUND(SrcParamData%D_F_DP,1)
-  i1_u = UBOUND(SrcParamData%D_F_DP,1)
-  i2_l = LBOUND(SrcParamData%D_F_DP,2)
-  i2_u = UBOUND(SrcParamData%D_F_DP,2)
-  i3_l = LBOUND(SrcParamData%D_F_DP,3)
-  i3_u = UBOUND(SrcParamData%D_F_DP,3)
-  IF (.NOT. ALLOCATED(DstParamData%D_F_DP)) THEN 
-    ALLOCATE(DstParamData%D_F_DP(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%D_F_DP.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%D_F_DP = SrcParamData%D_F_DP
-ENDIF
 IF (ALLOCATED(SrcParamData%D_dragConst)) THEN
   i1_l = LBOUND(SrcParamData%D_dragConst,1)
   i1_u = UBOUND(SrcParamData%D_dragConst,1)
@@ -8109,31 +8466,13 @@ IF (ALLOCATED(SrcParamData%L_F_B)) THEN
   END IF
     DstParamData%L_F_B = SrcParamData%L_F_B
 ENDIF
-IF (ALLOCATED(SrcParamData%L_F_I)) THEN
-  i1_l = LBOUND(SrcParamData%L_F_I,1)
-  i1_u = UBOUND(SrcParamData%L_F_I,1)
-  i2_l = LBOUND(SrcParamData%L_F_I,2)
-  i2_u = UBOUND(SrcParamData%L_F_I,2)
-  i3_l = LBOUND(SrcParamData%L_F_I,3)
-  i3_u = UBOUND(SrcParamData%L_F_I,3)
-  IF (.NOT. ALLOCATED(DstParamData%L_F_I)) THEN 
-    ALLOCATE(DstParamData%L_F_I(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%L_F_I.', ErrStat, ErrMsg,RoutineName)
-      RETURN
-    END IF
-  END IF
-    DstParamData%L_F_I = SrcParamData%L_F_I
-ENDIF
 IF (ALLOCATED(SrcParamData%L_F_DP)) THEN
   i1_l = LBOUND(SrcParamData%L_F_DP,1)
   i1_u = UBOUND(SrcParamData%L_F_DP,1)
   i2_l = LBOUND(SrcParamData%L_F_DP,2)
   i2_u = UBOUND(SrcParamData%L_F_DP,2)
-  i3_l = LBOUND(SrcParamData%L_F_DP,3)
-  i3_u = UBOUND(SrcParamData%L_F_DP,3)
   IF (.NOT. ALLOCATED(DstParamData%L_F_DP)) THEN 
-    ALLOCATE(DstParamData%L_F_DP(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(DstParamData%L_F_DP(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
       CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%L_F_DP.', ErrStat, ErrMsg,RoutineName)
       RETURN
@@ -8160,10 +8499,8 @@ IF (ALLOCATED(SrcParamData%L_AM_M)) THEN
   i1_u = UBOUND(SrcParamData%L_AM_M,1)
   i2_l = LBOUND(SrcParamData%L_AM_M,2)
   i2_u = UBOUND(SrcParamData%L_AM_M,2)
-  i3_l = LBOUND(SrcParamData%L_AM_M,3)
-  i3_u = UBOUND(SrcParamData%L_AM_M,3)
   IF (.NOT. ALLOCATED(DstParamData%L_AM_M)) THEN 
-    ALLOCATE(DstParamData%L_AM_M(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(DstParamData%L_AM_M(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
       CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%L_AM_M.', ErrStat, ErrMsg,RoutineName)
       RETURN
@@ -8354,10 +8691,8 @@ IF (ALLOCATED(SrcParamData%D_AM_M)) THEN
   i1_u = UBOUND(SrcParamData%D_AM_M,1)
   i2_l = LBOUND(SrcParamData%D_AM_M,2)
   i2_u = UBOUND(SrcParamData%D_AM_M,2)
-  i3_l = LBOUND(SrcParamData%D_AM_M,3)
-  i3_u = UBOUND(SrcParamData%D_AM_M,3)
   IF (.NOT. ALLOCATED(DstParamData%D_AM_M)) THEN 
-    ALLOCATE(DstParamData%D_AM_M(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(DstParamData%D_AM_M(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
       CALL SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%D_AM_M.', ErrStat, ErrMsg,RoutineName)
       RETURN
@@ -8390,6 +8725,7 @@ IF (ALLOCATED(SrcParamData%D_AM_F)) THEN
     DstParamData%D_AM_F = SrcParamData%D_AM_F
 ENDIF
     DstParamData%NStepWave = SrcParamData%NStepWave
+    DstParamData%WvKinMod = SrcParamData%WvKinMod
     DstParamData%NMOutputs = SrcParamData%NMOutputs
 IF (ALLOCATED(SrcParamData%MOutLst)) THEN
   i1_l = LBOUND(SrcParamData%MOutLst,1)
@@ -8467,9 +8803,6 @@ ENDIF
 IF (ALLOCATED(ParamData%D_F_I)) THEN
   DEALLOCATE(ParamData%D_F_I)
 ENDIF
-IF (ALLOCATED(ParamData%D_F_DP)) THEN
-  DEALLOCATE(ParamData%D_F_DP)
-ENDIF
 IF (ALLOCATED(ParamData%D_dragConst)) THEN
   DEALLOCATE(ParamData%D_dragConst)
 ENDIF
@@ -8479,9 +8812,6 @@ ENDIF
 IF (ALLOCATED(ParamData%L_F_B)) THEN
   DEALLOCATE(ParamData%L_F_B)
 ENDIF
-IF (ALLOCATED(ParamData%L_F_I)) THEN
-  DEALLOCATE(ParamData%L_F_I)
-ENDIF
 IF (ALLOCATED(ParamData%L_F_DP)) THEN
   DEALLOCATE(ParamData%L_F_DP)
 ENDIF
@@ -8623,14 +8953,9 @@ ENDIF
   END IF
   Int_BufSz   = Int_BufSz   + 1     ! D_F_I allocated yes/no
   IF ( ALLOCATED(InData%D_F_I) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*3  ! D_F_I upper/lower bounds for each dimension
+    Int_BufSz   = Int_BufSz   + 2*2  ! D_F_I upper/lower bounds for each dimension
       Re_BufSz   = Re_BufSz   + SIZE(InData%D_F_I)  ! D_F_I
   END IF
-  Int_BufSz   = Int_BufSz   + 1     ! D_F_DP allocated yes/no
-  IF ( ALLOCATED(InData%D_F_DP) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*3  ! D_F_DP upper/lower bounds for each dimension
-      Re_BufSz   = Re_BufSz   + SIZE(InData%D_F_DP)  ! D_F_DP
-  END IF
   Int_BufSz   = Int_BufSz   + 1     ! D_dragConst allocated yes/no
   IF ( ALLOCATED(InData%D_dragConst) ) THEN
     Int_BufSz   = Int_BufSz   + 2*1  ! D_dragConst upper/lower bounds for each dimension
@@ -8646,14 +8971,9 @@ ENDIF
     Int_BufSz   = Int_BufSz   + 2*2  ! L_F_B upper/lower bounds for each dimension
       Re_BufSz   = Re_BufSz   + SIZE(InData%L_F_B)  ! L_F_B
   END IF
-  Int_BufSz   = Int_BufSz   + 1     ! L_F_I allocated yes/no
-  IF ( ALLOCATED(InData%L_F_I) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*3  ! L_F_I upper/lower bounds for each dimension
-      Re_BufSz   = Re_BufSz   + SIZE(InData%L_F_I)  ! L_F_I
-  END IF
   Int_BufSz   = Int_BufSz   + 1     ! L_F_DP allocated yes/no
   IF ( ALLOCATED(InData%L_F_DP) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*3  ! L_F_DP upper/lower bounds for each dimension
+    Int_BufSz   = Int_BufSz   + 2*2  ! L_F_DP upper/lower bounds for each dimension
       Re_BufSz   = Re_BufSz   + SIZE(InData%L_F_DP)  ! L_F_DP
   END IF
   Int_BufSz   = Int_BufSz   + 1     ! L_F_BF allocated yes/no
@@ -8663,7 +8983,7 @@ ENDIF
   END IF
   Int_BufSz   = Int_BufSz   + 1     ! L_AM_M allocated yes/no
   IF ( ALLOCATED(InData%L_AM_M) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*3  ! L_AM_M upper/lower bounds for each dimension
+    Int_BufSz   = Int_BufSz   + 2*2  ! L_AM_M upper/lower bounds for each dimension
       Re_BufSz   = Re_BufSz   + SIZE(InData%L_AM_M)  ! L_AM_M
   END IF
   Int_BufSz   = Int_BufSz   + 1     ! L_dragConst allocated yes/no
@@ -8735,7 +9055,7 @@ ENDIF
   END IF
   Int_BufSz   = Int_BufSz   + 1     ! D_AM_M allocated yes/no
   IF ( ALLOCATED(InData%D_AM_M) ) THEN
-    Int_BufSz   = Int_BufSz   + 2*3  ! D_AM_M upper/lower bounds for each dimension
+    Int_BufSz   = Int_BufSz   + 2*2  ! D_AM_M upper/lower bounds for each dimension
       Re_BufSz   = Re_BufSz   + SIZE(InData%D_AM_M)  ! D_AM_M
   END IF
   Int_BufSz   = Int_BufSz   + 1     ! D_AM_MG allocated yes/no
@@ -8749,6 +9069,7 @@ ENDIF
       Re_BufSz   = Re_BufSz   + SIZE(InData%D_AM_F)  ! D_AM_F
   END IF
       Int_BufSz  = Int_BufSz  + 1  ! NStepWave
+      Int_BufSz  = Int_BufSz  + 1  ! WvKinMod
       Int_BufSz  = Int_BufSz  + 1  ! NMOutputs
   Int_BufSz   = Int_BufSz   + 1     ! MOutLst allocated yes/no
   IF ( ALLOCATED(InData%MOutLst) ) THEN
@@ -8912,33 +9233,11 @@ ENDIF
     Int_Xferred = Int_Xferred + 2
     IntKiBuf( Int_Xferred    ) = LBOUND(InData%D_F_I,2)
     IntKiBuf( Int_Xferred + 1) = UBOUND(InData%D_F_I,2)
-    Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%D_F_I,3)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%D_F_I,3)
     Int_Xferred = Int_Xferred + 2
 
       IF (SIZE(InData%D_F_I)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%D_F_I))-1 ) = PACK(InData%D_F_I,.TRUE.)
       Re_Xferred   = Re_Xferred   + SIZE(InData%D_F_I)
   END IF
-  IF ( .NOT. ALLOCATED(InData%D_F_DP) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    IntKiBuf( Int_Xferred ) = 1
-    Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%D_F_DP,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%D_F_DP,1)
-    Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%D_F_DP,2)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%D_F_DP,2)
-    Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%D_F_DP,3)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%D_F_DP,3)
-    Int_Xferred = Int_Xferred + 2
-
-      IF (SIZE(InData%D_F_DP)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%D_F_DP))-1 ) = PACK(InData%D_F_DP,.TRUE.)
-      Re_Xferred   = Re_Xferred   + SIZE(InData%D_F_DP)
-  END IF
   IF ( .NOT. ALLOCATED(InData%D_dragConst) ) THEN
     IntKiBuf( Int_Xferred ) = 0
     Int_Xferred = Int_Xferred + 1
@@ -8984,25 +9283,6 @@ ENDIF
       IF (SIZE(InData%L_F_B)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%L_F_B))-1 ) = PACK(InData%L_F_B,.TRUE.)
       Re_Xferred   = Re_Xferred   + SIZE(InData%L_F_B)
   END IF
-  IF ( .NOT. ALLOCATED(InData%L_F_I) ) THEN
-    IntKiBuf( Int_Xferred ) = 0
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    IntKiBuf( Int_Xferred ) = 1
-    Int_Xferred = Int_Xferred + 1
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%L_F_I,1)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%L_F_I,1)
-    Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%L_F_I,2)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%L_F_I,2)
-    Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%L_F_I,3)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%L_F_I,3)
-    Int_Xferred = Int_Xferred + 2
-
-      IF (SIZE(InData%L_F_I)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%L_F_I))-1 ) = PACK(InData%L_F_I,.TRUE.)
-      Re_Xferred   = Re_Xferred   + SIZE(InData%L_F_I)
-  END IF
   IF ( .NOT. ALLOCATED(InData%L_F_DP) ) THEN
     IntKiBuf( Int_Xferred ) = 0
     Int_Xferred = Int_Xferred + 1
@@ -9014,9 +9294,6 @@ ENDIF
     Int_Xferred = Int_Xferred + 2
     IntKiBuf( Int_Xferred    ) = LBOUND(InData%L_F_DP,2)
     IntKiBuf( Int_Xferred + 1) = UBOUND(InData%L_F_DP,2)
-    Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%L_F_DP,3)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%L_F_DP,3)
     Int_Xferred = Int_Xferred + 2
 
       IF (SIZE(InData%L_F_DP)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%L_F_DP))-1 ) = PACK(InData%L_F_DP,.TRUE.)
@@ -9049,9 +9326,6 @@ ENDIF
     Int_Xferred = Int_Xferred + 2
     IntKiBuf( Int_Xferred    ) = LBOUND(InData%L_AM_M,2)
     IntKiBuf( Int_Xferred + 1) = UBOUND(InData%L_AM_M,2)
-    Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%L_AM_M,3)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%L_AM_M,3)
     Int_Xferred = Int_Xferred + 2
 
       IF (SIZE(InData%L_AM_M)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%L_AM_M))-1 ) = PACK(InData%L_AM_M,.TRUE.)
@@ -9271,9 +9545,6 @@ ENDIF
     Int_Xferred = Int_Xferred + 2
     IntKiBuf( Int_Xferred    ) = LBOUND(InData%D_AM_M,2)
     IntKiBuf( Int_Xferred + 1) = UBOUND(InData%D_AM_M,2)
-    Int_Xferred = Int_Xferred + 2
-    IntKiBuf( Int_Xferred    ) = LBOUND(InData%D_AM_M,3)
-    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%D_AM_M,3)
     Int_Xferred = Int_Xferred + 2
 
       IF (SIZE(InData%D_AM_M)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%D_AM_M))-1 ) = PACK(InData%D_AM_M,.TRUE.)
@@ -9307,6 +9578,8 @@ ENDIF
   END IF
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NStepWave
       Int_Xferred   = Int_Xferred   + 1
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%WvKinMod
+      Int_Xferred   = Int_Xferred   + 1
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NMOutputs
       Int_Xferred   = Int_Xferred   + 1
   IF ( .NOT. ALLOCATED(InData%MOutLst) ) THEN
@@ -9563,53 +9836,21 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
     IF (ALLOCATED(OutData%D_F_I)) DEALLOCATE(OutData%D_F_I)
-    ALLOCATE(OutData%D_F_I(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(OutData%D_F_I(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
        CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%D_F_I.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    ALLOCATE(mask3(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask3.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    mask3 = .TRUE. 
-      IF (SIZE(OutData%D_F_I)>0) OutData%D_F_I = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%D_F_I))-1 ), mask3, 0.0_ReKi )
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%D_F_I)>0) OutData%D_F_I = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%D_F_I))-1 ), mask2, 0.0_ReKi )
       Re_Xferred   = Re_Xferred   + SIZE(OutData%D_F_I)
-    DEALLOCATE(mask3)
-  END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! D_F_DP not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%D_F_DP)) DEALLOCATE(OutData%D_F_DP)
-    ALLOCATE(OutData%D_F_DP(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%D_F_DP.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-    ALLOCATE(mask3(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask3.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-    mask3 = .TRUE. 
-      IF (SIZE(OutData%D_F_DP)>0) OutData%D_F_DP = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%D_F_DP))-1 ), mask3, 0.0_ReKi )
-      Re_Xferred   = Re_Xferred   + SIZE(OutData%D_F_DP)
-    DEALLOCATE(mask3)
+    DEALLOCATE(mask2)
   END IF
   IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! D_dragConst not allocated
     Int_Xferred = Int_Xferred + 1
@@ -9686,35 +9927,6 @@ ENDIF
       Re_Xferred   = Re_Xferred   + SIZE(OutData%L_F_B)
     DEALLOCATE(mask2)
   END IF
-  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! L_F_I not allocated
-    Int_Xferred = Int_Xferred + 1
-  ELSE
-    Int_Xferred = Int_Xferred + 1
-    i1_l = IntKiBuf( Int_Xferred    )
-    i1_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i2_l = IntKiBuf( Int_Xferred    )
-    i2_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
-    IF (ALLOCATED(OutData%L_F_I)) DEALLOCATE(OutData%L_F_I)
-    ALLOCATE(OutData%L_F_I(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%L_F_I.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-    ALLOCATE(mask3(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
-    IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask3.', ErrStat, ErrMsg,RoutineName)
-       RETURN
-    END IF
-    mask3 = .TRUE. 
-      IF (SIZE(OutData%L_F_I)>0) OutData%L_F_I = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%L_F_I))-1 ), mask3, 0.0_ReKi )
-      Re_Xferred   = Re_Xferred   + SIZE(OutData%L_F_I)
-    DEALLOCATE(mask3)
-  END IF
   IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! L_F_DP not allocated
     Int_Xferred = Int_Xferred + 1
   ELSE
@@ -9725,24 +9937,21 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
     IF (ALLOCATED(OutData%L_F_DP)) DEALLOCATE(OutData%L_F_DP)
-    ALLOCATE(OutData%L_F_DP(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(OutData%L_F_DP(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
        CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%L_F_DP.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    ALLOCATE(mask3(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask3.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    mask3 = .TRUE. 
-      IF (SIZE(OutData%L_F_DP)>0) OutData%L_F_DP = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%L_F_DP))-1 ), mask3, 0.0_ReKi )
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%L_F_DP)>0) OutData%L_F_DP = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%L_F_DP))-1 ), mask2, 0.0_ReKi )
       Re_Xferred   = Re_Xferred   + SIZE(OutData%L_F_DP)
-    DEALLOCATE(mask3)
+    DEALLOCATE(mask2)
   END IF
   IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! L_F_BF not allocated
     Int_Xferred = Int_Xferred + 1
@@ -9780,24 +9989,21 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
     IF (ALLOCATED(OutData%L_AM_M)) DEALLOCATE(OutData%L_AM_M)
-    ALLOCATE(OutData%L_AM_M(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(OutData%L_AM_M(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
        CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%L_AM_M.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    ALLOCATE(mask3(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask3.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    mask3 = .TRUE. 
-      IF (SIZE(OutData%L_AM_M)>0) OutData%L_AM_M = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%L_AM_M))-1 ), mask3, 0.0_ReKi )
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%L_AM_M)>0) OutData%L_AM_M = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%L_AM_M))-1 ), mask2, 0.0_ReKi )
       Re_Xferred   = Re_Xferred   + SIZE(OutData%L_AM_M)
-    DEALLOCATE(mask3)
+    DEALLOCATE(mask2)
   END IF
   IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! L_dragConst not allocated
     Int_Xferred = Int_Xferred + 1
@@ -10142,24 +10348,21 @@ ENDIF
     i2_l = IntKiBuf( Int_Xferred    )
     i2_u = IntKiBuf( Int_Xferred + 1)
     Int_Xferred = Int_Xferred + 2
-    i3_l = IntKiBuf( Int_Xferred    )
-    i3_u = IntKiBuf( Int_Xferred + 1)
-    Int_Xferred = Int_Xferred + 2
     IF (ALLOCATED(OutData%D_AM_M)) DEALLOCATE(OutData%D_AM_M)
-    ALLOCATE(OutData%D_AM_M(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(OutData%D_AM_M(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
        CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%D_AM_M.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    ALLOCATE(mask3(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
     IF (ErrStat2 /= 0) THEN 
-       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask3.', ErrStat, ErrMsg,RoutineName)
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
        RETURN
     END IF
-    mask3 = .TRUE. 
-      IF (SIZE(OutData%D_AM_M)>0) OutData%D_AM_M = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%D_AM_M))-1 ), mask3, 0.0_ReKi )
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%D_AM_M)>0) OutData%D_AM_M = UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%D_AM_M))-1 ), mask2, 0.0_ReKi )
       Re_Xferred   = Re_Xferred   + SIZE(OutData%D_AM_M)
-    DEALLOCATE(mask3)
+    DEALLOCATE(mask2)
   END IF
   IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! D_AM_MG not allocated
     Int_Xferred = Int_Xferred + 1
@@ -10209,6 +10412,8 @@ ENDIF
   END IF
       OutData%NStepWave = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
+      OutData%WvKinMod = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
       OutData%NMOutputs = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
   IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! MOutLst not allocated
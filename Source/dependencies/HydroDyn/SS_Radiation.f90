@@ -27,6 +27,8 @@ MODULE SS_Radiation
 
    USE SS_Radiation_Types   
    USE NWTC_Library
+   USE NWTC_LAPACK
+   USE HydroDyn_Cache
       
    IMPLICIT NONE
    
@@ -34,6 +36,12 @@ MODULE SS_Radiation
 
    TYPE(ProgDesc), PARAMETER  :: SS_Rad_ProgDesc = ProgDesc( 'SS_Radiation', 'v1.01.00', '23-Dec-2015' )
 
+   REAL(R8Ki),     PARAMETER  :: SS_Rad_MinKrnlNorm = 1.0E-3_R8Ki      ! Relative norm above which a fitted radiation kernel must get states
+
+#ifdef DEBUG_SCRATCH_ALLOC
+   INTEGER(IntKi), PUBLIC     :: SS_Rad_NumScratchAllocs = 0  ! number of times SS_Rad_CalcContStateDeriv allocated dxdt; should stay 0 after SS_Rad_Init
+#endif
+
    
       ! ..... Public Subroutines ...................................................................................................
 
@@ -79,6 +87,90 @@ SUBROUTINE SS_Rad_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
     ! Local Variables:
          
+    INTEGER                                :: I                                    ! Generic index
+    
+    integer                                :: ErrStat2
+    character(1024)                        :: ErrMsg2
+    
+    ! Initialize ErrStat   
+      ErrStat = ErrID_None         
+      ErrMsg  = ""               
+      
+      ! Get the state-space matrices: fit them to the wave radiation kernel if it is given, otherwise read the .ss file
+    IF ( ALLOCATED( InitInp%RdtnKrnl ) ) THEN
+       CALL SS_Rad_FitKrnl( InitInp, p, ErrStat2, ErrMsg2 )
+    ELSE
+       CALL SS_Rad_ReadSSFile( InitInp, p, ErrStat2, ErrMsg2 )
+    END IF
+       CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+       IF (ErrStat >= AbortErrLev) RETURN
+            
+    ! Define parameters here:
+         
+      p%DT  = Interval
+       
+    ! Define initial system states here:
+    CALL AllocAry( x%x, p%N,  'x%x', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')      
+      IF (ErrStat >= AbortErrLev) THEN
+         RETURN
+      END IF
+
+      x%x = 0
+     
+      xd%DummyDiscState          = 0 !TD: SS doesn't have disc states
+      z%DummyConstrState         = 0 !TD: SS doesn't have constr states
+      
+    ! Define other States: 
+      DO I=1,SIZE(OtherState%xdot)
+         CALL SS_Rad_CopyContState( x, OtherState%xdot(i), MESH_NEWCOPY, ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      END DO
+      OtherState%n = -1
+
+   ! misc vars: scratch states for the integrators, allocated here instead of on every step
+      CALL SS_Rad_CopyContState( x, m%xdot,   MESH_NEWCOPY, ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SS_Rad_CopyContState( x, m%k1,     MESH_NEWCOPY, ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SS_Rad_CopyContState( x, m%k2,     MESH_NEWCOPY, ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SS_Rad_CopyContState( x, m%k3,     MESH_NEWCOPY, ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SS_Rad_CopyContState( x, m%k4,     MESH_NEWCOPY, ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SS_Rad_CopyContState( x, m%x_tmp,  MESH_NEWCOPY, ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SS_Rad_CopyContState( x, m%x_pred, MESH_NEWCOPY, ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      IF (ErrStat >= AbortErrLev) THEN
+         RETURN
+      END IF
+      
+     !Inputs     
+      u%dq = 0 !6 DoF's velocities
+
+         ! Define system output initializations (set up mesh) here:
+         
+      y%y = 0         
+      y%WriteOutput = 0
+      
+         
+         ! Define initialization-routine output here:
+         
+      InitOut%WriteOutputHdr = (/ 'Time', 'F1  ' , 'F2  ' , 'F3  ' , 'F4  ' , 'F5  ' , 'F6  ' /)
+      InitOut%WriteOutputUnt = (/ '(s) ', '(N) ' , '(N) ' , '(N) ' , '(Nm)' , '(Nm)' , '(Nm)' /)     
+      
+         ! If you want to choose your own rate instead of using what the glue code suggests, tell the glue code the rate at which
+         !   this module must be called here:
+         
+       !p%DT=Interval
+
+END SUBROUTINE SS_Rad_Init
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine reads the state-space matrices of the radiation memory effect from the .ss file (e.g., from the SS_Fitting tool)
+!! and keeps the states of the DOFs enabled in InitInp%DOFs.
+SUBROUTINE SS_Rad_ReadSSFile( InitInp, p, ErrStat, ErrMsg )
+!..................................................................................................................................
+
+    TYPE(SS_Rad_InitInputType),       INTENT(IN   )  :: InitInp     !< Input data for initialization routine
+    TYPE(SS_Rad_ParameterType),       INTENT(INOUT)  :: p           !< Parameters
+    INTEGER(IntKi),                   INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+    CHARACTER(*),                     INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+    ! Local Variables:
+         
     REAL(ReKi), ALLOCATABLE                :: Rad_A (:,:)                          ! A matrix of the radiation state-space system on the input file ss
     REAL(ReKi), ALLOCATABLE                :: Rad_B (:,:)                          ! B matrix of the radiation state-space system on the input file ss
     REAL(ReKi), ALLOCATABLE                :: Rad_C (:,:)                          ! C matrix of the radiation state-space system on the input file ss
@@ -107,7 +199,7 @@ SUBROUTINE SS_Rad_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
     ! Open the .ss input file!
     CALL GetNewUnit( UnSS )
     CALL OpenFInpFile ( UnSS, TRIM(InitInp%InputFile)//'.ss', ErrStat2, ErrMsg2 )  ! Open file.
-      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
       IF (ErrStat >= AbortErrLev) THEN
          CALL CleanUp()
          RETURN
@@ -117,13 +209,13 @@ SUBROUTINE SS_Rad_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
     Nlines = 1
     
     CALL ReadCom ( UnSS, TRIM(InitInp%InputFile)//'.ss', 'Header',ErrStat2, ErrMsg2  )! Reads the first entire line (Title header)
-      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')    
+      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')    
     CALL ReadAry( UnSS,TRIM(InitInp%InputFile)//'.ss', xx(1,:), 6, 'xx', 'xx vector containing the enabled dofs',ErrStat2, ErrMsg2) ! Reads in the second line, containing the active dofs vector
-      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
     CALL ReadVar( UnSS,TRIM(InitInp%InputFile)//'.ss', N, 'N', 'Number of Dofs',ErrStat2, ErrMsg2) ! Reads in the third line, containing the number of states
-      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
     CALL ReadAry( UnSS,TRIM(InitInp%InputFile)//'.ss', spdof(1,:), 6, 'spdof', 'spdof vector containing the number of states per dofs',ErrStat2, ErrMsg2) ! Reads in the forth line, containing the state per dofs vector
-      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
       IF (ErrStat >= AbortErrLev) THEN
          CALL CleanUp()
          RETURN
@@ -143,18 +235,18 @@ SUBROUTINE SS_Rad_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
     
     !Verifications on the input file
     IF ( ( Nlines - 6 ) / 2 /= N) THEN
-      CALL SetErrStat(ErrID_Severe,'Error in the input file .ss: The size of the matrices does not correspond to the number of states!',ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SetErrStat(ErrID_Severe,'Error in the input file .ss: The size of the matrices does not correspond to the number of states!',ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
     END IF
     
     IF ( N /= SUM(spdof)) THEN
-      CALL SetErrStat(ErrID_Severe,'Error in the input file .ss: The size of the matrices does not correspond to the number of states!',ErrStat,ErrMsg,'SS_Rad_Init')
+      CALL SetErrStat(ErrID_Severe,'Error in the input file .ss: The size of the matrices does not correspond to the number of states!',ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
     END IF        
     
     !Verify if the DOFs active in the input file correspond to the ones active by FAST in this run
     DO I=1,6 !Loop through all 6 DOFs           
         IF ( InitInp%DOFs (1,I) == 1)  THEN !  True when the current DOF is active in FAST                   
             IF ( xx (1,I) /= 1) THEN ! True if a DOF enabled by FAST is not available in the INPUT File
-               CALL SetErrStat(ErrID_Severe,'Error in the input file .ss: The enabled DOFs in the current FAST Simulation don`t match the ones on the input file .ss!',ErrStat,ErrMsg,'SS_Rad_Init')
+               CALL SetErrStat(ErrID_Severe,'Error in the input file .ss: The enabled DOFs in the current FAST Simulation don`t match the ones on the input file .ss!',ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
             END IF           
         END IF
     END DO
@@ -168,9 +260,9 @@ SUBROUTINE SS_Rad_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
     
     ! Now we can allocate the temporary matrices A, B and C
     
-    CALL AllocAry( Rad_A, N,    N,    'Rad_A', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
-    CALL AllocAry( Rad_B, N,    DOFs, 'Rad_B', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
-    CALL AllocAry( Rad_C, DOFs, N,    'Rad_C', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+    CALL AllocAry( Rad_A, N,    N,    'Rad_A', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
+    CALL AllocAry( Rad_B, N,    DOFs, 'Rad_B', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
+    CALL AllocAry( Rad_C, DOFs, N,    'Rad_C', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
     
       IF (ErrStat >= AbortErrLev) THEN
          CALL CleanUp()
@@ -188,17 +280,17 @@ SUBROUTINE SS_Rad_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
     
     DO I = 1,N !Read A MatriX
         CALL ReadAry( UnSS,TRIM(InitInp%InputFile)//'.ss', Rad_A(I,:), N, 'Rad_A', 'A_Matrix',ErrStat2, ErrMsg2)
-          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
     END DO
     
     DO I = 1,N !Read B Matrix
         CALL ReadAry( UnSS, TRIM(InitInp%InputFile)//'.ss', Rad_B(I,:), 6, 'Rad_B', 'B_Matrix',ErrStat2, ErrMsg2) 
-          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
     END DO
     
     DO I = 1,6 !Read C Matrix
         CALL ReadAry( UnSS, TRIM(InitInp%InputFile)//'.ss', Rad_C(I,:), N, 'Rad_C', 'C_Matrix',ErrStat2, ErrMsg2)
-          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
     END DO
     
     CLOSE ( UnSS ) !Close .ss input file
@@ -215,9 +307,9 @@ SUBROUTINE SS_Rad_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
     CALL WrScr1 ( 'Using SS_Radiation Module, with '//TRIM( Num2LStr(p%N ))//' of '//TRIM( Num2LStr(N ))// ' radiation states' )
     
     !Now we can allocate the final size of the SS matrices
-    CALL AllocAry( p%A, p%N, p%N,    'p%A', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
-    CALL AllocAry( p%B, p%N, 6,      'p%B', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
-    CALL AllocAry( p%c, 6,   p%N,    'p%C', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
+    CALL AllocAry( p%A, p%N, p%N,    'p%A', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
+    CALL AllocAry( p%B, p%N, 6,      'p%B', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
+    CALL AllocAry( p%c, 6,   p%N,    'p%C', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_ReadSSFile')
       
     ! if these arrays weren't allocated, return before a seg fault occurs:      
       IF (ErrStat >= AbortErrLev) THEN
@@ -254,51 +346,7 @@ SUBROUTINE SS_Rad_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
             END IF
         END DO
     END IF
-            
-    ! Define parameters here:
-         
-      p%DT  = Interval
-       
-    ! Define initial system states here:
-    CALL AllocAry( x%x, p%N,  'x%x', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')      
-      IF (ErrStat >= AbortErrLev) THEN
-         CALL CleanUp()
-         RETURN
-      END IF
-
-      x%x = 0
-     
-      xd%DummyDiscState          = 0 !TD: SS doesn't have disc states
-      z%DummyConstrState         = 0 !TD: SS doesn't have constr states
-      
-    ! Define other States: 
-      DO I=1,SIZE(OtherState%xdot)
-         CALL SS_Rad_CopyContState( x, OtherState%xdot(i), MESH_NEWCOPY, ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_Init')
-      END DO
-      OtherState%n = -1
-
-   ! misc vars:
-      m%DummyMiscVar = 0
-      
-     !Inputs     
-      u%dq = 0 !6 DoF's velocities
 
-         ! Define system output initializations (set up mesh) here:
-         
-      y%y = 0         
-      y%WriteOutput = 0
-      
-         
-         ! Define initialization-routine output here:
-         
-      InitOut%WriteOutputHdr = (/ 'Time', 'F1  ' , 'F2  ' , 'F3  ' , 'F4  ' , 'F5  ' , 'F6  ' /)
-      InitOut%WriteOutputUnt = (/ '(s) ', '(N) ' , '(N) ' , '(N) ' , '(Nm)' , '(Nm)' , '(Nm)' /)     
-      
-         ! If you want to choose your own rate instead of using what the glue code suggests, tell the glue code the rate at which
-         !   this module must be called here:
-         
-       !p%DT=Interval
-       
    CALL CleanUp() ! deallocate local arrays
 
 CONTAINS
@@ -312,7 +360,623 @@ CONTAINS
    
    END SUBROUTINE CleanUp
        
-END SUBROUTINE SS_Rad_Init
+END SUBROUTINE SS_Rad_ReadSSFile
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine fits the state-space model of the radiation memory effect to the wave radiation kernel in InitInp%RdtnKrnl.
+!! A single-input, single-output model is fitted to each kernel of the upper triangle (the kernel matrix is symmetric); the model
+!! of an off-diagonal kernel is used for both of the DOF pairs.  Kernels of DOFs not enabled in InitInp%DOFs get no states.  It is
+!! a fatal error if the diagonal kernel of an enabled DOF, or a kernel that isn't negligible (see SS_Rad_FitKrnlPair), gets none.
+!! The fitted model is cached in InitInp%WvCacheDir (if given), and the errors of the fit are written to the summary file.
+SUBROUTINE SS_Rad_FitKrnl( InitInp, p, ErrStat, ErrMsg )
+!..................................................................................................................................
+
+    TYPE(SS_Rad_InitInputType),       INTENT(IN   )  :: InitInp     !< Input data for initialization routine
+    TYPE(SS_Rad_ParameterType),       INTENT(INOUT)  :: p           !< Parameters
+    INTEGER(IntKi),                   INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+    CHARACTER(*),                     INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+    ! Local Variables:
+         
+    REAL(R8Ki), ALLOCATABLE                :: Krnl  (:,:)                          ! Kernels of the upper-triangular DOF pairs (0:NStep-1,21)
+    REAL(R8Ki), ALLOCATABLE                :: PairA (:,:,:)                        ! A matrices of the models fitted to each kernel (FitOrd,FitOrd,21)
+    REAL(R8Ki), ALLOCATABLE                :: PairB (:,:)                          ! B vectors  of the models fitted to each kernel (FitOrd,21)
+    REAL(R8Ki), ALLOCATABLE                :: PairC (:,:)                          ! C vectors  of the models fitted to each kernel (FitOrd,21)
+    REAL(R8Ki)                             :: KNorm (21)                           ! 2-norms of the kernels
+    REAL(R8Ki)                             :: Ref                                  ! Reference norm for the relative error of a kernel
+    REAL(R8Ki)                             :: PairErr                              ! Relative error of the model fitted to a kernel
+    REAL(ReKi)                             :: FitErr(21)                           ! Relative errors of the models fitted to each kernel
+    INTEGER(IntKi)                         :: NStates(21)                          ! Number of states of the models fitted to each kernel
+    INTEGER                                :: PairI (21)                           ! First  DOF of each kernel
+    INTEGER                                :: PairJ (21)                           ! Second DOF of each kernel
+    INTEGER                                :: KDiag (6)                            ! Index of the diagonal kernel of each DOF
+    INTEGER                                :: NStep                                ! Number of time steps of the kernels
+    INTEGER                                :: Off                                  ! Number of states already assembled
+    INTEGER                                :: I                                    ! Generic index
+    INTEGER                                :: J                                    ! Generic index
+    INTEGER                                :: K                                    ! Kernel index
+    INTEGER                                :: N                                    ! Number of states of the current kernel
+    CHARACTER(1024)                        :: CacheFile                            ! Name of the cache file for this model; empty if not cached
+    LOGICAL                                :: CacheHit                             ! Whether the model was read from the cache
+    REAL(ReKi),    ALLOCATABLE             :: KeyRe(:)                             ! Packed reals    of the cache key (kernels and tolerance)
+    REAL(DbKi),    ALLOCATABLE             :: KeyDb(:)                             ! Packed doubles  of the cache key (time step)
+    INTEGER(IntKi),ALLOCATABLE             :: KeyInt(:)                            ! Packed integers of the cache key (order and number of steps)
+    REAL(ReKi),    ALLOCATABLE             :: ValRe(:)                             ! Packed reals    of the cached model
+    REAL(DbKi),    ALLOCATABLE             :: ValDb(:)                             ! Packed doubles  of the cached model (not used)
+    INTEGER(IntKi),ALLOCATABLE             :: ValInt(:)                            ! Packed integers of the cached model
+    
+    integer                                :: ErrStat2
+    character(1024)                        :: ErrMsg2
+    
+    ! Initialize ErrStat   
+      ErrStat   = ErrID_None         
+      ErrMsg    = ""               
+      CacheFile = ""
+      CacheHit  = .FALSE.
+      
+    IF ( InitInp%FitOrd < 1 ) THEN
+       CALL SetErrStat(ErrID_Fatal,'The maximum number of states of the fitted radiation kernels must be at least 1.',ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+       RETURN
+    END IF
+    
+    NStep = SIZE( InitInp%RdtnKrnl, 1 )
+    ALLOCATE ( Krnl(0:NStep-1,21), STAT=ErrStat2 )
+    IF ( ErrStat2 /= 0 ) THEN
+       CALL SetErrStat(ErrID_Fatal,'Error allocating memory for the radiation kernels.',ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+       RETURN
+    END IF
+    
+    ! Collect the upper triangle of the kernel matrix; the kernels of DOFs that aren't enabled are zeroed so they get no states
+    K = 0
+    DO I = 1,6
+       DO J = I,6
+          K = K + 1
+          PairI(K) = I
+          PairJ(K) = J
+          IF ( I == J ) KDiag(I) = K
+          IF ( InitInp%DOFs(1,I) == 1 .AND. InitInp%DOFs(1,J) == 1 ) THEN
+             Krnl(:,K) = InitInp%RdtnKrnl(:,I,J)
+          ELSE
+             Krnl(:,K) = 0.0_R8Ki
+          END IF
+       END DO
+    END DO
+    KNorm = SQRT( SUM( Krnl**2, DIM=1 ) )
+    
+    ! The fitted model only depends on the kernels and on the fit settings
+    IF ( LEN_TRIM( InitInp%WvCacheDir ) > 0 ) THEN
+       ALLOCATE ( KeyRe(21*NStep+1), KeyDb(1), KeyInt(2), STAT=ErrStat2 )
+       IF ( ErrStat2 == 0 ) THEN
+          KeyRe  = (/ REAL( RESHAPE( Krnl, (/ 21*NStep /) ), ReKi ), InitInp%FitTol /)
+          KeyDb  = (/ InitInp%RdtnDT /)
+          KeyInt = (/ InitInp%FitOrd, NStep /)
+          CacheFile = HDCache_FileName( InitInp%WvCacheDir, 'SSRad', KeyRe, KeyDb, KeyInt )
+          CALL HDCache_Read( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, CacheHit )
+          IF ( CacheHit ) CALL UnPackModel()
+          IF ( CacheHit ) CALL WrScr ( ' Reading the state-space radiation model from "'//TRIM(CacheFile)//'".' )
+       END IF
+    END IF
+    
+    IF ( .NOT. CacheHit ) THEN
+    
+       ALLOCATE ( PairA(InitInp%FitOrd,InitInp%FitOrd,21), PairB(InitInp%FitOrd,21), PairC(InitInp%FitOrd,21), STAT=ErrStat2 )
+       IF ( ErrStat2 /= 0 ) THEN
+          CALL SetErrStat(ErrID_Fatal,'Error allocating memory for the fitted radiation kernels.',ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+          RETURN
+       END IF
+       
+       ! The error of an off-diagonal kernel is relative to the diagonal kernels of its DOFs, which are usually much larger
+       DO K = 1,21
+          Ref = SQRT( KNorm(KDiag(PairI(K)))*KNorm(KDiag(PairJ(K))) )
+          IF ( Ref <= 0.0_R8Ki ) Ref = KNorm(K)
+          CALL SS_Rad_FitKrnlPair( Krnl(:,K), 'K'//TRIM(Num2LStr(PairI(K)))//TRIM(Num2LStr(PairJ(K))), InitInp%RdtnDT,       &
+                                   InitInp%FitOrd, REAL(InitInp%FitTol,R8Ki), Ref, NStates(K),                                   &
+                                   PairA(:,:,K), PairB(:,K), PairC(:,K), PairErr, ErrStat2, ErrMsg2 )
+             CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+             IF (ErrStat >= AbortErrLev) RETURN
+          FitErr(K) = REAL( PairErr, ReKi )
+          
+          ! The diagonal kernel of an enabled DOF only gets no states if RdtnSSTol accepts a zero kernel (RdtnSSTol >= 1)
+          IF ( PairI(K) == PairJ(K) .AND. NStates(K) == 0 .AND. KNorm(K) > 0.0_R8Ki ) THEN
+             CALL SetErrStat(ErrID_Fatal,'The state-space model of the diagonal radiation kernel K'//TRIM(Num2LStr(PairI(K)))//         &
+                             TRIM(Num2LStr(PairJ(K)))//' has no states. RdtnSSTol must be less than 1.',ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+             RETURN
+          END IF
+       END DO
+       
+       ! Assemble the model: each kernel K_IJ adds a block from input J to output I (and from I to J if off-diagonal); C is negated
+       ! because the radiation force is minus the convolution of the kernel with the body velocities
+       p%N = SUM( NStates ) + SUM( NStates, MASK = PairI /= PairJ )
+       CALL AllocAry( p%A, p%N, p%N,    'p%A', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+       CALL AllocAry( p%B, p%N, 6,      'p%B', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+       CALL AllocAry( p%C, 6,   p%N,    'p%C', ErrStat2, ErrMsg2); CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+          IF (ErrStat >= AbortErrLev) RETURN
+       
+       p%A = 0
+       p%B = 0
+       p%C = 0
+       Off = 0
+       DO K = 1,21
+          N = NStates(K)
+          IF ( N == 0 ) CYCLE
+          CALL AddBlock( PairI(K), PairJ(K) )
+          IF ( PairI(K) /= PairJ(K) ) CALL AddBlock( PairJ(K), PairI(K) )
+       END DO
+       
+       IF ( LEN_TRIM( CacheFile ) > 0 ) THEN
+          CALL PackModel()
+          IF ( ErrStat2 == 0 ) THEN
+             CALL HDCache_Write( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, ErrStat2, ErrMsg2 )
+                CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+          ELSE
+             CALL SetErrStat(ErrID_Warn,'Error allocating memory for the cache file of the state-space radiation model.',ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+          END IF
+       END IF
+       
+    END IF
+    
+    CALL WrScr1 ( 'Using SS_Radiation Module, with '//TRIM( Num2LStr(p%N ))//' radiation states fitted to the radiation kernels'// &
+                  ' (largest relative error '//TRIM( Num2LStr(MAXVAL(FitErr)) )//')' )
+    
+    IF ( InitInp%FitTol > 0.0_ReKi .AND. MAXVAL(FitErr) > InitInp%FitTol ) THEN
+       CALL SetErrStat(ErrID_Warn,'The state-space model fitted to the radiation kernels doesn''t meet the error tolerance: the largest'// &
+                       ' relative error is '//TRIM( Num2LStr(MAXVAL(FitErr)) )//'. Increase RdtnSSOrd for a better fit.',ErrStat,ErrMsg,'SS_Rad_FitKrnl')
+    END IF
+    
+    IF ( InitInp%UnSum > 0 ) THEN
+       WRITE( InitInp%UnSum,  '(//)' ) 
+       WRITE( InitInp%UnSum,  '(A)' ) 'State-space model fitted to the radiation memory effect kernels'
+       WRITE( InitInp%UnSum,  '(/)' ) 
+       WRITE( InitInp%UnSum, '(1X,A10,2X,A10,2X,A16)' )  ' Kernel ', ' States ', ' Rel. error '
+       WRITE( InitInp%UnSum, '(1X,A10,2X,A10,2X,A16)' )  '   (-)  ', '   (-)  ', '    (-)     '
+       DO K = 1,21
+          WRITE( InitInp%UnSum, '(1X,A10,2X,I10,2X,ES16.5)' ) 'K'//TRIM(Num2LStr(PairI(K)))//TRIM(Num2LStr(PairJ(K))), NStates(K), FitErr(K)
+       END DO
+    END IF
+
+CONTAINS
+
+   SUBROUTINE AddBlock( IOut, IIn )
+   
+      INTEGER, INTENT(IN)                 :: IOut                                 ! Output DOF of the block
+      INTEGER, INTENT(IN)                 :: IIn                                  ! Input  DOF of the block
+      
+      p%A(Off+1:Off+N,Off+1:Off+N) =  PairA(1:N,1:N,K)
+      p%B(Off+1:Off+N,IIn        ) =  PairB(1:N,K)
+      p%C(IOut,       Off+1:Off+N) = -PairC(1:N,K)
+      Off = Off + N
+      
+   END SUBROUTINE AddBlock
+
+   ! Packs the model for the cache file; ErrStat2 is nonzero if the arrays can't be allocated.
+   SUBROUTINE PackModel()
+
+      IF ( ALLOCATED(ValInt) ) DEALLOCATE(ValInt)
+      IF ( ALLOCATED(ValRe)  ) DEALLOCATE(ValRe)
+      ALLOCATE ( ValInt(22), ValRe(p%N*p%N + 12*p%N + 21), STAT=ErrStat2 )
+      IF ( ErrStat2 /= 0 ) RETURN
+
+      ValInt = (/ p%N, NStates /)
+      ValRe  = (/ RESHAPE( p%A, (/ p%N*p%N /) ), RESHAPE( p%B, (/ 6*p%N /) ), RESHAPE( p%C, (/ 6*p%N /) ), FitErr /)
+
+   END SUBROUTINE PackModel
+
+   ! Unpacks the model stored by PackModel; CacheHit is set to .FALSE. if the sizes don't match.
+   SUBROUTINE UnPackModel()
+
+      CacheHit = .FALSE.
+      IF ( SIZE(ValInt) /= 22 ) RETURN
+      N = ValInt(1)
+      IF ( N < 0 .OR. SIZE(ValRe) /= N*N + 12*N + 21 ) RETURN
+
+      ALLOCATE ( p%A(N,N), p%B(N,6), p%C(6,N), STAT=ErrStat2 )
+      IF ( ErrStat2 /= 0 ) RETURN
+
+      p%N     = N
+      NStates = ValInt(2:22)
+      p%A     = RESHAPE( ValRe(          1:N*N     ), (/ N, N /) )
+      p%B     = RESHAPE( ValRe(N*N+    1:N*N+ 6*N), (/ N, 6 /) )
+      p%C     = RESHAPE( ValRe(N*N+6*N+1:N*N+12*N), (/ 6, N /) )
+      FitErr  = ValRe(N*N+12*N+1:N*N+12*N+21)
+
+      CacheHit = .TRUE.
+
+   END SUBROUTINE UnPackModel
+
+END SUBROUTINE SS_Rad_FitKrnl
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine fits a single-input, single-output state-space model to one radiation kernel, K(t) ~ C*exp(A*t)*B, with the
+!! eigensystem realization algorithm: a discrete-time model is realized from the Hankel matrix of the (decimated) kernel samples and
+!! converted to continuous time with the matrix logarithm.  The orders 1 to FitOrd are tried; the most accurate stable model is kept,
+!! and the search stops at the first order whose error (the 2-norm of the error at all samples, relative to Ref) is within FitTol.
+!! A kernel gets no states if its relative norm is within FitTol; it is a fatal error if no stable model is found for a kernel whose
+!! relative norm is above both FitTol and SS_Rad_MinKrnlNorm.
+SUBROUTINE SS_Rad_FitKrnlPair( Krnl, KrnlName, DT, FitOrd, FitTol, Ref, N, A, B, C, FitErr, ErrStat, ErrMsg )
+!..................................................................................................................................
+
+    REAL(R8Ki),                       INTENT(IN   )  :: Krnl(0:)    !< Kernel at the time steps 0, DT, 2*DT, ...
+    CHARACTER(*),                     INTENT(IN   )  :: KrnlName    !< Name of the kernel (for error messages)
+    REAL(DbKi),                       INTENT(IN   )  :: DT          !< Time step of the kernel (s)
+    INTEGER(IntKi),                   INTENT(IN   )  :: FitOrd      !< Maximum number of states
+    REAL(R8Ki),                       INTENT(IN   )  :: FitTol      !< Relative error tolerance
+    REAL(R8Ki),                       INTENT(IN   )  :: Ref         !< Reference norm of the relative error
+    INTEGER(IntKi),                   INTENT(  OUT)  :: N           !< Number of states of the fitted model (0 if the kernel is within FitTol of zero)
+    REAL(R8Ki),                       INTENT(  OUT)  :: A(:,:)      !< A matrix of the fitted model (FitOrd,FitOrd); only A(1:N,1:N) is used
+    REAL(R8Ki),                       INTENT(  OUT)  :: B(:)        !< B vector of the fitted model (FitOrd); only B(1:N) is used
+    REAL(R8Ki),                       INTENT(  OUT)  :: C(:)        !< C vector of the fitted model (FitOrd); only C(1:N) is used
+    REAL(R8Ki),                       INTENT(  OUT)  :: FitErr      !< Relative error of the fitted model
+    INTEGER(IntKi),                   INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+    CHARACTER(*),                     INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+    ! Local Variables:
+         
+    INTEGER,    PARAMETER                  :: MaxHankel = 100                      ! Maximum size of the Hankel matrices
+    REAL(R8Ki), ALLOCATABLE                :: H0  (:,:)                            ! Hankel matrix of the kernel samples (replaced by its eigenvalue decomposition)
+    REAL(R8Ki), ALLOCATABLE                :: H1  (:,:)                            ! Hankel matrix of the kernel samples, shifted by one sample
+    REAL(R8Ki), ALLOCATABLE                :: Q   (:,:)                            ! Eigenvectors of H0, by decreasing magnitude of the eigenvalues
+    REAL(R8Ki), ALLOCATABLE                :: Lam (:)                              ! Eigenvalues of H0, by decreasing magnitude
+    REAL(R8Ki), ALLOCATABLE                :: Sq  (:)                              ! Square roots of the magnitudes of the eigenvalues
+    REAL(R8Ki), ALLOCATABLE                :: Ad  (:,:)                            ! Discrete-time A matrix (time step Dec*DT)
+    REAL(R8Ki), ALLOCATABLE                :: Lg  (:,:)                            ! Logarithm of Ad
+    REAL(R8Ki), ALLOCATABLE                :: Phi (:,:)                            ! Transition matrix over the time step DT
+    REAL(R8Ki), ALLOCATABLE                :: Bd  (:)                              ! B vector (the same in discrete and continuous time)
+    REAL(R8Ki), ALLOCATABLE                :: Cd  (:)                              ! C vector (the same in discrete and continuous time)
+    REAL(R8Ki), ALLOCATABLE                :: X   (:)                              ! States of the impulse response
+    REAL(R8Ki)                             :: Err                                  ! Relative error of the current order
+    LOGICAL                                :: Success                              ! Whether the matrix logarithm was found
+    INTEGER                                :: NStep                                ! Number of kernel samples
+    INTEGER                                :: NR                                   ! Size of the Hankel matrices
+    INTEGER                                :: Dec                                  ! Decimation of the kernel samples in the Hankel matrices
+    INTEGER                                :: Ord                                  ! Current order
+    INTEGER                                :: I                                    ! Generic index
+    INTEGER                                :: J                                    ! Generic index
+    INTEGER(IntKi)                         :: ErrStat2                             ! Temporary error status
+    
+    ! Initialize ErrStat   
+      ErrStat = ErrID_None         
+      ErrMsg  = ""               
+      
+    N = 0
+    A = 0.0_R8Ki
+    B = 0.0_R8Ki
+    C = 0.0_R8Ki
+    
+    NStep  = SIZE(Krnl)
+    FitErr = 0.0_R8Ki
+    IF ( Ref > 0.0_R8Ki ) FitErr = SQRT( SUM( Krnl**2 ) ) / Ref
+    IF ( FitErr <= FitTol ) RETURN
+    
+    ! The Hankel matrices span the whole kernel: H0(I,J) = K((I+J-2)*Dec*DT) and H1(I,J) = K((I+J-1)*Dec*DT)
+    NR = MIN( MaxHankel, (NStep-1)/2 )
+    IF ( NR < 1 ) THEN
+       CALL CheckStates()
+       RETURN
+    END IF
+    Dec = MAX( 1, (NStep-1)/(2*NR-1) )
+    
+    ALLOCATE ( H0(NR,NR), H1(NR,NR), Q(NR,NR), Lam(NR), Sq(NR), Ad(NR,NR), Lg(NR,NR), Phi(NR,NR), Bd(NR), Cd(NR), X(NR), STAT=ErrStat2 )
+    IF ( ErrStat2 /= 0 ) THEN
+       CALL SetErrStat(ErrID_Fatal,'Error allocating memory for the Hankel matrices of the radiation kernel.',ErrStat,ErrMsg,'SS_Rad_FitKrnlPair')
+       RETURN
+    END IF
+    
+    DO J = 1,NR
+       DO I = 1,NR
+          H0(I,J) = Krnl((I+J-2)*Dec)
+          H1(I,J) = Krnl((I+J-1)*Dec)
+       END DO
+    END DO
+    
+    ! H0 is symmetric, so its singular value decomposition follows from its eigenvalue decomposition: H0 = Q*|Lam|*(Q*sign(Lam))^T
+    CALL SS_Rad_SymEig( H0, Q, Lam )
+    
+    DO Ord = 1,MIN( FitOrd, NR )
+    
+       IF ( ABS(Lam(Ord)) <= NR*EPSILON(Lam)*ABS(Lam(1)) ) EXIT
+       
+       Sq(1:Ord) = SQRT( ABS( Lam(1:Ord) ) )
+       Ad(1:Ord,1:Ord) = MATMUL( TRANSPOSE( Q(:,1:Ord) ), MATMUL( H1, Q(:,1:Ord) ) )
+       DO J = 1,Ord
+          Ad(1:Ord,J) = SIGN( 1.0_R8Ki, Lam(J) ) * Ad(1:Ord,J) / ( Sq(1:Ord)*Sq(J) )
+       END DO
+       Bd(1:Ord) = Sq(1:Ord) * SIGN( 1.0_R8Ki, Lam(1:Ord) ) * Q(1,1:Ord)
+       Cd(1:Ord) = Sq(1:Ord) * Q(1,1:Ord)
+       
+       ! Only stable models with a real logarithm can be converted to continuous time
+       IF ( .NOT. SS_Rad_IsStable( Ad(1:Ord,1:Ord) ) ) CYCLE
+       CALL SS_Rad_LogM( Ad(1:Ord,1:Ord), Lg(1:Ord,1:Ord), Success )
+       IF ( .NOT. Success ) CYCLE
+       
+       ! Error of the impulse response at all of the kernel samples
+       CALL SS_Rad_ExpM( Lg(1:Ord,1:Ord) / Dec, Phi(1:Ord,1:Ord) )
+       X(1:Ord) = Bd(1:Ord)
+       Err = 0.0_R8Ki
+       DO I = 0,NStep-1
+          Err = Err + ( DOT_PRODUCT( Cd(1:Ord), X(1:Ord) ) - Krnl(I) )**2
+          X(1:Ord) = MATMUL( Phi(1:Ord,1:Ord), X(1:Ord) )
+       END DO
+       Err = SQRT( Err ) / Ref
+       
+       IF ( Err < FitErr ) THEN
+          N      = Ord
+          FitErr = Err
+          A(1:N,1:N) = Lg(1:N,1:N) / ( Dec*DT )
+          B(1:N)     = Bd(1:N)
+          C(1:N)     = Cd(1:N)
+       END IF
+       IF ( FitErr <= FitTol ) EXIT
+       
+    END DO
+    
+    CALL CheckStates()
+    
+CONTAINS
+
+   ! Sets a fatal error if the kernel isn't negligible but no model was found (FitErr is then the relative norm of the kernel).
+   SUBROUTINE CheckStates()
+   
+      IF ( N == 0 .AND. FitErr > MAX( FitTol, SS_Rad_MinKrnlNorm ) ) THEN
+         CALL SetErrStat(ErrID_Fatal,'No stable state-space model with up to '//TRIM(Num2LStr(FitOrd))//' states was found for the'// &
+                         ' radiation kernel '//TRIM(KrnlName)//', whose relative norm is '//TRIM(Num2LStr(REAL(FitErr,ReKi)))//        &
+                         '. Increase RdtnSSOrd or check the WAMIT output.',ErrStat,ErrMsg,'SS_Rad_FitKrnlPair')
+      END IF
+      
+   END SUBROUTINE CheckStates
+   
+END SUBROUTINE SS_Rad_FitKrnlPair
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine computes the eigenvalues and eigenvectors of a symmetric matrix with the cyclic Jacobi method.  The eigenvalues are
+!! sorted by decreasing magnitude.  S is overwritten.
+SUBROUTINE SS_Rad_SymEig( S, Q, Lam )
+
+    REAL(R8Ki),                       INTENT(INOUT)  :: S(:,:)      !< Symmetric matrix (destroyed)
+    REAL(R8Ki),                       INTENT(  OUT)  :: Q(:,:)      !< Eigenvectors (columns)
+    REAL(R8Ki),                       INTENT(  OUT)  :: Lam(:)      !< Eigenvalues
+
+    ! Local Variables:
+    
+    INTEGER,    PARAMETER                  :: MaxSweep = 50                        ! Maximum number of sweeps
+    REAL(R8Ki)                             :: Theta                                ! Cotangent of twice the rotation angle
+    REAL(R8Ki)                             :: T                                    ! Tangent of the rotation angle
+    REAL(R8Ki)                             :: Cs                                   ! Cosine of the rotation angle
+    REAL(R8Ki)                             :: Sn                                   ! Sine of the rotation angle
+    REAL(R8Ki)                             :: Tmp(SIZE(S,1))                       ! Temporary column
+    REAL(R8Ki)                             :: Tmp1                                 ! Temporary value
+    INTEGER                                :: N                                    ! Size of the matrix
+    INTEGER                                :: Sweep                                ! Current sweep
+    INTEGER                                :: I                                    ! Generic index
+    INTEGER                                :: P                                    ! Row of the rotated element
+    INTEGER                                :: R                                    ! Column of the rotated element
+    
+    N = SIZE(S,1)
+    Q = 0.0_R8Ki
+    DO I = 1,N
+       Q(I,I) = 1.0_R8Ki
+    END DO
+    
+    DO Sweep = 1,MaxSweep
+    
+       ! Stop when the off-diagonal elements are negligible
+       Tmp1 = 0.0_R8Ki
+       DO I = 1,N
+          Tmp1 = Tmp1 + SUM( S(1:I-1,I)**2 )
+       END DO
+       IF ( Tmp1 <= ( EPSILON(Tmp1)**2 )*SUM( S**2 ) ) EXIT
+       
+       DO P = 1,N-1
+          DO R = P+1,N
+             IF ( S(P,R) == 0.0_R8Ki ) CYCLE
+             Theta = ( S(R,R) - S(P,P) ) / ( 2.0_R8Ki*S(P,R) )
+             T     = SIGN( 1.0_R8Ki, Theta ) / ( ABS(Theta) + SQRT( Theta**2 + 1.0_R8Ki ) )
+             Cs    = 1.0_R8Ki / SQRT( T**2 + 1.0_R8Ki )
+             Sn    = T*Cs
+             
+                ! S = J^T*S*J and Q = Q*J, where J is the rotation in the (P,R) plane
+             Tmp    = S(:,P)
+             S(:,P) = Cs*Tmp - Sn*S(:,R)
+             S(:,R) = Sn*Tmp + Cs*S(:,R)
+             Tmp    = S(P,:)
+             S(P,:) = Cs*Tmp - Sn*S(R,:)
+             S(R,:) = Sn*Tmp + Cs*S(R,:)
+             Tmp    = Q(:,P)
+             Q(:,P) = Cs*Tmp - Sn*Q(:,R)
+             Q(:,R) = Sn*Tmp + Cs*Q(:,R)
+          END DO
+       END DO
+       
+    END DO
+    
+    DO I = 1,N
+       Lam(I) = S(I,I)
+    END DO
+    
+    ! Sort by decreasing magnitude (selection sort; the matrices are small)
+    DO I = 1,N-1
+       P = I - 1 + MAXLOC( ABS( Lam(I:N) ), 1 )
+       IF ( P == I ) CYCLE
+       Tmp1    = Lam(I)
+       Lam(I)  = Lam(P)
+       Lam(P)  = Tmp1
+       Tmp     = Q(:,I)
+       Q(:,I)  = Q(:,P)
+       Q(:,P)  = Tmp
+    END DO
+    
+END SUBROUTINE SS_Rad_SymEig
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This function determines whether a discrete-time A matrix is stable (all eigenvalues inside the unit circle) by repeated squaring.
+FUNCTION SS_Rad_IsStable( Ad )
+
+    REAL(R8Ki),                       INTENT(IN   )  :: Ad(:,:)     !< Discrete-time A matrix
+    LOGICAL                                          :: SS_Rad_IsStable
+
+    ! Local Variables:
+    
+    REAL(R8Ki)                             :: X(SIZE(Ad,1),SIZE(Ad,2))             ! Ad^(2^I)
+    REAL(R8Ki)                             :: XNorm                                ! 1-norm of X
+    INTEGER                                :: I                                    ! Generic index
+    
+    SS_Rad_IsStable = .FALSE.
+    X = Ad
+    DO I = 1,60
+       XNorm = MAXVAL( SUM( ABS(X), DIM=1 ) )
+       IF ( XNorm < 1.0E-6_R8Ki ) THEN
+          SS_Rad_IsStable = .TRUE.
+          RETURN
+       ELSE IF ( XNorm > 1.0E6_R8Ki ) THEN
+          RETURN
+       END IF
+       X = MATMUL( X, X )
+    END DO
+    
+END FUNCTION SS_Rad_IsStable
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine computes the (principal) logarithm of a real matrix by inverse scaling and squaring: the matrix is replaced by its
+!! square root (Denman-Beavers iteration) until it is close to the identity, where the Mercator series converges quickly.
+!! Success is .FALSE. if the matrix has no real logarithm (e.g., a negative real eigenvalue) or is (nearly) singular.
+SUBROUTINE SS_Rad_LogM( X, L, Success )
+
+    REAL(R8Ki),                       INTENT(IN   )  :: X(:,:)      !< Matrix
+    REAL(R8Ki),                       INTENT(  OUT)  :: L(:,:)      !< Logarithm of X
+    LOGICAL,                          INTENT(  OUT)  :: Success     !< Whether the logarithm was found
+
+    ! Local Variables:
+    
+    INTEGER,    PARAMETER                  :: MaxSqrt   = 40                       ! Maximum number of square roots
+    INTEGER,    PARAMETER                  :: NSeries   = 30                       ! Number of terms of the series
+    REAL(R8Ki)                             :: Y  (SIZE(X,1),SIZE(X,2))             ! X^(1/2^NRoot)
+    REAL(R8Ki)                             :: Z  (SIZE(X,1),SIZE(X,2))             ! Y - I
+    REAL(R8Ki)                             :: Trm(SIZE(X,1),SIZE(X,2))             ! Current term of the series
+    INTEGER                                :: NRoot                                ! Number of square roots taken
+    INTEGER                                :: I                                    ! Generic index
+    
+    Success = .FALSE.
+    L       = 0.0_R8Ki
+    Y       = X
+    NRoot   = 0
+    DO
+       Z = Y
+       DO I = 1,SIZE(X,1)
+          Z(I,I) = Z(I,I) - 1.0_R8Ki
+       END DO
+       IF ( MAXVAL( SUM( ABS(Z), DIM=1 ) ) <= 0.25_R8Ki ) EXIT
+       IF ( NRoot >= MaxSqrt ) RETURN
+       CALL SS_Rad_SqrtM( Y, Success )
+       IF ( .NOT. Success ) RETURN
+       NRoot = NRoot + 1
+    END DO
+    
+    ! log(I+Z) = Z - Z^2/2 + Z^3/3 - ...
+    Trm = Z
+    L   = Z
+    DO I = 2,NSeries
+       Trm = -MATMUL( Trm, Z )
+       L   = L + Trm / I
+    END DO
+    L       = L * 2.0_R8Ki**NRoot
+    Success = .TRUE.
+    
+END SUBROUTINE SS_Rad_LogM
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine replaces a matrix by its (principal) square root with the Denman-Beavers iteration.
+SUBROUTINE SS_Rad_SqrtM( Y, Success )
+
+    REAL(R8Ki),                       INTENT(INOUT)  :: Y(:,:)      !< Matrix; replaced by its square root
+    LOGICAL,                          INTENT(  OUT)  :: Success     !< Whether the iteration converged
+
+    ! Local Variables:
+    
+    INTEGER,    PARAMETER                  :: MaxIter = 50                         ! Maximum number of iterations
+    REAL(R8Ki)                             :: Z   (SIZE(Y,1),SIZE(Y,2))            ! Converges to the inverse of the square root
+    REAL(R8Ki)                             :: YInv(SIZE(Y,1),SIZE(Y,2))            ! Inverse of Y
+    REAL(R8Ki)                             :: ZInv(SIZE(Y,1),SIZE(Y,2))            ! Inverse of Z
+    REAL(R8Ki)                             :: YNew(SIZE(Y,1),SIZE(Y,2))            ! Next iterate of Y
+    INTEGER                                :: Iter                                 ! Current iteration
+    INTEGER                                :: I                                    ! Generic index
+    
+    Z = 0.0_R8Ki
+    DO I = 1,SIZE(Y,1)
+       Z(I,I) = 1.0_R8Ki
+    END DO
+    
+    DO Iter = 1,MaxIter
+       CALL SS_Rad_InvM( Y, YInv, Success )
+       IF ( .NOT. Success ) RETURN
+       CALL SS_Rad_InvM( Z, ZInv, Success )
+       IF ( .NOT. Success ) RETURN
+       YNew = 0.5_R8Ki*( Y + ZInv )
+       Z    = 0.5_R8Ki*( Z + YInv )
+       Success = MAXVAL( SUM( ABS(YNew - Y), DIM=1 ) ) <= 1.0E-12_R8Ki*MAXVAL( SUM( ABS(YNew), DIM=1 ) )
+       Y    = YNew
+       IF ( Success ) RETURN
+    END DO
+    
+END SUBROUTINE SS_Rad_SqrtM
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine computes the inverse of a matrix with the LAPACK LU factorization.  Success is .FALSE. if the matrix is singular.
+SUBROUTINE SS_Rad_InvM( X, XInv, Success )
+
+    REAL(R8Ki),                       INTENT(IN   )  :: X(:,:)      !< Matrix
+    REAL(R8Ki),                       INTENT(  OUT)  :: XInv(:,:)   !< Inverse of X
+    LOGICAL,                          INTENT(  OUT)  :: Success     !< Whether X could be inverted
+
+    ! Local Variables:
+    
+    REAL(R8Ki)                             :: LU  (SIZE(X,1),SIZE(X,2))            ! LU factorization of X
+    INTEGER                                :: IPIV(SIZE(X,1))                      ! Pivot indices of the factorization
+    INTEGER                                :: I                                    ! Generic index
+    INTEGER(IntKi)                         :: ErrStat2
+    CHARACTER(1024)                        :: ErrMsg2
+    
+    LU   = X
+    XInv = 0.0_R8Ki
+    DO I = 1,SIZE(X,1)
+       XInv(I,I) = 1.0_R8Ki
+    END DO
+    
+    CALL LAPACK_getrf( SIZE(LU,1), SIZE(LU,2), LU, IPIV, ErrStat2, ErrMsg2 )
+    Success = ErrStat2 < AbortErrLev
+    IF ( .NOT. Success ) RETURN
+    CALL LAPACK_getrs( 'N', SIZE(LU,1), LU, IPIV, XInv, ErrStat2, ErrMsg2 )
+    Success = ErrStat2 < AbortErrLev
+    
+END SUBROUTINE SS_Rad_InvM
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine computes the exponential of a matrix by scaling and squaring of its Taylor series.
+SUBROUTINE SS_Rad_ExpM( X, E )
+
+    REAL(R8Ki),                       INTENT(IN   )  :: X(:,:)      !< Matrix
+    REAL(R8Ki),                       INTENT(  OUT)  :: E(:,:)      !< Exponential of X
+
+    ! Local Variables:
+    
+    INTEGER,    PARAMETER                  :: NSeries = 20                         ! Number of terms of the series
+    REAL(R8Ki)                             :: Y  (SIZE(X,1),SIZE(X,2))             ! X / 2^NSquare
+    REAL(R8Ki)                             :: Trm(SIZE(X,1),SIZE(X,2))             ! Current term of the series
+    REAL(R8Ki)                             :: XNorm                                ! 1-norm of X
+    INTEGER                                :: NSquare                              ! Number of squarings
+    INTEGER                                :: I                                    ! Generic index
+    
+    XNorm   = MAXVAL( SUM( ABS(X), DIM=1 ) )
+    NSquare = 0
+    IF ( XNorm > 0.5_R8Ki ) NSquare = CEILING( LOG( XNorm / 0.5_R8Ki ) / LOG( 2.0_R8Ki ) )
+    Y = X / 2.0_R8Ki**NSquare
+    
+    E   = 0.0_R8Ki
+    Trm = 0.0_R8Ki
+    DO I = 1,SIZE(X,1)
+       E  (I,I) = 1.0_R8Ki
+       Trm(I,I) = 1.0_R8Ki
+    END DO
+    DO I = 1,NSeries
+       Trm = MATMUL( Trm, Y ) / I
+       E   = E + Trm
+    END DO
+    
+    DO I = 1,NSquare
+       E = MATMUL( E, E )
+    END DO
+    
+END SUBROUTINE SS_Rad_ExpM
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This routine is called at the end of the simulation.
 SUBROUTINE SS_Rad_End( u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
@@ -357,6 +1021,10 @@ SUBROUTINE SS_Rad_End( u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
          
          ! Destroy misc vars:
       CALL SS_Rad_DestroyMisc(  m,  ErrStat, ErrMsg )
+
+#ifdef DEBUG_SCRATCH_ALLOC
+      CALL WrScr( ' SS_Rad_End: SS_Rad_CalcContStateDeriv allocated dxdt '//TRIM(Num2LStr(SS_Rad_NumScratchAllocs))//' time(s).' )
+#endif
       
       
          ! Destroy the output data:
@@ -464,25 +1132,46 @@ SUBROUTINE SS_Rad_CalcContStateDeriv( Time, u, p, x, xd, z, OtherState, m, dxdt,
       TYPE(SS_Rad_ConstraintStateType),  INTENT(IN   )  :: z           !< Constraint states at Time
       TYPE(SS_Rad_OtherStateType),       INTENT(IN   )  :: OtherState  !< Other states                    
       TYPE(SS_Rad_MiscVarType),          INTENT(INOUT)  :: m           !< Initial misc/optimization variables            
-      TYPE(SS_Rad_ContinuousStateType),  INTENT(  OUT)  :: dxdt        !< Continuous state derivatives at Time
+      TYPE(SS_Rad_ContinuousStateType),  INTENT(INOUT)  :: dxdt        !< Continuous state derivatives at Time (allocated in SS_Rad_Init when passed from m)
       INTEGER(IntKi),                    INTENT(  OUT)  :: ErrStat     !< Error status of the operation     
       CHARACTER(*),                      INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
    
+      INTEGER(IntKi)                                    :: I           ! Index of the state
+      INTEGER(IntKi)                                    :: J           ! Index of the state or input
+   
          ! Initialize ErrStat
          
       ErrStat = ErrID_None         
       ErrMsg  = ""               
       
       
-      CALL AllocAry( dxdt%x, p%N, 'SS_Rad_CalcContStateDeriv:dxdt%x', ErrStat, ErrMsg)
-      IF ( ErrStat >= AbortErrLev) RETURN
+         ! The integrators in this module pass m%xdot or OtherState%xdot, which SS_Rad_Init allocates.  Other callers (e.g., 
+         ! WAMIT_CalcContStateDeriv, with the derivatives of the glue code) may pass dxdt unallocated on their first call:
+      IF ( .NOT. ALLOCATED(dxdt%x) ) THEN
+#ifdef DEBUG_SCRATCH_ALLOC
+         SS_Rad_NumScratchAllocs = SS_Rad_NumScratchAllocs + 1
+#endif
+         CALL AllocAry( dxdt%x, p%N, 'SS_Rad_CalcContStateDeriv:dxdt%x', ErrStat, ErrMsg)
+         IF ( ErrStat >= AbortErrLev) RETURN
+      END IF
             
       ! Compute the first time derivatives of the continuous states here:
       
       !Calc dxdt of a state space system
       ! [dxdt] = [A]*[xr]+B*[q]
+      !   (summed in place, so no temporary arrays are allocated for the MATMUL results)
       
-      dxdt%x =matmul(p%A,x%x) + matmul( p%B, u%dq)
+      dxdt%x = 0.0
+      DO J = 1,p%N
+         DO I = 1,p%N
+            dxdt%x(I) = dxdt%x(I) + p%A(I,J)*x%x(J)
+         END DO
+      END DO
+      DO J = 1,SIZE(u%dq)
+         DO I = 1,p%N
+            dxdt%x(I) = dxdt%x(I) + p%B(I,J)*u%dq(J)
+         END DO
+      END DO
         
 END SUBROUTINE SS_Rad_CalcContStateDeriv
 !----------------------------------------------------------------------------------------------------------------------------------
@@ -577,13 +1266,7 @@ SUBROUTINE SS_Rad_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, Err
       CHARACTER(*),                     INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
 
       ! local variables
-         
-      TYPE(SS_Rad_ContinuousStateType)                 :: xdot        ! time derivatives of continuous states      
-      TYPE(SS_Rad_ContinuousStateType)                 :: k1          ! RK4 constant; see above
-      TYPE(SS_Rad_ContinuousStateType)                 :: k2          ! RK4 constant; see above 
-      TYPE(SS_Rad_ContinuousStateType)                 :: k3          ! RK4 constant; see above 
-      TYPE(SS_Rad_ContinuousStateType)                 :: k4          ! RK4 constant; see above 
-      TYPE(SS_Rad_ContinuousStateType)                 :: x_tmp       ! Holds temporary modification to x
+      ! (xdot, the RK4 constants k1-k4, and x_tmp are scratch variables in m, allocated in SS_Rad_Init)
       TYPE(SS_Rad_InputType)                           :: u_interp    ! interpolated value of inputs 
 
       INTEGER(IntKi)                                   :: ErrStat2    ! local error status
@@ -594,19 +1277,6 @@ SUBROUTINE SS_Rad_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, Err
       ErrStat = ErrID_None
       ErrMsg  = "" 
 
-      CALL SS_Rad_CopyContState( x, k1, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-      CALL SS_Rad_CopyContState( x, k2, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-      CALL SS_Rad_CopyContState( x, k3, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-      CALL SS_Rad_CopyContState( x, k4,    MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-      CALL SS_Rad_CopyContState( x, x_tmp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
-         CALL CheckError(ErrStat2,ErrMsg2)
-         IF ( ErrStat >= AbortErrLev ) RETURN
-
-
       CALL SS_Rad_CopyInput( u(1), u_interp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
@@ -617,12 +1287,12 @@ SUBROUTINE SS_Rad_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, Err
          IF ( ErrStat >= AbortErrLev ) RETURN
 
       ! find xdot at t
-      CALL SS_Rad_CalcContStateDeriv( t, u_interp, p, x, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL SS_Rad_CalcContStateDeriv( t, u_interp, p, x, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      k1%x     = p%dt * xdot%x  
-      x_tmp%x  = x%x  + 0.5 * k1%x
+      m%k1%x     = p%dt * m%xdot%x  
+      m%x_tmp%x  = x%x  + 0.5 * m%k1%x
 
       ! interpolate u to find u_interp = u(t + dt/2)
       CALL SS_Rad_Input_ExtrapInterp(u, utimes, u_interp, t+0.5*p%dt, ErrStat2, ErrMsg2)
@@ -630,20 +1300,20 @@ SUBROUTINE SS_Rad_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, Err
          IF ( ErrStat >= AbortErrLev ) RETURN
 
       ! find xdot at t + dt/2
-      CALL SS_Rad_CalcContStateDeriv( t + 0.5*p%dt, u_interp, p, x_tmp, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL SS_Rad_CalcContStateDeriv( t + 0.5*p%dt, u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      k2%x     = p%dt * xdot%x
-      x_tmp%x  = x%x  + 0.5 * k2%x
+      m%k2%x     = p%dt * m%xdot%x
+      m%x_tmp%x  = x%x  + 0.5 * m%k2%x
 
       ! find xdot at t + dt/2
-      CALL SS_Rad_CalcContStateDeriv( t + 0.5*p%dt, u_interp, p, x_tmp, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL SS_Rad_CalcContStateDeriv( t + 0.5*p%dt, u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      k3%x     = p%dt * xdot%x 
-      x_tmp%x  = x%x  + k3%x
+      m%k3%x     = p%dt * m%xdot%x 
+      m%x_tmp%x  = x%x  + m%k3%x
 
       ! interpolate u to find u_interp = u(t + dt)
       CALL SS_Rad_Input_ExtrapInterp(u, utimes, u_interp, t + p%dt, ErrStat2, ErrMsg2)
@@ -651,40 +1321,17 @@ SUBROUTINE SS_Rad_RK4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, Err
          IF ( ErrStat >= AbortErrLev ) RETURN
 
       ! find xdot at t + dt
-      CALL SS_Rad_CalcContStateDeriv( t + p%dt, u_interp, p, x_tmp, xd, z, OtherState, m, xdot, ErrStat2, ErrMsg2 )
+      CALL SS_Rad_CalcContStateDeriv( t + p%dt, u_interp, p, m%x_tmp, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      k4%x  = p%dt * xdot%x
-      x%x   = x%x  +  ( k1%x  + 2. * k2%x  + 2. * k3%x  + k4%x  ) / 6.      
+      m%k4%x  = p%dt * m%xdot%x
+      x%x   = x%x  +  ( m%k1%x  + 2. * m%k2%x  + 2. * m%k3%x  + m%k4%x  ) / 6.      
 
-         ! clean up local variables:
-      CALL ExitThisRoutine(  )
-         
 CONTAINS      
-   !...............................................................................................................................
-   SUBROUTINE ExitThisRoutine()
-   ! This subroutine destroys all the local variables
-   !...............................................................................................................................
-
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(1024)            :: ErrMsg3     ! The error message (ErrMsg)
-   
-   
-      CALL SS_Rad_DestroyContState( xdot,     ErrStat3, ErrMsg3 )
-      CALL SS_Rad_DestroyContState( k1,       ErrStat3, ErrMsg3 )
-      CALL SS_Rad_DestroyContState( k2,       ErrStat3, ErrMsg3 )
-      CALL SS_Rad_DestroyContState( k3,       ErrStat3, ErrMsg3 )
-      CALL SS_Rad_DestroyContState( k4,       ErrStat3, ErrMsg3 )
-      CALL SS_Rad_DestroyContState( x_tmp,    ErrStat3, ErrMsg3 )
-
-      CALL SS_Rad_DestroyInput(     u_interp, ErrStat3, ErrMsg3 )
-         
-   END SUBROUTINE ExitThisRoutine      
    !...............................................................................................................................
    SUBROUTINE CheckError(ErrID,Msg)
-   ! This subroutine sets the error message and level and cleans up if the error is >= AbortErrLev
+   ! This subroutine sets the error message and level
    !...............................................................................................................................
 
          ! Passed arguments
@@ -705,13 +1352,6 @@ CONTAINS
          ErrMsg = TRIM(ErrMsg)//'SS_Rad_RK4:'//TRIM(Msg)         
          ErrStat = MAX(ErrStat,ErrID)
          
-         !.........................................................................................................................
-         ! Clean up if we're going to return on error: close files, deallocate local arrays
-         !.........................................................................................................................
-         
-         IF ( ErrStat >= AbortErrLev ) CALL ExitThisRoutine( )                  
-                  
-         
       END IF
 
    END SUBROUTINE CheckError                    
@@ -817,26 +1457,10 @@ SUBROUTINE SS_Rad_AB4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, Err
       endif
             
       
-         ! clean up local variables:
-      CALL ExitThisRoutine()
-      
 CONTAINS      
-   !...............................................................................................................................
-   SUBROUTINE ExitThisRoutine()
-   ! This subroutine destroys all the local variables
-   !...............................................................................................................................
-
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(1024)            :: ErrMsg3     ! The error message (ErrMsg)
-   
-   
-      CALL SS_Rad_DestroyInput(     u_interp, ErrStat3, ErrMsg3 )
-         
-   END SUBROUTINE ExitThisRoutine    
    !...............................................................................................................................
    SUBROUTINE CheckError(ErrID,Msg)
-   ! This subroutine sets the error message and level and cleans up if the error is >= AbortErrLev
+   ! This subroutine sets the error message and level
    !...............................................................................................................................
 
          ! Passed arguments
@@ -857,12 +1481,6 @@ CONTAINS
          ErrMsg = TRIM(ErrMsg)//'SS_Rad_AB4:'//TRIM(Msg)
          ErrStat = MAX(ErrStat, ErrID)
 
-         !.........................................................................................................................
-         ! Clean up if we're going to return on error: close files, deallocate local arrays
-         !.........................................................................................................................
-         
-         IF ( ErrStat >= AbortErrLev ) CALL ExitThisRoutine( )                  
-         
       END IF
 
    END SUBROUTINE CheckError            
@@ -903,10 +1521,8 @@ SUBROUTINE SS_Rad_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, Er
       CHARACTER(*),                       INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
 
       ! local variables
-
+      ! (the predicted states and their derivatives are the scratch variables m%x_pred and m%xdot, allocated in SS_Rad_Init)
       TYPE(SS_Rad_InputType)                             :: u_interp    ! Inputs at t
-      TYPE(SS_Rad_ContinuousStateType)                   :: x_pred      ! Continuous states at t
-      TYPE(SS_Rad_ContinuousStateType)                   :: xdot_pred   ! Derivative of continuous states at t
 
       INTEGER(IntKi)                                     :: ErrStat2    ! local error status
       CHARACTER(ErrMsgLen)                               :: ErrMsg2     ! local error message (ErrMsg)
@@ -917,11 +1533,11 @@ SUBROUTINE SS_Rad_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, Er
       ErrStat = ErrID_None
       ErrMsg  = "" 
 
-      CALL SS_Rad_CopyContState(x, x_pred, MESH_NEWCOPY, ErrStat2, ErrMsg2)
+      CALL SS_Rad_CopyContState(x, m%x_pred, MESH_UPDATECOPY, ErrStat2, ErrMsg2)
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
-      CALL SS_Rad_AB4( t, n, u, utimes, p, x_pred, xd, z, OtherState, m, ErrStat2, ErrMsg2 )
+      CALL SS_Rad_AB4( t, n, u, utimes, p, m%x_pred, xd, z, OtherState, m, ErrStat2, ErrMsg2 )
          CALL CheckError(ErrStat2,ErrMsg2)
          IF ( ErrStat >= AbortErrLev ) RETURN
 
@@ -935,43 +1551,25 @@ SUBROUTINE SS_Rad_ABM4( t, n, u, utimes, p, x, xd, z, OtherState, m, ErrStat, Er
             CALL CheckError(ErrStat2,ErrMsg2)
             IF ( ErrStat >= AbortErrLev ) RETURN
 
-         CALL SS_Rad_CalcContStateDeriv(t + p%dt, u_interp, p, x_pred, xd, z, OtherState, m, xdot_pred, ErrStat2, ErrMsg2 )
+         CALL SS_Rad_CalcContStateDeriv(t + p%dt, u_interp, p, m%x_pred, xd, z, OtherState, m, m%xdot, ErrStat2, ErrMsg2 )
             CALL CheckError(ErrStat2,ErrMsg2)
             IF ( ErrStat >= AbortErrLev ) RETURN
 
-         x%x  = x%x  + p%DT/24. * ( 9. * xdot_pred%x +  19. * OtherState%xdot(1)%x &
+         x%x  = x%x  + p%DT/24. * ( 9. * m%xdot%x +  19. * OtherState%xdot(1)%x &
                                                        - 5. * OtherState%xdot(2)%x &
                                                        + 1. * OtherState%xdot(3)%x )
                                 
       else
 
-         x%x  = x_pred%x
+         x%x  = m%x_pred%x
 
       endif
       
       
-         ! clean up local variables:
-      CALL ExitThisRoutine()
-      
 CONTAINS      
-   !...............................................................................................................................
-   SUBROUTINE ExitThisRoutine()
-   ! This subroutine destroys all the local variables
-   !...............................................................................................................................
-
-         ! local variables
-      INTEGER(IntKi)             :: ErrStat3    ! The error identifier (ErrStat)
-      CHARACTER(1024)            :: ErrMsg3     ! The error message (ErrMsg)
-   
-   
-      CALL SS_Rad_DestroyContState( xdot_pred,  ErrStat3, ErrMsg3 )
-      CALL SS_Rad_DestroyContState( x_pred,     ErrStat3, ErrMsg3 )
-      CALL SS_Rad_DestroyInput(     u_interp,   ErrStat3, ErrMsg3 )               
-      
-   END SUBROUTINE ExitThisRoutine    
    !...............................................................................................................................
    SUBROUTINE CheckError(ErrID,Msg)
-   ! This subroutine sets the error message and level and cleans up if the error is >= AbortErrLev
+   ! This subroutine sets the error message and level
    !...............................................................................................................................
 
          ! Passed arguments
@@ -992,11 +1590,6 @@ CONTAINS
          ErrMsg = TRIM(ErrMsg)//'SS_Rad_ABM4:'//TRIM(Msg)
          ErrStat = MAX(ErrStat, ErrID)
 
-         !.........................................................................................................................
-         ! Clean up if we're going to return on error: close files, deallocate local arrays
-         !.........................................................................................................................
-         IF ( ErrStat >= AbortErrLev ) CALL ExitThisRoutine( )                  
-         
       END IF
 
    END SUBROUTINE CheckError                 
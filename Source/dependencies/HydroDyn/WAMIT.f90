@@ -26,6 +26,7 @@
 MODULE WAMIT
 
    USE Waves
+   USE HydroDyn_Cache
    USE WAMIT_Types 
    USE WAMIT_Output
    USE WAMIT_Interp
@@ -102,51 +103,26 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
          
       COMPLEX(SiKi), ALLOCATABLE             :: HdroExctn (:,:,:)                    ! Frequency- and direction-dependent complex hydrodynamic wave excitation force per unit wave amplitude vector (kg/s^2, kg-m/s^2)
       COMPLEX(SiKi), ALLOCATABLE             :: WaveExctnC(:,:)                      ! Discrete Fourier transform of the instantaneous value of the total excitation force on the support platfrom from incident waves (N, N-m)
-      REAL(ReKi)                             :: DffrctDim (6)                        ! Matrix used to redimensionalize WAMIT hydrodynamic wave excitation force  output (kg/s^2, kg-m/s^2            )
       REAL(SiKi), ALLOCATABLE                :: HdroAddMs (:,:)                      ! The upper-triangular portion (diagonal and above) of the frequency-dependent hydrodynamic added mass matrix from the radiation problem (kg  , kg-m  , kg-m^2  )
       REAL(SiKi), ALLOCATABLE                :: HdroDmpng (:,:)                      ! The upper-triangular portion (diagonal and above) of the frequency-dependent hydrodynamic damping    matrix from the radiation problem (kg/s, kg-m/s, kg-m^2/s)
       REAL(SiKi), ALLOCATABLE                :: HdroFreq  (:)                        ! Frequency components inherent in the hydrodynamic added mass matrix, hydrodynamic daming matrix, and complex wave excitation force per unit wave amplitude vector (rad/s)
       REAL(SiKi), ALLOCATABLE                :: HdroWvDir (:)                        ! Incident wave propagation heading direction components inherent in the complex wave excitation force per unit wave amplitude vector (degrees)
       REAL(ReKi)                             :: HighFreq                             ! The highest frequency component in the WAMIT file, not counting infinity.
       REAL(ReKi)                             :: Omega                                ! Wave frequency (rad/s)
-      REAL(ReKi)                             :: PrvDir                               ! The value of TmpDir from the previous line (degrees)
-      REAL(ReKi)                             :: PrvPer                               ! The value of TmpPer from the previous line (sec    )
-      REAL(ReKi)                             :: SttcDim   (6,6)                      ! Matrix used to redimensionalize WAMIT hydrostatic  restoring              output (kg/s^2, kg-m/s^2, kg-m^2/s^2)
-      REAL(ReKi)                             :: RdtnDim   (6,6)                      ! Matrix used to redimensionalize WAMIT hydrodynamic added mass and damping output (kg    , kg-m    , kg-m^2    )
-      REAL(ReKi)                             :: TmpData1                             ! A temporary           value  read in from a WAMIT file (-      )
-      REAL(ReKi)                             :: TmpData2                             ! A temporary           value  read in from a WAMIT file (-      )
-      REAL(ReKi)                             :: TmpDir                               ! A temporary direction        read in from a WAMIT file (degrees)
-      REAL(ReKi)                             :: TmpIm                                ! A temporary imaginary value  read in from a WAMIT file (-      ) - stored as a REAL value
-      REAL(ReKi)                             :: TmpPer                               ! A temporary period           read in from a WAMIT file (sec    )
-      REAL(ReKi)                             :: TmpRe                                ! A temporary real      value  read in from a WAMIT file (-      )
       REAL(SiKi)                             :: TmpCoord(2)                          ! A temporary real array to hold the (Omega,WaveDir) pair for interpolation
-      REAL(ReKi), ALLOCATABLE                :: WAMITFreq (:)                        ! Frequency      components as ordered in the WAMIT output files (rad/s  )
-      REAL(ReKi), ALLOCATABLE                :: WAMITPer  (:)                        ! Period         components as ordered in the WAMIT output files (sec    )
-      REAL(ReKi), ALLOCATABLE                :: WAMITWvDir(:)                        ! Wave direction components as ordered in the WAMIT output files (degrees)
 
       INTEGER                                :: I                                    ! Generic index
       INTEGER                                :: Indx                                 ! Cycles through the upper-triangular portion (diagonal and above) of the frequency-dependent hydrodynamic added mass and damping matrices from the radiation problem
-      INTEGER                                :: InsertInd                            ! The lowest sorted index whose associated frequency component is higher than the current frequency component -- this is to sort the frequency components from lowest to highest
       INTEGER                                :: J                                    ! Generic index
       INTEGER                                :: K                                    ! Generic index
       INTEGER                                :: LastInd                              ! Index into the arrays saved from the last call as a starting point for this call
       INTEGER                                :: LastInd2(2)                          ! Index into the arrays saved from the last call as a starting point for this call. 2D
       INTEGER                                :: NInpFreq                             ! Number of input frequency components inherent in the hydrodynamic added mass matrix, hydrodynamic daming matrix, and complex wave excitation force per unit wave amplitude vector (-)
       INTEGER                                :: NInpWvDir                            ! Number of input incident wave propagation heading direction components inherent in the complex wave excitation force per unit wave amplitude vector (-)
-      INTEGER,    ALLOCATABLE                :: SortFreqInd (:)                      ! The array of indices such that WAMITFreq (SortFreqInd (:)) is sorted from lowest to highest frequency (-)
-      INTEGER,    ALLOCATABLE                :: SortWvDirInd(:)                      ! The array of indices such that WAMITWvDir(SortWvDirInd(:)) is sorted from lowest to highest agnle     (-)
-      INTEGER                                :: Sttus                                ! Status returned by an attempted allocation or READ.
-      INTEGER                                :: UnW1                                 ! I/O unit number for the WAMIT output file with the .1   extension; this file contains the linear, nondimensionalized, frequency-dependent solution to the radiation   problem.
-      INTEGER                                :: UnW3                                 ! I/O unit number for the WAMIT output file with the .3   extension; this file contains the linear, nondimensionalized, frequency-dependent solution to the diffraction problem.
-      INTEGER                                :: UnWh                                 ! I/O unit number for the WAMIT output file with the .hst extension; this file contains the linear, nondimensionalized hydrostatic restoring matrix.
 
-      LOGICAL                                :: FirstFreq                            ! When .TRUE., indicates we're still looping through the first frequency component.
-      LOGICAL                                :: FirstPass                            ! When .TRUE., indicates we're on the first pass through a loop.
       LOGICAL                                :: InfFreq                              ! When .TRUE., indicates that the infinite-frequency limit of added mass is contained within the WAMIT output files.
-      LOGICAL                                :: NewPer                               ! When .TRUE., indicates that the period has just changed.
       LOGICAL                                :: ZeroFreq                             ! When .TRUE., indicates that the zero    -frequency limit of added mass is contained within the WAMIT output files.
       
-      CHARACTER(1024)                        :: Line                                 ! String to temporarily hold the value of a line within a WAMIT output file.
 
       TYPE(FFT_DataType)                     :: FFT_Data                             ! the instance of the FFT module we're using
 
@@ -158,14 +134,8 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
 
          ! Initialize data
          
-      HighFreq    = 0.0
-      UnW1        = 31
-      UnW3        = 32
-      UnWh        = 33
       LastInd     = 1
       LastInd2    = 0
-      InfFreq     = .FALSE.    
-      ZeroFreq    = .FALSE.
       
       
          ! Initialize ErrStat
@@ -224,165 +194,804 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
       
 
          
-         ! Tell our nice users what is about to happen that may take a while:
-
-      CALL WrScr ( ' Reading in WAMIT output with root name "'//TRIM(InitInp%WAMITFile)//'".' )
-
-
-
-         ! Let's set up the matrices used to redimensionalize the hydrodynamic data
-         !   from WAMIT; all these matrices are symmetric and need to be used with
-         !   element-by-element multiplication, instead of matrix-by-matrix
-         !   multiplication:
-
-      SttcDim(1,1) = p%RhoXg  *InitInp%WAMITULEN**2  ! Force-translation
-      SttcDim(1,4) = p%RhoXg  *InitInp%WAMITULEN**3  ! Force-rotation/Moment-translation - Hydrostatic restoring
-      SttcDim(4,4) = p%RhoXg  *InitInp%WAMITULEN**4  ! Moment-rotation
-
-      RdtnDim(1,1) = InitInp%WtrDens*InitInp%WAMITULEN**3  ! Force-translation
-      RdtnDim(1,4) = InitInp%WtrDens*InitInp%WAMITULEN**4  ! Force-rotation/Moment-translation - Hydrodynamic added mass and damping
-      RdtnDim(4,4) = InitInp%WtrDens*InitInp%WAMITULEN**5  ! Moment-rotation
-
-      DffrctDim(1) = p%RhoXg  *InitInp%WAMITULEN**2  ! Force-translation - Hydrodynamic wave excitation force
-      DffrctDim(4) = p%RhoXg  *InitInp%WAMITULEN**3  ! Moment-rotation
-
-      DO I = 1,3     ! Loop through all force-translation elements (rows)
+         ! Read in and redimensionalize the hydrodynamic data from the WAMIT output files, or read the processed data from the
+         !   cache when another simulation has already read the same files:
 
-         DO J = 1,3  ! Loop through all force-translation elements (columns)
-
-            SttcDim(I,J) = SttcDim(1,1)
+      CALL WAMIT_ReadHydroData( InitInp, p%HdroSttc, HdroFreq, HdroAddMs, HdroDmpng, HdroWvDir, HdroExctn, NInpFreq, NInpWvDir, &
+                                HighFreq, ZeroFreq, InfFreq, ErrStat2, ErrMsg2 )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+         IF ( ErrStat >= AbortErrLev )  THEN
+            CALL Cleanup()
+            RETURN
+         END IF
 
-            RdtnDim(I,J) = RdtnDim(1,1)
 
-         END DO       ! J - All force-translation elements (columns)
+      
+            ! Tell our nice users what is about to happen that may take a while:
 
-         DffrctDim (I  ) = DffrctDim(1)
+      CALL WrScr ( ' Computing radiation impulse response functions and wave diffraction forces.' )
 
-      END DO          ! I - All force-translation elements (rows)
 
-      DO I = 1,3     ! Loop through all force-rotation/moment-translation elements (rows/columns)
 
-         DO J = 4,6  ! Loop through all force-rotation/moment-translation elements (columns/rows)
+         ! Abort if the WAMIT files do not contain both the zero- and and infinite-
+         !   frequency limits of added mass.  
 
-            SttcDim(I,J) = SttcDim(1,4)
-            SttcDim(J,I) = SttcDim(1,4)
+      IF ( .NOT. ( ZeroFreq .AND. InfFreq ) )  THEN   ! .TRUE. if both the zero- and infinite-frequency limits of added mass are contained within the WAMIT file
+         ErrMsg2  = ' "'//TRIM(InitInp%WAMITFile)// &
+                          '.1" must contain both the zero- and infinite-frequency limits of added mass.'
+         CALL SetErrStat( ErrID_Fatal, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+         CALL Cleanup()
+         RETURN         
+      END IF
 
-            RdtnDim(I,J) = RdtnDim(1,4)
-            RdtnDim(J,I) = RdtnDim(1,4)
 
-         END DO       ! J - All force-rotation/moment-translation elements (rows/columns)
 
-      END DO          ! I - All force-rotation/moment-translation elements (columns/rows)
+         ! Set the infinite-frequency limit of the frequency-dependent hydrodynamic
+         !   added mass matrix, HdroAdMsI, based on the highest frequency available:
 
-      DO I = 4,6     ! Loop through all moment-rotation elements (rows)
+      Indx = 0
+      DO J = 1,6        ! Loop through all rows    of HdroAdMsI
+         DO K = J,6     ! Loop through all columns of HdroAdMsI above and including the diagonal
+            Indx = Indx + 1
+            p%HdroAdMsI(J,K) = HdroAddMs(NInpFreq,Indx)
+         END DO          ! K - All columns of HdroAdMsI above and including the diagonal
+         DO K = J+1,6   ! Loop through all rows    of HdroAdMsI below the diagonal
+            p%HdroAdMsI(K,J) = p%HdroAdMsI(J,K)
+         END DO          ! K - All rows    of HdroAdMsI below the diagonal
+      END DO             ! J - All rows    of HdroAdMsI
 
-         DO J = 4,6  ! Loop through all moment-rotation elements (columns)
 
-            SttcDim(I,J) = SttcDim(4,4)
 
-            RdtnDim(I,J) = RdtnDim(4,4)
+     
+   
+           ! Initialize the variables associated with the incident wave:
 
-         END DO       ! J - All moment-rotation elements (columns)
+      SELECT CASE ( InitInp%WaveMod ) ! Which incident wave kinematics model are we using?
 
-         DffrctDim (I  ) = DffrctDim(4)
+      CASE ( 0 )              ! None=still water.
 
-      END DO          ! I - All moment-rotation elements (rows)
 
 
+            ! Initialize everything to zero:
 
+         ALLOCATE ( p%WaveExctn (0:InitInp%NStepWave,6) , STAT=ErrStat2 )
+         IF ( ErrStat2 /= 0 )  THEN
+            CALL SetErrStat( ErrID_Fatal, 'Error allocating memory for the WaveExctn array.', ErrStat, ErrMsg, 'WAMIT_Init')
+            CALL Cleanup()
+            RETURN
+         END IF
 
-         ! Let's read in and redimensionalize the hydrodynamic data from the WAMIT
-         !   output files:
+         p%WaveExctn = 0.0   
+         
+      CASE ( 1, 2, 3, 4, 5, 10 )    ! Plane progressive (regular) wave, JONSWAP/Pierson-Moskowitz spectrum (irregular) wave, white-noise wave,  or user-defined spectrum (irregular) wave.
 
 
 
-         ! Linear restoring from the hydrostatics problem:
+            ! Abort if we have chosen a wave heading direction that is outside the range
+            !   of directions where the complex wave excitation force per unit wave
+            !   amplitude vector has been defined, else interpolate to find the complex
+            !   wave excitation force per unit wave amplitude vector at the chosen wave
+            !   heading direction:
+            ! NOTE: we may end up inadvertantly aborting if the wave direction crosses
+            !   the -Pi / Pi boundary (-180/180 degrees).
 
-      CALL OpenFInpFile ( UnWh, TRIM(InitInp%WAMITFile)//'.hst', ErrStat2, ErrMsg2 )  ! Open file.
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')      
-         IF ( ErrStat >= AbortErrLev )  THEN
+         IF ( ( InitInp%WaveDirMin < HdroWvDir(1) ) .OR. ( InitInp%WaveDirMax > HdroWvDir(NInpWvDir) ) )  THEN
+            ErrMsg2  = 'All Wave directions must be within the wave heading angle range available in "' &
+                           //TRIM(InitInp%WAMITFile)//'.3" (inclusive).'
+            CALL SetErrStat( ErrID_Fatal, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
             CALL Cleanup()
             RETURN
          END IF
-      p%HdroSttc (:,:) = 0.0 ! Initialize to zero
-
-      DO    ! Loop through all rows in the file
 
 
-         READ (UnWh,*,IOSTAT=Sttus)  I, J, TmpData1   ! Read in the row index, column index, and nondimensional data from the WAMIT file
-
-         IF ( Sttus == 0 )  THEN                ! .TRUE. when data is read in successfully
-!bjj: TODO verify that I and J are valid values
-            p%HdroSttc (I,J) = TmpData1*SttcDim(I,J)    ! Redimensionalize the data and place it at the appropriate location within the array
-
-         ELSE                                   ! We must have reached the end of the file, so stop reading in data
+            ! ALLOCATE the arrays:
 
-            EXIT
+         ALLOCATE (         WaveExctnC(0:InitInp%NStepWave2 ,6) , STAT=ErrStat2 )
+         IF ( ErrStat2 /= 0 )  THEN
+            CALL SetErrStat( ErrID_Fatal, 'Error allocating memory for the WaveExctnC array.', ErrStat, ErrMsg, 'WAMIT_Init')
+            CALL Cleanup()
+            RETURN            
+         END IF
 
+         ALLOCATE ( p%WaveExctn (0:InitInp%NStepWave,6) , STAT=ErrStat2 )
+         IF ( ErrStat2 /= 0 )  THEN
+            CALL SetErrStat( ErrID_Fatal, 'Error allocating memory for the WaveExctn array.', ErrStat, ErrMsg, 'WAMIT_Init')
+            CALL Cleanup()
+            RETURN            
          END IF
 
 
-      END DO ! End loop through all rows in the file
 
-      CLOSE ( UnWh ) ! Close file.
+         ! Compute the positive-frequency components (including zero) of the discrete
+         !   Fourier transform of the wave excitation force:
 
+         DO I = 0,InitInp%NStepWave2  ! Loop through the positive frequency components (including zero) of the discrete Fourier transform
 
+               ! Compute the frequency of this component:
 
-         ! Linear, frequency-dependent hydrodynamic added mass and damping from the
-         !   radiation problem:
+            Omega = I*InitInp%WaveDOmega
 
-      CALL OpenFInpFile ( UnW1, TRIM(InitInp%WAMITFile)//'.1', ErrStat2, ErrMsg2   )  ! Open file.
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')      
-         IF ( ErrStat >= AbortErrLev )  THEN
-            CALL Cleanup()
-            RETURN
-         END IF
+               ! Compute the discrete Fourier transform of the instantaneous value of the
+               !   total excitation force on the support platfrom from incident waves:
 
+            DO J = 1,6           ! Loop through all wave excitation forces and moments
+               TmpCoord(1) = Omega
+               TmpCoord(2) = InitInp%WaveDirArr(I)
+               CALL WAMIT_Interp2D_Cplx( TmpCoord, HdroExctn(:,:,J), HdroFreq, HdroWvDir, LastInd2, WaveExctnC(I,J), ErrStat2, ErrMsg2 )
+               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+               IF ( ErrStat >= AbortErrLev ) THEN
+                  CALL Cleanup()
+                  RETURN
+               END IF
+               WaveExctnC(I,J) = WaveExctnC(I,J) * CMPLX(InitInp%WaveElevC0(1,I), InitInp%WaveElevC0(2,I))
+            END DO                ! J - All wave excitation forces and moments
 
-         ! First find the number of input frequency components inherent in the
-         !   hydrodynamic added mass matrix, hydrodynamic daming matrix, and complex
-         !   wave excitation force per unit wave amplitude vector:
 
-      NInpFreq  = 0        ! Initialize to zero
-      PrvPer    = 0.0      ! Initialize to a don't care
-      FirstPass = .TRUE.   ! Initialize to .TRUE. for the first pass
+         END DO                ! I - The positive frequency components (including zero) of the discrete Fourier transform
+        
 
-      DO    ! Loop through all rows in the file
 
 
-         READ (UnW1,*,IOSTAT=Sttus)  TmpPer  ! Read in only the period from the WAMIT file
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+! Dump the HdroFreq variable to a file for debugging
+! Open and write header info to the HydroDyn Output File
+!CALL OpenFOutFile ( 66, 'C:\Dev\NREL_SVN\HydroDyn\branches\HydroDyn_Modularization\Samples\NRELOffshrBsline5MW_OC3Hywind\HdroFreq_HD.txt', ErrStat   )  ! Open motion file.
+!DO K = 1, NInpFreq
+!   WRITE ( 66, '(2(e20.9))', IOSTAT = ErrStat) REAL(K), HdroFreq(K)
+!END DO
+!CLOSE ( 66 )
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
-         IF ( Sttus == 0 )  THEN ! .TRUE. when data is read in successfully
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+! Dump the WaveElevCO variable to a file for debugging
+! Open and write header info to the HydroDyn Output File
+!CALL OpenFOutFile ( 66, 'C:\Dev\NREL_SVN\HydroDyn\branches\HydroDyn_Modularization\Samples\NRELOffshrBsline5MW_OC3Hywind\WaveElevC0_HD.txt', ErrStat   )  ! Open motion file.
+!DO K = 0, InitInp%NStepWave2
+!   WRITE ( 66, '(2(e20.9))', IOSTAT = ErrStat) REAL(K), REAL(InitInp%WaveElevC0(K))
+!END DO
+!CLOSE ( 66 )
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
-            IF ( FirstPass .OR. ( TmpPer /= PrvPer ) )  THEN   ! .TRUE. if we are on the first pass or if the period currently read in is different than the previous period read in; thus we found a new frequency in the WAMIT file!
-               NInpFreq  = NInpFreq + 1      ! Since we found a new frequency, count it in the total
-               PrvPer    = TmpPer            ! Store the current period as the previous period for the next pass
-               FirstPass = .FALSE.           ! Sorry, you can only have one first pass
-            END IF
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+! Dump the WaveExctnC variable to a file for debugging
+! Open and write header info to the HydroDyn Output File
+!CALL OpenFOutFile ( 66, 'C:\Dev\NREL_SVN\HydroDyn\branches\HydroDyn_Modularization\Samples\NRELOffshrBsline5MW_OC3Hywind\WaveExctnC_HD.txt', ErrStat   )  ! Open motion file.
+!DO K = 0, InitInp%NStepWave2 
+!   WRITE ( 66, '(7(e20.9))', IOSTAT = ErrStat) REAL(K), REAL(WaveExctnC(K,:))
+!END DO
+!CLOSE ( 66 )
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
-         ELSE                    ! We must have reached the end of the file, so stop reading in data  !bjj -- this isn't necessarially true....
+            ! Compute the inverse discrete Fourier transform to find the time-domain
+            !   representation of the wave excitation force:
 
-            EXIT
+         CALL InitFFT ( InitInp%NStepWave, FFT_Data, .TRUE., ErrStat2 )
+            CALL SetErrStat( ErrStat2, 'Error in call to InitFFT.', ErrStat, ErrMsg, 'WAMIT_Init')
+            IF ( ErrStat >= AbortErrLev) THEN
+               CALL Cleanup()
+               RETURN
+            END IF
+         
+         DO J = 1,6           ! Loop through all wave excitation forces and moments
+            CALL ApplyFFT_cx ( p%WaveExctn(0:InitInp%NStepWave-1,J), WaveExctnC(:,J), FFT_Data, ErrStat2 )
+            CALL SetErrStat( ErrStat2, ' An error occured while applying an FFT to WaveExctnC.', ErrStat, ErrMsg, 'WAMIT_Init')
+            IF ( ErrStat >= AbortErrLev) THEN
+               CALL Cleanup()
+               RETURN
+            END IF
+            
+               ! Append first datpoint as the last as aid for repeated wave data
+            p%WaveExctn(InitInp%NStepWave,J) = p%WaveExctn(0,J)
+         END DO                ! J - All wave excitation forces and moments
 
-         END IF
+         CALL ExitFFT(FFT_Data, ErrStat2)
+            CALL SetErrStat( ErrStat2, 'Error in call to ExitFFT.', ErrStat, ErrMsg, 'WAMIT_Init')
+            IF ( ErrStat >= AbortErrLev) THEN
+               CALL Cleanup()
+               RETURN
+            END IF
 
 
-      END DO ! End loop through all rows in the file
+      CASE ( 6 )              ! User wave data.
 
+         CALL SetErrStat( ErrID_Fatal, 'User input wave data not applicable for floating platforms.', ErrStat, ErrMsg, 'WAMIT_Init')
+         CALL Cleanup()
+         RETURN
 
-      REWIND (UNIT=UnW1)   ! REWIND the file so we can read it in a second time.
+      ENDSELECT   
+      
+      
+      IF ( InitInp%RdtnTMax == 0.0 )  THEN   ! .TRUE. when we don't want to model wave radiation damping; set RdtnTMax to some minimum value greater than zero to avoid an error in the calculations below.
+      
+         p%RdtnMod   = 0
+         
+      ELSE                                    ! We will be modeling wave radiation damping.
+                 
+         p%RdtnMod   = InitInp%RdtnMod
+         
+         if ( InitInp%RdtnMod == 1 ) THEN
+            
+            ! Set Initialization data for the Conv_Rdtn submodule
+            ! Would be nice if there were a copy InitInput function in the *_Types file
+            ! BJJ 6/25/2014: There is a copy InitInput function.... ???
+            
+            CALL MOVE_ALLOC( HdroFreq,  Conv_Rdtn_InitInp%HdroFreq  )
+            CALL MOVE_ALLOC( HdroAddMs, Conv_Rdtn_InitInp%HdroAddMs )
+            CALL MOVE_ALLOC( HdroDmpng, Conv_Rdtn_InitInp%HdroDmpng )
+                  
+            Conv_Rdtn_InitInp%RdtnTMax            = InitInp%RdtnTMax
+            Conv_Rdtn_InitInp%RdtnDT              = InitInp%Conv_Rdtn%RdtnDT                     
+            Conv_Rdtn_InitInp%HighFreq            = HighFreq                          
+            Conv_Rdtn_InitInp%WAMITFile           = InitInp%WAMITFile                      
+            Conv_Rdtn_InitInp%NInpFreq            = NInpFreq                         
+            Conv_Rdtn_InitInp%UnSum               = InitInp%Conv_Rdtn%UnSum
+    
+         
+            CALL Conv_Rdtn_Init(Conv_Rdtn_InitInp, m%Conv_Rdtn_u, p%Conv_Rdtn, x%Conv_Rdtn, xd%Conv_Rdtn, z%Conv_Rdtn, OtherState%Conv_Rdtn, &
+                                   m%Conv_Rdtn_y, m%Conv_Rdtn, Interval, Conv_Rdtn_InitOut, ErrStat2, ErrMsg2)
+            
+               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+               IF ( ErrStat >= AbortErrLev ) THEN
+                  CALL Cleanup()
+                  RETURN
+               END IF
+            
+            
+         ELSE IF ( InitInp%RdtnMod == 2 ) THEN
+            
+            SS_Rdtn_InitInp%InputFile    = InitInp%WAMITFile    
+            SS_Rdtn_InitInp%DOFs         = 1
+            CALL SS_Rad_Init(SS_Rdtn_InitInp, m%SS_Rdtn_u, p%SS_Rdtn, x%SS_Rdtn, xd%SS_Rdtn, z%SS_Rdtn, OtherState%SS_Rdtn, &
+                                   m%SS_Rdtn_y, m%SS_Rdtn, Interval, SS_Rdtn_InitOut, ErrStat2, ErrMsg2)
+            
+               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+               IF ( ErrStat >= AbortErrLev ) THEN
+                  CALL Cleanup()
+                  RETURN
+               END IF
+
+         ELSE IF ( InitInp%RdtnMod == 3 ) THEN
+            
+            ! The state-space model is fitted to the convolution kernel here, so it runs in the SS_Rdtn submodule:
+            p%RdtnMod   = 2
+            
+            CALL MOVE_ALLOC( HdroFreq,  Conv_Rdtn_InitInp%HdroFreq  )
+            CALL MOVE_ALLOC( HdroAddMs, Conv_Rdtn_InitInp%HdroAddMs )
+            CALL MOVE_ALLOC( HdroDmpng, Conv_Rdtn_InitInp%HdroDmpng )
+                  
+            Conv_Rdtn_InitInp%RdtnTMax            = InitInp%RdtnTMax
+            Conv_Rdtn_InitInp%RdtnDT              = InitInp%Conv_Rdtn%RdtnDT                     
+            Conv_Rdtn_InitInp%HighFreq            = HighFreq                          
+            Conv_Rdtn_InitInp%WAMITFile           = InitInp%WAMITFile                      
+            Conv_Rdtn_InitInp%NInpFreq            = NInpFreq                         
+            
+            CALL Conv_Rdtn_CalcKrnl( Conv_Rdtn_InitInp, SS_Rdtn_InitInp%RdtnKrnl, ErrStat2, ErrMsg2 )
+               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+               IF ( ErrStat >= AbortErrLev ) THEN
+                  CALL Cleanup()
+                  RETURN
+               END IF
+            
+            SS_Rdtn_InitInp%InputFile    = InitInp%WAMITFile    
+            SS_Rdtn_InitInp%DOFs         = 1
+            SS_Rdtn_InitInp%RdtnDT       = InitInp%Conv_Rdtn%RdtnDT
+            SS_Rdtn_InitInp%FitOrd       = InitInp%SS_Rdtn%FitOrd
+            SS_Rdtn_InitInp%FitTol       = InitInp%SS_Rdtn%FitTol
+            SS_Rdtn_InitInp%WvCacheDir   = InitInp%WvCacheDir
+            SS_Rdtn_InitInp%UnSum        = InitInp%Conv_Rdtn%UnSum
+            CALL SS_Rad_Init(SS_Rdtn_InitInp, m%SS_Rdtn_u, p%SS_Rdtn, x%SS_Rdtn, xd%SS_Rdtn, z%SS_Rdtn, OtherState%SS_Rdtn, &
+                                   m%SS_Rdtn_y, m%SS_Rdtn, Interval, SS_Rdtn_InitOut, ErrStat2, ErrMsg2)
+            
+               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+               IF ( ErrStat >= AbortErrLev ) THEN
+                  CALL Cleanup()
+                  RETURN
+               END IF
+
+         END IF
+         
+      END IF
+      
+         ! create the input and output meshes
+         ! CALL MeshCreate(u%MeshData, COMPONENT_INPUT, 1, ErrStat2, ErrMsg2, .TRUE.)
+         ! deallocate arrays
+
+      IF ( ALLOCATED( HdroExctn    ) ) DEALLOCATE( HdroExctn    )
+      IF ( ALLOCATED( WaveExctnC   ) ) DEALLOCATE( WaveExctnC   )
+      IF ( ALLOCATED( HdroAddMs    ) ) DEALLOCATE( HdroAddMs    )
+      IF ( ALLOCATED( HdroDmpng    ) ) DEALLOCATE( HdroDmpng    )
+      IF ( ALLOCATED( HdroFreq     ) ) DEALLOCATE( HdroFreq     )
+      IF ( ALLOCATED( HdroWvDir    ) ) DEALLOCATE( HdroWvDir    )
+      
+         ! Define parameters here:
+         
+      p%DT  = Interval
+      
+      
+      ! Define system output initializations (set up mesh) here:
+      
+      
+          ! Create the input and output meshes associated with lumped loads
+      
+      CALL MeshCreate( BlankMesh        = u%Mesh            &
+                     ,IOS               = COMPONENT_INPUT   &
+                     ,Nnodes            = 1                 &
+                     ,ErrStat           = ErrStat2          &
+                     ,ErrMess           = ErrMsg2           &
+                     ,TranslationDisp   = .TRUE.            &
+                     ,Orientation       = .TRUE.            &
+                     ,TranslationVel    = .TRUE.            &
+                     ,RotationVel       = .TRUE.            &
+                     ,TranslationAcc    = .TRUE.            &
+                     ,RotationAcc       = .TRUE.)
+         
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL Cleanup()
+            RETURN
+         END IF
+      
+         ! Create the node on the mesh
+            
+         
+         
+      CALL MeshPositionNode (u%Mesh                                &
+                              , 1                                  &
+                              , (/0.0_ReKi, 0.0_ReKi, 0.0_ReKi/)   &  
+                              , ErrStat2                           &
+                              , ErrMsg2                            )
+      
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+       
+      
+         ! Create the mesh element
+      CALL MeshConstructElement (  u%Mesh              &
+                                  , ELEMENT_POINT      &                         
+                                  , ErrStat2           &
+                                  , ErrMsg2            &
+                                  , 1                  &
+                                              )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+
+      CALL MeshCommit ( u%Mesh              &
+                      , ErrStat2            &
+                      , ErrMsg2             )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL Cleanup()
+            RETURN
+         END IF      
+
+         
+      CALL MeshCopy ( SrcMesh      = u%Mesh                 &
+                     ,DestMesh     = y%Mesh                 &
+                     ,CtrlCode     = MESH_SIBLING           &
+                     ,IOS          = COMPONENT_OUTPUT       &
+                     ,ErrStat      = ErrStat2               &
+                     ,ErrMess      = ErrMsg2                &
+                     ,Force        = .TRUE.                 &
+                     ,Moment       = .TRUE.                 )
+     
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL Cleanup()
+            RETURN
+         END IF      
+      
+      
+     u%Mesh%RemapFlag  = .TRUE.
+     y%Mesh%RemapFlag  = .TRUE.
+         
+         ! Define initialization-routine output here:
+         
+            ! Initialize the outputs
+      CALL WMTOUT_Init( InitInp, y, p, InitOut, ErrStat2, ErrMsg2 )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL Cleanup()
+            RETURN
+         END IF      
+      
+     
+         ! If you want to choose your own rate instead of using what the glue code suggests, tell the glue code the rate at which
+         !   this module must be called here:
+         
+       !Interval = p%DT                                               
+
+      ! initialize misc vars:      
+   m%LastIndWave = 1
+       
+       CALL Cleanup()
+       
+CONTAINS
+
+
+   SUBROUTINE Cleanup()
+   
+      ! destroy local variables that are types in the framework:
+      
+      CALL Conv_Rdtn_DestroyInitInput(  Conv_Rdtn_InitInp,  ErrStat2, ErrMsg2 )
+      CALL Conv_Rdtn_DestroyInitOutput( Conv_Rdtn_InitOut,  ErrStat2, ErrMsg2 )
+
+      CALL SS_Rad_DestroyInitInput(     SS_Rdtn_InitInp,    ErrStat2, ErrMsg2 )
+      CALL SS_Rad_DestroyInitOutput(    SS_Rdtn_InitOut,    ErrStat2, ErrMsg2 )
+      
+      
+      ! destroy local variables that are allocatable arrays:
+      
+      IF ( ALLOCATED( HdroExctn   ) ) DEALLOCATE(HdroExctn   )
+      IF ( ALLOCATED( WaveExctnC  ) ) DEALLOCATE(WaveExctnC  )
+      
+      IF ( ALLOCATED( HdroAddMs   ) ) DEALLOCATE(HdroAddMs   )
+      IF ( ALLOCATED( HdroDmpng   ) ) DEALLOCATE(HdroDmpng   )
+      IF ( ALLOCATED( HdroFreq    ) ) DEALLOCATE(HdroFreq    )
+      IF ( ALLOCATED( HdroWvDir   ) ) DEALLOCATE(HdroWvDir   )
+   
+   
+   END SUBROUTINE Cleanup
+            
+END SUBROUTINE WAMIT_Init
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine returns the redimensionalized hydrodynamic data from the WAMIT output files (.hst, .1, and .3), sorted from lowest
+!! to highest frequency and direction.  When InitInp%WvCacheDir is set, the processed data is kept in a cache file whose key holds
+!! the checksums of the three files and the inputs used to redimensionalize the data, so a later simulation with the same files
+!! reads the binary cache file instead of parsing the text.  An edited file doesn't match the key and is read as text again.  The
+!! warnings given while reading the files are stored in the cache file, and given again when the data is read from it.
+SUBROUTINE WAMIT_ReadHydroData( InitInp, HdroSttc, HdroFreq, HdroAddMs, HdroDmpng, HdroWvDir, HdroExctn, NInpFreq, NInpWvDir, &
+                                HighFreq, ZeroFreq, InfFreq, ErrStat, ErrMsg )
+
+      TYPE(WAMIT_InitInputType),       INTENT(IN   )  :: InitInp          !< Input data for initialization routine
+      REAL(ReKi),                      INTENT(  OUT)  :: HdroSttc (6,6)   !< Linear hydrostatic restoring matrix (kg/s^2, kg-m/s^2, kg-m^2/s^2)
+      REAL(SiKi),    ALLOCATABLE,      INTENT(  OUT)  :: HdroFreq (:)     !< Frequency components of the hydrodynamic data, sorted (rad/s)
+      REAL(SiKi),    ALLOCATABLE,      INTENT(  OUT)  :: HdroAddMs(:,:)   !< Upper-triangular portion of the frequency-dependent added mass matrix (kg, kg-m, kg-m^2)
+      REAL(SiKi),    ALLOCATABLE,      INTENT(  OUT)  :: HdroDmpng(:,:)   !< Upper-triangular portion of the frequency-dependent damping    matrix (kg/s, kg-m/s, kg-m^2/s)
+      REAL(SiKi),    ALLOCATABLE,      INTENT(  OUT)  :: HdroWvDir(:)     !< Wave heading direction components of the wave excitation force, sorted (degrees)
+      COMPLEX(SiKi), ALLOCATABLE,      INTENT(  OUT)  :: HdroExctn(:,:,:) !< Frequency- and direction-dependent wave excitation force per unit wave amplitude (kg/s^2, kg-m/s^2)
+      INTEGER,                         INTENT(  OUT)  :: NInpFreq         !< Number of frequency components
+      INTEGER,                         INTENT(  OUT)  :: NInpWvDir        !< Number of wave heading direction components
+      REAL(ReKi),                      INTENT(  OUT)  :: HighFreq         !< The highest frequency component in the WAMIT file, not counting infinity
+      LOGICAL,                         INTENT(  OUT)  :: ZeroFreq         !< Whether the zero-frequency limit of added mass is in the WAMIT files
+      LOGICAL,                         INTENT(  OUT)  :: InfFreq          !< Whether the infinite-frequency limit of added mass is in the WAMIT files
+      INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat          !< Error status of the operation
+      CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg           !< Error message if ErrStat /= ErrID_None
+
+         ! Local Variables
+      CHARACTER(4),  PARAMETER               :: WAMITExt(3) = (/ '.hst', '.1  ', '.3  ' /)  ! Extensions of the WAMIT output files
+      CHARACTER(1024)                        :: CacheFile                            ! Name of the cache file for these WAMIT files; empty if not cached
+      LOGICAL                                :: CacheHit                             ! Whether the data was read from the cache
+      LOGICAL                                :: Found                                ! Whether a WAMIT file could be read for its checksum
+      REAL(ReKi),    ALLOCATABLE             :: KeyRe(:)                             ! Packed reals    of the cache key (redimensionalization inputs)
+      REAL(DbKi),    ALLOCATABLE             :: KeyDb(:)                             ! Packed doubles  of the cache key (not used)
+      INTEGER(IntKi),ALLOCATABLE             :: KeyInt(:)                            ! Packed integers of the cache key (checksums of the WAMIT files)
+      REAL(ReKi),    ALLOCATABLE             :: ValRe(:)                             ! Packed reals    of the cached data
+      REAL(DbKi),    ALLOCATABLE             :: ValDb(:)                             ! Packed doubles  of the cached data (not used)
+      INTEGER(IntKi),ALLOCATABLE             :: ValInt(:)                            ! Packed integers of the cached data
+      INTEGER                                :: I                                    ! Generic index
+      CHARACTER(1024)                        :: ErrMsg2                              ! Temporary error message for calls
+      INTEGER(IntKi)                         :: ErrStat2                             ! Temporary error status for calls
+
+
+      ErrStat   = ErrID_None
+      ErrMsg    = ""
+      CacheFile = ""
+      CacheHit  = .FALSE.
+
+      IF ( LEN_TRIM( InitInp%WvCacheDir ) > 0 ) THEN
+
+         ALLOCATE ( KeyRe(3), KeyInt(2*SIZE(WAMITExt)), STAT=ErrStat2 )
+         Found = ErrStat2 == 0
+         IF ( Found ) KeyRe = (/ InitInp%RhoXg, InitInp%WtrDens, InitInp%WAMITULEN /)
+         DO I = 1,SIZE(WAMITExt)
+            IF ( Found ) CALL HDCache_FileChecksum( TRIM(InitInp%WAMITFile)//TRIM(WAMITExt(I)), KeyInt(2*I-1:2*I), Found )
+         END DO
+
+            ! A file that can't be read isn't cached; WAMIT_ReadFiles reports the error.
+         IF ( Found ) THEN
+            CacheFile = HDCache_FileName( InitInp%WvCacheDir, 'WAMIT', KeyRe, KeyDb, KeyInt )
+            CALL HDCache_Read( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, CacheHit )
+            IF ( CacheHit ) CALL UnPackHydroData()
+            IF ( CacheHit ) THEN
+               CALL WrScr ( ' Reading the processed WAMIT output with root name "'//TRIM(InitInp%WAMITFile)//'" from "'//TRIM(CacheFile)//'".' )
+               RETURN
+            END IF
+            ErrStat = ErrID_None
+            ErrMsg  = ""
+         END IF
+
+      END IF
+
+
+      CALL WAMIT_ReadFiles( InitInp, HdroSttc, HdroFreq, HdroAddMs, HdroDmpng, HdroWvDir, HdroExctn, NInpFreq, NInpWvDir, &
+                            HighFreq, ZeroFreq, InfFreq, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+      IF ( LEN_TRIM( CacheFile ) > 0 ) THEN
+         CALL PackHydroData()
+         CALL HDCache_Write( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, ErrStat2, ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadHydroData')
+      END IF
+
+CONTAINS
+
+   SUBROUTINE PackHydroData()
+
+      ValInt = (/ NInpFreq, NInpWvDir, MERGE( 1, 0, ZeroFreq ), MERGE( 1, 0, InfFreq ), HDCache_PackMsg( ErrStat, ErrMsg ) /)
+      ValRe  = (/ RESHAPE( HdroSttc, (/ 36 /) ), HighFreq,                                     &
+                  REAL( HdroFreq, ReKi ),                                                      &
+                  REAL( RESHAPE( HdroAddMs, (/ SIZE(HdroAddMs) /) ), ReKi ),                   &
+                  REAL( RESHAPE( HdroDmpng, (/ SIZE(HdroDmpng) /) ), ReKi ),                   &
+                  REAL( HdroWvDir, ReKi ),                                                     &
+                  REAL( RESHAPE( REAL ( HdroExctn ), (/ SIZE(HdroExctn) /) ), ReKi ),          &
+                  REAL( RESHAPE( AIMAG( HdroExctn ), (/ SIZE(HdroExctn) /) ), ReKi ) /)
+
+   END SUBROUTINE PackHydroData
+
+   ! Unpacks the data and the warnings stored by PackHydroData; CacheHit is set to .FALSE. if the sizes don't match.
+   SUBROUTINE UnPackHydroData()
+
+      INTEGER                                :: Indx                                 ! Current position in ValRe
+      INTEGER                                :: NExctn                               ! Number of elements of HdroExctn
+      LOGICAL                                :: MsgFound                             ! Whether the warnings were unpacked
+
+      CacheHit = .FALSE.
+      IF ( SIZE(ValInt) < 4 ) RETURN
+      CALL HDCache_UnPackMsg( ValInt(5:), ErrStat, ErrMsg, MsgFound )
+      IF ( .NOT. MsgFound ) RETURN
+      NInpFreq  = ValInt(1)
+      NInpWvDir = ValInt(2)
+      NExctn    = NInpFreq*NInpWvDir*6
+      IF ( NInpFreq < 1 .OR. NInpWvDir < 1 ) RETURN
+      IF ( SIZE(ValRe) /= 37 + 43*NInpFreq + NInpWvDir + 2*NExctn ) RETURN
+
+      ALLOCATE ( HdroFreq(NInpFreq), HdroAddMs(NInpFreq,21), HdroDmpng(NInpFreq,21), HdroWvDir(NInpWvDir), &
+                 HdroExctn(NInpFreq,NInpWvDir,6), STAT=ErrStat2 )
+      IF ( ErrStat2 /= 0 ) RETURN
+
+      ZeroFreq  = ValInt(3) /= 0
+      InfFreq   = ValInt(4) /= 0
+      HdroSttc  = RESHAPE( ValRe(1:36), (/ 6, 6 /) )
+      HighFreq  = ValRe(37)
+      Indx      = 37
+
+      HdroFreq  =          REAL( ValRe(Indx+1:Indx+   NInpFreq), SiKi );                              Indx = Indx +    NInpFreq
+      HdroAddMs = RESHAPE( REAL( ValRe(Indx+1:Indx+21*NInpFreq), SiKi ), (/ NInpFreq, 21 /) );        Indx = Indx + 21*NInpFreq
+      HdroDmpng = RESHAPE( REAL( ValRe(Indx+1:Indx+21*NInpFreq), SiKi ), (/ NInpFreq, 21 /) );        Indx = Indx + 21*NInpFreq
+      HdroWvDir =          REAL( ValRe(Indx+1:Indx+  NInpWvDir), SiKi );                              Indx = Indx +   NInpWvDir
+      HdroExctn = RESHAPE( CMPLX( ValRe(Indx+1:Indx+NExctn), ValRe(Indx+NExctn+1:Indx+2*NExctn), SiKi ), (/ NInpFreq, NInpWvDir, 6 /) )
+
+      CacheHit = .TRUE.
+
+   END SUBROUTINE UnPackHydroData
+
+END SUBROUTINE WAMIT_ReadHydroData
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine reads in and redimensionalizes the hydrodynamic data from the WAMIT output files (.hst, .1, and .3).  The frequency
+!! and direction components are sorted from lowest to highest, and the zero-frequency limit of the wave excitation force is set.
+SUBROUTINE WAMIT_ReadFiles( InitInp, HdroSttc, HdroFreq, HdroAddMs, HdroDmpng, HdroWvDir, HdroExctn, NInpFreq, NInpWvDir, &
+                            HighFreq, ZeroFreq, InfFreq, ErrStat, ErrMsg )
+
+      TYPE(WAMIT_InitInputType),       INTENT(IN   )  :: InitInp          !< Input data for initialization routine
+      REAL(ReKi),                      INTENT(  OUT)  :: HdroSttc (6,6)   !< Linear hydrostatic restoring matrix (kg/s^2, kg-m/s^2, kg-m^2/s^2)
+      REAL(SiKi),    ALLOCATABLE,      INTENT(  OUT)  :: HdroFreq (:)     !< Frequency components of the hydrodynamic data, sorted (rad/s)
+      REAL(SiKi),    ALLOCATABLE,      INTENT(  OUT)  :: HdroAddMs(:,:)   !< Upper-triangular portion of the frequency-dependent added mass matrix (kg, kg-m, kg-m^2)
+      REAL(SiKi),    ALLOCATABLE,      INTENT(  OUT)  :: HdroDmpng(:,:)   !< Upper-triangular portion of the frequency-dependent damping    matrix (kg/s, kg-m/s, kg-m^2/s)
+      REAL(SiKi),    ALLOCATABLE,      INTENT(  OUT)  :: HdroWvDir(:)     !< Wave heading direction components of the wave excitation force, sorted (degrees)
+      COMPLEX(SiKi), ALLOCATABLE,      INTENT(  OUT)  :: HdroExctn(:,:,:) !< Frequency- and direction-dependent wave excitation force per unit wave amplitude (kg/s^2, kg-m/s^2)
+      INTEGER,                         INTENT(  OUT)  :: NInpFreq         !< Number of frequency components
+      INTEGER,                         INTENT(  OUT)  :: NInpWvDir        !< Number of wave heading direction components
+      REAL(ReKi),                      INTENT(  OUT)  :: HighFreq         !< The highest frequency component in the WAMIT file, not counting infinity
+      LOGICAL,                         INTENT(  OUT)  :: ZeroFreq         !< Whether the zero-frequency limit of added mass is in the WAMIT files
+      LOGICAL,                         INTENT(  OUT)  :: InfFreq          !< Whether the infinite-frequency limit of added mass is in the WAMIT files
+      INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat          !< Error status of the operation
+      CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg           !< Error message if ErrStat /= ErrID_None
+
+         ! Local Variables
+      REAL(ReKi)                             :: DffrctDim (6)                        ! Matrix used to redimensionalize WAMIT hydrodynamic wave excitation force  output (kg/s^2, kg-m/s^2            )
+      REAL(ReKi)                             :: PrvDir                               ! The value of TmpDir from the previous line (degrees)
+      REAL(ReKi)                             :: PrvPer                               ! The value of TmpPer from the previous line (sec    )
+      REAL(ReKi)                             :: SttcDim   (6,6)                      ! Matrix used to redimensionalize WAMIT hydrostatic  restoring              output (kg/s^2, kg-m/s^2, kg-m^2/s^2)
+      REAL(ReKi)                             :: RdtnDim   (6,6)                      ! Matrix used to redimensionalize WAMIT hydrodynamic added mass and damping output (kg    , kg-m    , kg-m^2    )
+      REAL(ReKi)                             :: TmpData1                             ! A temporary           value  read in from a WAMIT file (-      )
+      REAL(ReKi)                             :: TmpData2                             ! A temporary           value  read in from a WAMIT file (-      )
+      REAL(ReKi)                             :: TmpDir                               ! A temporary direction        read in from a WAMIT file (degrees)
+      REAL(ReKi)                             :: TmpIm                                ! A temporary imaginary value  read in from a WAMIT file (-      ) - stored as a REAL value
+      REAL(ReKi)                             :: TmpPer                               ! A temporary period           read in from a WAMIT file (sec    )
+      REAL(ReKi)                             :: TmpRe                                ! A temporary real      value  read in from a WAMIT file (-      )
+      REAL(ReKi), ALLOCATABLE                :: WAMITFreq (:)                        ! Frequency      components as ordered in the WAMIT output files (rad/s  )
+      REAL(ReKi), ALLOCATABLE                :: WAMITPer  (:)                        ! Period         components as ordered in the WAMIT output files (sec    )
+      REAL(ReKi), ALLOCATABLE                :: WAMITWvDir(:)                        ! Wave direction components as ordered in the WAMIT output files (degrees)
+      INTEGER                                :: I                                    ! Generic index
+      INTEGER                                :: Indx                                 ! Cycles through the upper-triangular portion (diagonal and above) of the frequency-dependent hydrodynamic added mass and damping matrices from the radiation problem
+      INTEGER                                :: InsertInd                            ! The lowest sorted index whose associated frequency component is higher than the current frequency component -- this is to sort the frequency components from lowest to highest
+      INTEGER                                :: J                                    ! Generic index
+      INTEGER                                :: K                                    ! Generic index
+      INTEGER,    ALLOCATABLE                :: SortFreqInd (:)                      ! The array of indices such that WAMITFreq (SortFreqInd (:)) is sorted from lowest to highest frequency (-)
+      INTEGER,    ALLOCATABLE                :: SortWvDirInd(:)                      ! The array of indices such that WAMITWvDir(SortWvDirInd(:)) is sorted from lowest to highest agnle     (-)
+      INTEGER                                :: Sttus                                ! Status returned by an attempted allocation or READ.
+      INTEGER                                :: UnW1                                 ! I/O unit number for the WAMIT output file with the .1   extension; this file contains the linear, nondimensionalized, frequency-dependent solution to the radiation   problem.
+      INTEGER                                :: UnW3                                 ! I/O unit number for the WAMIT output file with the .3   extension; this file contains the linear, nondimensionalized, frequency-dependent solution to the diffraction problem.
+      INTEGER                                :: UnWh                                 ! I/O unit number for the WAMIT output file with the .hst extension; this file contains the linear, nondimensionalized hydrostatic restoring matrix.
+      LOGICAL                                :: FirstFreq                            ! When .TRUE., indicates we're still looping through the first frequency component.
+      LOGICAL                                :: FirstPass                            ! When .TRUE., indicates we're on the first pass through a loop.
+      LOGICAL                                :: NewPer                               ! When .TRUE., indicates that the period has just changed.
+      CHARACTER(1024)                        :: Line                                 ! String to temporarily hold the value of a line within a WAMIT output file.
+
+         ! Error handling
+      CHARACTER(1024)                        :: ErrMsg2                              ! Temporary error message for calls
+      INTEGER(IntKi)                         :: ErrStat2                             ! Temporary error status for calls
+
+         ! Initialize data
+
+      HighFreq    = 0.0
+      UnW1        = 31
+      UnW3        = 32
+      UnWh        = 33
+      InfFreq     = .FALSE.
+      ZeroFreq    = .FALSE.
+
+      ErrStat     = ErrID_None
+      ErrMsg      = ""
+
+
+         ! Tell our nice users what is about to happen that may take a while:
+
+      CALL WrScr ( ' Reading in WAMIT output with root name "'//TRIM(InitInp%WAMITFile)//'".' )
+
+
+
+         ! Let's set up the matrices used to redimensionalize the hydrodynamic data
+         !   from WAMIT; all these matrices are symmetric and need to be used with
+         !   element-by-element multiplication, instead of matrix-by-matrix
+         !   multiplication:
+
+      SttcDim(1,1) = InitInp%RhoXg  *InitInp%WAMITULEN**2  ! Force-translation
+      SttcDim(1,4) = InitInp%RhoXg  *InitInp%WAMITULEN**3  ! Force-rotation/Moment-translation - Hydrostatic restoring
+      SttcDim(4,4) = InitInp%RhoXg  *InitInp%WAMITULEN**4  ! Moment-rotation
+
+      RdtnDim(1,1) = InitInp%WtrDens*InitInp%WAMITULEN**3  ! Force-translation
+      RdtnDim(1,4) = InitInp%WtrDens*InitInp%WAMITULEN**4  ! Force-rotation/Moment-translation - Hydrodynamic added mass and damping
+      RdtnDim(4,4) = InitInp%WtrDens*InitInp%WAMITULEN**5  ! Moment-rotation
+
+      DffrctDim(1) = InitInp%RhoXg  *InitInp%WAMITULEN**2  ! Force-translation - Hydrodynamic wave excitation force
+      DffrctDim(4) = InitInp%RhoXg  *InitInp%WAMITULEN**3  ! Moment-rotation
+
+      DO I = 1,3     ! Loop through all force-translation elements (rows)
+
+         DO J = 1,3  ! Loop through all force-translation elements (columns)
+
+            SttcDim(I,J) = SttcDim(1,1)
+
+            RdtnDim(I,J) = RdtnDim(1,1)
+
+         END DO       ! J - All force-translation elements (columns)
+
+         DffrctDim (I  ) = DffrctDim(1)
+
+      END DO          ! I - All force-translation elements (rows)
+
+      DO I = 1,3     ! Loop through all force-rotation/moment-translation elements (rows/columns)
+
+         DO J = 4,6  ! Loop through all force-rotation/moment-translation elements (columns/rows)
+
+            SttcDim(I,J) = SttcDim(1,4)
+            SttcDim(J,I) = SttcDim(1,4)
+
+            RdtnDim(I,J) = RdtnDim(1,4)
+            RdtnDim(J,I) = RdtnDim(1,4)
+
+         END DO       ! J - All force-rotation/moment-translation elements (rows/columns)
+
+      END DO          ! I - All force-rotation/moment-translation elements (columns/rows)
+
+      DO I = 4,6     ! Loop through all moment-rotation elements (rows)
+
+         DO J = 4,6  ! Loop through all moment-rotation elements (columns)
+
+            SttcDim(I,J) = SttcDim(4,4)
+
+            RdtnDim(I,J) = RdtnDim(4,4)
+
+         END DO       ! J - All moment-rotation elements (columns)
+
+         DffrctDim (I  ) = DffrctDim(4)
+
+      END DO          ! I - All moment-rotation elements (rows)
+
+
+
+
+         ! Let's read in and redimensionalize the hydrodynamic data from the WAMIT
+         !   output files:
+
+
+
+         ! Linear restoring from the hydrostatics problem:
+
+      CALL OpenFInpFile ( UnWh, TRIM(InitInp%WAMITFile)//'.hst', ErrStat2, ErrMsg2 )  ! Open file.
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')      
+         IF ( ErrStat >= AbortErrLev )  THEN
+            CALL Cleanup()
+            RETURN
+         END IF
+      HdroSttc (:,:) = 0.0 ! Initialize to zero
+
+      DO    ! Loop through all rows in the file
+
+
+         READ (UnWh,*,IOSTAT=Sttus)  I, J, TmpData1   ! Read in the row index, column index, and nondimensional data from the WAMIT file
+
+         IF ( Sttus == 0 )  THEN                ! .TRUE. when data is read in successfully
+!bjj: TODO verify that I and J are valid values
+            HdroSttc (I,J) = TmpData1*SttcDim(I,J)    ! Redimensionalize the data and place it at the appropriate location within the array
+
+         ELSE                                   ! We must have reached the end of the file, so stop reading in data
+
+            EXIT
+
+         END IF
+
+
+      END DO ! End loop through all rows in the file
+
+      CLOSE ( UnWh ) ! Close file.
+
+
+
+         ! Linear, frequency-dependent hydrodynamic added mass and damping from the
+         !   radiation problem:
+
+      CALL OpenFInpFile ( UnW1, TRIM(InitInp%WAMITFile)//'.1', ErrStat2, ErrMsg2   )  ! Open file.
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')      
+         IF ( ErrStat >= AbortErrLev )  THEN
+            CALL Cleanup()
+            RETURN
+         END IF
+
+
+         ! First find the number of input frequency components inherent in the
+         !   hydrodynamic added mass matrix, hydrodynamic daming matrix, and complex
+         !   wave excitation force per unit wave amplitude vector:
+
+      NInpFreq  = 0        ! Initialize to zero
+      PrvPer    = 0.0      ! Initialize to a don't care
+      FirstPass = .TRUE.   ! Initialize to .TRUE. for the first pass
+
+      DO    ! Loop through all rows in the file
+
+
+         READ (UnW1,*,IOSTAT=Sttus)  TmpPer  ! Read in only the period from the WAMIT file
+
+         IF ( Sttus == 0 )  THEN ! .TRUE. when data is read in successfully
+
+            IF ( FirstPass .OR. ( TmpPer /= PrvPer ) )  THEN   ! .TRUE. if we are on the first pass or if the period currently read in is different than the previous period read in; thus we found a new frequency in the WAMIT file!
+               NInpFreq  = NInpFreq + 1      ! Since we found a new frequency, count it in the total
+               PrvPer    = TmpPer            ! Store the current period as the previous period for the next pass
+               FirstPass = .FALSE.           ! Sorry, you can only have one first pass
+            END IF
+
+         ELSE                    ! We must have reached the end of the file, so stop reading in data  !bjj -- this isn't necessarially true....
+
+            EXIT
+
+         END IF
+
+
+      END DO ! End loop through all rows in the file
+
+
+      REWIND (UNIT=UnW1)   ! REWIND the file so we can read it in a second time.
 
 
       ! Now that we know how many frequencies there are, we can ALLOCATE the arrays
       !   to store the frequencies and frequency-dependent hydrodynamic added mass
       !   and damping matrices:
 
-      CALL AllocAry( WAMITFreq,    NInpFreq,    'WAMITFreq',    ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-      CALL AllocAry( WAMITPer,     NInpFreq,    'WAMITPer',     ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-      CALL AllocAry( SortFreqInd,  NInpFreq,    'SortFreqInd',  ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-      CALL AllocAry( HdroFreq,     NInpFreq,    'HdroFreq',     ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-      CALL AllocAry( HdroAddMs,    NInpFreq, 21,'HdroAddMs',    ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-      CALL AllocAry( HdroDmpng,    NInpFreq, 21,'HdroDmpng',    ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+      CALL AllocAry( WAMITFreq,    NInpFreq,    'WAMITFreq',    ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')
+      CALL AllocAry( WAMITPer,     NInpFreq,    'WAMITPer',     ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')
+      CALL AllocAry( SortFreqInd,  NInpFreq,    'SortFreqInd',  ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')
+      CALL AllocAry( HdroFreq,     NInpFreq,    'HdroFreq',     ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')
+      CALL AllocAry( HdroAddMs,    NInpFreq, 21,'HdroAddMs',    ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')
+      CALL AllocAry( HdroDmpng,    NInpFreq, 21,'HdroDmpng',    ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')
             
          IF ( ErrStat >= AbortErrLev )  THEN
             CALL Cleanup()
@@ -494,7 +1103,7 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
                READ (Line,*,IOSTAT=Sttus)  TmpPer, I, J, TmpData1           ! Read in the period, row index, column index, and nondimensional data from the WAMIT file
 
                IF ( Sttus /= 0 ) THEN
-                  CALL SetErrStat( ErrID_Fatal, "Error reading line from WAMIT file", ErrStat, ErrMsg, 'WAMIT_Init')
+                  CALL SetErrStat( ErrID_Fatal, "Error reading line from WAMIT file", ErrStat, ErrMsg, 'WAMIT_ReadFiles')
                   CALL Cleanup()
                   RETURN
                END IF              
@@ -511,7 +1120,7 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
 
                READ (Line,*,IOSTAT=Sttus)  TmpPer, I, J, TmpData1, TmpData2 ! Read in the period, row index, column index, and nondimensional data from the WAMIT file
                IF ( Sttus /= 0 ) THEN
-                  CALL SetErrStat( ErrID_Fatal, "Error reading line from WAMIT file", ErrStat, ErrMsg, 'WAMIT_Init')
+                  CALL SetErrStat( ErrID_Fatal, "Error reading line from WAMIT file", ErrStat, ErrMsg, 'WAMIT_ReadFiles')
                   CALL Cleanup()
                   RETURN
                END IF              
@@ -548,7 +1157,7 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
          !   problem:
 
       CALL OpenFInpFile ( UnW3, TRIM(InitInp%WAMITFile)//'.3', ErrStat2, ErrMsg2   )  ! Open file.
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')      
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')      
          IF ( ErrStat >= AbortErrLev )  THEN
             CALL Cleanup()
             RETURN
@@ -610,9 +1219,9 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
       !   to store the directions and frequency- and direction-dependent complex wave
       !   excitation force per unit wave amplitude vector:
 
-      CALL AllocAry(  WAMITWvDir,    NInpWvDir, 'WAMITWvDir',   ErrStat2, ErrMsg2 );  CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')      
-      CALL AllocAry(  SortWvDirInd,  NInpWvDir, 'SortWvDirInd', ErrStat2, ErrMsg2 );  CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')      
-      CALL AllocAry(  HdroWvDir,     NInpWvDir, 'HdroWvDir',    ErrStat2, ErrMsg2 );  CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')      
+      CALL AllocAry(  WAMITWvDir,    NInpWvDir, 'WAMITWvDir',   ErrStat2, ErrMsg2 );  CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')      
+      CALL AllocAry(  SortWvDirInd,  NInpWvDir, 'SortWvDirInd', ErrStat2, ErrMsg2 );  CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')      
+      CALL AllocAry(  HdroWvDir,     NInpWvDir, 'HdroWvDir',    ErrStat2, ErrMsg2 );  CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')      
          IF ( ErrStat >= AbortErrLev )  THEN
             CALL Cleanup()
             RETURN
@@ -620,7 +1229,7 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
             
       ALLOCATE ( HdroExctn   (NInpFreq,NInpWvDir,6) , STAT=ErrStat2 ) ! complex so we don't have a reoutine
       IF ( ErrStat2 /= 0 )  THEN
-         CALL SetErrStat( ErrID_Fatal, 'Error allocating space for HdroExctn array', ErrStat, ErrMsg, 'WAMIT_Init')
+         CALL SetErrStat( ErrID_Fatal, 'Error allocating space for HdroExctn array', ErrStat, ErrMsg, 'WAMIT_ReadFiles')
          CALL Cleanup()
          RETURN
       END IF
@@ -649,7 +1258,7 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
 
             READ (Line,*,IOSTAT=Sttus)  TmpPer, TmpDir ! Read in only the period and direction from the WAMIT file
                IF ( Sttus /= 0 )  THEN
-                  CALL SetErrStat( ErrID_Fatal, 'Error reading period and direction from WAMIT file.', ErrStat, ErrMsg, 'WAMIT_Init')
+                  CALL SetErrStat( ErrID_Fatal, 'Error reading period and direction from WAMIT file.', ErrStat, ErrMsg, 'WAMIT_ReadFiles')
                   CALL Cleanup()
                   RETURN
                END IF
@@ -671,7 +1280,7 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
                   ErrMsg2  = ' Other than zero and infinite frequencies, "'   //TRIM(InitInp%WAMITFile)//'.3",' // &
                                ' contains different frequency components than "'//TRIM(InitInp%WAMITFile)//'.1". '// &
                                ' Both WAMIT output files must be generated from the same run.'
-                  CALL SetErrStat( ErrID_Fatal, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+                  CALL SetErrStat( ErrID_Fatal, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')
                   CALL Cleanup()
                   RETURN
                END IF
@@ -701,7 +1310,7 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
                   ErrMsg2  = ' Not every frequency component in "'//TRIM(InitInp%WAMITFile)//'.3"'// &
                                ' contains the same listing of direction angles.  Check for' // &
                                ' errors in the WAMIT output file.'
-                  CALL SetErrStat( ErrID_Fatal, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
+                  CALL SetErrStat( ErrID_Fatal, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_ReadFiles')
                   CALL Cleanup()
                   RETURN
                END IF
@@ -744,7 +1353,7 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
 
             READ (Line,*,IOSTAT=Sttus)  TmpPer, TmpDir, I, TmpData1, TmpData2, TmpRe, TmpIm   ! Read in the period, direction, row index, and nondimensional data from the WAMIT file
                IF ( Sttus /= 0 )  THEN
-                  CALL SetErrStat( ErrID_Fatal, 'Error reading period and direction, row index, and nondimensional data from the WAMIT file.', ErrStat, ErrMsg, 'WAMIT_Init')
+                  CALL SetErrStat( ErrID_Fatal, 'Error reading period and direction, row index, and nondimensional data from the WAMIT file.', ErrStat, ErrMsg, 'WAMIT_ReadFiles')
                   CALL Cleanup()
                   RETURN
                END IF
@@ -768,460 +1377,74 @@ SUBROUTINE WAMIT_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
             IF ( FirstPass .OR. ( TmpDir /= PrvDir ) .OR. NewPer )  THEN   ! .TRUE. if we are on the first pass, or if this is new period, or if the direction currently read in is different than the previous direction read in; thus we found a new direction in the WAMIT file!
 
                J            = J + 1       ! This is current count of which direction component we are on
-               PrvDir       = TmpDir      ! Store the current direction as the previous direction for the next pass
-               FirstPass    = .FALSE.     ! Sorry, you can only have one first pass
-               NewPer       = .FALSE.     ! Disable the new period flag
-
-               IF ( FirstFreq )  THEN  ! .TRUE. while we are still looping through all directions for the first frequency component
-                  HdroWvDir(SortWvDirInd(J)) = TmpDir ! Store the directions sorted from lowest to highest
-               END IF
-
-            END IF
-
-
-            HdroExctn(SortFreqInd(K),SortWvDirInd(J),I) = CMPLX( TmpRe, TmpIm )*DffrctDim(I) ! Redimensionalize the data and place it at the appropriate location within the array
-
-
-         ELSE                    ! We must have reached the end of the file, so stop reading in data
-
-
-            EXIT
-
-
-         END IF
-
-
-      END DO ! End loop through all rows in the file
-
-
-      CLOSE ( UnW3 ) ! Close file.
-
-
-      ! For some reason, WAMIT computes the zero- and infinite- frequency limits for
-      !   only the added mass.  Based on hydrodynamic theory, the damping is zero at
-      !   these limits (as initialized).  Hydrodynamic theory also says that the
-      !   infinite-frequency limit of the diffraction force is zero (as initialized);
-      !   however, the zero-frequency limit need not be zero.  Thus, if necessary
-      !   (i.e., if we have read in a WAMIT output file that contains the
-      !   zero-frequency limit of the added mass), compute the zero-frequency limit
-      !   of the diffraction problem using the known values at the lowest
-      !   nonzero-valued frequency available:
-
-      DO I = 1,NInpFreq       ! Loop through all input frequency components
-
-         IF ( HdroFreq(I) > 0.0 )  THEN ! .TRUE. at the lowest nonzero-valued frequency component
-
-            DO J = I-1,1,-1   ! Loop through all zero-valued frequency components
-               HdroExctn(J,:,:) = HdroExctn(I,:,:) ! Set the zero-frequency limits to equal the known values at the lowest nonzero-valued frequency available
-            END DO             ! J - All zero-valued frequency components
-
-            EXIT  ! Since HdroFreq(:) is sorted from lowest to highest frequency, there is no reason to continue on once we have found the lowest nonzero-valued frequency component
-
-         END IF
-
-      END DO                   ! I - All input frequency components
-
-
-      
-            ! Tell our nice users what is about to happen that may take a while:
-
-      CALL WrScr ( ' Computing radiation impulse response functions and wave diffraction forces.' )
-
-
-
-         ! Abort if the WAMIT files do not contain both the zero- and and infinite-
-         !   frequency limits of added mass.  
-
-      IF ( .NOT. ( ZeroFreq .AND. InfFreq ) )  THEN   ! .TRUE. if both the zero- and infinite-frequency limits of added mass are contained within the WAMIT file
-         ErrMsg2  = ' "'//TRIM(InitInp%WAMITFile)// &
-                          '.1" must contain both the zero- and infinite-frequency limits of added mass.'
-         CALL SetErrStat( ErrID_Fatal, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-         CALL Cleanup()
-         RETURN         
-      END IF
-
-
-
-         ! Set the infinite-frequency limit of the frequency-dependent hydrodynamic
-         !   added mass matrix, HdroAdMsI, based on the highest frequency available:
-
-      Indx = 0
-      DO J = 1,6        ! Loop through all rows    of HdroAdMsI
-         DO K = J,6     ! Loop through all columns of HdroAdMsI above and including the diagonal
-            Indx = Indx + 1
-            p%HdroAdMsI(J,K) = HdroAddMs(NInpFreq,Indx)
-         END DO          ! K - All columns of HdroAdMsI above and including the diagonal
-         DO K = J+1,6   ! Loop through all rows    of HdroAdMsI below the diagonal
-            p%HdroAdMsI(K,J) = p%HdroAdMsI(J,K)
-         END DO          ! K - All rows    of HdroAdMsI below the diagonal
-      END DO             ! J - All rows    of HdroAdMsI
-
-
-
-     
-   
-           ! Initialize the variables associated with the incident wave:
-
-      SELECT CASE ( InitInp%WaveMod ) ! Which incident wave kinematics model are we using?
-
-      CASE ( 0 )              ! None=still water.
-
-
-
-            ! Initialize everything to zero:
-
-         ALLOCATE ( p%WaveExctn (0:InitInp%NStepWave,6) , STAT=ErrStat2 )
-         IF ( ErrStat2 /= 0 )  THEN
-            CALL SetErrStat( ErrID_Fatal, 'Error allocating memory for the WaveExctn array.', ErrStat, ErrMsg, 'WAMIT_Init')
-            CALL Cleanup()
-            RETURN
-         END IF
-
-         p%WaveExctn = 0.0   
-         
-      CASE ( 1, 2, 3, 4, 5, 10 )    ! Plane progressive (regular) wave, JONSWAP/Pierson-Moskowitz spectrum (irregular) wave, white-noise wave,  or user-defined spectrum (irregular) wave.
-
-
-
-            ! Abort if we have chosen a wave heading direction that is outside the range
-            !   of directions where the complex wave excitation force per unit wave
-            !   amplitude vector has been defined, else interpolate to find the complex
-            !   wave excitation force per unit wave amplitude vector at the chosen wave
-            !   heading direction:
-            ! NOTE: we may end up inadvertantly aborting if the wave direction crosses
-            !   the -Pi / Pi boundary (-180/180 degrees).
-
-         IF ( ( InitInp%WaveDirMin < HdroWvDir(1) ) .OR. ( InitInp%WaveDirMax > HdroWvDir(NInpWvDir) ) )  THEN
-            ErrMsg2  = 'All Wave directions must be within the wave heading angle range available in "' &
-                           //TRIM(InitInp%WAMITFile)//'.3" (inclusive).'
-            CALL SetErrStat( ErrID_Fatal, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-            CALL Cleanup()
-            RETURN
-         END IF
-
-
-            ! ALLOCATE the arrays:
-
-         ALLOCATE (         WaveExctnC(0:InitInp%NStepWave2 ,6) , STAT=ErrStat2 )
-         IF ( ErrStat2 /= 0 )  THEN
-            CALL SetErrStat( ErrID_Fatal, 'Error allocating memory for the WaveExctnC array.', ErrStat, ErrMsg, 'WAMIT_Init')
-            CALL Cleanup()
-            RETURN            
-         END IF
-
-         ALLOCATE ( p%WaveExctn (0:InitInp%NStepWave,6) , STAT=ErrStat2 )
-         IF ( ErrStat2 /= 0 )  THEN
-            CALL SetErrStat( ErrID_Fatal, 'Error allocating memory for the WaveExctn array.', ErrStat, ErrMsg, 'WAMIT_Init')
-            CALL Cleanup()
-            RETURN            
-         END IF
-
-
-
-         ! Compute the positive-frequency components (including zero) of the discrete
-         !   Fourier transform of the wave excitation force:
-
-         DO I = 0,InitInp%NStepWave2  ! Loop through the positive frequency components (including zero) of the discrete Fourier transform
-
-               ! Compute the frequency of this component:
-
-            Omega = I*InitInp%WaveDOmega
-
-               ! Compute the discrete Fourier transform of the instantaneous value of the
-               !   total excitation force on the support platfrom from incident waves:
-
-            DO J = 1,6           ! Loop through all wave excitation forces and moments
-               TmpCoord(1) = Omega
-               TmpCoord(2) = InitInp%WaveDirArr(I)
-               CALL WAMIT_Interp2D_Cplx( TmpCoord, HdroExctn(:,:,J), HdroFreq, HdroWvDir, LastInd2, WaveExctnC(I,J), ErrStat2, ErrMsg2 )
-               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-               IF ( ErrStat >= AbortErrLev ) THEN
-                  CALL Cleanup()
-                  RETURN
-               END IF
-               WaveExctnC(I,J) = WaveExctnC(I,J) * CMPLX(InitInp%WaveElevC0(1,I), InitInp%WaveElevC0(2,I))
-            END DO                ! J - All wave excitation forces and moments
-
-
-         END DO                ! I - The positive frequency components (including zero) of the discrete Fourier transform
-        
-
-
-
-!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-! Dump the HdroFreq variable to a file for debugging
-! Open and write header info to the HydroDyn Output File
-!CALL OpenFOutFile ( 66, 'C:\Dev\NREL_SVN\HydroDyn\branches\HydroDyn_Modularization\Samples\NRELOffshrBsline5MW_OC3Hywind\HdroFreq_HD.txt', ErrStat   )  ! Open motion file.
-!DO K = 1, NInpFreq
-!   WRITE ( 66, '(2(e20.9))', IOSTAT = ErrStat) REAL(K), HdroFreq(K)
-!END DO
-!CLOSE ( 66 )
-!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-
-!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-! Dump the WaveElevCO variable to a file for debugging
-! Open and write header info to the HydroDyn Output File
-!CALL OpenFOutFile ( 66, 'C:\Dev\NREL_SVN\HydroDyn\branches\HydroDyn_Modularization\Samples\NRELOffshrBsline5MW_OC3Hywind\WaveElevC0_HD.txt', ErrStat   )  ! Open motion file.
-!DO K = 0, InitInp%NStepWave2
-!   WRITE ( 66, '(2(e20.9))', IOSTAT = ErrStat) REAL(K), REAL(InitInp%WaveElevC0(K))
-!END DO
-!CLOSE ( 66 )
-!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-
-!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-! Dump the WaveExctnC variable to a file for debugging
-! Open and write header info to the HydroDyn Output File
-!CALL OpenFOutFile ( 66, 'C:\Dev\NREL_SVN\HydroDyn\branches\HydroDyn_Modularization\Samples\NRELOffshrBsline5MW_OC3Hywind\WaveExctnC_HD.txt', ErrStat   )  ! Open motion file.
-!DO K = 0, InitInp%NStepWave2 
-!   WRITE ( 66, '(7(e20.9))', IOSTAT = ErrStat) REAL(K), REAL(WaveExctnC(K,:))
-!END DO
-!CLOSE ( 66 )
-!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+               PrvDir       = TmpDir      ! Store the current direction as the previous direction for the next pass
+               FirstPass    = .FALSE.     ! Sorry, you can only have one first pass
+               NewPer       = .FALSE.     ! Disable the new period flag
 
-            ! Compute the inverse discrete Fourier transform to find the time-domain
-            !   representation of the wave excitation force:
+               IF ( FirstFreq )  THEN  ! .TRUE. while we are still looping through all directions for the first frequency component
+                  HdroWvDir(SortWvDirInd(J)) = TmpDir ! Store the directions sorted from lowest to highest
+               END IF
 
-         CALL InitFFT ( InitInp%NStepWave, FFT_Data, .TRUE., ErrStat2 )
-            CALL SetErrStat( ErrStat2, 'Error in call to InitFFT.', ErrStat, ErrMsg, 'WAMIT_Init')
-            IF ( ErrStat >= AbortErrLev) THEN
-               CALL Cleanup()
-               RETURN
-            END IF
-         
-         DO J = 1,6           ! Loop through all wave excitation forces and moments
-            CALL ApplyFFT_cx ( p%WaveExctn(0:InitInp%NStepWave-1,J), WaveExctnC(:,J), FFT_Data, ErrStat2 )
-            CALL SetErrStat( ErrStat2, ' An error occured while applying an FFT to WaveExctnC.', ErrStat, ErrMsg, 'WAMIT_Init')
-            IF ( ErrStat >= AbortErrLev) THEN
-               CALL Cleanup()
-               RETURN
             END IF
-            
-               ! Append first datpoint as the last as aid for repeated wave data
-            p%WaveExctn(InitInp%NStepWave,J) = p%WaveExctn(0,J)
-         END DO                ! J - All wave excitation forces and moments
 
-         CALL ExitFFT(FFT_Data, ErrStat2)
-            CALL SetErrStat( ErrStat2, 'Error in call to ExitFFT.', ErrStat, ErrMsg, 'WAMIT_Init')
-            IF ( ErrStat >= AbortErrLev) THEN
-               CALL Cleanup()
-               RETURN
-            END IF
 
+            HdroExctn(SortFreqInd(K),SortWvDirInd(J),I) = CMPLX( TmpRe, TmpIm )*DffrctDim(I) ! Redimensionalize the data and place it at the appropriate location within the array
 
-      CASE ( 6 )              ! User wave data.
 
-         CALL SetErrStat( ErrID_Fatal, 'User input wave data not applicable for floating platforms.', ErrStat, ErrMsg, 'WAMIT_Init')
-         CALL Cleanup()
-         RETURN
+         ELSE                    ! We must have reached the end of the file, so stop reading in data
+
+
+            EXIT
 
-      ENDSELECT   
-      
-      
-      IF ( InitInp%RdtnTMax == 0.0 )  THEN   ! .TRUE. when we don't want to model wave radiation damping; set RdtnTMax to some minimum value greater than zero to avoid an error in the calculations below.
-      
-         p%RdtnMod   = 0
-         
-      ELSE                                    ! We will be modeling wave radiation damping.
-                 
-         p%RdtnMod   = InitInp%RdtnMod
-         
-         if ( InitInp%RdtnMod == 1 ) THEN
-            
-            ! Set Initialization data for the Conv_Rdtn submodule
-            ! Would be nice if there were a copy InitInput function in the *_Types file
-            ! BJJ 6/25/2014: There is a copy InitInput function.... ???
-            
-            CALL MOVE_ALLOC( HdroFreq,  Conv_Rdtn_InitInp%HdroFreq  )
-            CALL MOVE_ALLOC( HdroAddMs, Conv_Rdtn_InitInp%HdroAddMs )
-            CALL MOVE_ALLOC( HdroDmpng, Conv_Rdtn_InitInp%HdroDmpng )
-                  
-            Conv_Rdtn_InitInp%RdtnTMax            = InitInp%RdtnTMax
-            Conv_Rdtn_InitInp%RdtnDT              = InitInp%Conv_Rdtn%RdtnDT                     
-            Conv_Rdtn_InitInp%HighFreq            = HighFreq                          
-            Conv_Rdtn_InitInp%WAMITFile           = InitInp%WAMITFile                      
-            Conv_Rdtn_InitInp%NInpFreq            = NInpFreq                         
-            Conv_Rdtn_InitInp%UnSum               = InitInp%Conv_Rdtn%UnSum
-    
-         
-            CALL Conv_Rdtn_Init(Conv_Rdtn_InitInp, m%Conv_Rdtn_u, p%Conv_Rdtn, x%Conv_Rdtn, xd%Conv_Rdtn, z%Conv_Rdtn, OtherState%Conv_Rdtn, &
-                                   m%Conv_Rdtn_y, m%Conv_Rdtn, Interval, Conv_Rdtn_InitOut, ErrStat2, ErrMsg2)
-            
-               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-               IF ( ErrStat >= AbortErrLev ) THEN
-                  CALL Cleanup()
-                  RETURN
-               END IF
-            
-            
-         ELSE IF ( InitInp%RdtnMod == 2 ) THEN
-            
-            SS_Rdtn_InitInp%InputFile    = InitInp%WAMITFile    
-            SS_Rdtn_InitInp%DOFs         = 1
-            CALL SS_Rad_Init(SS_Rdtn_InitInp, m%SS_Rdtn_u, p%SS_Rdtn, x%SS_Rdtn, xd%SS_Rdtn, z%SS_Rdtn, OtherState%SS_Rdtn, &
-                                   m%SS_Rdtn_y, m%SS_Rdtn, Interval, SS_Rdtn_InitOut, ErrStat2, ErrMsg2)
-            
-               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-               IF ( ErrStat >= AbortErrLev ) THEN
-                  CALL Cleanup()
-                  RETURN
-               END IF
 
-            
-            
          END IF
-         
-      END IF
-      
-         ! create the input and output meshes
-         ! CALL MeshCreate(u%MeshData, COMPONENT_INPUT, 1, ErrStat2, ErrMsg2, .TRUE.)
-         ! deallocate arrays
 
-      IF ( ALLOCATED( HdroExctn    ) ) DEALLOCATE( HdroExctn    )
-      IF ( ALLOCATED( WaveExctnC   ) ) DEALLOCATE( WaveExctnC   )
-      IF ( ALLOCATED( HdroAddMs    ) ) DEALLOCATE( HdroAddMs    )
-      IF ( ALLOCATED( HdroDmpng    ) ) DEALLOCATE( HdroDmpng    )
-      IF ( ALLOCATED( HdroFreq     ) ) DEALLOCATE( HdroFreq     )
-      IF ( ALLOCATED( HdroWvDir    ) ) DEALLOCATE( HdroWvDir    )
-      
-      IF ( ALLOCATED( WAMITFreq    ) ) DEALLOCATE( WAMITFreq    )
-      IF ( ALLOCATED( WAMITPer     ) ) DEALLOCATE( WAMITPer     )
-      IF ( ALLOCATED( WAMITWvDir   ) ) DEALLOCATE( WAMITWvDir   )
-      IF ( ALLOCATED( SortFreqInd  ) ) DEALLOCATE( SortFreqInd  )
-      IF ( ALLOCATED( SortWvDirInd ) ) DEALLOCATE( SortWvDirInd )
-         ! Define parameters here:
-         
-      p%DT  = Interval
-      
-      
-      ! Define system output initializations (set up mesh) here:
-      
-      
-          ! Create the input and output meshes associated with lumped loads
-      
-      CALL MeshCreate( BlankMesh        = u%Mesh            &
-                     ,IOS               = COMPONENT_INPUT   &
-                     ,Nnodes            = 1                 &
-                     ,ErrStat           = ErrStat2          &
-                     ,ErrMess           = ErrMsg2           &
-                     ,TranslationDisp   = .TRUE.            &
-                     ,Orientation       = .TRUE.            &
-                     ,TranslationVel    = .TRUE.            &
-                     ,RotationVel       = .TRUE.            &
-                     ,TranslationAcc    = .TRUE.            &
-                     ,RotationAcc       = .TRUE.)
-         
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-         IF ( ErrStat >= AbortErrLev ) THEN
-            CALL Cleanup()
-            RETURN
+
+      END DO ! End loop through all rows in the file
+
+
+      CLOSE ( UnW3 ) ! Close file.
+
+
+      ! For some reason, WAMIT computes the zero- and infinite- frequency limits for
+      !   only the added mass.  Based on hydrodynamic theory, the damping is zero at
+      !   these limits (as initialized).  Hydrodynamic theory also says that the
+      !   infinite-frequency limit of the diffraction force is zero (as initialized);
+      !   however, the zero-frequency limit need not be zero.  Thus, if necessary
+      !   (i.e., if we have read in a WAMIT output file that contains the
+      !   zero-frequency limit of the added mass), compute the zero-frequency limit
+      !   of the diffraction problem using the known values at the lowest
+      !   nonzero-valued frequency available:
+
+      DO I = 1,NInpFreq       ! Loop through all input frequency components
+
+         IF ( HdroFreq(I) > 0.0 )  THEN ! .TRUE. at the lowest nonzero-valued frequency component
+
+            DO J = I-1,1,-1   ! Loop through all zero-valued frequency components
+               HdroExctn(J,:,:) = HdroExctn(I,:,:) ! Set the zero-frequency limits to equal the known values at the lowest nonzero-valued frequency available
+            END DO             ! J - All zero-valued frequency components
+
+            EXIT  ! Since HdroFreq(:) is sorted from lowest to highest frequency, there is no reason to continue on once we have found the lowest nonzero-valued frequency component
+
          END IF
-      
-         ! Create the node on the mesh
-            
-         
-         
-      CALL MeshPositionNode (u%Mesh                                &
-                              , 1                                  &
-                              , (/0.0_ReKi, 0.0_ReKi, 0.0_ReKi/)   &  
-                              , ErrStat2                           &
-                              , ErrMsg2                            )
-      
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-       
-      
-         ! Create the mesh element
-      CALL MeshConstructElement (  u%Mesh              &
-                                  , ELEMENT_POINT      &                         
-                                  , ErrStat2           &
-                                  , ErrMsg2            &
-                                  , 1                  &
-                                              )
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
 
-      CALL MeshCommit ( u%Mesh              &
-                      , ErrStat2            &
-                      , ErrMsg2             )
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-         IF ( ErrStat >= AbortErrLev ) THEN
-            CALL Cleanup()
-            RETURN
-         END IF      
+      END DO                   ! I - All input frequency components
 
-         
-      CALL MeshCopy ( SrcMesh      = u%Mesh                 &
-                     ,DestMesh     = y%Mesh                 &
-                     ,CtrlCode     = MESH_SIBLING           &
-                     ,IOS          = COMPONENT_OUTPUT       &
-                     ,ErrStat      = ErrStat2               &
-                     ,ErrMess      = ErrMsg2                &
-                     ,Force        = .TRUE.                 &
-                     ,Moment       = .TRUE.                 )
-     
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-         IF ( ErrStat >= AbortErrLev ) THEN
-            CALL Cleanup()
-            RETURN
-         END IF      
-      
-      
-     u%Mesh%RemapFlag  = .TRUE.
-     y%Mesh%RemapFlag  = .TRUE.
-         
-         ! Define initialization-routine output here:
-         
-            ! Initialize the outputs
-      CALL WMTOUT_Init( InitInp, y, p, InitOut, ErrStat2, ErrMsg2 )
-         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'WAMIT_Init')
-         IF ( ErrStat >= AbortErrLev ) THEN
-            CALL Cleanup()
-            RETURN
-         END IF      
-      
-     
-         ! If you want to choose your own rate instead of using what the glue code suggests, tell the glue code the rate at which
-         !   this module must be called here:
-         
-       !Interval = p%DT                                               
+      CALL Cleanup()
 
-      ! initialize misc vars:      
-   m%LastIndWave = 1
-       
-       CALL Cleanup()
-       
 CONTAINS
 
-
    SUBROUTINE Cleanup()
-   
-      ! destroy local variables that are types in the framework:
-      
-      CALL Conv_Rdtn_DestroyInitInput(  Conv_Rdtn_InitInp,  ErrStat2, ErrMsg2 )
-      CALL Conv_Rdtn_DestroyInitOutput( Conv_Rdtn_InitOut,  ErrStat2, ErrMsg2 )
 
-      CALL SS_Rad_DestroyInitInput(     SS_Rdtn_InitInp,    ErrStat2, ErrMsg2 )
-      CALL SS_Rad_DestroyInitOutput(    SS_Rdtn_InitOut,    ErrStat2, ErrMsg2 )
-      
-      
-      ! destroy local variables that are allocatable arrays:
-      
-      IF ( ALLOCATED( HdroExctn   ) ) DEALLOCATE(HdroExctn   )
-      IF ( ALLOCATED( WaveExctnC  ) ) DEALLOCATE(WaveExctnC  )
-      
-      IF ( ALLOCATED( HdroAddMs   ) ) DEALLOCATE(HdroAddMs   )
-      IF ( ALLOCATED( HdroDmpng   ) ) DEALLOCATE(HdroDmpng   )
-      IF ( ALLOCATED( HdroFreq    ) ) DEALLOCATE(HdroFreq    )
-      IF ( ALLOCATED( HdroWvDir   ) ) DEALLOCATE(HdroWvDir   )
-      
       IF ( ALLOCATED( WAMITFreq   ) ) DEALLOCATE(WAMITFreq   )
       IF ( ALLOCATED( WAMITPer    ) ) DEALLOCATE(WAMITPer    )
       IF ( ALLOCATED( WAMITWvDir  ) ) DEALLOCATE(WAMITWvDir  )
       IF ( ALLOCATED( SortFreqInd ) ) DEALLOCATE(SortFreqInd )
       IF ( ALLOCATED( SortWvDirInd) ) DEALLOCATE(SortWvDirInd)
-   
-   
+
    END SUBROUTINE Cleanup
-            
-END SUBROUTINE WAMIT_Init
+
+END SUBROUTINE WAMIT_ReadFiles
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This routine is called at the end of the simulation.
 SUBROUTINE WAMIT_End( u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
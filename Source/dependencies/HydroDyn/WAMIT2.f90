@@ -61,6 +61,7 @@ MODULE WAMIT2
    USE WAMIT2_Output
    USE NWTC_Library
    USE NWTC_FFTPACK
+   USE HydroDyn_Cache
 
    IMPLICIT NONE
 
@@ -315,11 +316,11 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          !> If the MnDrift method will be used, read in the data for it.
       IF ( p%MnDriftF ) THEN
          IF ( MnDriftData%DataIs3D ) THEN
-            CALL Read_DataFile3D( TRIM(MnDriftData%Filename), MnDriftData%Data3D, ErrStatTmp, ErrMsgTmp )
+            CALL Read_CachedFile3D( TRIM(MnDriftData%Filename), MnDriftData%Data3D, ErrStatTmp, ErrMsgTmp )
             CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'WAMIT2_Init')
          ELSEIF ( MnDriftData%DataIs4D ) THEN
             MnDriftData%Data4D%IsSumForce = .FALSE.
-            CALL Read_DataFile4D( TRIM(MnDriftData%Filename), MnDriftData%Data4D, ErrStatTmp, ErrMsgTmp )
+            CALL Read_CachedFile4D( TRIM(MnDriftData%Filename), MnDriftData%Data4D, ErrStatTmp, ErrMsgTmp )
             CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'WAMIT2_Init')
          ELSE
             CALL SetErrStat( ErrID_Fatal, ' Programming error.  MnDrift method flags incorrectly set by '// &
@@ -335,11 +336,11 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          !> If the NewmanApp method will be used, read in the data for it.
       IF ( p%NewmanAppF ) THEN
          IF ( NewmanAppData%DataIs3D ) THEN
-            CALL Read_DataFile3D( TRIM(NewmanAppData%Filename), NewmanAppData%Data3D, ErrStatTmp, ErrMsgTmp )
+            CALL Read_CachedFile3D( TRIM(NewmanAppData%Filename), NewmanAppData%Data3D, ErrStatTmp, ErrMsgTmp )
             CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'WAMIT2_Init')
          ELSEIF ( NewmanAppData%DataIs4D ) THEN
             NewmanAppData%Data4D%IsSumForce = .FALSE.
-            CALL Read_DataFile4D( TRIM(NewmanAppData%Filename), NewmanAppData%Data4D, ErrStatTmp, ErrMsgTmp )
+            CALL Read_CachedFile4D( TRIM(NewmanAppData%Filename), NewmanAppData%Data4D, ErrStatTmp, ErrMsgTmp )
             CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'WAMIT2_Init')
          ELSE
             CALL SetErrStat( ErrID_Fatal, ' Programming error.  NewmanApp method flags incorrectly set by '// &
@@ -361,7 +362,7 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                   'CheckInitInput subroutine. 3D data cannot be used in the DiffQTF method.', ErrStat, ErrMsg, 'WAMIT2_Init' )
          ELSEIF ( DiffQTFData%DataIs4D ) THEN
             DiffQTFData%Data4D%IsSumForce = .FALSE.
-            CALL Read_DataFile4D( TRIM(DiffQTFData%Filename), DiffQTFData%Data4D, ErrStatTmp, ErrMsgTmp )
+            CALL Read_CachedFile4D( TRIM(DiffQTFData%Filename), DiffQTFData%Data4D, ErrStatTmp, ErrMsgTmp )
             CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'WAMIT2_Init')
          ELSE
             CALL SetErrStat( ErrID_Fatal, ' Programming error.  DiffQTF method flags incorrectly set by '// &
@@ -378,7 +379,7 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       IF ( p%SumQTFF ) THEN
          IF ( SumQTFData%DataIs4D ) THEN
             SumQTFData%Data4D%IsSumForce = .TRUE.
-            CALL Read_DataFile4D( TRIM(SumQTFData%Filename), SumQTFData%Data4D, ErrStatTmp, ErrMsgTmp )
+            CALL Read_CachedFile4D( TRIM(SumQTFData%Filename), SumQTFData%Data4D, ErrStatTmp, ErrMsgTmp )
             CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'WAMIT2_Init')
          ELSE
             CALL SetErrStat( ErrID_Fatal, ' Programming error.  SumQTF method flags incorrectly set by '// &
@@ -810,8 +811,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       INTEGER(IntKi)                                     :: LastIndex4(4)        !< Last used index for searching in the interpolation algorithms
       REAL(SiKi)                                         :: Coord3(3)            !< The (omega1,beta1,beta2) coordinate we want in the 3D dataset
       REAL(SiKi)                                         :: Coord4(4)            !< The (omega1,omega2,beta1,beta2) coordinate we want in the 4D dataset
-      COMPLEX(SiKi),ALLOCATABLE                          :: TmpData3D(:,:,:)     !< Temporary 3D array we put the 3D data into (minus the load component indice)
-      COMPLEX(SiKi),ALLOCATABLE                          :: TmpData4D(:,:,:,:)   !< Temporary 4D array we put the 4D data into (minus the load component indice)
 
 
          ! Initialize a few things
@@ -1066,26 +1065,11 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          !!      for \f$\quad k=1,2,\ldots,6,      \f$
 
 
-         ! Setup temporary arrays that we will be passing the data to the interpolation routines in.
-      IF (MnDriftData%DataIs3D) THEN
-         ALLOCATE( TmpData3D(MnDriftData%Data3D%NumWvFreq1, MnDriftData%Data3D%NumWvDir1,MnDriftData%Data3D%NumWvDir2),STAT=ErrStatTmp )
-         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,' Cannot allocate temporary array for interpolation of 3D QTF data.', &
-                                                ErrStat, ErrMsg, 'MnDrift_InitCalc')
-      ELSE
-         ALLOCATE( TmpData4D(MnDriftData%Data4D%NumWvFreq1,MnDriftData%Data4D%NumWvFreq2,MnDriftData%Data4D%NumWvDir1,MnDriftData%Data4D%NumWvDir2),STAT=ErrStatTmp )
-         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,' Cannot allocate temporary array for interpolation of 4D QTF data.', &
-                                                ErrStat, ErrMsg, 'MnDrift_InitCalc')
-      ENDIF
-
-         ! If something went wrong during allocation of the temporary arrays...
-      IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
-         RETURN
-      ENDIF
-
-
-         ! Now loop through all the dimensions and perform the calculation
+         ! Now loop through all the dimensions and perform the calculation.  The load components are independent, so they are
+         ! computed in parallel; the summation over the frequencies within each component stays in order.  The QTF data of each
+         ! component is passed to the interpolation routines in place (as an array section) rather than copied.
+      !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(I, J, aWaveElevC, Omega1, Coord3, Coord4, LastIndex3, LastIndex4, QTF_Value, &
+      !$OMP             ErrStatTmp, ErrMsgTmp) SCHEDULE(DYNAMIC,1)
       DO I=1,6
 
             ! Set the MnDrift force to 0.0 (Even ones we don't calculate)
@@ -1098,13 +1082,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
             LastIndex3 = (/0,0,0/)
             LastIndex4 = (/0,0,0,0/)
 
-               ! To make things run slightly quicker, copy the data we will be interpolating over into the temporary arrays
-            IF (MnDriftData%DataIs3D) THEN
-               TmpData3D = MnDriftData%Data3D%DataSet(:,:,:,I)
-            ELSE
-               TmpData4D = MnDriftData%Data4D%DataSet(:,:,:,:,I)
-            END IF
-            
 
             DO J=1,InitInp%NStepWave2
 
@@ -1127,7 +1104,7 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                      Coord3 = (/ Omega1, InitInp%WaveDirArr(J), InitInp%WaveDirArr(J) /)
 
                         ! get the interpolated value for F(omega1,beta1,beta2)
-                     CALL WAMIT_Interp3D_Cplx( Coord3, TmpData3D, MnDriftData%Data3D%WvFreq1, &
+                     CALL WAMIT_Interp3D_Cplx( Coord3, MnDriftData%Data3D%DataSet(:,:,:,I), MnDriftData%Data3D%WvFreq1, &
                                           MnDriftData%Data3D%WvDir1, MnDriftData%Data3D%WvDir2, LastIndex3, QTF_Value, ErrStatTmp, ErrMsgTmp )
 
                   ELSE
@@ -1136,12 +1113,20 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                      Coord4 = (/ Omega1, Omega1, InitInp%WaveDirArr(J), InitInp%WaveDirArr(J) /)
 
                         ! get the interpolated value for F(omega1,omega2,beta1,beta2)
-                     CALL WAMIT_Interp4D_Cplx( Coord4, TmpData4D, MnDriftData%Data4D%WvFreq1, MnDriftData%Data4D%WvFreq2, &
+                     CALL WAMIT_Interp4D_Cplx( Coord4, MnDriftData%Data4D%DataSet(:,:,:,:,I), MnDriftData%Data4D%WvFreq1, MnDriftData%Data4D%WvFreq2, &
                                           MnDriftData%Data4D%WvDir1, MnDriftData%Data4D%WvDir2, LastIndex4, QTF_Value, ErrStatTmp, ErrMsgTmp )
 
 
                   ENDIF !QTF value find
 
+                     ! Check and make sure nothing bombed in the interpolation that we need to be aware of
+                  IF ( ErrStatTmp /= ErrID_None ) THEN
+                     !$OMP CRITICAL(MnDrift_InitCalc_Err)
+                     CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'MnDrift_InitCalc')
+                     !$OMP END CRITICAL(MnDrift_InitCalc_Err)
+                     IF ( ErrStatTmp >= AbortErrLev ) EXIT
+                  ENDIF
+
 
                ELSE     ! outside the frequency range
 
@@ -1150,15 +1135,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                ENDIF    ! frequency check
 
 
-                  ! Check and make sure nothing bombed in the interpolation that we need to be aware of
-               CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'MnDrift_InitCalc')
-               IF ( ErrStat >= AbortErrLev ) THEN
-                  IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-                  IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
-                  RETURN
-               ENDIF
-
-
                   ! Now we have the value of the QTF.  These values should only be real for the omega1=omega2 case of the mean drift.
                   ! However if the value came from the 4D interpolation routine, it might have some residual complex part to it.  So
                   ! we throw the complex part out.
@@ -1174,13 +1150,7 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          ENDIF    ! Load component to calculate
 
       ENDDO
-
-
-
-         ! Cleanup
-
-      IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-      IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
+      !$OMP END PARALLEL DO
 
    END SUBROUTINE MnDrift_InitCalc
 
@@ -1273,8 +1243,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       INTEGER(IntKi)                                     :: LastIndex4(4)        !< Last used index for searching in the interpolation algorithms
       REAL(SiKi)                                         :: Coord3(3)            !< The (omega1,beta1,beta2) coordinate we want in the 3D dataset
       REAL(SiKi)                                         :: Coord4(4)            !< The (omega1,omega2,beta1,beta2) coordinate we want in the 4D dataset
-      COMPLEX(SiKi), ALLOCATABLE                         :: TmpData3D(:,:,:)     !< Temporary 3D array we put the 3D data into (minus the load component indice)
-      COMPLEX(SiKi), ALLOCATABLE                         :: TmpData4D(:,:,:,:)   !< Temporary 4D array we put the 4D data into (minus the load component indice)
 
 
          ! Initialize a few things
@@ -1528,18 +1496,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          !!                      for     \f$ \quad k=1,2,\ldots,6,         \f$
 
 
-         ! Setup temporary arrays that we will be passing the data to the interpolation routines in.
-      IF (NewmanAppData%DataIs3D) THEN
-         ALLOCATE( TmpData3D(NewmanAppData%Data3D%NumWvFreq1, NewmanAppData%Data3D%NumWvDir1,NewmanAppData%Data3D%NumWvDir2),STAT=ErrStatTmp )
-         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,' Cannot allocate temporary array for interpolation of 3D QTF data.', &
-                                                ErrStat, ErrMsg, 'NewmanApp_InitCalc')
-      ELSE
-         ALLOCATE( TmpData4D(NewmanAppData%Data4D%NumWvFreq1,NewmanAppData%Data4D%NumWvFreq1,NewmanAppData%Data4D%NumWvDir1,NewmanAppData%Data4D%NumWvDir2),STAT=ErrStatTmp )
-         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,' Cannot allocate temporary array for interpolation of 4D QTF data.', &
-                                                ErrStat, ErrMsg, 'NewmanApp_InitCalc')
-      ENDIF
-
-
          ! Setup the arrays holding the Newman terms, both the complex frequency domain and real time domain pieces
       ALLOCATE( NewmanTerm1t( 0:InitInp%NStepWave  ), STAT=ErrStatTmp )
       IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,' Cannot allocate array for calculating the first term of the Newmans '// &
@@ -1561,8 +1517,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
          ! If something went wrong during allocation of the temporary arrays...
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(NewmanTerm1t))     DEALLOCATE(NewmanTerm1t,STAT=ErrStatTmp)
          IF (ALLOCATED(NewmanTerm2t))     DEALLOCATE(NewmanTerm2t,STAT=ErrStatTmp)
          IF (ALLOCATED(NewmanTerm1C))     DEALLOCATE(NewmanTerm1C,STAT=ErrStatTmp)
@@ -1580,8 +1534,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       CALL InitCFFT ( InitInp%NStepWave, FFT_Data, .FALSE., ErrStatTmp )      ! Complex result FFT initialize
       CALL SetErrStat(ErrStatTmp,'Error occured while initializing the FFT.',ErrStat,ErrMsg,'NewmanApp_InitCalc')
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(NewmanTerm1t))     DEALLOCATE(NewmanTerm1t,STAT=ErrStatTmp)
          IF (ALLOCATED(NewmanTerm2t))     DEALLOCATE(NewmanTerm2t,STAT=ErrStatTmp)
          IF (ALLOCATED(NewmanTerm1C))     DEALLOCATE(NewmanTerm1C,STAT=ErrStatTmp)
@@ -1606,14 +1558,9 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
             LastIndex3 = (/0,0,0/)
             LastIndex4 = (/0,0,0,0/)
 
-               ! To make things run slightly quicker, copy the data we will be interpolating over into the temporary arrays
-            IF (NewmanAppData%DataIs3D) THEN
-               TmpData3D = NewmanAppData%Data3D%DataSet(:,:,:,I)
-            ELSE
-               TmpData4D = NewmanAppData%Data4D%DataSet(:,:,:,:,I)
-            END IF
-            
-
+               ! Each frequency fills its own element of the Newman terms, so the frequencies are split between the threads.
+            !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(J, aWaveElevC, Omega1, Coord3, Coord4, QTF_Value, ErrStatTmp, ErrMsgTmp) &
+            !$OMP             FIRSTPRIVATE(LastIndex3, LastIndex4) SCHEDULE(STATIC)
             DO J=1,InitInp%NStepWave2
 
                   ! First get the wave amplitude -- must be reconstructed from the WaveElevC array.  First index is the real (1) or
@@ -1633,7 +1580,7 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                      Coord3 = (/ Omega1, InitInp%WaveDirArr(J), InitInp%WaveDirArr(J) /)
 
                         ! get the interpolated value for F(omega1,beta1,beta2)
-                     CALL WAMIT_Interp3D_Cplx( Coord3, TmpData3D, NewmanAppData%Data3D%WvFreq1, &
+                     CALL WAMIT_Interp3D_Cplx( Coord3, NewmanAppData%Data3D%DataSet(:,:,:,I), NewmanAppData%Data3D%WvFreq1, &
                                           NewmanAppData%Data3D%WvDir1, NewmanAppData%Data3D%WvDir2, LastIndex3, QTF_Value, ErrStatTmp, ErrMsgTmp )
 
                   ELSE
@@ -1642,12 +1589,19 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                      Coord4 = (/ Omega1, Omega1, InitInp%WaveDirArr(J), InitInp%WaveDirArr(J) /)
 
                         ! get the interpolated value for F(omega1,omega2,beta1,beta2)
-                     CALL WAMIT_Interp4D_Cplx( Coord4, TmpData4D, NewmanAppData%Data4D%WvFreq1, NewmanAppData%Data4D%WvFreq2, &
+                     CALL WAMIT_Interp4D_Cplx( Coord4, NewmanAppData%Data4D%DataSet(:,:,:,:,I), NewmanAppData%Data4D%WvFreq1, NewmanAppData%Data4D%WvFreq2, &
                                           NewmanAppData%Data4D%WvDir1, NewmanAppData%Data4D%WvDir2, LastIndex4, QTF_Value, ErrStatTmp, ErrMsgTmp )
 
 
                   ENDIF !QTF value find
 
+                     ! Check and make sure nothing bombed in the interpolation that we need to be aware of
+                  IF ( ErrStatTmp /= ErrID_None ) THEN
+                     !$OMP CRITICAL(NewmanApp_InitCalc_Err)
+                     CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'NewmanApp_InitCalc')
+                     !$OMP END CRITICAL(NewmanApp_InitCalc_Err)
+                  ENDIF
+
 
                ELSE     ! outside the frequency range
 
@@ -1657,21 +1611,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
 
 
-                  ! Check and make sure nothing bombed in the interpolation that we need to be aware of
-               CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'NewmanApp_InitCalc')
-               IF ( ErrStat >= AbortErrLev ) THEN
-                  IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-                  IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
-                  IF (ALLOCATED(NewmanTerm1t))     DEALLOCATE(NewmanTerm1t,STAT=ErrStatTmp)
-                  IF (ALLOCATED(NewmanTerm2t))     DEALLOCATE(NewmanTerm2t,STAT=ErrStatTmp)
-                  IF (ALLOCATED(NewmanTerm1C))     DEALLOCATE(NewmanTerm1C,STAT=ErrStatTmp)
-                  IF (ALLOCATED(NewmanTerm2C))     DEALLOCATE(NewmanTerm2C,STAT=ErrStatTmp)
-                  IF (ALLOCATED(NewmanAppForce))   DEALLOCATE(NewmanAppForce,STAT=ErrStatTmp)
-                  RETURN
-               ENDIF
-
-
-
                   ! Now we have the value of the QTF.  These values should only be real for the omega1=omega2 case of the approximation.
                   ! However if the value came from the 4D interpolation routine, it might have some residual complex part to it.  So
                   ! we throw the complex part out.
@@ -1699,13 +1638,22 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
 
             ENDDO
+            !$OMP END PARALLEL DO
+
+               ! Check and make sure nothing bombed in the interpolation that we need to be aware of
+            IF ( ErrStat >= AbortErrLev ) THEN
+               IF (ALLOCATED(NewmanTerm1t))     DEALLOCATE(NewmanTerm1t,STAT=ErrStatTmp)
+               IF (ALLOCATED(NewmanTerm2t))     DEALLOCATE(NewmanTerm2t,STAT=ErrStatTmp)
+               IF (ALLOCATED(NewmanTerm1C))     DEALLOCATE(NewmanTerm1C,STAT=ErrStatTmp)
+               IF (ALLOCATED(NewmanTerm2C))     DEALLOCATE(NewmanTerm2C,STAT=ErrStatTmp)
+               IF (ALLOCATED(NewmanAppForce))   DEALLOCATE(NewmanAppForce,STAT=ErrStatTmp)
+               RETURN
+            ENDIF
 
                ! Now we apply the FFT to the first piece.
             CALL ApplyCFFT(  NewmanTerm1t(:), NewmanTerm1C(:), FFT_Data, ErrStatTmp )
             CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'NewmanApp_InitCalc')
             IF ( ErrStat >= AbortErrLev ) THEN
-               IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-               IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
                IF (ALLOCATED(NewmanTerm1t))     DEALLOCATE(NewmanTerm1t,STAT=ErrStatTmp)
                IF (ALLOCATED(NewmanTerm2t))     DEALLOCATE(NewmanTerm2t,STAT=ErrStatTmp)
                IF (ALLOCATED(NewmanTerm1C))     DEALLOCATE(NewmanTerm1C,STAT=ErrStatTmp)
@@ -1718,8 +1666,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
             CALL ApplyCFFT( NewmanTerm2t(:), NewmanTerm2C(:), FFT_Data, ErrStatTmp )
             CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'NewmanApp_InitCalc')
             IF ( ErrStat >= AbortErrLev ) THEN
-               IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-               IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
                IF (ALLOCATED(NewmanTerm1t))     DEALLOCATE(NewmanTerm1t,STAT=ErrStatTmp)
                IF (ALLOCATED(NewmanTerm2t))     DEALLOCATE(NewmanTerm2t,STAT=ErrStatTmp)
                IF (ALLOCATED(NewmanTerm1C))     DEALLOCATE(NewmanTerm1C,STAT=ErrStatTmp)
@@ -1746,8 +1692,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       CALL  ExitCFFT(FFT_Data, ErrStatTmp)
       CALL  SetErrStat(ErrStatTmp,'Error occured while cleaning up after the FFTs.', ErrStat,ErrMsg,'NewmanApp_InitCalc')
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(NewmanTerm1t))     DEALLOCATE(NewmanTerm1t,STAT=ErrStatTmp)
          IF (ALLOCATED(NewmanTerm2t))     DEALLOCATE(NewmanTerm2t,STAT=ErrStatTmp)
          IF (ALLOCATED(NewmanTerm1C))     DEALLOCATE(NewmanTerm1C,STAT=ErrStatTmp)
@@ -1758,8 +1702,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
 
          ! Cleanup
-      IF (ALLOCATED(TmpData3D))        DEALLOCATE(TmpData3D,STAT=ErrStatTmp)
-      IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
       IF (ALLOCATED(NewmanTerm1t))     DEALLOCATE(NewmanTerm1t,STAT=ErrStatTmp)
       IF (ALLOCATED(NewmanTerm2t))     DEALLOCATE(NewmanTerm2t,STAT=ErrStatTmp)
       IF (ALLOCATED(NewmanTerm1C))     DEALLOCATE(NewmanTerm1C,STAT=ErrStatTmp)
@@ -1846,7 +1788,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          ! Interpolation routine indices and value to search for, and smaller array to pass
       INTEGER(IntKi)                                     :: LastIndex4(4)        !< Last used index for searching in the interpolation algorithms.  First  wave freq
       REAL(SiKi)                                         :: Coord4(4)            !< The (omega1,omega2,beta1,beta2) coordinate we want in the 4D dataset. First  wave freq.
-      COMPLEX(SiKi), ALLOCATABLE                         :: TmpData4D(:,:,:,:)   !< Temporary 4D array we put the 4D data into (minus the load component indice)
 
 
          ! Initialize a few things
@@ -1979,12 +1920,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          !! The single summation equation used here is given by
 
 
-         ! Setup temporary arrays that we will be passing the data to the interpolation routines in.
-      ALLOCATE( TmpData4D(DiffQTFData%Data4D%NumWvFreq1,DiffQTFData%Data4D%NumWvFreq1,DiffQTFData%Data4D%NumWvDir1,DiffQTFData%Data4D%NumWvDir2),STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,' Cannot allocate temporary array for interpolation of 4D QTF data.', &
-                                             ErrStat, ErrMsg, 'DiffQTF_InitCalc')
-
-
          ! Setup the arrays holding the DiffQTF terms, both the complex frequency domain and real time domain pieces
       ALLOCATE( TmpDiffQTFForce( 0:InitInp%NStepWave), STAT=ErrStatTmp )
       IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,' Cannot allocate array for one load component of the full difference '// &
@@ -1998,7 +1933,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
          ! If something went wrong during allocation of the temporary arrays...
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(DiffQTFForce))     DEALLOCATE(DiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpDiffQTFForce))  DEALLOCATE(TmpDiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpComplexArr))    DEALLOCATE(TmpComplexArr,STAT=ErrStatTmp)
@@ -2014,7 +1948,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       CALL InitFFT ( InitInp%NStepWave, FFT_Data, .FALSE., ErrStatTmp )
       CALL SetErrStat(ErrStatTmp,'Error occured while initializing the FFT.',ErrStat,ErrMsg,'DiffQTF_InitCalc')
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(DiffQTFForce))     DEALLOCATE(DiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpDiffQTFForce))  DEALLOCATE(TmpDiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpComplexArr))    DEALLOCATE(TmpComplexArr,STAT=ErrStatTmp)
@@ -2029,7 +1962,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       CALL MnDrift_InitCalc( InitInp, p, DiffQTFData, MnDriftForce, ErrMsgTmp, ErrStatTmp )
       CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'DiffQTF_InitCalc' )
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(DiffQTFForce))     DEALLOCATE(DiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpDiffQTFForce))  DEALLOCATE(TmpDiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpComplexArr))    DEALLOCATE(TmpComplexArr,STAT=ErrStatTmp)
@@ -2046,7 +1978,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                      ErrStat,ErrMsg,'DiffQTF_InitCalc')
       ENDDO
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(DiffQTFForce))     DEALLOCATE(DiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpDiffQTFForce))  DEALLOCATE(TmpDiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpComplexArr))    DEALLOCATE(TmpComplexArr,STAT=ErrStatTmp)
@@ -2065,14 +1996,15 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                ! Set an initial search index for the 4D array interpolation
             LastIndex4 = (/0,0,0,0/)
 
-               ! To make things run slightly quicker, copy the data we will be interpolating over into the temporary arrays
-            TmpData4D = DiffQTFData%Data4D%DataSet(:,:,:,:,I)
-
                ! Initialize the temporary array to zero.
             TmpComplexArr = CMPLX(0.0_SiKi,0.0_SiKi)
 
 
-               ! Outer loop to create the TmpComplexArr
+               ! Outer loop to create the TmpComplexArr.  Each difference frequency is an independent sum that fills its own element,
+               ! so the difference frequencies are split between the threads (the sum over each one stays in order).  The number of
+               ! terms in the sum drops with the difference frequency, hence the dynamic schedule.
+            !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(J, K, OmegaDiff, Omega1, Omega2, aWaveElevC1, aWaveElevC2, Coord4, QTF_Value, &
+            !$OMP             TmpHMinusC, ErrStatTmp, ErrMsgTmp) FIRSTPRIVATE(LastIndex4) SCHEDULE(DYNAMIC,1)
             DO J=1,InitInp%NStepWave2-1
 
                   ! Calculate the frequency  -- This is the difference frequency.
@@ -2102,15 +2034,13 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                      Coord4 = (/ Omega1, Omega2, InitInp%WaveDirArr(J+K), InitInp%WaveDirArr(K) /)
 
                         ! get the interpolated value for F(omega1,omega2,beta1,beta2)  --> QTF_Value
-                     CALL WAMIT_Interp4D_Cplx( Coord4, TmpData4D, DiffQTFData%Data4D%WvFreq1, DiffQTFData%Data4D%WvFreq2, &
+                     CALL WAMIT_Interp4D_Cplx( Coord4, DiffQTFData%Data4D%DataSet(:,:,:,:,I), DiffQTFData%Data4D%WvFreq1, DiffQTFData%Data4D%WvFreq2, &
                                           DiffQTFData%Data4D%WvDir1, DiffQTFData%Data4D%WvDir2, LastIndex4, QTF_Value, ErrStatTmp, ErrMsgTmp )
-                     CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'DiffQTF_InitCalc')
-                     IF (ErrStat >= AbortErrLev ) THEN
-                        IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
-                        IF (ALLOCATED(DiffQTFForce))     DEALLOCATE(DiffQTFForce,STAT=ErrStatTmp)
-                        IF (ALLOCATED(TmpDiffQTFForce))  DEALLOCATE(TmpDiffQTFForce,STAT=ErrStatTmp)
-                        IF (ALLOCATED(TmpComplexArr))    DEALLOCATE(TmpComplexArr,STAT=ErrStatTmp)
-                        RETURN
+                     IF ( ErrStatTmp /= ErrID_None ) THEN
+                        !$OMP CRITICAL(DiffQTF_InitCalc_Err)
+                        CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'DiffQTF_InitCalc')
+                        !$OMP END CRITICAL(DiffQTF_InitCalc_Err)
+                        IF ( ErrStatTmp >= AbortErrLev ) EXIT
                      ENDIF
 
                         ! Calculate this value and add it to what we have so far.
@@ -2130,13 +2060,21 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
 
             ENDDO
+            !$OMP END PARALLEL DO
+
+               ! Check and make sure nothing bombed in the interpolation that we need to be aware of
+            IF ( ErrStat >= AbortErrLev ) THEN
+               IF (ALLOCATED(DiffQTFForce))     DEALLOCATE(DiffQTFForce,STAT=ErrStatTmp)
+               IF (ALLOCATED(TmpDiffQTFForce))  DEALLOCATE(TmpDiffQTFForce,STAT=ErrStatTmp)
+               IF (ALLOCATED(TmpComplexArr))    DEALLOCATE(TmpComplexArr,STAT=ErrStatTmp)
+               RETURN
+            ENDIF
 
                ! Now we apply the FFT to the result of the sum
             CALL ApplyFFT_cx(  TmpDiffQTFForce(:),  TmpComplexArr(:), FFT_Data, ErrStatTmp )
             CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to the second term of the difference QTF.', &
                            ErrStat,ErrMsg,'DiffQTF_InitCalc')
             IF ( ErrStat >= AbortErrLev ) THEN
-               IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
                IF (ALLOCATED(DiffQTFForce))     DEALLOCATE(DiffQTFForce,STAT=ErrStatTmp)
                IF (ALLOCATED(TmpDiffQTFForce))  DEALLOCATE(TmpDiffQTFForce,STAT=ErrStatTmp)
                IF (ALLOCATED(TmpComplexArr))    DEALLOCATE(TmpComplexArr,STAT=ErrStatTmp)
@@ -2162,7 +2100,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       CALL  ExitFFT(FFT_Data, ErrStatTmp)
       CALL  SetErrStat(ErrStatTmp,'Error occured while cleaning up after the FFTs.', ErrStat,ErrMsg,'DiffQTF_InitCalc')
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(DiffQTFForce))     DEALLOCATE(DiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpDiffQTFForce))  DEALLOCATE(TmpDiffQTFForce,STAT=ErrStatTmp)
          IF (ALLOCATED(TmpComplexArr))    DEALLOCATE(TmpComplexArr,STAT=ErrStatTmp)
@@ -2171,7 +2108,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
 
          ! Cleanup
-      IF (ALLOCATED(TmpData4D))           DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
       IF (ALLOCATED(TmpDiffQTFForce))     DEALLOCATE(TmpDiffQTFForce,STAT=ErrStatTmp)
       IF (ALLOCATED(TmpComplexArr))       DEALLOCATE(TmpComplexArr,STAT=ErrStatTmp)
 
@@ -2283,7 +2219,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          ! Interpolation routine indices and value to search for, and smaller array to pass
       INTEGER(IntKi)                                     :: LastIndex4(4)        !< Last used index for searching in the interpolation algorithms.  First  wave freq
       REAL(SiKi)                                         :: Coord4(4)            !< The (omega1,omega2,beta1,beta2) coordinate we want in the 4D dataset. First  wave freq.
-      COMPLEX(SiKi), ALLOCATABLE                         :: TmpData4D(:,:,:,:)   !< Temporary 4D array we put the 4D data into (minus the load component indice)
 
 
          ! Initialize a few things
@@ -2416,12 +2351,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          !! The single summation equation used here is given by
 
 
-         ! Setup temporary arrays that we will be passing the data to the interpolation routines in.
-      ALLOCATE( TmpData4D(SumQTFData%Data4D%NumWvFreq1,SumQTFData%Data4D%NumWvFreq1,SumQTFData%Data4D%NumWvDir1,SumQTFData%Data4D%NumWvDir2),STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,' Cannot allocate temporary array for interpolation of 4D QTF data.', &
-                                             ErrStat, ErrMsg, 'SumQTF_InitCalc')
-
-
          ! Setup the arrays holding the SumQTF terms, both the complex frequency domain and real time domain pieces
       ALLOCATE( Term1ArrayC( 0:InitInp%NStepWave2), STAT=ErrStatTmp )
       IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,' Cannot allocate array for the first term of one load component of the full sum '// &
@@ -2441,7 +2370,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
          ! If something went wrong during allocation of the temporary arrays...
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(Term1ArrayC))      DEALLOCATE(Term1ArrayC,STAT=ErrStatTmp)
          IF (ALLOCATED(Term2ArrayC))      DEALLOCATE(Term2ArrayC,STAT=ErrStatTmp)
          IF (ALLOCATED(Term1Array))       DEALLOCATE(Term1Array,STAT=ErrStatTmp)
@@ -2458,7 +2386,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       CALL InitFFT ( InitInp%NStepWave, FFT_Data, .FALSE., ErrStatTmp )        ! FIXME:
       CALL SetErrStat(ErrStatTmp,'Error occured while initializing the FFT.',ErrStat,ErrMsg,'SumQTF_InitCalc')
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          IF (ALLOCATED(SumQTFForce))      DEALLOCATE(SumQTFForce,STAT=ErrStatTmp)
          RETURN
       END IF
@@ -2472,9 +2399,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
          IF ( p%SumQTFDims(I) ) THEN
 
 
-               ! To make things run slightly quicker, copy the data we will be interpolating over into the temporary arrays
-            TmpData4D = SumQTFData%Data4D%DataSet(:,:,:,:,I)
-
 
 
             !---------------------------------------------------------------------------------
@@ -2496,7 +2420,10 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
                ! The limits look a little funny.  But remember we are placing the value in the 2*J location,
                ! so we cannot overun the end of the array, and the highest frequency must be zero.  The
-               ! floor function is just in case (NStepWave2 - 1) is an odd number
+               ! floor function is just in case (NStepWave2 - 1) is an odd number.  Each J fills its own element,
+               ! so the frequencies are split between the threads.
+            !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(J, Omega1, OmegaSum, aWaveElevC1, Coord4, QTF_Value, ErrStatTmp, ErrMsgTmp) &
+            !$OMP             FIRSTPRIVATE(LastIndex4) SCHEDULE(STATIC)
             DO J=1,FLOOR(REAL(InitInp%NStepWave2-1)/2.0_SiKi)
 
                   ! The frequency
@@ -2514,12 +2441,12 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                   Coord4 = (/ Omega1, Omega1, InitInp%WaveDirArr(J), InitInp%WaveDirArr(J) /)
 
                      ! get the interpolated value for F(omega1,omega2,beta1,beta2)  --> QTF_Value
-                  CALL WAMIT_Interp4D_Cplx( Coord4, TmpData4D, SumQTFData%Data4D%WvFreq1, SumQTFData%Data4D%WvFreq2, &
+                  CALL WAMIT_Interp4D_Cplx( Coord4, SumQTFData%Data4D%DataSet(:,:,:,:,I), SumQTFData%Data4D%WvFreq1, SumQTFData%Data4D%WvFreq2, &
                                        SumQTFData%Data4D%WvDir1, SumQTFData%Data4D%WvDir2, LastIndex4, QTF_Value, ErrStatTmp, ErrMsgTmp )
-                  CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'SumQTF_InitCalc')
-                  IF (ErrStat >= AbortErrLev ) THEN
-                     IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
-                     RETURN
+                  IF ( ErrStatTmp /= ErrID_None ) THEN
+                     !$OMP CRITICAL(SumQTF_InitCalc_Err)
+                     CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'SumQTF_InitCalc')
+                     !$OMP END CRITICAL(SumQTF_InitCalc_Err)
                   ENDIF
 
                      ! Set the value of the first term in the frequency domain
@@ -2528,6 +2455,11 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
                ENDIF    ! Check on the limits
             ENDDO       ! First term calculation
+            !$OMP END PARALLEL DO
+
+            IF ( ErrStat >= AbortErrLev ) THEN
+               RETURN
+            ENDIF
 
 
 
@@ -2570,7 +2502,11 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
 
 
-               ! Outer loop to create the Term2ArrayC. This is stepwise through the sum frequencies.
+               ! Outer loop to create the Term2ArrayC. This is stepwise through the sum frequencies.  Each sum frequency is an
+               ! independent sum that fills its own element, so the sum frequencies are split between the threads (the sum over
+               ! each one stays in order).  The number of terms grows with the sum frequency, hence the dynamic schedule.
+            !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(J, K, OmegaSum, Omega1, Omega2, aWaveElevC1, aWaveElevC2, Coord4, QTF_Value, &
+            !$OMP             TmpHPlusC, ErrStatTmp, ErrMsgTmp) FIRSTPRIVATE(LastIndex4) SCHEDULE(DYNAMIC,1)
             DO J=1,InitInp%NStepWave2
 
                   ! Calculate the frequency  -- This is the sum frequency.
@@ -2606,12 +2542,13 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                      Coord4 = (/ Omega1, Omega2, InitInp%WaveDirArr(K), InitInp%WaveDirArr(J-K) /)
 
                         ! get the interpolated value for F(omega1,omega2,beta1,beta2)  --> QTF_Value
-                     CALL WAMIT_Interp4D_Cplx( Coord4, TmpData4D, SumQTFData%Data4D%WvFreq1, SumQTFData%Data4D%WvFreq2, &
+                     CALL WAMIT_Interp4D_Cplx( Coord4, SumQTFData%Data4D%DataSet(:,:,:,:,I), SumQTFData%Data4D%WvFreq1, SumQTFData%Data4D%WvFreq2, &
                                           SumQTFData%Data4D%WvDir1, SumQTFData%Data4D%WvDir2, LastIndex4, QTF_Value, ErrStatTmp, ErrMsgTmp )
-                     CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'SumQTF_InitCalc')
-                     IF (ErrStat >= AbortErrLev ) THEN
-                        IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
-                        RETURN
+                     IF ( ErrStatTmp /= ErrID_None ) THEN
+                        !$OMP CRITICAL(SumQTF_InitCalc_Err)
+                        CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'SumQTF_InitCalc')
+                        !$OMP END CRITICAL(SumQTF_InitCalc_Err)
+                        IF ( ErrStatTmp >= AbortErrLev ) EXIT
                      ENDIF
 
                         ! Set the value of the first term in the frequency domain.
@@ -2626,6 +2563,11 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
                ENDIF    ! Check on the limits
 
             ENDDO       ! Second term calculation -- frequency step on the sum frequency
+            !$OMP END PARALLEL DO
+
+            IF ( ErrStat >= AbortErrLev ) THEN
+               RETURN
+            ENDIF
 
 
 
@@ -2634,7 +2576,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
             CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to the first term of the Sum QTF.', &
                            ErrStat,ErrMsg,'SumQTF_InitCalc')
             IF ( ErrStat >= AbortErrLev ) THEN
-               IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
                RETURN
             END IF
 
@@ -2643,7 +2584,6 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
             CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to the second term of the Sum QTF.', &
                            ErrStat,ErrMsg,'SumQTF_InitCalc')
             IF ( ErrStat >= AbortErrLev ) THEN
-               IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
                RETURN
             ENDIF
 
@@ -2665,13 +2605,11 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
       CALL  ExitFFT(FFT_Data, ErrStatTmp)
       CALL  SetErrStat(ErrStatTmp,'Error occured while cleaning up after the FFTs.', ErrStat,ErrMsg,'SumQTF_InitCalc')
       IF ( ErrStat >= AbortErrLev ) THEN
-         IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
          RETURN
       END IF
 
 
          ! Cleanup
-      IF (ALLOCATED(TmpData4D))           DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
 
    END SUBROUTINE SumQTF_InitCalc
 
@@ -3228,6 +3166,318 @@ SUBROUTINE WAMIT2_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Ini
 
 
 
+   !-------------------------------------------------------------------------------------------------------------------------------
+   !> This routine returns the 3D data from the datafile like _Read_DataFile3D_.  When InitInp%WvCacheDir is set, the data is kept
+   !! in a cache file whose key holds the checksum of the datafile, so a later simulation with the same datafile reads the binary
+   !! cache file instead of parsing the text.  The warnings from reading the datafile are stored in the cache file, and given again
+   !! when the data is read from it.
+   SUBROUTINE Read_CachedFile3D( Filename3D, Data3D, ErrStat, ErrMsg )
+
+      IMPLICIT NONE
+
+         ! Passed variables.
+      CHARACTER(*),                       INTENT(IN   )  :: Filename3D        !< Name of the file containing the 3D data
+      TYPE(W2_InitData3D_Type),           INTENT(INOUT)  :: Data3D            !< 3D QTF data
+      INTEGER(IntKi),                     INTENT(  OUT)  :: ErrStat           !< The error value
+      CHARACTER(*),                       INTENT(  OUT)  :: ErrMsg            !< A message about the error.
+
+         ! Local variables
+      CHARACTER(1024)                                    :: CacheFile         !< Name of the cache file for the datafile; empty if not cached
+      LOGICAL                                            :: CacheHit          !< Whether the data was read from the cache
+      REAL(ReKi),       ALLOCATABLE                      :: KeyRe(:)          !< Packed reals    of the cache key
+      REAL(DbKi),       ALLOCATABLE                      :: KeyDb(:)          !< Packed doubles  of the cache key (not used)
+      INTEGER(IntKi),   ALLOCATABLE                      :: KeyInt(:)         !< Packed integers of the cache key
+      REAL(ReKi),       ALLOCATABLE                      :: ValRe(:)          !< Packed reals    of the cached data
+      REAL(DbKi),       ALLOCATABLE                      :: ValDb(:)          !< Packed doubles  of the cached data (not used)
+      INTEGER(IntKi),   ALLOCATABLE                      :: ValInt(:)         !< Packed integers of the cached data
+      INTEGER(IntKi)                                     :: NData             !< Number of elements of DataSet
+      INTEGER(IntKi)                                     :: NFreq             !< Number of frequencies
+      INTEGER(IntKi)                                     :: NDir1             !< Number of wave directions in the first  set
+      INTEGER(IntKi)                                     :: NDir2             !< Number of wave directions in the second set
+      INTEGER(IntKi)                                     :: Indx              !< Current position in ValRe
+
+            ! Error handling temporary variables
+      INTEGER(IntKi)                                     :: ErrStatTmp        !< Temporary variable for the local error status
+      CHARACTER(2048)                                    :: ErrMsgTmp         !< Temporary error message variable
+      INTEGER(IntKi)                                     :: ErrStatCache      !< Error status stored in the cache file
+      CHARACTER(2048)                                    :: ErrMsgCache       !< Error message stored in the cache file
+      CHARACTER(*), PARAMETER                            :: RoutineName = 'Read_CachedFile3D'
+
+
+      ErrStat  = ErrID_None
+      ErrMsg   = ""
+
+      CALL W2_CacheKey( Filename3D, 3, .FALSE., CacheFile, KeyRe, KeyDb, KeyInt )
+      CacheHit = .FALSE.
+      IF ( LEN_TRIM(CacheFile) > 0 ) CALL HDCache_Read( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, CacheHit )
+
+         ! Unpack the cached data, making sure the sizes are consistent
+      IF ( CacheHit ) THEN
+         CacheHit = SIZE(ValInt) >= 15
+      END IF
+      IF ( CacheHit ) THEN
+         NFreq    = ValInt(1)
+         NDir1    = ValInt(2)
+         NDir2    = ValInt(3)
+         NData    = NFreq*NDir1*NDir2*6
+         CacheHit = NFreq > 0 .AND. NDir1 > 0 .AND. NDir2 > 0
+         IF ( CacheHit ) CacheHit = SIZE(ValInt) > 15 + NData .AND. SIZE(ValRe) == NFreq + NDir1 + NDir2 + 2*NData
+         IF ( CacheHit ) CALL HDCache_UnPackMsg( ValInt(16+NData:), ErrStatCache, ErrMsgCache, CacheHit )
+      END IF
+      IF ( CacheHit ) THEN
+         ALLOCATE( Data3D%WvFreq1(NFreq), Data3D%WvDir1(NDir1), Data3D%WvDir2(NDir2), Data3D%DataSet(NFreq,NDir1,NDir2,6), &
+                   Data3D%DataMask(NFreq,NDir1,NDir2,6), STAT=ErrStatTmp )
+         CacheHit = ErrStatTmp == 0
+      END IF
+      IF ( CacheHit ) THEN
+         Data3D%NumWvFreq1     = NFreq
+         Data3D%NumWvDir1      = NDir1
+         Data3D%NumWvDir2      = NDir2
+         Data3D%DataIsSparse   = ValInt( 4: 9) /= 0
+         Data3D%LoadComponents = ValInt(10:15) /= 0
+         Data3D%DataMask       = RESHAPE( ValInt(16:15+NData) /= 0, SHAPE(Data3D%DataMask) )
+         Data3D%WvFreq1        = REAL( ValRe(1:NFreq), SiKi );                Indx = NFreq
+         Data3D%WvDir1         = REAL( ValRe(Indx+1:Indx+NDir1), SiKi );      Indx = Indx + NDir1
+         Data3D%WvDir2         = REAL( ValRe(Indx+1:Indx+NDir2), SiKi );      Indx = Indx + NDir2
+         Data3D%DataSet        = RESHAPE( CMPLX( ValRe(Indx+1:Indx+NData), ValRe(Indx+NData+1:Indx+2*NData), SiKi ), SHAPE(Data3D%DataSet) )
+         CALL WrScr( ' Reading the processed 2nd order WAMIT file "'//TRIM(Filename3D)//'" from "'//TRIM(CacheFile)//'".' )
+         ErrStat = ErrStatCache
+         ErrMsg  = ErrMsgCache
+         RETURN
+      END IF
+      IF ( ALLOCATED(Data3D%WvFreq1)  )  DEALLOCATE(Data3D%WvFreq1)
+      IF ( ALLOCATED(Data3D%WvDir1)   )  DEALLOCATE(Data3D%WvDir1)
+      IF ( ALLOCATED(Data3D%WvDir2)   )  DEALLOCATE(Data3D%WvDir2)
+      IF ( ALLOCATED(Data3D%DataSet)  )  DEALLOCATE(Data3D%DataSet)
+      IF ( ALLOCATED(Data3D%DataMask) )  DEALLOCATE(Data3D%DataMask)
+
+
+      CALL Read_DataFile3D( Filename3D, Data3D, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev .OR. LEN_TRIM(CacheFile) == 0 ) RETURN
+
+      ValInt = (/ Data3D%NumWvFreq1, Data3D%NumWvDir1, Data3D%NumWvDir2, MERGE( 1, 0, Data3D%DataIsSparse ),    &
+                  MERGE( 1, 0, Data3D%LoadComponents ), MERGE( 1, 0, RESHAPE( Data3D%DataMask, (/ SIZE(Data3D%DataMask) /) ) ), &
+                  HDCache_PackMsg( ErrStat, ErrMsg ) /)
+      ValRe  = (/ REAL( Data3D%WvFreq1, ReKi ), REAL( Data3D%WvDir1, ReKi ), REAL( Data3D%WvDir2, ReKi ),                 &
+                  REAL( RESHAPE( REAL ( Data3D%DataSet ), (/ SIZE(Data3D%DataSet) /) ), ReKi ),                          &
+                  REAL( RESHAPE( AIMAG( Data3D%DataSet ), (/ SIZE(Data3D%DataSet) /) ), ReKi ) /)
+      CALL HDCache_Write( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, ErrStatTmp, ErrMsgTmp )
+      CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, RoutineName )
+
+   END SUBROUTINE Read_CachedFile3D
+
+
+   !-------------------------------------------------------------------------------------------------------------------------------
+   !> This routine returns the 4D data from the datafile like _Read_DataFile4D_, using the cache files in the same way as
+   !! _Read_CachedFile3D_.  Data4D%IsSumForce must be set before the call, as it is part of the cache key.  The 4D data can be
+   !! large, so it is written to and read from the cache file one (frequency, frequency, direction) section at a time instead of
+   !! through another full-size packed array.
+   SUBROUTINE Read_CachedFile4D( Filename4D, Data4D, ErrStat, ErrMsg )
+
+      IMPLICIT NONE
+
+         ! Passed variables.
+      CHARACTER(*),                       INTENT(IN   )  :: Filename4D        !< Name of the file containing the 4D data
+      TYPE(W2_InitData4D_Type),           INTENT(INOUT)  :: Data4D            !< 4D QTF data
+      INTEGER(IntKi),                     INTENT(  OUT)  :: ErrStat           !< The error value
+      CHARACTER(*),                       INTENT(  OUT)  :: ErrMsg            !< A message about the error.
+
+         ! Local variables
+      CHARACTER(1024)                                    :: CacheFile         !< Name of the cache file for the datafile; empty if not cached
+      LOGICAL                                            :: CacheHit          !< Whether the data was read from the cache
+      REAL(ReKi),       ALLOCATABLE                      :: KeyRe(:)          !< Packed reals    of the cache key
+      REAL(DbKi),       ALLOCATABLE                      :: KeyDb(:)          !< Packed doubles  of the cache key (not used)
+      INTEGER(IntKi),   ALLOCATABLE                      :: KeyInt(:)         !< Packed integers of the cache key
+      REAL(ReKi),       ALLOCATABLE                      :: AxisRe(:)         !< Cached frequencies and directions
+      REAL(ReKi),       ALLOCATABLE                      :: SecRe(:,:,:)      !< One DataSet(:,:,:,I,J) section of the cached reals
+      INTEGER(IntKi),   ALLOCATABLE                      :: SecInt(:,:,:)     !< One DataMask(:,:,:,I,J) section of the cached integers
+      INTEGER(IntKi)                                     :: Flags(17)         !< Cached sizes and flags (the first cached integers)
+      INTEGER(IntKi)                                     :: NumVal(3)         !< Numbers of cached reals, doubles, and integers
+      INTEGER(B8Ki)                                      :: PosVal(3)         !< File positions of the cached reals, doubles, and integers
+      INTEGER(IntKi)                                     :: NData             !< Number of elements of DataSet
+      INTEGER(IntKi)                                     :: NFreq1            !< Number of frequencies in the first  set
+      INTEGER(IntKi)                                     :: NFreq2            !< Number of frequencies in the second set
+      INTEGER(IntKi)                                     :: NDir1             !< Number of wave directions in the first  set
+      INTEGER(IntKi)                                     :: NDir2             !< Number of wave directions in the second set
+      INTEGER(IntKi),   ALLOCATABLE                      :: MsgInt(:)         !< Packed warnings from reading the datafile
+      INTEGER(IntKi)                                     :: UnCache           !< Unit number of the cache file being read or written
+      INTEGER(IntKi)                                     :: IOS               !< I/O status of reading or writing the cache file
+      INTEGER(IntKi)                                     :: I                 !< Generic index of the second wave direction
+      INTEGER(IntKi)                                     :: J                 !< Generic index of the load component
+      CHARACTER(1024)                                    :: TmpFile           !< Name of the temporary cache file
+
+            ! Error handling temporary variables
+      INTEGER(IntKi)                                     :: ErrStatTmp        !< Temporary variable for the local error status
+      CHARACTER(2048)                                    :: ErrMsgTmp         !< Temporary error message variable
+      INTEGER(IntKi)                                     :: ErrStatCache      !< Error status stored in the cache file
+      CHARACTER(2048)                                    :: ErrMsgCache       !< Error message stored in the cache file
+      CHARACTER(*), PARAMETER                            :: RoutineName = 'Read_CachedFile4D'
+
+
+      ErrStat  = ErrID_None
+      ErrMsg   = ""
+
+      CALL W2_CacheKey( Filename4D, 4, Data4D%IsSumForce, CacheFile, KeyRe, KeyDb, KeyInt )
+      CacheHit = .FALSE.
+      UnCache  = -1
+      IF ( LEN_TRIM(CacheFile) > 0 ) CALL HDCache_ReadBegin( CacheFile, KeyRe, KeyDb, KeyInt, NumVal, UnCache, PosVal, CacheHit )
+
+         ! Read the sizes and flags at the start of the cached integers, making sure the sizes are consistent
+      IOS = 0
+      IF ( CacheHit ) THEN
+         CacheHit = NumVal(2) == 0 .AND. NumVal(3) >= SIZE(Flags)
+         IF ( CacheHit ) READ (UnCache, POS=PosVal(3), IOSTAT=IOS)  Flags
+         CacheHit = CacheHit .AND. IOS == 0
+      END IF
+      IF ( CacheHit ) THEN
+         NFreq1   = Flags(1)
+         NFreq2   = Flags(2)
+         NDir1    = Flags(3)
+         NDir2    = Flags(4)
+         NData    = NFreq1*NFreq2*NDir1*NDir2*6
+         CacheHit = NFreq1 > 0 .AND. NFreq2 > 0 .AND. NDir1 > 0 .AND. NDir2 > 0
+         IF ( CacheHit ) CacheHit = NumVal(3) > SIZE(Flags) + NData .AND. NumVal(1) == NFreq1 + NFreq2 + NDir1 + NDir2 + 2*NData
+      END IF
+      IF ( CacheHit ) THEN
+         ALLOCATE( Data4D%WvFreq1(NFreq1), Data4D%WvFreq2(NFreq2), Data4D%WvDir1(NDir1), Data4D%WvDir2(NDir2),             &
+                   Data4D%DataSet(NFreq1,NFreq2,NDir1,NDir2,6), Data4D%DataMask(NFreq1,NFreq2,NDir1,NDir2,6),             &
+                   AxisRe(NFreq1+NFreq2+NDir1+NDir2), SecRe(NFreq1,NFreq2,NDir1), SecInt(NFreq1,NFreq2,NDir1),             &
+                   MsgInt(NumVal(3)-SIZE(Flags)-NData), STAT=ErrStatTmp )
+         CacheHit = ErrStatTmp == 0
+      END IF
+
+         ! Read the data back in the order it is written below, straight into the DataSet(:,:,:,I,J) and DataMask(:,:,:,I,J)
+         ! sections, so only one section of the cached values is held at a time.
+      IF ( CacheHit ) THEN
+         READ (UnCache, POS=PosVal(1), IOSTAT=IOS)  AxisRe
+         DO J = 1,6
+            DO I = 1,NDir2
+               IF ( IOS == 0 ) READ (UnCache, IOSTAT=IOS)  SecRe
+               IF ( IOS == 0 ) Data4D%DataSet(:,:,:,I,J) = CMPLX( SecRe, 0.0_ReKi, SiKi )
+            END DO
+         END DO
+         DO J = 1,6
+            DO I = 1,NDir2
+               IF ( IOS == 0 ) READ (UnCache, IOSTAT=IOS)  SecRe
+               IF ( IOS == 0 ) Data4D%DataSet(:,:,:,I,J) = CMPLX( REAL( Data4D%DataSet(:,:,:,I,J) ), SecRe, SiKi )
+            END DO
+         END DO
+         IF ( IOS == 0 ) READ (UnCache, POS=PosVal(3), IOSTAT=IOS)  Flags
+         DO J = 1,6
+            DO I = 1,NDir2
+               IF ( IOS == 0 ) READ (UnCache, IOSTAT=IOS)  SecInt
+               IF ( IOS == 0 ) Data4D%DataMask(:,:,:,I,J) = SecInt /= 0
+            END DO
+         END DO
+         IF ( IOS == 0 ) READ (UnCache, IOSTAT=IOS)  MsgInt
+         CacheHit = IOS == 0
+         IF ( CacheHit ) CALL HDCache_UnPackMsg( MsgInt, ErrStatCache, ErrMsgCache, CacheHit )
+      END IF
+      CALL HDCache_ReadEnd( UnCache )
+
+      IF ( CacheHit ) THEN
+         Data4D%NumWvFreq1         = NFreq1
+         Data4D%NumWvFreq2         = NFreq2
+         Data4D%NumWvDir1          = NDir1
+         Data4D%NumWvDir2          = NDir2
+         Data4D%WvFreqDiagComplete = Flags(5) /= 0
+         Data4D%DataIsSparse       = Flags( 6:11) /= 0
+         Data4D%LoadComponents     = Flags(12:17) /= 0
+         Data4D%WvFreq1            = REAL( AxisRe(1:NFreq1), SiKi )
+         Data4D%WvFreq2            = REAL( AxisRe(NFreq1+1:NFreq1+NFreq2), SiKi )
+         Data4D%WvDir1             = REAL( AxisRe(NFreq1+NFreq2+1:NFreq1+NFreq2+NDir1), SiKi )
+         Data4D%WvDir2             = REAL( AxisRe(NFreq1+NFreq2+NDir1+1:), SiKi )
+         CALL WrScr( ' Reading the processed 2nd order WAMIT file "'//TRIM(Filename4D)//'" from "'//TRIM(CacheFile)//'".' )
+         ErrStat = ErrStatCache
+         ErrMsg  = ErrMsgCache
+         RETURN
+      END IF
+      IF ( ALLOCATED(Data4D%WvFreq1)  )  DEALLOCATE(Data4D%WvFreq1)
+      IF ( ALLOCATED(Data4D%WvFreq2)  )  DEALLOCATE(Data4D%WvFreq2)
+      IF ( ALLOCATED(Data4D%WvDir1)   )  DEALLOCATE(Data4D%WvDir1)
+      IF ( ALLOCATED(Data4D%WvDir2)   )  DEALLOCATE(Data4D%WvDir2)
+      IF ( ALLOCATED(Data4D%DataSet)  )  DEALLOCATE(Data4D%DataSet)
+      IF ( ALLOCATED(Data4D%DataMask) )  DEALLOCATE(Data4D%DataMask)
+
+
+      CALL Read_DataFile4D( Filename4D, Data4D, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev .OR. LEN_TRIM(CacheFile) == 0 ) RETURN
+
+         ! Write the same layout as HDCache_Write would for the packed arrays, one DataSet(:,:,:,I,J) section at a time, in the
+         ! order of the packed arrays: the reals (the frequencies and directions, and the real and imaginary parts of DataSet),
+         ! then the integers (the flags, DataMask, and the warnings).
+      NData    = SIZE(Data4D%DataSet)
+      MsgInt   = HDCache_PackMsg( ErrStat, ErrMsg )
+      CALL HDCache_WriteBegin( CacheFile, KeyRe, KeyDb, KeyInt,                                                         &
+                                (/ SIZE(Data4D%WvFreq1) + SIZE(Data4D%WvFreq2) + SIZE(Data4D%WvDir1) + SIZE(Data4D%WvDir2) + 2*NData, &
+                                   0, 17 + NData + SIZE(MsgInt) /), UnCache, TmpFile, ErrStatTmp, ErrMsgTmp )
+      CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, RoutineName )
+      IF ( UnCache < 0 ) RETURN
+
+      WRITE (UnCache, IOSTAT=IOS)  REAL( Data4D%WvFreq1, ReKi ), REAL( Data4D%WvFreq2, ReKi ), REAL( Data4D%WvDir1, ReKi ), &
+                                   REAL( Data4D%WvDir2,  ReKi )
+      DO J = 1,6
+         DO I = 1,Data4D%NumWvDir2
+            IF ( IOS == 0 ) WRITE (UnCache, IOSTAT=IOS)  REAL( REAL ( Data4D%DataSet(:,:,:,I,J) ), ReKi )
+         END DO
+      END DO
+      DO J = 1,6
+         DO I = 1,Data4D%NumWvDir2
+            IF ( IOS == 0 ) WRITE (UnCache, IOSTAT=IOS)  REAL( AIMAG( Data4D%DataSet(:,:,:,I,J) ), ReKi )
+         END DO
+      END DO
+      IF ( IOS == 0 ) WRITE (UnCache, IOSTAT=IOS)  Data4D%NumWvFreq1, Data4D%NumWvFreq2, Data4D%NumWvDir1, Data4D%NumWvDir2,   &
+                                                   MERGE( 1_IntKi, 0_IntKi, Data4D%WvFreqDiagComplete ),                      &
+                                                   MERGE( 1_IntKi, 0_IntKi, Data4D%DataIsSparse ),                            &
+                                                   MERGE( 1_IntKi, 0_IntKi, Data4D%LoadComponents )
+      DO J = 1,6
+         DO I = 1,Data4D%NumWvDir2
+            IF ( IOS == 0 ) WRITE (UnCache, IOSTAT=IOS)  MERGE( 1_IntKi, 0_IntKi, Data4D%DataMask(:,:,:,I,J) )
+         END DO
+      END DO
+      IF ( IOS == 0 ) WRITE (UnCache, IOSTAT=IOS)  MsgInt
+
+      CALL HDCache_WriteEnd( CacheFile, UnCache, TmpFile, IOS, ErrStatTmp, ErrMsgTmp )
+      CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, RoutineName )
+
+   END SUBROUTINE Read_CachedFile4D
+
+
+   !-------------------------------------------------------------------------------------------------------------------------------
+   !> This routine returns the name of the cache file and its key for a 2nd order WAMIT datafile.  The key holds the checksum of
+   !! the datafile and the inputs used to redimensionalize the data.  CacheFile is empty if InitInp%WvCacheDir is not set or the
+   !! datafile can't be read (Read_DataFile3D or Read_DataFile4D report the error).
+   SUBROUTINE W2_CacheKey( Filename, NumDims, IsSumForce, CacheFile, KeyRe, KeyDb, KeyInt )
+
+      IMPLICIT NONE
+
+         ! Passed variables.
+      CHARACTER(*),                       INTENT(IN   )  :: Filename          !< Name of the datafile
+      INTEGER(IntKi),                     INTENT(IN   )  :: NumDims           !< 3 or 4 for the 3D or 4D data
+      LOGICAL,                            INTENT(IN   )  :: IsSumForce        !< Whether the 4D data is sum frequency data
+      CHARACTER(*),                       INTENT(  OUT)  :: CacheFile         !< Name of the cache file; empty if not cached
+      REAL(ReKi),       ALLOCATABLE,      INTENT(  OUT)  :: KeyRe(:)          !< Packed reals    of the cache key
+      REAL(DbKi),       ALLOCATABLE,      INTENT(  OUT)  :: KeyDb(:)          !< Packed doubles  of the cache key (not used)
+      INTEGER(IntKi),   ALLOCATABLE,      INTENT(  OUT)  :: KeyInt(:)         !< Packed integers of the cache key
+
+         ! Local variables
+      INTEGER(IntKi)                                     :: Checksum(2)       !< Checksum of the datafile
+      LOGICAL                                            :: Found             !< Whether the datafile could be read
+
+
+      CacheFile = ""
+      IF ( LEN_TRIM( InitInp%WvCacheDir ) == 0 ) RETURN
+
+      CALL HDCache_FileChecksum( Filename, Checksum, Found )
+      IF ( .NOT. Found ) RETURN
+
+      KeyRe     = (/ InitInp%RhoXg, InitInp%WAMITULEN /)
+      KeyInt    = (/ NumDims, MERGE( 1, 0, IsSumForce ), Checksum /)
+      CacheFile = HDCache_FileName( InitInp%WvCacheDir, 'WAMIT2', KeyRe, KeyDb, KeyInt )
+
+   END SUBROUTINE W2_CacheKey
+
+
    !-------------------------------------------------------------------------------------------------------------------------------
    !> This routine reads in the datafile containing 3D data (Omega, WaveDir1, WaveDir2), stores it to Data3D, and sets flags
    !! indicating how complete the data is.
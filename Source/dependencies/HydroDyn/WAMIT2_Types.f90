@@ -38,6 +38,7 @@ IMPLICIT NONE
   TYPE, PUBLIC :: WAMIT2_InitInputType
     LOGICAL  :: HasWAMIT      !< .TRUE. if using WAMIT model, .FALSE. otherwise [-]
     CHARACTER(1024)  :: WAMITFile      !< Root of the filename for WAMIT2 outputs [-]
+    CHARACTER(1024)  :: WvCacheDir      !< Directory of the cache files (for the processed WAMIT 2nd order output); empty for no cache [-]
     INTEGER(IntKi)  :: UnSum      !< The unit number for the HydroDyn summary file [-]
     REAL(ReKi)  :: WAMITULEN      !< WAMIT unit length scale [-]
     REAL(ReKi)  :: RhoXg      !< Density * Gravity -- from the Waves module. [-]
@@ -164,6 +165,7 @@ CONTAINS
    ErrMsg  = ""
     DstInitInputData%HasWAMIT = SrcInitInputData%HasWAMIT
     DstInitInputData%WAMITFile = SrcInitInputData%WAMITFile
+    DstInitInputData%WvCacheDir = SrcInitInputData%WvCacheDir
     DstInitInputData%UnSum = SrcInitInputData%UnSum
     DstInitInputData%WAMITULEN = SrcInitInputData%WAMITULEN
     DstInitInputData%RhoXg = SrcInitInputData%RhoXg
@@ -297,6 +299,7 @@ ENDIF
   Int_BufSz  = 0
       Int_BufSz  = Int_BufSz  + 1  ! HasWAMIT
       Int_BufSz  = Int_BufSz  + 1*LEN(InData%WAMITFile)  ! WAMITFile
+      Int_BufSz  = Int_BufSz  + 1*LEN(InData%WvCacheDir)  ! WvCacheDir
       Int_BufSz  = Int_BufSz  + 1  ! UnSum
       Re_BufSz   = Re_BufSz   + 1  ! WAMITULEN
       Re_BufSz   = Re_BufSz   + 1  ! RhoXg
@@ -381,6 +384,10 @@ ENDIF
           IntKiBuf(Int_Xferred) = ICHAR(InData%WAMITFile(I:I), IntKi)
           Int_Xferred = Int_Xferred   + 1
         END DO ! I
+        DO I = 1, LEN(InData%WvCacheDir)
+          IntKiBuf(Int_Xferred) = ICHAR(InData%WvCacheDir(I:I), IntKi)
+          Int_Xferred = Int_Xferred   + 1
+        END DO ! I
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%UnSum
       Int_Xferred   = Int_Xferred   + 1
       ReKiBuf ( Re_Xferred:Re_Xferred+(1)-1 ) = InData%WAMITULEN
@@ -541,6 +548,10 @@ ENDIF
         OutData%WAMITFile(I:I) = CHAR(IntKiBuf(Int_Xferred))
         Int_Xferred = Int_Xferred   + 1
       END DO ! I
+      DO I = 1, LEN(OutData%WvCacheDir)
+        OutData%WvCacheDir(I:I) = CHAR(IntKiBuf(Int_Xferred))
+        Int_Xferred = Int_Xferred   + 1
+      END DO ! I
       OutData%UnSum = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
       OutData%WAMITULEN = ReKiBuf( Re_Xferred )
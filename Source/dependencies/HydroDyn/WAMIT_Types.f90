@@ -47,6 +47,7 @@ IMPLICIT NONE
     INTEGER(IntKi)  :: RdtnMod      !<  [-]
     REAL(DbKi)  :: RdtnTMax      !<  [-]
     CHARACTER(1024)  :: WAMITFile      !<  [-]
+    CHARACTER(1024)  :: WvCacheDir      !< Directory of the cache files (for the processed WAMIT output); empty for no cache [-]
     TYPE(Conv_Rdtn_InitInputType)  :: Conv_Rdtn      !<  [-]
     TYPE(SS_Rad_InitInputType)  :: SS_Rdtn      !<  [-]
     REAL(ReKi)  :: Rhoxg      !<  [-]
@@ -177,6 +178,7 @@ CONTAINS
     DstInitInputData%RdtnMod = SrcInitInputData%RdtnMod
     DstInitInputData%RdtnTMax = SrcInitInputData%RdtnTMax
     DstInitInputData%WAMITFile = SrcInitInputData%WAMITFile
+    DstInitInputData%WvCacheDir = SrcInitInputData%WvCacheDir
       CALL Conv_Rdtn_CopyInitInput( SrcInitInputData%Conv_Rdtn, DstInitInputData%Conv_Rdtn, CtrlCode, ErrStat2, ErrMsg2 )
          CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
          IF (ErrStat>=AbortErrLev) RETURN
@@ -299,6 +301,7 @@ ENDIF
       Int_BufSz  = Int_BufSz  + 1  ! RdtnMod
       Db_BufSz   = Db_BufSz   + 1  ! RdtnTMax
       Int_BufSz  = Int_BufSz  + 1*LEN(InData%WAMITFile)  ! WAMITFile
+      Int_BufSz  = Int_BufSz  + 1*LEN(InData%WvCacheDir)  ! WvCacheDir
    ! Allocate buffers for subtypes, if any (we'll get sizes from these) 
       Int_BufSz   = Int_BufSz + 3  ! Conv_Rdtn: size of buffers for each call to pack subtype
       CALL Conv_Rdtn_PackInitInput( Re_Buf, Db_Buf, Int_Buf, InData%Conv_Rdtn, ErrStat2, ErrMsg2, .TRUE. ) ! Conv_Rdtn 
@@ -405,6 +408,10 @@ ENDIF
           IntKiBuf(Int_Xferred) = ICHAR(InData%WAMITFile(I:I), IntKi)
           Int_Xferred = Int_Xferred   + 1
         END DO ! I
+        DO I = 1, LEN(InData%WvCacheDir)
+          IntKiBuf(Int_Xferred) = ICHAR(InData%WvCacheDir(I:I), IntKi)
+          Int_Xferred = Int_Xferred   + 1
+        END DO ! I
       CALL Conv_Rdtn_PackInitInput( Re_Buf, Db_Buf, Int_Buf, InData%Conv_Rdtn, ErrStat2, ErrMsg2, OnlySize ) ! Conv_Rdtn 
         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
         IF (ErrStat >= AbortErrLev) RETURN
@@ -583,6 +590,10 @@ ENDIF
         OutData%WAMITFile(I:I) = CHAR(IntKiBuf(Int_Xferred))
         Int_Xferred = Int_Xferred   + 1
       END DO ! I
+      DO I = 1, LEN(OutData%WvCacheDir)
+        OutData%WvCacheDir(I:I) = CHAR(IntKiBuf(Int_Xferred))
+        Int_Xferred = Int_Xferred   + 1
+      END DO ! I
       Buf_size=IntKiBuf( Int_Xferred )
       Int_Xferred = Int_Xferred + 1
       IF(Buf_size > 0) THEN
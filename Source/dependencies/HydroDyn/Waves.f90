@@ -30,6 +30,8 @@ MODULE Waves
    USE UserWaves
    USE NWTC_Library
    USE NWTC_FFTPACK
+   USE HydroDyn_Cache
+!$ USE OMP_LIB
       
    IMPLICIT NONE
    
@@ -37,11 +39,17 @@ MODULE Waves
 
    TYPE(ProgDesc), PARAMETER            :: Waves_ProgDesc = ProgDesc( 'Waves', 'v1.01.00', '23-Dec-2015' )
 
+   INTEGER(IntKi), PARAMETER            :: WvKinWinSize   = 4                    ! Number of time slices held by the on-demand wave kinematics (WvKinMod = 1); Morison uses two consecutive slices per call
+
    
       ! ..... Public Subroutines ...................................................................................................
    PUBLIC :: WavePkShpDefault                     ! Return the default value of the peak shape parameter of the incident wave spectrum
    PUBLIC :: Waves_Init                           ! Initialization routine
    PUBLIC :: Waves_End                            ! Ending routine (includes clean up)
+   PUBLIC :: Waves_GetKinSlice                    ! Return a time slice of the on-demand wave kinematics (WvKinMod = 1)
+   PUBLIC :: Waves_MoveKinProvider                ! Move the on-demand wave kinematics (WvKinMod = 1) to another variable without copying them
+   PUBLIC :: Waves_InitThreadFFTs                 ! Initialize one instance of the FFT module for each OpenMP thread
+   PUBLIC :: Waves_ExitThreadFFTs                 ! Clean up the instances of the FFT module from Waves_InitThreadFFTs
             
    
    PRIVATE:: WheelerStretching                    ! This FUNCTION applies the principle of Wheeler stretching to (1-Forward) find the elevation where the wave kinematics are to be applied using Wheeler stretching or (2-Backword)   
@@ -51,6 +59,9 @@ MODULE Waves
    PRIVATE:: UserWaveSpctrm   
    PRIVATE:: StillWaterWaves_Init
    PRIVATE:: VariousWaves_Init
+   PRIVATE:: WaveKinProvider_Init
+   PRIVATE:: WaveKinSlice_Synth
+   PRIVATE:: WavesCache_Key
   ! PRIVATE:: WhiteNoiseWaves_Init
 
 CONTAINS
@@ -771,6 +782,9 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, ErrStat, ErrMsg )
    COMPLEX(SiKi)                :: tmpComplex                                      ! A temporary varible to hold the complex value of the wave elevation before storing it into a REAL array
    COMPLEX(SiKi),ALLOCATABLE    :: tmpComplexArr(:)                                ! A temporary array (0:NStepWave2-1) for FFT use. 
    TYPE(FFT_DataType)           :: FFT_Data                                        ! the instance of the FFT module we're using
+   TYPE(FFT_DataType),ALLOCATABLE :: FFT_Thread(:)                                 ! the instances of the FFT module used by each thread for the wave kinematics (0:NThreads-1)
+   INTEGER(IntKi)               :: iThread                                         ! Index of the current OpenMP thread (0 without OpenMP)
+   INTEGER(IntKi)               :: ErrStatFFT                                      ! Highest error status of the FFTs of the wave kinematics
 
       ! Variables for mult-direction waves
    INTEGER(IntKi)               :: WaveNDirMax                                     !< Maximum value we can change WaveNDir to (relative to original value passed in). Used in finding new WaveNDir value.
@@ -1043,26 +1057,30 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, ErrStat, ErrMsg )
       ALLOCATE ( WaveElevC         (0:InitOut%NStepWave2 ,InitInp%NWaveElev), STAT=ErrStatTmp )
       IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveElevC.',         ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveDynPC0        (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveDynPC0.',        ErrStat,ErrMsg,'VariousWaves_Init')
+      IF ( InitInp%WvKinMod /= 1 ) THEN   ! The kinematics at the points are synthesized on demand by Waves_GetKinSlice for WvKinMod = 1
+
+         ALLOCATE ( WaveDynPC0        (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveDynPC0.',        ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveVelC0Hxi      (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVelC0Hxi.',      ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveVelC0Hxi      (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVelC0Hxi.',      ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveVelC0Hyi      (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVelC0Hyi.',      ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveVelC0Hyi      (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVelC0Hyi.',      ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveVelC0V        (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVelC0V.',        ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveVelC0V        (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVelC0V.',        ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveAccC0Hxi      (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAccC0Hxi.',      ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveAccC0Hxi      (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAccC0Hxi.',      ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveAccC0Hyi      (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAccC0Hyi.',      ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveAccC0Hyi      (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAccC0Hyi.',      ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveAccC0V        (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAccC0V.',        ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveAccC0V        (0:InitOut%NStepWave2 ,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAccC0V.',        ErrStat,ErrMsg,'VariousWaves_Init')
+
+      END IF
 
       !ALLOCATE ( PWaveDynPC0BPz0   (0:InitOut%NStepWave2 ,InitInp%NWaveKin   ), STAT=ErrStatTmp )
       !IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array PWaveDynPC0BPz0.',   ErrStat,ErrMsg,'VariousWaves_Init')
@@ -1091,26 +1109,30 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, ErrStat, ErrMsg )
       ALLOCATE ( InitOut%WaveElev  (0:InitOut%NStepWave,InitInp%NWaveElev  ), STAT=ErrStatTmp )
       IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%WaveElev.',  ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveDynP0B        (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveDynP0B.',        ErrStat,ErrMsg,'VariousWaves_Init')
+      IF ( InitInp%WvKinMod /= 1 ) THEN
 
-      ALLOCATE ( WaveVel0Hxi       (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVel0Hxi.',       ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveDynP0B        (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveDynP0B.',        ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveVel0Hyi       (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVel0Hyi.',       ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveVel0Hxi       (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVel0Hxi.',       ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveVel0V         (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVel0V.',         ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveVel0Hyi       (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVel0Hyi.',       ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveAcc0Hxi       (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAcc0Hxi.',       ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveVel0V         (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveVel0V.',         ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveAcc0Hyi       (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAcc0Hyi.',       ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveAcc0Hxi       (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAcc0Hxi.',       ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( WaveAcc0V         (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAcc0V.',         ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( WaveAcc0Hyi       (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAcc0Hyi.',       ErrStat,ErrMsg,'VariousWaves_Init')
+
+         ALLOCATE ( WaveAcc0V         (0:InitOut%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveAcc0V.',         ErrStat,ErrMsg,'VariousWaves_Init')
+
+      END IF
 
       !ALLOCATE ( PWaveDynP0BPz0    (0:InitOut%NStepWave-1,InitInp%NWaveKin   ), STAT=ErrStatTmp )
       !IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array PWaveDynP0BPz0.',    ErrStat,ErrMsg,'VariousWaves_Init')
@@ -1133,27 +1155,36 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, ErrStat, ErrMsg )
       !ALLOCATE ( PWaveAcc0VPz0     (0:InitOut%NStepWave-1,InitInp%NWaveKin ), STAT=ErrStatTmp )
       !IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array PWaveAcc0VPz0.',     ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( InitOut%WaveDynP (0:InitOut%NStepWave,InitInp%NWaveKin  ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%WaveDynP.', ErrStat,ErrMsg,'VariousWaves_Init')
+      IF ( InitInp%WvKinMod /= 1 ) THEN
+
+         ALLOCATE ( InitOut%WaveDynP (0:InitOut%NStepWave,InitInp%NWaveKin  ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%WaveDynP.', ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( InitOut%WaveVel  (0:InitOut%NStepWave,InitInp%NWaveKin,3), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%WaveVel.',  ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( InitOut%WaveVel  (0:InitOut%NStepWave,InitInp%NWaveKin,3), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%WaveVel.',  ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( InitOut%WaveAcc  (0:InitOut%NStepWave,InitInp%NWaveKin,3), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%WaveAcc.',  ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( InitOut%WaveAcc  (0:InitOut%NStepWave,InitInp%NWaveKin,3), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%WaveAcc.',  ErrStat,ErrMsg,'VariousWaves_Init')
       
-      ALLOCATE ( InitOut%PWaveDynP0 (0:InitOut%NStepWave,InitInp%NWaveKin  ), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%PWaveDynP0.', ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( InitOut%PWaveDynP0 (0:InitOut%NStepWave,InitInp%NWaveKin  ), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%PWaveDynP0.', ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( InitOut%PWaveVel0  (0:InitOut%NStepWave,InitInp%NWaveKin,3), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%PWaveVel0.',  ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( InitOut%PWaveVel0  (0:InitOut%NStepWave,InitInp%NWaveKin,3), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%PWaveVel0.',  ErrStat,ErrMsg,'VariousWaves_Init')
 
-      ALLOCATE ( InitOut%PWaveAcc0  (0:InitOut%NStepWave,InitInp%NWaveKin,3), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%PWaveAcc0.',  ErrStat,ErrMsg,'VariousWaves_Init')
+         ALLOCATE ( InitOut%PWaveAcc0  (0:InitOut%NStepWave,InitInp%NWaveKin,3), STAT=ErrStatTmp )
+         IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%PWaveAcc0.',  ErrStat,ErrMsg,'VariousWaves_Init')
+
+      END IF
       
       
 
-      ALLOCATE ( InitOut%nodeInWater(0:InitOut%NStepWave,InitInp%NWaveKin  ) , STAT=ErrStatTmp )
+         ! Without stretching, nodeInWater doesn't vary in time, so only one time step is stored for the on-demand kinematics.
+      IF ( InitInp%WvKinMod == 1 ) THEN
+         ALLOCATE ( InitOut%nodeInWater(0:0,InitInp%NWaveKin                ) , STAT=ErrStatTmp )
+      ELSE
+         ALLOCATE ( InitOut%nodeInWater(0:InitOut%NStepWave,InitInp%NWaveKin) , STAT=ErrStatTmp )
+      END IF
       IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array InitOut%nodeInWater.',  ErrStat,ErrMsg,'VariousWaves_Init')
       
          ! Wave direction associated with each frequency
@@ -1680,68 +1711,75 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, ErrStat, ErrMsg )
       !!   incident waves at each desired point on the still water level plane
       !!   where it can be output:
 
-      DO I = 0,InitOut%NStepWave2  ! Loop through the positive frequency components (including zero) of the discrete Fourier transforms
+      IF ( InitInp%WvKinMod /= 1 ) THEN   ! The transfer functions are evaluated by Waves_GetKinSlice for WvKinMod = 1
+
+            ! The frequency components are independent, so they are split among the threads.
+         !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(I, J, tmpComplex, Omega, ImagOmega, WaveNmbr, WaveElevxiPrime0) SCHEDULE(STATIC)
+         DO I = 0,InitOut%NStepWave2  ! Loop through the positive frequency components (including zero) of the discrete Fourier transforms
 
       
-            ! Set tmpComplex to the Ith element of the WAveElevC0 array
+               ! Set tmpComplex to the Ith element of the WAveElevC0 array
 
-         tmpComplex  = CMPLX(  InitOut%WaveElevC0(1,I),   InitOut%WaveElevC0(2,I))
+            tmpComplex  = CMPLX(  InitOut%WaveElevC0(1,I),   InitOut%WaveElevC0(2,I))
          
 
-      ! Compute the frequency of this component and its imaginary value:
+         ! Compute the frequency of this component and its imaginary value:
 
-             Omega = I*       InitOut%WaveDOmega
-         ImagOmega = ImagNmbr*Omega
+                Omega = I*       InitOut%WaveDOmega
+            ImagOmega = ImagNmbr*Omega
 
-      ! Compute the wavenumber:  
+         ! Compute the wavenumber:  
 
-         WaveNmbr   = WaveNumber ( Omega, InitInp%Gravity, InitInp%WtrDpth )
+            WaveNmbr   = WaveNumber ( Omega, InitInp%Gravity, InitInp%WtrDpth )
          
 
-      ! Compute the discrete Fourier transform of the incident wave kinematics
-      !   before applying stretching at the zi-coordinates for the WAMIT reference point, and all
-      !   points where are Morison loads will be calculated.
+         ! Compute the discrete Fourier transform of the incident wave kinematics
+         !   before applying stretching at the zi-coordinates for the WAMIT reference point, and all
+         !   points where are Morison loads will be calculated.
 
-         DO J = 1,NWaveKin0Prime ! Loop through all points where the incident wave kinematics will be computed without stretching
+            DO J = 1,NWaveKin0Prime ! Loop through all points where the incident wave kinematics will be computed without stretching
 
-            WaveElevxiPrime0 = EXP( -ImagNmbr*WaveNmbr*( InitInp%WaveKinxi(WaveKinPrimeMap(J))*CosWaveDir(I) + &
-               InitInp%WaveKinyi(WaveKinPrimeMap(J))*SinWaveDir(I) ))
+               WaveElevxiPrime0 = EXP( -ImagNmbr*WaveNmbr*( InitInp%WaveKinxi(WaveKinPrimeMap(J))*CosWaveDir(I) + &
+                  InitInp%WaveKinyi(WaveKinPrimeMap(J))*SinWaveDir(I) ))
                                                            
-            WaveDynPC0 (I,J)     = InitOut%RhoXg*tmpComplex*WaveElevxiPrime0 * COSHNumOvrCOSHDen ( WaveNmbr, InitInp%WtrDpth, WaveKinzi0Prime(J) )       
+               WaveDynPC0 (I,J)     = InitOut%RhoXg*tmpComplex*WaveElevxiPrime0 * COSHNumOvrCOSHDen ( WaveNmbr, InitInp%WtrDpth, WaveKinzi0Prime(J) )       
              
-            WaveVelC0Hxi (I,J)   = CosWaveDir(I)*Omega*tmpComplex* WaveElevxiPrime0 * COSHNumOvrSINHDen ( WaveNmbr, InitInp%WtrDpth, WaveKinzi0Prime(J) )
-            WaveVelC0Hyi (I,J)   = SinWaveDir(I)*Omega*tmpComplex* WaveElevxiPrime0 * COSHNumOvrSINHDen ( WaveNmbr, InitInp%WtrDpth, WaveKinzi0Prime(J) )
+               WaveVelC0Hxi (I,J)   = CosWaveDir(I)*Omega*tmpComplex* WaveElevxiPrime0 * COSHNumOvrSINHDen ( WaveNmbr, InitInp%WtrDpth, WaveKinzi0Prime(J) )
+               WaveVelC0Hyi (I,J)   = SinWaveDir(I)*Omega*tmpComplex* WaveElevxiPrime0 * COSHNumOvrSINHDen ( WaveNmbr, InitInp%WtrDpth, WaveKinzi0Prime(J) )
              
-            WaveVelC0V (I,J)     =           ImagOmega*tmpComplex* WaveElevxiPrime0 * SINHNumOvrSINHDen ( WaveNmbr, InitInp%WtrDpth, WaveKinzi0Prime(J) )
-            WaveAccC0Hxi (I,J)   = ImagOmega*        WaveVelC0Hxi (I,J)
+               WaveVelC0V (I,J)     =           ImagOmega*tmpComplex* WaveElevxiPrime0 * SINHNumOvrSINHDen ( WaveNmbr, InitInp%WtrDpth, WaveKinzi0Prime(J) )
+               WaveAccC0Hxi (I,J)   = ImagOmega*        WaveVelC0Hxi (I,J)
               
-            WaveAccC0Hyi (I,J)   = ImagOmega*        WaveVelC0Hyi (I,J)
-            WaveAccC0V (I,J)     = ImagOmega*        WaveVelC0V   (I,J)
+               WaveAccC0Hyi (I,J)   = ImagOmega*        WaveVelC0Hyi (I,J)
+               WaveAccC0V (I,J)     = ImagOmega*        WaveVelC0V   (I,J)
          
             
          
 
-         END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
+            END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
  
 !===================================
 ! Wave stretching
-   !     DO J = 1,InitInp%NWaveKin
-   !         WaveElevxiPrime0 = EXP( -ImagNmbr*WaveNmbr*( InitInp%WaveKinxi(J)*CosWaveDir(I) + &
-   !                                                      InitInp%WaveKinyi(J)*SinWaveDir(I) ))
-   !! Partial derivatives at zi = 0
-   !         PWaveDynPC0BPz0 (I,J) = InitOut%RhoXg*      tmpComplex*WaveElevxiPrime0*WaveNmbr*TANH ( WaveNmbr*InitInp%WtrDpth )
-   !         PWaveVelC0HxiPz0(I,J) = CosWaveDir(I)*Omega*tmpComplex*WaveElevxiPrime0*WaveNmbr
-   !         PWaveVelC0HyiPz0(I,J) = SinWaveDir(I)*Omega*tmpComplex*WaveElevxiPrime0*WaveNmbr
-   !         PWaveVelC0VPz0  (I,J) =           ImagOmega*tmpComplex*WaveElevxiPrime0*WaveNmbr*COTH ( WaveNmbr*InitInp%WtrDpth )
-   !         PWaveAccC0HxiPz0(I,J) =           ImagOmega*PWaveVelC0HxiPz0(I,J)
-   !         PWaveAccC0HyiPz0(I,J) =           ImagOmega*PWaveVelC0HyiPz0(I,J)
-   !         PWaveAccC0VPz0  (I,J) =           ImagOmega*PWaveVelC0VPz0  (I,J)
-   !      
-   !
-   !     END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
+      !     DO J = 1,InitInp%NWaveKin
+      !         WaveElevxiPrime0 = EXP( -ImagNmbr*WaveNmbr*( InitInp%WaveKinxi(J)*CosWaveDir(I) + &
+      !                                                      InitInp%WaveKinyi(J)*SinWaveDir(I) ))
+      !! Partial derivatives at zi = 0
+      !         PWaveDynPC0BPz0 (I,J) = InitOut%RhoXg*      tmpComplex*WaveElevxiPrime0*WaveNmbr*TANH ( WaveNmbr*InitInp%WtrDpth )
+      !         PWaveVelC0HxiPz0(I,J) = CosWaveDir(I)*Omega*tmpComplex*WaveElevxiPrime0*WaveNmbr
+      !         PWaveVelC0HyiPz0(I,J) = SinWaveDir(I)*Omega*tmpComplex*WaveElevxiPrime0*WaveNmbr
+      !         PWaveVelC0VPz0  (I,J) =           ImagOmega*tmpComplex*WaveElevxiPrime0*WaveNmbr*COTH ( WaveNmbr*InitInp%WtrDpth )
+      !         PWaveAccC0HxiPz0(I,J) =           ImagOmega*PWaveVelC0HxiPz0(I,J)
+      !         PWaveAccC0HyiPz0(I,J) =           ImagOmega*PWaveVelC0HyiPz0(I,J)
+      !         PWaveAccC0VPz0  (I,J) =           ImagOmega*PWaveVelC0VPz0  (I,J)
+      !      
+      !
+      !     END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
 !===================================
 
-      END DO                ! I - The positive frequency components (including zero) of the discrete Fourier transforms
+         END DO                ! I - The positive frequency components (including zero) of the discrete Fourier transforms
+         !$OMP END PARALLEL DO
+
+      END IF
       
 
 
@@ -1799,36 +1837,57 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, ErrStat, ErrMsg )
          ENDDO
       ENDIF
 
-      
-         ! User requested data points -- Do all the FFT calls first, then return if something failed.
-      DO J = 1,NWaveKin0Prime ! Loop through all points where the incident wave kinematics will be computed without stretching
-         CALL ApplyFFT_cx (          WaveDynP0B   (:,J),          WaveDynPC0    (:,J), FFT_Data, ErrStatTmp )
-         CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to WaveDynP0B.',       ErrStat,ErrMsg,'VariousWaves_Init')
-
-         CALL ApplyFFT_cx (          WaveVel0Hxi  (:,J),          WaveVelC0Hxi  (:,J), FFT_Data, ErrStatTmp )
-         CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to WaveVel0Hxi.',      ErrStat,ErrMsg,'VariousWaves_Init')
-
-         CALL ApplyFFT_cx (          WaveVel0Hyi  (:,J),          WaveVelC0Hyi  (:,J), FFT_Data, ErrStatTmp )
-         CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to WaveVel0Hyi.',      ErrStat,ErrMsg,'VariousWaves_Init')
-
-         CALL ApplyFFT_cx (          WaveVel0V    (:,J),          WaveVelC0V    (:,J), FFT_Data, ErrStatTmp )
-         CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to WaveVel0V.',        ErrStat,ErrMsg,'VariousWaves_Init')
-
-         CALL ApplyFFT_cx (          WaveAcc0Hxi  (:,J),          WaveAccC0Hxi  (:,J), FFT_Data, ErrStatTmp )
-         CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to WaveAcc0Hxi.',      ErrStat,ErrMsg,'VariousWaves_Init')
 
-         CALL ApplyFFT_cx (          WaveAcc0Hyi  (:,J),          WaveAccC0Hyi  (:,J), FFT_Data, ErrStatTmp )
-         CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to WaveAcc0Hyi.',      ErrStat,ErrMsg,'VariousWaves_Init')
-
-         CALL ApplyFFT_cx (          WaveAcc0V    (:,J),          WaveAccC0V    (:,J), FFT_Data, ErrStatTmp )
-         CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT to WaveAcc0V.',        ErrStat,ErrMsg,'VariousWaves_Init')
+         ! For the on-demand kinematics, keep only the wave spectrum; the time slices are synthesized from it by Waves_GetKinSlice.
+      IF ( InitInp%WvKinMod == 1 ) THEN
+         CALL WaveKinProvider_Init ( InitInp, InitOut, ErrStatTmp, ErrMsgTmp )
+         CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'VariousWaves_Init')
+         CALL ExitFFT(FFT_Data, ErrStatTmp)
+         CALL SetErrStat(ErrStatTmp,'Error occured while cleaning up after the FFTs.', ErrStat,ErrMsg,'VariousWaves_Init')
+         CALL CleanUp()
+         RETURN
+      END IF
 
-         IF ( ErrStat >= AbortErrLev ) THEN
-            CALL CleanUp()
-            RETURN
-         END IF
+         ! User requested data points -- Do all the FFT calls first, then return if something failed.
+         ! The points are split among the threads; FFTPACK uses the work array of the FFT instance as scratch space, so each thread
+         ! gets its own instance.
+      CALL Waves_InitThreadFFTs ( InitOut%NStepWave, .TRUE., FFT_Thread, ErrStatTmp, ErrMsgTmp )
+      CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'VariousWaves_Init')
+      IF ( ErrStat >= AbortErrLev ) THEN
+         CALL Waves_ExitThreadFFTs ( FFT_Thread, ErrStatTmp, ErrMsgTmp )
+         CALL CleanUp()
+         RETURN
+      END IF
 
+      ErrStatFFT = ErrID_None
+      !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(J, iThread, ErrStatTmp) REDUCTION(MAX:ErrStatFFT) SCHEDULE(DYNAMIC,1)
+      DO J = 1,NWaveKin0Prime ! Loop through all points where the incident wave kinematics will be computed without stretching
+         iThread = 0
+         !$ iThread = OMP_GET_THREAD_NUM()
+         CALL ApplyFFT_cx (          WaveDynP0B   (:,J),          WaveDynPC0    (:,J), FFT_Thread(iThread), ErrStatTmp )
+         ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+         CALL ApplyFFT_cx (          WaveVel0Hxi  (:,J),          WaveVelC0Hxi  (:,J), FFT_Thread(iThread), ErrStatTmp )
+         ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+         CALL ApplyFFT_cx (          WaveVel0Hyi  (:,J),          WaveVelC0Hyi  (:,J), FFT_Thread(iThread), ErrStatTmp )
+         ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+         CALL ApplyFFT_cx (          WaveVel0V    (:,J),          WaveVelC0V    (:,J), FFT_Thread(iThread), ErrStatTmp )
+         ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+         CALL ApplyFFT_cx (          WaveAcc0Hxi  (:,J),          WaveAccC0Hxi  (:,J), FFT_Thread(iThread), ErrStatTmp )
+         ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+         CALL ApplyFFT_cx (          WaveAcc0Hyi  (:,J),          WaveAccC0Hyi  (:,J), FFT_Thread(iThread), ErrStatTmp )
+         ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+         CALL ApplyFFT_cx (          WaveAcc0V    (:,J),          WaveAccC0V    (:,J), FFT_Thread(iThread), ErrStatTmp )
+         ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
       END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
+      !$OMP END PARALLEL DO
+
+      CALL SetErrStat(ErrStatFFT,'Error occured while applying the FFTs to the wave kinematics.',ErrStat,ErrMsg,'VariousWaves_Init')
+      CALL Waves_ExitThreadFFTs ( FFT_Thread, ErrStatTmp, ErrMsgTmp )
+      CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'VariousWaves_Init')
+      IF ( ErrStat >= AbortErrLev ) THEN
+         CALL CleanUp()
+         RETURN
+      END IF
  
 !===================================
       !DO J = 1,InitInp%NWaveKin ! Loop through all points where the incident wave kinematics will be computed without stretching
@@ -2104,6 +2163,341 @@ CONTAINS
 
 
 END SUBROUTINE VariousWaves_Init
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine sets up the on-demand wave kinematics (WvKinMod = 1) from the wave spectrum computed in VariousWaves_Init.  Only
+!! the frequency components with a nonzero amplitude are kept; the time slices are synthesized later by Waves_GetKinSlice.
+SUBROUTINE WaveKinProvider_Init ( InitInp, InitOut, ErrStat, ErrMsg )
+
+   TYPE(Waves_InitInputType),       INTENT(IN   )  :: InitInp     !< Input data for initialization routine
+   TYPE(Waves_InitOutputType),      INTENT(INOUT)  :: InitOut     !< Output data (WaveElevC0 and WaveDirArr must be set)
+   INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+   CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: I           ! Index of the frequency component
+   INTEGER(IntKi)                                  :: K           ! Counter of the frequency components with a nonzero amplitude
+   INTEGER(IntKi)                                  :: ErrStatTmp  ! Temporary error status
+   CHARACTER(*), PARAMETER                         :: RoutineName = 'WaveKinProvider_Init'
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   InitOut%WaveKin%NStepWave = InitOut%NStepWave
+   InitOut%WaveKin%NWaveKin  = InitInp%NWaveKin
+   InitOut%WaveKin%WtrDpth   = InitInp%WtrDpth
+   InitOut%WaveKin%RhoXg     = InitOut%RhoXg
+   InitOut%WaveKin%NFreq     = 0
+   DO I = 0,InitOut%NStepWave2
+      IF ( InitOut%WaveElevC0(1,I) /= 0.0_SiKi .OR. InitOut%WaveElevC0(2,I) /= 0.0_SiKi )  InitOut%WaveKin%NFreq = InitOut%WaveKin%NFreq + 1
+   END DO
+
+   ALLOCATE ( InitOut%WaveKin%FreqIndx  (InitOut%WaveKin%NFreq), InitOut%WaveKin%Omega     (InitOut%WaveKin%NFreq), &
+              InitOut%WaveKin%WaveNmbr  (InitOut%WaveKin%NFreq), InitOut%WaveKin%CosWaveDir(InitOut%WaveKin%NFreq), &
+              InitOut%WaveKin%SinWaveDir(InitOut%WaveKin%NFreq), InitOut%WaveKin%WaveElevC0(2,InitOut%WaveKin%NFreq), STAT=ErrStatTmp )
+   IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate the frequency components of InitOut%WaveKin.',ErrStat,ErrMsg,RoutineName)
+
+   ALLOCATE ( InitOut%WaveKin%WaveKinxi(InitInp%NWaveKin), InitOut%WaveKin%WaveKinyi(InitInp%NWaveKin), &
+              InitOut%WaveKin%WaveKinzi(InitInp%NWaveKin), InitOut%WaveKin%CurrVxi  (InitInp%NWaveKin), &
+              InitOut%WaveKin%CurrVyi  (InitInp%NWaveKin), STAT=ErrStatTmp )
+   IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate the points of InitOut%WaveKin.',ErrStat,ErrMsg,RoutineName)
+
+   ALLOCATE ( InitOut%WaveKin%WinStep(WvKinWinSize), InitOut%WaveKin%WinDynP(InitInp%NWaveKin,WvKinWinSize), &
+              InitOut%WaveKin%WinVel(3,InitInp%NWaveKin,WvKinWinSize), InitOut%WaveKin%WinAcc(3,InitInp%NWaveKin,WvKinWinSize), STAT=ErrStatTmp )
+   IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate the time-slice window of InitOut%WaveKin.',ErrStat,ErrMsg,RoutineName)
+   IF ( ErrStat >= AbortErrLev ) RETURN
+
+   K = 0
+   DO I = 0,InitOut%NStepWave2
+      IF ( InitOut%WaveElevC0(1,I) == 0.0_SiKi .AND. InitOut%WaveElevC0(2,I) == 0.0_SiKi )  CYCLE
+      K = K + 1
+      InitOut%WaveKin%FreqIndx    (K) = I
+      InitOut%WaveKin%Omega       (K) = I*InitOut%WaveDOmega
+      InitOut%WaveKin%WaveNmbr    (K) = WaveNumber ( InitOut%WaveKin%Omega(K), InitInp%Gravity, InitInp%WtrDpth )
+      InitOut%WaveKin%CosWaveDir  (K) = COS( D2R*InitOut%WaveDirArr(I) )
+      InitOut%WaveKin%SinWaveDir  (K) = SIN( D2R*InitOut%WaveDirArr(I) )
+      InitOut%WaveKin%WaveElevC0(:,K) = InitOut%WaveElevC0(:,I)
+   END DO
+
+   InitOut%WaveKin%WaveKinxi = InitInp%WaveKinxi
+   InitOut%WaveKin%WaveKinyi = InitInp%WaveKinyi
+   InitOut%WaveKin%WaveKinzi = InitInp%WaveKinzi
+
+   IF ( ALLOCATED(InitInp%CurrVxi) ) THEN
+      InitOut%WaveKin%CurrVxi = InitInp%CurrVxi
+      InitOut%WaveKin%CurrVyi = InitInp%CurrVyi
+   ELSE
+      InitOut%WaveKin%CurrVxi = 0.0_SiKi
+      InitOut%WaveKin%CurrVyi = 0.0_SiKi
+   END IF
+
+   InitOut%WaveKin%WinStep = -1     ! All slots are empty
+   InitOut%WaveKin%WinDynP = 0.0_SiKi
+   InitOut%WaveKin%WinVel  = 0.0_SiKi
+   InitOut%WaveKin%WinAcc  = 0.0_SiKi
+
+END SUBROUTINE WaveKinProvider_Init
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine returns the slot of WaveKin%WinDynP, WaveKin%WinVel, and WaveKin%WinAcc that holds the first-order wave kinematics
+!! at wave time step iStep (the kinematics repeat every WaveKin%NStepWave steps).  The slice is synthesized from the wave spectrum
+!! if it isn't already in the window.  The result equals the corresponding time step of InitOut%WaveDynP, WaveVel, and WaveAcc
+!! computed with WvKinMod = 0, apart from rounding.
+SUBROUTINE Waves_GetKinSlice ( iStep, WaveKin, iSlot, ErrStat, ErrMsg )
+
+   INTEGER(IntKi),                  INTENT(IN   )  :: iStep       !< Wave time step (0 = WaveTime(0))
+   TYPE(Waves_KinProviderType),     INTENT(INOUT)  :: WaveKin     !< On-demand wave kinematics
+   INTEGER(IntKi),                  INTENT(  OUT)  :: iSlot       !< Slot of the window holding time step iStep
+   INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+   CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: n           ! Wave time step within the wave period (0 to NStepWave-1)
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   iSlot   = 1
+
+   IF ( .NOT. ALLOCATED(WaveKin%WinStep) ) THEN
+      CALL SetErrStat(ErrID_Fatal,'The on-demand wave kinematics have not been initialized.',ErrStat,ErrMsg,'Waves_GetKinSlice')
+      RETURN
+   END IF
+
+   n     = MODULO( iStep, WaveKin%NStepWave )
+   iSlot = MOD( n, SIZE(WaveKin%WinStep) ) + 1
+
+   IF ( WaveKin%WinStep(iSlot) /= n ) THEN
+      CALL WaveKinSlice_Synth ( n, WaveKin, WaveKin%WinDynP(:,iSlot), WaveKin%WinVel(:,:,iSlot), WaveKin%WinAcc(:,:,iSlot) )
+      WaveKin%WinStep(iSlot) = n
+   END IF
+
+END SUBROUTINE Waves_GetKinSlice
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine moves the on-demand wave kinematics from Src to Dst with MOVE_ALLOC, so the frequency components, the points, and
+!! the window of time slices aren't copied.  The arrays of Src are deallocated.
+SUBROUTINE Waves_MoveKinProvider ( Src, Dst )
+
+   TYPE(Waves_KinProviderType),     INTENT(INOUT)  :: Src         !< On-demand wave kinematics to move (arrays deallocated on return)
+   TYPE(Waves_KinProviderType),     INTENT(INOUT)  :: Dst         !< On-demand wave kinematics moved from Src
+
+
+   Dst%NStepWave = Src%NStepWave
+   Dst%NWaveKin  = Src%NWaveKin
+   Dst%NFreq     = Src%NFreq
+   Dst%WtrDpth   = Src%WtrDpth
+   Dst%RhoXg     = Src%RhoXg
+
+   CALL MOVE_ALLOC( Src%FreqIndx,   Dst%FreqIndx   )
+   CALL MOVE_ALLOC( Src%Omega,      Dst%Omega      )
+   CALL MOVE_ALLOC( Src%WaveNmbr,   Dst%WaveNmbr   )
+   CALL MOVE_ALLOC( Src%CosWaveDir, Dst%CosWaveDir )
+   CALL MOVE_ALLOC( Src%SinWaveDir, Dst%SinWaveDir )
+   CALL MOVE_ALLOC( Src%WaveElevC0, Dst%WaveElevC0 )
+   CALL MOVE_ALLOC( Src%WaveKinxi,  Dst%WaveKinxi  )
+   CALL MOVE_ALLOC( Src%WaveKinyi,  Dst%WaveKinyi  )
+   CALL MOVE_ALLOC( Src%WaveKinzi,  Dst%WaveKinzi  )
+   CALL MOVE_ALLOC( Src%CurrVxi,    Dst%CurrVxi    )
+   CALL MOVE_ALLOC( Src%CurrVyi,    Dst%CurrVyi    )
+   CALL MOVE_ALLOC( Src%WinStep,    Dst%WinStep    )
+   CALL MOVE_ALLOC( Src%WinDynP,    Dst%WinDynP    )
+   CALL MOVE_ALLOC( Src%WinVel,     Dst%WinVel     )
+   CALL MOVE_ALLOC( Src%WinAcc,     Dst%WinAcc     )
+
+END SUBROUTINE Waves_MoveKinProvider
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine evaluates the inverse discrete Fourier transform of the first-order wave kinematics at a single time step by direct
+!! summation over the frequency components, using the same transfer functions as VariousWaves_Init.  The depth factors are
+!! computed here for each point and frequency component rather than stored, so the memory doesn't grow with the number of
+!! frequency components times the number of points.  No stretching is applied: points below the seabed or above the mean sea level get zero
+!! kinematics, and the current is added to the others.
+SUBROUTINE WaveKinSlice_Synth ( n, WaveKin, DynP, Vel, Acc )
+
+   INTEGER(IntKi),                  INTENT(IN   )  :: n           !< Wave time step within the wave period (0 to NStepWave-1)
+   TYPE(Waves_KinProviderType),     INTENT(IN   )  :: WaveKin     !< On-demand wave kinematics
+   REAL(SiKi),                      INTENT(  OUT)  :: DynP(:)     !< Dynamic pressure at each point (N/m^2)
+   REAL(SiKi),                      INTENT(  OUT)  :: Vel(:,:)    !< Velocity (including current) at each point (m/s)
+   REAL(SiKi),                      INTENT(  OUT)  :: Acc(:,:)    !< Acceleration at each point (m/s^2)
+
+      ! Local Variables
+   COMPLEX(DbKi)                                   :: E           ! Complex elevation of the current frequency component at the point and time step (meters)
+   REAL(DbKi)                                      :: Phase       ! Phase of the current frequency component at the time step (rad)
+   REAL(DbKi)                                      :: Wght        ! Weight of the current frequency component in the one-sided inverse transform (-)
+   REAL(DbKi)                                      :: SumDynP     ! Sums of the frequency components of the kinematics
+   REAL(DbKi)                                      :: SumVel(3)
+   REAL(DbKi)                                      :: SumAcc(3)
+   REAL(DbKi)                                      :: ReH         ! Velocity amplitude terms of the current frequency component
+   REAL(DbKi)                                      :: ImH
+   REAL(DbKi)                                      :: ReV
+   REAL(DbKi)                                      :: ImV
+   REAL(DbKi)                                      :: OmegaRe     ! Omega times the real and imaginary parts of E
+   REAL(DbKi)                                      :: OmegaIm
+   REAL(SiKi)                                      :: DpthH       ! Depth factor COSH( k*( z + h ) )/SINH( k*h ) of the horizontal velocity and acceleration (-)
+   REAL(SiKi)                                      :: DpthV       ! Depth factor SINH( k*( z + h ) )/SINH( k*h ) of the vertical velocity and acceleration (-)
+   REAL(SiKi)                                      :: zi          ! zi-coordinate of the point (meters)
+   INTEGER(IntKi)                                  :: J           ! Index of the point
+   INTEGER(IntKi)                                  :: K           ! Index of the frequency component
+
+
+   !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(J, K, zi, E, Phase, Wght, SumDynP, SumVel, SumAcc, ReH, ImH, ReV, ImV, OmegaRe, OmegaIm, DpthH, DpthV) SCHEDULE(STATIC)
+   DO J = 1,WaveKin%NWaveKin
+
+      zi = WaveKin%WaveKinzi(J)
+
+         ! NOTE: We test to 0 instead of MSL2SWL because the locations of WaveKinzi and WtrDpth have already been adjusted using MSL2SWL
+      IF ( ( zi < -WaveKin%WtrDpth ) .OR. ( zi > 0.0 ) )  THEN
+         DynP(  J) = 0.0
+         Vel (:,J) = 0.0
+         Acc (:,J) = 0.0
+         CYCLE
+      END IF
+
+      SumDynP = 0.0_DbKi
+      SumVel  = 0.0_DbKi
+      SumAcc  = 0.0_DbKi
+
+      DO K = 1,WaveKin%NFreq
+
+         IF ( WaveKin%FreqIndx(K) == 0 .OR. 2*WaveKin%FreqIndx(K) == WaveKin%NStepWave ) THEN
+            Wght = 1.0_DbKi
+         ELSE
+            Wght = 2.0_DbKi
+         END IF
+
+         Phase = TwoPi_D*REAL( MOD( INT(WaveKin%FreqIndx(K),B8Ki)*n, INT(WaveKin%NStepWave,B8Ki) ), DbKi )/WaveKin%NStepWave
+         Phase = Phase - WaveKin%WaveNmbr(K)*( WaveKin%WaveKinxi(J)*WaveKin%CosWaveDir(K) + WaveKin%WaveKinyi(J)*WaveKin%SinWaveDir(K) )
+         E     = Wght*CMPLX( WaveKin%WaveElevC0(1,K), WaveKin%WaveElevC0(2,K), DbKi )*CMPLX( COS(Phase), SIN(Phase), DbKi )
+
+         SumDynP = SumDynP + WaveKin%RhoXg*REAL(E,DbKi)*COSHNumOvrCOSHDen( WaveKin%WaveNmbr(K), WaveKin%WtrDpth, zi )
+
+         IF ( WaveKin%Omega(K) > 0.0 ) THEN
+               ! Horizontal and vertical velocity amplitudes; the acceleration is ImagNmbr*Omega times the velocity
+            OmegaRe = WaveKin%Omega(K)*REAL (E,DbKi)
+            OmegaIm = WaveKin%Omega(K)*AIMAG(E     )
+            DpthH   = COSHNumOvrSINHDen( WaveKin%WaveNmbr(K), WaveKin%WtrDpth, zi )
+            DpthV   = SINHNumOvrSINHDen( WaveKin%WaveNmbr(K), WaveKin%WtrDpth, zi )
+            ReH = OmegaRe*DpthH
+            ImH = OmegaIm*DpthH
+            ReV = OmegaRe*DpthV
+            ImV = OmegaIm*DpthV
+
+            SumVel(1) = SumVel(1) + WaveKin%CosWaveDir(K)*ReH
+            SumVel(2) = SumVel(2) + WaveKin%SinWaveDir(K)*ReH
+            SumVel(3) = SumVel(3) - ImV
+            SumAcc(1) = SumAcc(1) - WaveKin%Omega(K)*WaveKin%CosWaveDir(K)*ImH
+            SumAcc(2) = SumAcc(2) - WaveKin%Omega(K)*WaveKin%SinWaveDir(K)*ImH
+            SumAcc(3) = SumAcc(3) - WaveKin%Omega(K)*ReV
+         END IF
+
+      END DO                   ! K - All frequency components with a nonzero amplitude
+
+      DynP(  J) = SumDynP/WaveKin%NStepWave
+      Vel (1,J) = SumVel(1)/WaveKin%NStepWave + WaveKin%CurrVxi(J)
+      Vel (2,J) = SumVel(2)/WaveKin%NStepWave + WaveKin%CurrVyi(J)
+      Vel (3,J) = SumVel(3)/WaveKin%NStepWave
+      Acc (:,J) = SumAcc/WaveKin%NStepWave
+
+   END DO                      ! J - All points where the incident wave kinematics are computed
+   !$OMP END PARALLEL DO
+
+END SUBROUTINE WaveKinSlice_Synth
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine initializes one instance of the FFT module for each thread of an OpenMP parallel region (a single instance without
+!! OpenMP).  FFTPACK uses the work array of an instance as scratch space, so concurrent transforms must not share an instance; a
+!! thread uses FFT_Thread(OMP_GET_THREAD_NUM()).
+SUBROUTINE Waves_InitThreadFFTs ( N, Normalize, FFT_Thread, ErrStat, ErrMsg )
+
+   INTEGER(IntKi),                  INTENT(IN   )  :: N              !< Number of points in the transforms
+   LOGICAL,                         INTENT(IN   )  :: Normalize      !< Whether the inverse transforms are normalized (see InitFFT)
+   TYPE(FFT_DataType), ALLOCATABLE, INTENT(INOUT)  :: FFT_Thread(:)  !< Instances of the FFT module (0:NThreads-1)
+   INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat        !< Error status of the operation
+   CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg         !< Error message if ErrStat /= ErrID_None
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: NThreads       ! Number of threads of the next parallel region
+   INTEGER(IntKi)                                  :: I              ! Index of the thread
+   INTEGER(IntKi)                                  :: ErrStatTmp     ! Temporary error status
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   NThreads = 1
+   !$ NThreads = OMP_GET_MAX_THREADS()
+
+   IF ( ALLOCATED(FFT_Thread) ) DEALLOCATE(FFT_Thread)
+   ALLOCATE ( FFT_Thread(0:NThreads-1), STAT=ErrStatTmp )
+   IF ( ErrStatTmp /= 0 ) THEN
+      CALL SetErrStat(ErrID_Fatal,'Cannot allocate the FFT instances of the threads.',ErrStat,ErrMsg,'Waves_InitThreadFFTs')
+      RETURN
+   END IF
+
+   DO I = 0,NThreads-1
+      CALL InitFFT ( N, FFT_Thread(I), Normalize, ErrStatTmp )
+      CALL SetErrStat(ErrStatTmp,'Error occured while initializing the FFT.',ErrStat,ErrMsg,'Waves_InitThreadFFTs')
+      IF ( ErrStat >= AbortErrLev ) RETURN
+   END DO
+
+END SUBROUTINE Waves_InitThreadFFTs
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine cleans up and deallocates the instances of the FFT module initialized by Waves_InitThreadFFTs.
+SUBROUTINE Waves_ExitThreadFFTs ( FFT_Thread, ErrStat, ErrMsg )
+
+   TYPE(FFT_DataType), ALLOCATABLE, INTENT(INOUT)  :: FFT_Thread(:)  !< Instances of the FFT module (0:NThreads-1)
+   INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat        !< Error status of the operation
+   CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg         !< Error message if ErrStat /= ErrID_None
+
+      ! Local Variables
+   INTEGER(IntKi)                                  :: I              ! Index of the thread
+   INTEGER(IntKi)                                  :: ErrStatTmp     ! Temporary error status
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   IF ( .NOT. ALLOCATED(FFT_Thread) ) RETURN
+
+   DO I = LBOUND(FFT_Thread,1),UBOUND(FFT_Thread,1)
+      CALL ExitFFT ( FFT_Thread(I), ErrStatTmp )
+      CALL SetErrStat(ErrStatTmp,'Error occured while cleaning up after the FFTs.',ErrStat,ErrMsg,'Waves_ExitThreadFFTs')
+   END DO
+
+   DEALLOCATE ( FFT_Thread )
+
+END SUBROUTINE Waves_ExitThreadFFTs
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine packs the inputs of VariousWaves_Init, which are the key of the wave kinematics cache.  The file names and the unit
+!! number don't change the wave kinematics, so they are cleared first.
+SUBROUTINE WavesCache_Key ( InitInp, KeyRe, KeyDb, KeyInt, ErrStat, ErrMsg )
+
+   TYPE(Waves_InitInputType),       INTENT(IN   )  :: InitInp     !< Input data for initialization routine
+   REAL(ReKi),         ALLOCATABLE, INTENT(  OUT)  :: KeyRe(:)    !< Packed reals of the key
+   REAL(DbKi),         ALLOCATABLE, INTENT(  OUT)  :: KeyDb(:)    !< Packed doubles of the key
+   INTEGER(IntKi),     ALLOCATABLE, INTENT(  OUT)  :: KeyInt(:)   !< Packed integers of the key
+   INTEGER(IntKi),                  INTENT(  OUT)  :: ErrStat     !< Error status of the operation
+   CHARACTER(*),                    INTENT(  OUT)  :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+      ! Local Variables
+   TYPE(Waves_InitInputType)                       :: KeyInp      ! Copy of InitInp without the file names
+   INTEGER(IntKi)                                  :: ErrStat2    ! Temporary error status
+   CHARACTER(ErrMsgLen)                            :: ErrMsg2     ! Temporary error message
+
+
+   CALL Waves_CopyInitInput( InitInp, KeyInp, MESH_NEWCOPY, ErrStat, ErrMsg )
+   IF ( ErrStat >= AbortErrLev ) RETURN
+
+   KeyInp%InputFile    = ""
+   KeyInp%DirRoot      = ""
+   KeyInp%WvKinFile    = ""
+   KeyInp%WvCacheDir   = ""
+   KeyInp%WriteWvKin   = .FALSE.
+   KeyInp%UnSum        = -1
+   KeyInp%WaveModChr   = ""
+   KeyInp%WavePkShpChr = ""
+
+   CALL Waves_PackInitInput( KeyRe, KeyDb, KeyInt, KeyInp, ErrStat, ErrMsg )
+   CALL Waves_DestroyInitInput( KeyInp, ErrStat2, ErrMsg2 )
+
+END SUBROUTINE WavesCache_Key
 
 
 
@@ -2140,6 +2534,16 @@ SUBROUTINE Waves_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
          ! Local Variables:
       INTEGER(IntKi)                                  :: ErrStatTmp  ! Temporary error status for processing
       CHARACTER(1024)                                 :: ErrMsgTmp   ! Temporary error message for procesing
+      CHARACTER(1024)                                 :: CacheFile   ! Name of the wave kinematics cache file for these inputs
+      LOGICAL                                         :: CacheHit    ! Whether the wave kinematics were read from the cache
+      REAL(ReKi),     ALLOCATABLE                     :: KeyRe(:)    ! Packed reals    of the cache key (the inputs)
+      REAL(DbKi),     ALLOCATABLE                     :: KeyDb(:)    ! Packed doubles  of the cache key
+      INTEGER(IntKi), ALLOCATABLE                     :: KeyInt(:)   ! Packed integers of the cache key
+      REAL(ReKi),     ALLOCATABLE                     :: ValRe(:)    ! Packed reals    of the cached InitOut
+      REAL(DbKi),     ALLOCATABLE                     :: ValDb(:)    ! Packed doubles  of the cached InitOut
+      INTEGER(IntKi), ALLOCATABLE                     :: ValInt(:)   ! Packed integers of the cached InitOut, after the packed warnings of VariousWaves_Init
+      INTEGER(IntKi), ALLOCATABLE                     :: MsgInt(:)   ! Packed warnings of VariousWaves_Init
+      INTEGER(IntKi)                                  :: NMsg        ! Number of packed integers of the warnings in ValInt
 !      REAL(ReKi), ALLOCATABLE                         :: tmpWaveKinzi(:)
      
 !      TYPE(FFT_DataType)           :: FFT_Data                                        ! the instance of the FFT module we're using
@@ -2243,10 +2647,51 @@ SUBROUTINE Waves_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, Init
          !DEALLOCATE( InitOut%WaveTime  )
          !DEALLOCATE( InitOut%NodeInWater  )
          
-            ! Now call the init with all the zi locations for the Morrison member nodes 
-         CALL VariousWaves_Init( InitInp, InitOut, ErrStatTmp, ErrMsgTmp )
-            CALL  SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'Waves_Init')
-            IF ( ErrStat >= AbortErrLev ) RETURN
+            ! The kinematics of these wave models depend only on InitInp, so they can be read from the wave kinematics cache
+            ! when another simulation has already computed them for the same inputs.
+         CacheFile = ""
+         CacheHit  = .FALSE.
+         IF ( LEN_TRIM( InitInp%WvCacheDir ) > 0 ) THEN
+            CALL WavesCache_Key( InitInp, KeyRe, KeyDb, KeyInt, ErrStatTmp, ErrMsgTmp )
+               CALL  SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'Waves_Init')
+               IF ( ErrStat >= AbortErrLev ) RETURN
+            CacheFile = HDCache_FileName( InitInp%WvCacheDir, 'Waves', KeyRe, KeyDb, KeyInt )
+            CALL HDCache_Read( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, CacheHit )
+
+               ! The warnings of VariousWaves_Init are packed before InitOut, so they can be given again
+            IF ( CacheHit ) THEN
+               NMsg = -1
+               IF ( SIZE(ValInt) >= 2 ) NMsg = 2 + ValInt(2)
+               CacheHit = NMsg >= 2 .AND. NMsg <= SIZE(ValInt)
+            END IF
+            IF ( CacheHit ) THEN
+               MsgInt = ValInt(1:NMsg)
+               ValInt = ValInt(NMsg+1:)
+               CALL WrScr ( ' Reading the incident wave kinematics from "'//TRIM(CacheFile)//'".' )
+               CALL Waves_UnPackInitOutput( ValRe, ValDb, ValInt, InitOut, ErrStatTmp, ErrMsgTmp )
+                  CALL  SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'Waves_Init')
+                  IF ( ErrStat >= AbortErrLev ) RETURN
+               CALL HDCache_UnPackMsg( MsgInt, ErrStatTmp, ErrMsgTmp, CacheHit )
+                  CALL  SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'Waves_Init')
+            END IF
+         END IF
+
+         IF ( .NOT. CacheHit ) THEN
+               ! Now call the init with all the zi locations for the Morrison member nodes 
+            CALL VariousWaves_Init( InitInp, InitOut, ErrStatTmp, ErrMsgTmp )
+               CALL  SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'Waves_Init')
+               IF ( ErrStat >= AbortErrLev ) RETURN
+
+            IF ( LEN_TRIM( CacheFile ) > 0 ) THEN
+               MsgInt = HDCache_PackMsg( ErrStatTmp, ErrMsgTmp )
+               CALL Waves_PackInitOutput( ValRe, ValDb, ValInt, InitOut, ErrStatTmp, ErrMsgTmp )
+                  CALL  SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'Waves_Init')
+                  IF ( ErrStat >= AbortErrLev ) RETURN
+               ValInt = (/ MsgInt, ValInt /)
+               CALL HDCache_Write( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, ErrStatTmp, ErrMsgTmp )
+                  CALL  SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'Waves_Init')
+            END IF
+         END IF
 
         
       CASE ( 5 )              ! User-supplied wave elevation time history; HD derives full wave kinematics from this elevation time series data.   
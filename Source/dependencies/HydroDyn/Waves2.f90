@@ -41,7 +41,9 @@ MODULE Waves2
    USE Waves2_Output
    USE NWTC_Library
    USE NWTC_FFTPACK
-   USE Waves,  ONLY : WaveNumber
+   USE Waves,  ONLY : WaveNumber, Waves_InitThreadFFTs, Waves_ExitThreadFFTs
+   USE HydroDyn_Cache
+!$ USE OMP_LIB
 
    IMPLICIT NONE
 
@@ -69,6 +71,10 @@ MODULE Waves2
    PUBLIC :: Waves2_CalcContStateDeriv             !< Tight coupling routine for computing derivatives of continuous states
    PUBLIC :: Waves2_UpdateDiscState                !< Tight coupling routine for updating discrete states
 
+   PRIVATE:: Waves2Cache_Key                       !< Pack the inputs that are the key of the wave kinematics cache
+   PRIVATE:: Waves2Cache_Pack                      !< Pack the results for the wave kinematics cache
+   PRIVATE:: Waves2Cache_Unpack                    !< Unpack the results read from the wave kinematics cache
+
 
 CONTAINS
 !----------------------------------------------------------------------------------------------------------------------------------
@@ -203,9 +209,24 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
 
          ! Stuff for the FFT calculations
       TYPE(FFT_DataType)                                 :: FFT_Data             !< the instance of the FFT module we're using
+      TYPE(FFT_DataType),                    ALLOCATABLE :: FFT_Thread(:)        !< the instances of the FFT module used by each thread for the kinematics (0:NThreads-1)
+      INTEGER(IntKi)                                     :: iThread              !< Index of the current OpenMP thread (0 without OpenMP)
+      INTEGER(IntKi)                                     :: ErrStatFFT           !< Highest error status of the FFTs of the kinematics
+
 
 
 
+         ! Wave kinematics cache
+      CHARACTER(1024)                                    :: CacheFile            !< Name of the wave kinematics cache file for these inputs
+      LOGICAL                                            :: CacheHit             !< Whether the kinematics were read from the cache
+      REAL(ReKi),                            ALLOCATABLE :: KeyRe(:)             !< Packed reals    of the cache key (the inputs)
+      REAL(DbKi),                            ALLOCATABLE :: KeyDb(:)             !< Packed doubles  of the cache key
+      INTEGER(IntKi),                        ALLOCATABLE :: KeyInt(:)            !< Packed integers of the cache key
+      REAL(ReKi),                            ALLOCATABLE :: ValRe(:)             !< Packed reals    of the cached results
+      REAL(DbKi),                            ALLOCATABLE :: ValDb(:)             !< Packed doubles  of the cached results
+      INTEGER(IntKi),                        ALLOCATABLE :: ValInt(:)            !< Packed integers of the cached results
+      INTEGER(IntKi)                                     :: ErrStatCache         !< Error status of the cached calculation
+      CHARACTER(2048)                                    :: ErrMsgCache          !< Error message of the cached calculation
 
          ! Temporary error trapping variables
       INTEGER(IntKi)                                     :: ErrStatTmp           !< Temporary variable for holding the error status  returned from a CALL statement
@@ -500,6 +521,49 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
       ENDIF
 
 
+      !--------------------------------------------------------------------------------
+      ! Read the results from the wave kinematics cache when another simulation has
+      ! already computed them for the same inputs
+      !--------------------------------------------------------------------------------
+
+      CacheFile = ""
+      CacheHit  = .FALSE.
+      IF ( LEN_TRIM( InitInp%WvCacheDir ) > 0 ) THEN
+
+         CALL Waves2Cache_Key( InitInp, KeyRe, KeyDb, KeyInt, ErrStatTmp, ErrMsgTmp )
+         CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'Waves2_Init')
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL CleanUp()
+            RETURN
+         END IF
+
+         CacheFile = HDCache_FileName( InitInp%WvCacheDir, 'Waves2', KeyRe, KeyDb, KeyInt )
+         CALL HDCache_Read( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, CacheHit )
+
+         IF ( CacheHit ) THEN
+            CALL WrScr ( ' Reading the second order wave kinematics from "'//TRIM(CacheFile)//'".' )
+            CALL Waves2Cache_Unpack( ValRe, ValDb, ValInt, p, InitOut, ErrStatCache, ErrMsgCache, ErrStatTmp, ErrMsgTmp )
+
+               ! give the warnings of the cached calculation again (they include those of Waves2Cache_Key above)
+            IF ( ErrStatCache /= ErrID_None ) THEN
+               ErrStat = MAX( ErrStat, ErrStatCache )
+               ErrMsg  = ErrMsgCache
+            END IF
+            CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'Waves2_Init')
+
+            u%DummyInput               = 0.0_SiKi
+            x%DummyContState           = 0.0_SiKi
+            xd%DummyDiscState          = 0.0_SiKi
+            z%DummyConstrState         = 0.0_SiKi
+            OtherState%DummyOtherState = 0_IntKi
+
+            CALL CleanUp()
+            RETURN
+         END IF
+
+      END IF
+
+
          ! For calculating the 2nd-order wave elevation corrections, we need a temporary array to hold the information.
       ALLOCATE ( TmpTimeSeries(0:InitInp%NStepWave), STAT=ErrStatTmp )
       IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array TmpTimeSeries.', ErrStat,ErrMsg,'Waves2_Init')
@@ -519,6 +583,11 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
 
       CALL InitFFT ( InitInp%NStepWave, FFT_Data, .FALSE., ErrStatTmp )
       CALL SetErrStat(ErrStatTmp,'Error occured while initializing the FFT.',ErrStat,ErrMsg,'Waves2_Init')
+
+         ! The kinematics points are split among the threads.  FFTPACK uses the work array of the FFT instance as scratch space, so
+         ! each thread gets its own instance.
+      CALL Waves_InitThreadFFTs ( InitInp%NStepWave, .FALSE., FFT_Thread, ErrStatTmp, ErrMsgTmp )
+      CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'Waves2_Init')
       IF ( ErrStat >= AbortErrLev ) THEN
          CALL CleanUp()
          RETURN
@@ -647,6 +716,12 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
 
 
             ! NWaveKin0Prime loop start
+         ErrStatFFT = ErrID_None
+         !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(I, n, m, mu_minus, Omega_n, Omega_m, Omega_minus, k_n, k_m, k_nm, WaveElevxyPrime0, WaveElevC_n, WaveElevC_m, B_minus, &
+         !$OMP    Ux_nm_minus, Uy_nm_minus, Uz_nm_minus, Accx_nm_minus, Accy_nm_minus, Accz_nm_minus, DynP_nm_minus, &
+         !$OMP    WaveVel2xCDiff, WaveVel2yCDiff, WaveVel2zCDiff, WaveAcc2xCDiff, WaveAcc2yCDiff, WaveAcc2zCDiff, WaveDynP2CDiff, &
+         !$OMP    WaveVel2xDiff, WaveVel2yDiff, WaveVel2zDiff, WaveAcc2xDiff, WaveAcc2yDiff, WaveAcc2zDiff, WaveDynP2Diff, iThread, ErrStatTmp) &
+         !$OMP REDUCTION(MAX:ErrStatFFT) SCHEDULE(DYNAMIC,1)
          DO I=1,NWaveKin0Prime
 
 
@@ -774,31 +849,27 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
 
                !> ### Apply the inverse FFT to each of the components to get the time domain result ###
                !> *   \f$ V(t) = 2 \operatorname{IFFT}\left[H^-\right] \f$
-            CALL ApplyFFT_cx(  WaveVel2xDiff(:),  WaveVel2xCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on V_x.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveVel2yDiff(:),  WaveVel2yCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on V_y.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveVel2zDiff(:),  WaveVel2zCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on V_z.',ErrStat,ErrMsg,'Waves2_Init')
+            iThread = 0
+            !$ iThread = OMP_GET_THREAD_NUM()
+            CALL ApplyFFT_cx(  WaveVel2xDiff(:),  WaveVel2xCDiff(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveVel2yDiff(:),  WaveVel2yCDiff(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveVel2zDiff(:),  WaveVel2zCDiff(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
 
-            CALL ApplyFFT_cx(  WaveAcc2xDiff(:),  WaveAcc2xCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on Acc_x.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveAcc2yDiff(:),  WaveAcc2yCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on Acc_y.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveAcc2zDiff(:),  WaveAcc2zCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on Acc_z.',ErrStat,ErrMsg,'Waves2_Init')
+            CALL ApplyFFT_cx(  WaveAcc2xDiff(:),  WaveAcc2xCDiff(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveAcc2yDiff(:),  WaveAcc2yCDiff(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveAcc2zDiff(:),  WaveAcc2zCDiff(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
 
-            CALL ApplyFFT_cx(  WaveDynP2Diff(:),  WaveDynP2CDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on DynP2.',ErrStat,ErrMsg,'Waves2_Init')
+            CALL ApplyFFT_cx(  WaveDynP2Diff(:),  WaveDynP2CDiff(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
 
 
 
-            IF ( ErrStat >= AbortErrLev ) THEN
-               CALL CleanUp()
-               RETURN
-            END IF
-
-
                ! Copy the results to the output
             InitOut%WaveVel2D(:,WaveKinPrimeMap(I),1) =  2.0_SiKi * WaveVel2xDiff(:)     ! x-component of velocity
             InitOut%WaveVel2D(:,WaveKinPrimeMap(I),2) =  2.0_SiKi * WaveVel2yDiff(:)     ! y-component of velocity
@@ -824,6 +895,9 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
 
 
          ENDDO    ! I=1,NWaveKin0Prime loop end
+         !$OMP END PARALLEL DO
+
+         CALL SetErrStat(ErrStatFFT,'Error occured while applying the FFTs to the difference-frequency kinematics.',ErrStat,ErrMsg,'Waves2_Init')
 
 
             ! Deallocate working arrays.
@@ -1018,6 +1092,14 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
          !> ## Calculate the second order velocity, acceleration, and pressure corrections for all joints below surface. ##
          !--------------------------------------------------------------------------------
             ! NWaveKin0Prime loop start
+         ErrStatFFT = ErrID_None
+         !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(I, n, m, mu_plus, Omega_n, Omega_m, Omega_plus, k_n, k_m, k_nm, WaveElevxyPrime0, WaveElevC_n, WaveElevC_m, B_plus, &
+         !$OMP    Ux_nm_plus, Uy_nm_plus, Uz_nm_plus, Accx_nm_plus, Accy_nm_plus, Accz_nm_plus, DynP_nm_plus, &
+         !$OMP    WaveVel2xCSumT1, WaveVel2yCSumT1, WaveVel2zCSumT1, WaveAcc2xCSumT1, WaveAcc2yCSumT1, WaveAcc2zCSumT1, WaveDynP2CSumT1, &
+         !$OMP    WaveVel2xSumT1, WaveVel2ySumT1, WaveVel2zSumT1, WaveAcc2xSumT1, WaveAcc2ySumT1, WaveAcc2zSumT1, WaveDynP2SumT1, &
+         !$OMP    WaveVel2xCSumT2, WaveVel2yCSumT2, WaveVel2zCSumT2, WaveAcc2xCSumT2, WaveAcc2yCSumT2, WaveAcc2zCSumT2, WaveDynP2CSumT2, &
+         !$OMP    WaveVel2xSumT2, WaveVel2ySumT2, WaveVel2zSumT2, WaveAcc2xSumT2, WaveAcc2ySumT2, WaveAcc2zSumT2, WaveDynP2SumT2, iThread, ErrStatTmp) &
+         !$OMP REDUCTION(MAX:ErrStatFFT) SCHEDULE(DYNAMIC,1)
          DO I=1,NWaveKin0Prime
 
 
@@ -1270,44 +1352,41 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
                !> ### Apply the inverse FFT to the first and second terms of each of the components to get the time domain result ###
                !> *   \f$ V^{(2)+}(t)  =  \operatorname{IFFT}\left[K^+\right]
                !!                      + 2\operatorname{IFFT}\left[H^+\right]     \f$
-            CALL ApplyFFT_cx(  WaveVel2xSumT1(:),  WaveVel2xCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on V_x.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveVel2ySumT1(:),  WaveVel2yCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on V_y.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveVel2zSumT1(:),  WaveVel2zCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on V_z.',ErrStat,ErrMsg,'Waves2_Init')
-
-            CALL ApplyFFT_cx(  WaveAcc2xSumT1(:),  WaveAcc2xCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on Acc_x.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveAcc2ySumT1(:),  WaveAcc2yCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on Acc_y.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveAcc2zSumT1(:),  WaveAcc2zCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on Acc_z.',ErrStat,ErrMsg,'Waves2_Init')
-
-            CALL ApplyFFT_cx(  WaveDynP2SumT1(:),  WaveDynP2CSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on DynP2.',ErrStat,ErrMsg,'Waves2_Init')
-
-            CALL ApplyFFT_cx(  WaveVel2xSumT2(:),  WaveVel2xCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on V_x.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveVel2ySumT2(:),  WaveVel2yCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on V_y.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveVel2zSumT2(:),  WaveVel2zCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on V_z.',ErrStat,ErrMsg,'Waves2_Init')
-
-            CALL ApplyFFT_cx(  WaveAcc2xSumT2(:),  WaveAcc2xCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on Acc_x.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveAcc2ySumT2(:),  WaveAcc2yCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on Acc_y.',ErrStat,ErrMsg,'Waves2_Init')
-            CALL ApplyFFT_cx(  WaveAcc2zSumT2(:),  WaveAcc2zCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on Acc_z.',ErrStat,ErrMsg,'Waves2_Init')
-
-            CALL ApplyFFT_cx(  WaveDynP2SumT2(:),  WaveDynP2CSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occured while applying the FFT on DynP2.',ErrStat,ErrMsg,'Waves2_Init')
-
-            IF ( ErrStat >= AbortErrLev ) THEN
-               CALL CleanUp()
-               RETURN
-            END IF
+            iThread = 0
+            !$ iThread = OMP_GET_THREAD_NUM()
+            CALL ApplyFFT_cx(  WaveVel2xSumT1(:),  WaveVel2xCSumT1(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveVel2ySumT1(:),  WaveVel2yCSumT1(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveVel2zSumT1(:),  WaveVel2zCSumT1(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+
+            CALL ApplyFFT_cx(  WaveAcc2xSumT1(:),  WaveAcc2xCSumT1(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveAcc2ySumT1(:),  WaveAcc2yCSumT1(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveAcc2zSumT1(:),  WaveAcc2zCSumT1(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+
+            CALL ApplyFFT_cx(  WaveDynP2SumT1(:),  WaveDynP2CSumT1(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+
+            CALL ApplyFFT_cx(  WaveVel2xSumT2(:),  WaveVel2xCSumT2(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveVel2ySumT2(:),  WaveVel2yCSumT2(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveVel2zSumT2(:),  WaveVel2zCSumT2(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+
+            CALL ApplyFFT_cx(  WaveAcc2xSumT2(:),  WaveAcc2xCSumT2(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveAcc2ySumT2(:),  WaveAcc2yCSumT2(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+            CALL ApplyFFT_cx(  WaveAcc2zSumT2(:),  WaveAcc2zCSumT2(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
+
+            CALL ApplyFFT_cx(  WaveDynP2SumT2(:),  WaveDynP2CSumT2(:), FFT_Thread(iThread), ErrStatTmp )
+               ErrStatFFT = MAX( ErrStatFFT, ErrStatTmp )
 
 
                ! Add the results to the output
@@ -1329,6 +1408,9 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
 
 
          ENDDO    ! I=1,NWaveKin0Prime loop end
+         !$OMP END PARALLEL DO
+
+         CALL SetErrStat(ErrStatFFT,'Error occured while applying the FFTs to the sum-frequency kinematics.',ErrStat,ErrMsg,'Waves2_Init')
 
 
             ! Deallocate working arrays.
@@ -1380,6 +1462,8 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
 
          CALL  ExitFFT(FFT_Data, ErrStatTmp)
          CALL  SetErrStat(ErrStatTmp,'Error occured while cleaning up after the FFTs.', ErrStat,ErrMsg,'Waves2_Init')
+         CALL  Waves_ExitThreadFFTs(FFT_Thread, ErrStatTmp, ErrMsgTmp)
+         CALL  SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,'Waves2_Init')
          IF ( ErrStat >= AbortErrLev ) THEN
             CALL CleanUp()
             RETURN
@@ -1393,6 +1477,19 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
          IF (ALLOCATED(TmpFreqSeries2))   DEALLOCATE(TmpFreqSeries2,    STAT=ErrStatTmp)
 
 
+            ! Store the results in the wave kinematics cache for the next simulation with the same inputs
+         IF ( LEN_TRIM( CacheFile ) > 0 ) THEN
+            CALL Waves2Cache_Pack( p, InitOut, ErrStat, ErrMsg, ValRe, ValDb, ValInt, ErrStatTmp, ErrMsgTmp )
+            CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'Waves2_Init')
+            IF ( ErrStat >= AbortErrLev ) THEN
+               CALL CleanUp()
+               RETURN
+            END IF
+            CALL HDCache_Write( CacheFile, KeyRe, KeyDb, KeyInt, ValRe, ValDb, ValInt, ErrStatTmp, ErrMsgTmp )
+            CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, 'Waves2_Init')
+         END IF
+
+
          ! initialize dummy variables for the framework, so that compilers don't complain that the INTENT(OUT) variables have not been set:
          u%DummyInput               = 0.0_SiKi
          x%DummyContState           = 0.0_SiKi
@@ -2103,6 +2200,7 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
       SUBROUTINE CleanUp()
 
          CALL  ExitFFT(FFT_Data, ErrStatTmp)
+         CALL  Waves_ExitThreadFFTs(FFT_Thread, ErrStatTmp, ErrMsgTmp)
 
          IF (ALLOCATED(TmpTimeSeries))    DEALLOCATE(TmpTimeSeries,     STAT=ErrStatTmp)
 
@@ -2157,6 +2255,137 @@ SUBROUTINE Waves2_Init( InitInp, u, p, x, xd, z, OtherState, y, misc, Interval,
 
 
 END SUBROUTINE Waves2_Init
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine packs the inputs of the second order wave kinematics calculations, which are the key of the wave kinematics
+!! cache.  The summary file unit and the output channels don't change the kinematics, so they are cleared first.
+SUBROUTINE Waves2Cache_Key( InitInp, KeyRe, KeyDb, KeyInt, ErrStat, ErrMsg )
+
+      TYPE(Waves2_InitInputType),         INTENT(IN   )  :: InitInp              !< Input data for initialization routine
+      REAL(ReKi),            ALLOCATABLE, INTENT(  OUT)  :: KeyRe(:)             !< Packed reals of the key
+      REAL(DbKi),            ALLOCATABLE, INTENT(  OUT)  :: KeyDb(:)             !< Packed doubles of the key
+      INTEGER(IntKi),        ALLOCATABLE, INTENT(  OUT)  :: KeyInt(:)            !< Packed integers of the key
+      INTEGER(IntKi),                     INTENT(  OUT)  :: ErrStat              !< Error status of the operation
+      CHARACTER(*),                       INTENT(  OUT)  :: ErrMsg               !< Error message if ErrStat /= ErrID_None
+
+         ! Local Variables
+      TYPE(Waves2_InitInputType)                         :: KeyInp               !< Copy of InitInp without the output settings
+      INTEGER(IntKi)                                     :: ErrStatTmp           !< Temporary error status
+      CHARACTER(ErrMsgLen)                               :: ErrMsgTmp            !< Temporary error message
+
+
+      CALL Waves2_CopyInitInput( InitInp, KeyInp, MESH_NEWCOPY, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+      KeyInp%UnSum      = -1
+      KeyInp%WvCacheDir = ""
+      KeyInp%OutList    = ""
+      KeyInp%OutAll     = .FALSE.
+      KeyInp%NumOuts    = 0
+      KeyInp%NumOutAll  = 0
+
+      CALL Waves2_PackInitInput( KeyRe, KeyDb, KeyInt, KeyInp, ErrStat, ErrMsg )
+      CALL Waves2_DestroyInitInput( KeyInp, ErrStatTmp, ErrMsgTmp )
+
+END SUBROUTINE Waves2Cache_Key
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine packs the results of the second order wave kinematics calculations for the wave kinematics cache: InitOut
+!! (without the output channel names and units, which Wvs2OUT_Init sets from the inputs) followed by the reals of p%WaveElev2,
+!! and the warnings of the calculation (packed with HDCache_PackMsg) before the integers of InitOut.
+SUBROUTINE Waves2Cache_Pack( p, InitOut, ErrStatInit, ErrMsgInit, ValRe, ValDb, ValInt, ErrStat, ErrMsg )
+
+      TYPE(Waves2_ParameterType),         INTENT(IN   )  :: p                    !< Parameters
+      TYPE(Waves2_InitOutputType),        INTENT(INOUT)  :: InitOut              !< Output for initialization routine (unchanged on return)
+      INTEGER(IntKi),                     INTENT(IN   )  :: ErrStatInit          !< Error status of the calculation
+      CHARACTER(*),                       INTENT(IN   )  :: ErrMsgInit           !< Error message of the calculation
+      REAL(ReKi),            ALLOCATABLE, INTENT(  OUT)  :: ValRe(:)             !< Packed reals of the results
+      REAL(DbKi),            ALLOCATABLE, INTENT(  OUT)  :: ValDb(:)             !< Packed doubles of the results
+      INTEGER(IntKi),        ALLOCATABLE, INTENT(  OUT)  :: ValInt(:)            !< Packed integers of the results
+      INTEGER(IntKi),                     INTENT(  OUT)  :: ErrStat              !< Error status of the operation
+      CHARACTER(*),                       INTENT(  OUT)  :: ErrMsg               !< Error message if ErrStat /= ErrID_None
+
+         ! Local Variables
+      REAL(ReKi),            ALLOCATABLE                 :: PackRe(:)            !< Packed reals of InitOut
+      CHARACTER(10),         ALLOCATABLE                 :: WriteOutputHdr(:)    !< InitOut%WriteOutputHdr, held while InitOut is packed
+      CHARACTER(10),         ALLOCATABLE                 :: WriteOutputUnt(:)    !< InitOut%WriteOutputUnt, held while InitOut is packed
+      INTEGER(IntKi)                                     :: NRe                  !< Number of packed reals of InitOut
+      INTEGER(IntKi)                                     :: NElev                !< Number of elements of p%WaveElev2
+      INTEGER(IntKi)                                     :: ErrStatTmp           !< Temporary error status
+
+
+      CALL MOVE_ALLOC( InitOut%WriteOutputHdr, WriteOutputHdr )
+      CALL MOVE_ALLOC( InitOut%WriteOutputUnt, WriteOutputUnt )
+      CALL Waves2_PackInitOutput( PackRe, ValDb, ValInt, InitOut, ErrStat, ErrMsg )
+      CALL MOVE_ALLOC( WriteOutputHdr, InitOut%WriteOutputHdr )
+      CALL MOVE_ALLOC( WriteOutputUnt, InitOut%WriteOutputUnt )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+      NRe   = 0
+      IF ( ALLOCATED(PackRe) ) NRe = SIZE(PackRe)
+      NElev = SIZE(p%WaveElev2)
+
+      ALLOCATE ( ValRe(NRe + NElev), STAT=ErrStatTmp )
+      IF (ErrStatTmp /= 0) THEN
+         CALL SetErrStat(ErrID_Fatal,'Cannot allocate array ValRe.',ErrStat,ErrMsg,'Waves2Cache_Pack')
+         RETURN
+      END IF
+
+      IF ( NRe > 0 ) ValRe(1:NRe) = PackRe
+      ValRe(NRe+1:NRe+NElev) = REAL( RESHAPE( p%WaveElev2, (/ NElev /) ), ReKi )
+
+      ValInt = (/ HDCache_PackMsg( ErrStatInit, ErrMsgInit ), ValInt /)
+
+END SUBROUTINE Waves2Cache_Pack
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine is the inverse of Waves2Cache_Pack.  p%WaveElev2 must already be allocated.
+SUBROUTINE Waves2Cache_Unpack( ValRe, ValDb, ValInt, p, InitOut, ErrStatInit, ErrMsgInit, ErrStat, ErrMsg )
+
+      REAL(ReKi),            ALLOCATABLE, INTENT(IN   )  :: ValRe(:)             !< Packed reals of the results
+      REAL(DbKi),            ALLOCATABLE, INTENT(IN   )  :: ValDb(:)             !< Packed doubles of the results
+      INTEGER(IntKi),        ALLOCATABLE, INTENT(IN   )  :: ValInt(:)            !< Packed integers of the results
+      TYPE(Waves2_ParameterType),         INTENT(INOUT)  :: p                    !< Parameters
+      TYPE(Waves2_InitOutputType),        INTENT(INOUT)  :: InitOut              !< Output for initialization routine
+      INTEGER(IntKi),                     INTENT(  OUT)  :: ErrStatInit          !< Error status of the cached calculation
+      CHARACTER(*),                       INTENT(  OUT)  :: ErrMsgInit           !< Error message of the cached calculation
+      INTEGER(IntKi),                     INTENT(  OUT)  :: ErrStat              !< Error status of the operation
+      CHARACTER(*),                       INTENT(  OUT)  :: ErrMsg               !< Error message if ErrStat /= ErrID_None
+
+         ! Local Variables
+      INTEGER(IntKi),        ALLOCATABLE                 :: PackInt(:)           !< Packed integers of InitOut
+      INTEGER(IntKi)                                     :: NRe                  !< Number of packed reals
+      INTEGER(IntKi)                                     :: NElev                !< Number of elements of p%WaveElev2
+      INTEGER(IntKi)                                     :: NMsg                 !< Number of packed integers of the warnings
+      LOGICAL                                            :: MsgFound             !< Whether the warnings were unpacked
+
+
+      ErrStat = ErrID_None
+      ErrMsg  = ""
+      ErrStatInit = ErrID_None
+      ErrMsgInit  = ""
+
+      NRe   = SIZE(ValRe)
+      NElev = SIZE(p%WaveElev2)
+      IF ( NRe < NElev ) THEN
+         CALL SetErrStat(ErrID_Fatal,'The wave kinematics cache file doesn''t hold the second order wave elevations.',ErrStat,ErrMsg,'Waves2Cache_Unpack')
+         RETURN
+      END IF
+
+      NMsg = -1
+      IF ( SIZE(ValInt) >= 2 ) NMsg = 2 + ValInt(2)
+      MsgFound = NMsg >= 2 .AND. NMsg <= SIZE(ValInt)
+      IF ( MsgFound ) CALL HDCache_UnPackMsg( ValInt(1:NMsg), ErrStatInit, ErrMsgInit, MsgFound )
+      IF ( .NOT. MsgFound ) THEN
+         CALL SetErrStat(ErrID_Fatal,'The wave kinematics cache file doesn''t hold the warnings of the second order calculation.',ErrStat,ErrMsg,'Waves2Cache_Unpack')
+         RETURN
+      END IF
+      PackInt = ValInt(NMsg+1:)
+
+         ! The unpacking routine ignores the reals of p%WaveElev2 at the end of ValRe
+      CALL Waves2_UnPackInitOutput( ValRe, ValDb, PackInt, InitOut, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+      p%WaveElev2 = RESHAPE( REAL( ValRe(NRe-NElev+1:NRe), SiKi ), SHAPE(p%WaveElev2) )
+
+END SUBROUTINE Waves2Cache_Unpack
 
 
 
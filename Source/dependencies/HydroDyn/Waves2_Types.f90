@@ -37,6 +37,7 @@ IMPLICIT NONE
 ! =========  Waves2_InitInputType  =======
   TYPE, PUBLIC :: Waves2_InitInputType
     INTEGER(IntKi)  :: UnSum      !< The unit number for the HydroDyn summary file [-]
+    CHARACTER(1024)  :: WvCacheDir      !< Directory of the wave kinematics cache files; empty for no cache [-]
     REAL(ReKi)  :: Gravity      !< Gravitational acceleration [(m/s^2)]
     REAL(ReKi)  :: WtrDens      !< Water density [(kg/m^3)]
     REAL(SiKi)  :: WtrDpth      !< Water depth [(meters)]
@@ -160,6 +161,7 @@ CONTAINS
    ErrStat = ErrID_None
    ErrMsg  = ""
     DstInitInputData%UnSum = SrcInitInputData%UnSum
+    DstInitInputData%WvCacheDir = SrcInitInputData%WvCacheDir
     DstInitInputData%Gravity = SrcInitInputData%Gravity
     DstInitInputData%WtrDens = SrcInitInputData%WtrDens
     DstInitInputData%WtrDpth = SrcInitInputData%WtrDpth
@@ -368,6 +370,7 @@ ENDIF
   Db_BufSz  = 0
   Int_BufSz  = 0
       Int_BufSz  = Int_BufSz  + 1  ! UnSum
+      Int_BufSz  = Int_BufSz  + 1*LEN(InData%WvCacheDir)  ! WvCacheDir
       Re_BufSz   = Re_BufSz   + 1  ! Gravity
       Re_BufSz   = Re_BufSz   + 1  ! WtrDens
       Re_BufSz   = Re_BufSz   + 1  ! WtrDpth
@@ -462,6 +465,10 @@ ENDIF
 
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%UnSum
       Int_Xferred   = Int_Xferred   + 1
+        DO I = 1, LEN(InData%WvCacheDir)
+          IntKiBuf(Int_Xferred) = ICHAR(InData%WvCacheDir(I:I), IntKi)
+          Int_Xferred = Int_Xferred   + 1
+        END DO ! I
       ReKiBuf ( Re_Xferred:Re_Xferred+(1)-1 ) = InData%Gravity
       Re_Xferred   = Re_Xferred   + 1
       ReKiBuf ( Re_Xferred:Re_Xferred+(1)-1 ) = InData%WtrDens
@@ -668,6 +675,10 @@ ENDIF
   Int_Xferred  = 1
       OutData%UnSum = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
+      DO I = 1, LEN(OutData%WvCacheDir)
+        OutData%WvCacheDir(I:I) = CHAR(IntKiBuf(Int_Xferred))
+        Int_Xferred = Int_Xferred   + 1
+      END DO ! I
       OutData%Gravity = ReKiBuf( Re_Xferred )
       Re_Xferred   = Re_Xferred + 1
       OutData%WtrDens = ReKiBuf( Re_Xferred )
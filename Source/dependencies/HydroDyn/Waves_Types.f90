@@ -33,11 +33,37 @@ MODULE Waves_Types
 !---------------------------------------------------------------------------------------------------------------------------------
 USE NWTC_Library
 IMPLICIT NONE
+! =========  Waves_KinProviderType  =======
+  TYPE, PUBLIC :: Waves_KinProviderType
+    INTEGER(IntKi)  :: NStepWave      !< Total number of time steps in the incident wave (the kinematics repeat every NStepWave steps) [-]
+    INTEGER(IntKi)  :: NWaveKin      !< Number of points where the incident wave kinematics are computed [-]
+    INTEGER(IntKi)  :: NFreq      !< Number of frequency components with a nonzero amplitude [-]
+    REAL(SiKi)  :: WtrDpth      !< Water depth [(meters)]
+    REAL(SiKi)  :: RhoXg      !< = WtrDens*Gravity [-]
+    INTEGER(IntKi) , DIMENSION(:), ALLOCATABLE  :: FreqIndx      !< Index (0 to NStepWave2) of each frequency component with a nonzero amplitude [-]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: Omega      !< Frequency of each component [(rad/s)]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveNmbr      !< Wavenumber of each component [(1/meter)]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: CosWaveDir      !< COS of the wave direction of each component [-]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: SinWaveDir      !< SIN of the wave direction of each component [-]
+    REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: WaveElevC0      !< Discrete Fourier transform of the instantaneous elevation of incident waves at the platform reference point for each component.  First column is real part, second column is imaginary part [(meters)]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveKinxi      !< xi-coordinates for points where the incident wave kinematics are computed [(meters)]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveKinyi      !< yi-coordinates for points where the incident wave kinematics are computed [(meters)]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveKinzi      !< zi-coordinates for points where the incident wave kinematics are computed [(meters)]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: CurrVxi      !< xi-component of the current velocity at each point [(m/s)]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: CurrVyi      !< yi-component of the current velocity at each point [(m/s)]
+    INTEGER(IntKi) , DIMENSION(:), ALLOCATABLE  :: WinStep      !< Wave time step (0 to NStepWave-1) held in each slot of the window; -1 for an empty slot [-]
+    REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: WinDynP      !< Instantaneous dynamic pressure of incident waves at each point, for each slot of the window [(N/m^2)]
+    REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: WinVel      !< Instantaneous velocity of incident waves (including current) in the xi- (1), yi- (2), and zi- (3) directions at each point, for each slot of the window [(m/s)]
+    REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: WinAcc      !< Instantaneous acceleration of incident waves in the xi- (1), yi- (2), and zi- (3) directions at each point, for each slot of the window [(m/s^2)]
+  END TYPE Waves_KinProviderType
+! =======================
 ! =========  Waves_InitInputType  =======
   TYPE, PUBLIC :: Waves_InitInputType
     CHARACTER(1024)  :: InputFile      !< Name of the input file [-]
     CHARACTER(1024)  :: DirRoot      !< The name of the root file including the full path.  This may be useful if you want this routine to write a permanent record of what it does to be stored with the simulation results: the results should be stored in a file whose name (including path) is generated by appending any suitable extension to DirRoot. [-]
     CHARACTER(1024)  :: WvKinFile      !< The root name of user input wave kinematics files [-]
+    INTEGER(IntKi)  :: WvKinMod      !< Wave kinematics evaluation {0: precomputed over the wave period, 1: on demand from the wave spectrum (see Waves_GetKinSlice)} [-]
+    CHARACTER(1024)  :: WvCacheDir      !< Directory of the wave kinematics cache files; empty for no cache [only used when WaveMod=1, 2, 3, 4, or 10] [-]
     LOGICAL  :: WriteWvKin      !< Flag indicating whether we are going to write out kinematics files.  [Must be FALSE if WaveMod = 5 or 6, if TRUE then WvKinFile must have a string value and this is the rootname for all the output files] [-]
     INTEGER(IntKi)  :: UnSum      !< The unit number for the HydroDyn summary file [-]
     REAL(ReKi)  :: Gravity      !< Gravitational acceleration [(m/s^2)]
@@ -103,6 +129,7 @@ IMPLICIT NONE
     REAL(SiKi)  :: RhoXg      !< = WtrDens*Gravity [-]
     INTEGER(IntKi)  :: NStepWave      !< Total number of frequency components = total number of time steps in the incident wave [-]
     INTEGER(IntKi)  :: NStepWave2      !< NStepWave / 2 [-]
+    TYPE(Waves_KinProviderType)  :: WaveKin      !< On-demand wave kinematics [only used when WvKinMod = 1; WaveDynP, WaveVel, and WaveAcc are not allocated then] [-]
   END TYPE Waves_InitOutputType
 ! =======================
 ! =========  Waves_ContinuousStateType  =======
@@ -150,6 +177,1055 @@ IMPLICIT NONE
   END TYPE Waves_OutputType
 ! =======================
 CONTAINS
+ SUBROUTINE Waves_CopyKinProviderType( SrcKinProviderTypeData, DstKinProviderTypeData, CtrlCode, ErrStat, ErrMsg )
+   TYPE(Waves_KinProviderType), INTENT(IN) :: SrcKinProviderTypeData
+   TYPE(Waves_KinProviderType), INTENT(INOUT) :: DstKinProviderTypeData
+   INTEGER(IntKi),  INTENT(IN   ) :: CtrlCode
+   INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
+   CHARACTER(*),    INTENT(  OUT) :: ErrMsg
+! Local 
+   INTEGER(IntKi)                 :: i,j,k
+   INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
+   INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
+   INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
+   INTEGER(IntKi)                 :: ErrStat2
+   CHARACTER(ErrMsgLen)           :: ErrMsg2
+   CHARACTER(*), PARAMETER        :: RoutineName = 'Waves_CopyKinProviderType'
+! 
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+    DstKinProviderTypeData%NStepWave = SrcKinProviderTypeData%NStepWave
+    DstKinProviderTypeData%NWaveKin = SrcKinProviderTypeData%NWaveKin
+    DstKinProviderTypeData%NFreq = SrcKinProviderTypeData%NFreq
+    DstKinProviderTypeData%WtrDpth = SrcKinProviderTypeData%WtrDpth
+    DstKinProviderTypeData%RhoXg = SrcKinProviderTypeData%RhoXg
+IF (ALLOCATED(SrcKinProviderTypeData%FreqIndx)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%FreqIndx,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%FreqIndx,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%FreqIndx)) THEN 
+    ALLOCATE(DstKinProviderTypeData%FreqIndx(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%FreqIndx.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%FreqIndx = SrcKinProviderTypeData%FreqIndx
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%Omega)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%Omega,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%Omega,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%Omega)) THEN 
+    ALLOCATE(DstKinProviderTypeData%Omega(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%Omega.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%Omega = SrcKinProviderTypeData%Omega
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%WaveNmbr)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%WaveNmbr,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%WaveNmbr,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%WaveNmbr)) THEN 
+    ALLOCATE(DstKinProviderTypeData%WaveNmbr(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%WaveNmbr.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%WaveNmbr = SrcKinProviderTypeData%WaveNmbr
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%CosWaveDir)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%CosWaveDir,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%CosWaveDir,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%CosWaveDir)) THEN 
+    ALLOCATE(DstKinProviderTypeData%CosWaveDir(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%CosWaveDir.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%CosWaveDir = SrcKinProviderTypeData%CosWaveDir
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%SinWaveDir)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%SinWaveDir,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%SinWaveDir,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%SinWaveDir)) THEN 
+    ALLOCATE(DstKinProviderTypeData%SinWaveDir(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%SinWaveDir.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%SinWaveDir = SrcKinProviderTypeData%SinWaveDir
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%WaveElevC0)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%WaveElevC0,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%WaveElevC0,1)
+  i2_l = LBOUND(SrcKinProviderTypeData%WaveElevC0,2)
+  i2_u = UBOUND(SrcKinProviderTypeData%WaveElevC0,2)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%WaveElevC0)) THEN 
+    ALLOCATE(DstKinProviderTypeData%WaveElevC0(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%WaveElevC0.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%WaveElevC0 = SrcKinProviderTypeData%WaveElevC0
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%WaveKinxi)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%WaveKinxi,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%WaveKinxi,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%WaveKinxi)) THEN 
+    ALLOCATE(DstKinProviderTypeData%WaveKinxi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%WaveKinxi.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%WaveKinxi = SrcKinProviderTypeData%WaveKinxi
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%WaveKinyi)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%WaveKinyi,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%WaveKinyi,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%WaveKinyi)) THEN 
+    ALLOCATE(DstKinProviderTypeData%WaveKinyi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%WaveKinyi.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%WaveKinyi = SrcKinProviderTypeData%WaveKinyi
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%WaveKinzi)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%WaveKinzi,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%WaveKinzi,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%WaveKinzi)) THEN 
+    ALLOCATE(DstKinProviderTypeData%WaveKinzi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%WaveKinzi.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%WaveKinzi = SrcKinProviderTypeData%WaveKinzi
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%CurrVxi)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%CurrVxi,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%CurrVxi,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%CurrVxi)) THEN 
+    ALLOCATE(DstKinProviderTypeData%CurrVxi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%CurrVxi.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%CurrVxi = SrcKinProviderTypeData%CurrVxi
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%CurrVyi)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%CurrVyi,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%CurrVyi,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%CurrVyi)) THEN 
+    ALLOCATE(DstKinProviderTypeData%CurrVyi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%CurrVyi.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%CurrVyi = SrcKinProviderTypeData%CurrVyi
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%WinStep)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%WinStep,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%WinStep,1)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%WinStep)) THEN 
+    ALLOCATE(DstKinProviderTypeData%WinStep(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%WinStep.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%WinStep = SrcKinProviderTypeData%WinStep
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%WinDynP)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%WinDynP,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%WinDynP,1)
+  i2_l = LBOUND(SrcKinProviderTypeData%WinDynP,2)
+  i2_u = UBOUND(SrcKinProviderTypeData%WinDynP,2)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%WinDynP)) THEN 
+    ALLOCATE(DstKinProviderTypeData%WinDynP(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%WinDynP.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%WinDynP = SrcKinProviderTypeData%WinDynP
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%WinVel)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%WinVel,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%WinVel,1)
+  i2_l = LBOUND(SrcKinProviderTypeData%WinVel,2)
+  i2_u = UBOUND(SrcKinProviderTypeData%WinVel,2)
+  i3_l = LBOUND(SrcKinProviderTypeData%WinVel,3)
+  i3_u = UBOUND(SrcKinProviderTypeData%WinVel,3)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%WinVel)) THEN 
+    ALLOCATE(DstKinProviderTypeData%WinVel(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%WinVel.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%WinVel = SrcKinProviderTypeData%WinVel
+ENDIF
+IF (ALLOCATED(SrcKinProviderTypeData%WinAcc)) THEN
+  i1_l = LBOUND(SrcKinProviderTypeData%WinAcc,1)
+  i1_u = UBOUND(SrcKinProviderTypeData%WinAcc,1)
+  i2_l = LBOUND(SrcKinProviderTypeData%WinAcc,2)
+  i2_u = UBOUND(SrcKinProviderTypeData%WinAcc,2)
+  i3_l = LBOUND(SrcKinProviderTypeData%WinAcc,3)
+  i3_u = UBOUND(SrcKinProviderTypeData%WinAcc,3)
+  IF (.NOT. ALLOCATED(DstKinProviderTypeData%WinAcc)) THEN 
+    ALLOCATE(DstKinProviderTypeData%WinAcc(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstKinProviderTypeData%WinAcc.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstKinProviderTypeData%WinAcc = SrcKinProviderTypeData%WinAcc
+ENDIF
+ END SUBROUTINE Waves_CopyKinProviderType
+
+ SUBROUTINE Waves_DestroyKinProviderType( KinProviderTypeData, ErrStat, ErrMsg )
+  TYPE(Waves_KinProviderType), INTENT(INOUT) :: KinProviderTypeData
+  INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
+  CHARACTER(*),    INTENT(  OUT) :: ErrMsg
+  CHARACTER(*),    PARAMETER :: RoutineName = 'Waves_DestroyKinProviderType'
+  INTEGER(IntKi)                 :: i, i1, i2, i3, i4, i5 
+! 
+  ErrStat = ErrID_None
+  ErrMsg  = ""
+IF (ALLOCATED(KinProviderTypeData%FreqIndx)) THEN
+  DEALLOCATE(KinProviderTypeData%FreqIndx)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%Omega)) THEN
+  DEALLOCATE(KinProviderTypeData%Omega)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%WaveNmbr)) THEN
+  DEALLOCATE(KinProviderTypeData%WaveNmbr)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%CosWaveDir)) THEN
+  DEALLOCATE(KinProviderTypeData%CosWaveDir)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%SinWaveDir)) THEN
+  DEALLOCATE(KinProviderTypeData%SinWaveDir)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%WaveElevC0)) THEN
+  DEALLOCATE(KinProviderTypeData%WaveElevC0)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%WaveKinxi)) THEN
+  DEALLOCATE(KinProviderTypeData%WaveKinxi)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%WaveKinyi)) THEN
+  DEALLOCATE(KinProviderTypeData%WaveKinyi)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%WaveKinzi)) THEN
+  DEALLOCATE(KinProviderTypeData%WaveKinzi)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%CurrVxi)) THEN
+  DEALLOCATE(KinProviderTypeData%CurrVxi)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%CurrVyi)) THEN
+  DEALLOCATE(KinProviderTypeData%CurrVyi)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%WinStep)) THEN
+  DEALLOCATE(KinProviderTypeData%WinStep)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%WinDynP)) THEN
+  DEALLOCATE(KinProviderTypeData%WinDynP)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%WinVel)) THEN
+  DEALLOCATE(KinProviderTypeData%WinVel)
+ENDIF
+IF (ALLOCATED(KinProviderTypeData%WinAcc)) THEN
+  DEALLOCATE(KinProviderTypeData%WinAcc)
+ENDIF
+ END SUBROUTINE Waves_DestroyKinProviderType
+
+ SUBROUTINE Waves_PackKinProviderType( ReKiBuf, DbKiBuf, IntKiBuf, Indata, ErrStat, ErrMsg, SizeOnly )
+  REAL(ReKi),       ALLOCATABLE, INTENT(  OUT) :: ReKiBuf(:)
+  REAL(DbKi),       ALLOCATABLE, INTENT(  OUT) :: DbKiBuf(:)
+  INTEGER(IntKi),   ALLOCATABLE, INTENT(  OUT) :: IntKiBuf(:)
+  TYPE(Waves_KinProviderType),  INTENT(IN) :: InData
+  INTEGER(IntKi),   INTENT(  OUT) :: ErrStat
+  CHARACTER(*),     INTENT(  OUT) :: ErrMsg
+  LOGICAL,OPTIONAL, INTENT(IN   ) :: SizeOnly
+    ! Local variables
+  INTEGER(IntKi)                 :: Re_BufSz
+  INTEGER(IntKi)                 :: Re_Xferred
+  INTEGER(IntKi)                 :: Db_BufSz
+  INTEGER(IntKi)                 :: Db_Xferred
+  INTEGER(IntKi)                 :: Int_BufSz
+  INTEGER(IntKi)                 :: Int_Xferred
+  INTEGER(IntKi)                 :: i,i1,i2,i3,i4,i5
+  LOGICAL                        :: OnlySize ! if present and true, do not pack, just allocate buffers
+  INTEGER(IntKi)                 :: ErrStat2
+  CHARACTER(ErrMsgLen)           :: ErrMsg2
+  CHARACTER(*), PARAMETER        :: RoutineName = 'Waves_PackKinProviderType'
+ ! buffers to store subtypes, if any
+  REAL(ReKi),      ALLOCATABLE   :: Re_Buf(:)
+  REAL(DbKi),      ALLOCATABLE   :: Db_Buf(:)
+  INTEGER(IntKi),  ALLOCATABLE   :: Int_Buf(:)
+
+  OnlySize = .FALSE.
+  IF ( PRESENT(SizeOnly) ) THEN
+    OnlySize = SizeOnly
+  ENDIF
+    !
+  ErrStat = ErrID_None
+  ErrMsg  = ""
+  Re_BufSz  = 0
+  Db_BufSz  = 0
+  Int_BufSz  = 0
+      Int_BufSz  = Int_BufSz  + 1  ! NStepWave
+      Int_BufSz  = Int_BufSz  + 1  ! NWaveKin
+      Int_BufSz  = Int_BufSz  + 1  ! NFreq
+      Re_BufSz   = Re_BufSz   + 1  ! WtrDpth
+      Re_BufSz   = Re_BufSz   + 1  ! RhoXg
+  Int_BufSz   = Int_BufSz   + 1     ! FreqIndx allocated yes/no
+  IF ( ALLOCATED(InData%FreqIndx) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! FreqIndx upper/lower bounds for each dimension
+      Int_BufSz  = Int_BufSz  + SIZE(InData%FreqIndx)  ! FreqIndx
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! Omega allocated yes/no
+  IF ( ALLOCATED(InData%Omega) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! Omega upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%Omega)  ! Omega
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! WaveNmbr allocated yes/no
+  IF ( ALLOCATED(InData%WaveNmbr) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! WaveNmbr upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%WaveNmbr)  ! WaveNmbr
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! CosWaveDir allocated yes/no
+  IF ( ALLOCATED(InData%CosWaveDir) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! CosWaveDir upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%CosWaveDir)  ! CosWaveDir
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! SinWaveDir allocated yes/no
+  IF ( ALLOCATED(InData%SinWaveDir) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! SinWaveDir upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%SinWaveDir)  ! SinWaveDir
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! WaveElevC0 allocated yes/no
+  IF ( ALLOCATED(InData%WaveElevC0) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! WaveElevC0 upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%WaveElevC0)  ! WaveElevC0
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! WaveKinxi allocated yes/no
+  IF ( ALLOCATED(InData%WaveKinxi) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! WaveKinxi upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%WaveKinxi)  ! WaveKinxi
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! WaveKinyi allocated yes/no
+  IF ( ALLOCATED(InData%WaveKinyi) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! WaveKinyi upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%WaveKinyi)  ! WaveKinyi
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! WaveKinzi allocated yes/no
+  IF ( ALLOCATED(InData%WaveKinzi) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! WaveKinzi upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%WaveKinzi)  ! WaveKinzi
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! CurrVxi allocated yes/no
+  IF ( ALLOCATED(InData%CurrVxi) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! CurrVxi upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%CurrVxi)  ! CurrVxi
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! CurrVyi allocated yes/no
+  IF ( ALLOCATED(InData%CurrVyi) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! CurrVyi upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%CurrVyi)  ! CurrVyi
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! WinStep allocated yes/no
+  IF ( ALLOCATED(InData%WinStep) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*1  ! WinStep upper/lower bounds for each dimension
+      Int_BufSz  = Int_BufSz  + SIZE(InData%WinStep)  ! WinStep
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! WinDynP allocated yes/no
+  IF ( ALLOCATED(InData%WinDynP) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! WinDynP upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%WinDynP)  ! WinDynP
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! WinVel allocated yes/no
+  IF ( ALLOCATED(InData%WinVel) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*3  ! WinVel upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%WinVel)  ! WinVel
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! WinAcc allocated yes/no
+  IF ( ALLOCATED(InData%WinAcc) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*3  ! WinAcc upper/lower bounds for each dimension
+      Re_BufSz   = Re_BufSz   + SIZE(InData%WinAcc)  ! WinAcc
+  END IF
+  IF ( Re_BufSz  .GT. 0 ) THEN 
+     ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
+     IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating ReKiBuf.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+     END IF
+  END IF
+  IF ( Db_BufSz  .GT. 0 ) THEN 
+     ALLOCATE( DbKiBuf(  Db_BufSz  ), STAT=ErrStat2 )
+     IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating DbKiBuf.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+     END IF
+  END IF
+  IF ( Int_BufSz  .GT. 0 ) THEN 
+     ALLOCATE( IntKiBuf(  Int_BufSz  ), STAT=ErrStat2 )
+     IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating IntKiBuf.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+     END IF
+  END IF
+  IF(OnlySize) RETURN ! return early if only trying to allocate buffers (not pack them)
+
+  Re_Xferred  = 1
+  Db_Xferred  = 1
+  Int_Xferred = 1
+
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NStepWave
+      Int_Xferred   = Int_Xferred   + 1
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NWaveKin
+      Int_Xferred   = Int_Xferred   + 1
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NFreq
+      Int_Xferred   = Int_Xferred   + 1
+      ReKiBuf ( Re_Xferred:Re_Xferred+(1)-1 ) = InData%WtrDpth
+      Re_Xferred   = Re_Xferred   + 1
+      ReKiBuf ( Re_Xferred:Re_Xferred+(1)-1 ) = InData%RhoXg
+      Re_Xferred   = Re_Xferred   + 1
+  IF ( .NOT. ALLOCATED(InData%FreqIndx) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%FreqIndx,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%FreqIndx,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%FreqIndx)>0) IntKiBuf ( Int_Xferred:Int_Xferred+(SIZE(InData%FreqIndx))-1 ) = PACK(InData%FreqIndx,.TRUE.)
+      Int_Xferred   = Int_Xferred   + SIZE(InData%FreqIndx)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%Omega) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%Omega,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%Omega,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%Omega)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%Omega))-1 ) = PACK(InData%Omega,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%Omega)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%WaveNmbr) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WaveNmbr,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WaveNmbr,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%WaveNmbr)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%WaveNmbr))-1 ) = PACK(InData%WaveNmbr,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%WaveNmbr)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%CosWaveDir) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%CosWaveDir,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%CosWaveDir,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%CosWaveDir)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%CosWaveDir))-1 ) = PACK(InData%CosWaveDir,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%CosWaveDir)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%SinWaveDir) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%SinWaveDir,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%SinWaveDir,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%SinWaveDir)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%SinWaveDir))-1 ) = PACK(InData%SinWaveDir,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%SinWaveDir)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%WaveElevC0) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WaveElevC0,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WaveElevC0,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WaveElevC0,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WaveElevC0,2)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%WaveElevC0)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%WaveElevC0))-1 ) = PACK(InData%WaveElevC0,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%WaveElevC0)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%WaveKinxi) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WaveKinxi,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WaveKinxi,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%WaveKinxi)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%WaveKinxi))-1 ) = PACK(InData%WaveKinxi,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%WaveKinxi)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%WaveKinyi) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WaveKinyi,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WaveKinyi,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%WaveKinyi)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%WaveKinyi))-1 ) = PACK(InData%WaveKinyi,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%WaveKinyi)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%WaveKinzi) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WaveKinzi,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WaveKinzi,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%WaveKinzi)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%WaveKinzi))-1 ) = PACK(InData%WaveKinzi,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%WaveKinzi)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%CurrVxi) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%CurrVxi,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%CurrVxi,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%CurrVxi)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%CurrVxi))-1 ) = PACK(InData%CurrVxi,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%CurrVxi)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%CurrVyi) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%CurrVyi,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%CurrVyi,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%CurrVyi)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%CurrVyi))-1 ) = PACK(InData%CurrVyi,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%CurrVyi)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%WinStep) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WinStep,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WinStep,1)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%WinStep)>0) IntKiBuf ( Int_Xferred:Int_Xferred+(SIZE(InData%WinStep))-1 ) = PACK(InData%WinStep,.TRUE.)
+      Int_Xferred   = Int_Xferred   + SIZE(InData%WinStep)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%WinDynP) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WinDynP,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WinDynP,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WinDynP,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WinDynP,2)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%WinDynP)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%WinDynP))-1 ) = PACK(InData%WinDynP,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%WinDynP)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%WinVel) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WinVel,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WinVel,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WinVel,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WinVel,2)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WinVel,3)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WinVel,3)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%WinVel)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%WinVel))-1 ) = PACK(InData%WinVel,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%WinVel)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%WinAcc) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WinAcc,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WinAcc,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WinAcc,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WinAcc,2)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%WinAcc,3)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%WinAcc,3)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%WinAcc)>0) ReKiBuf ( Re_Xferred:Re_Xferred+(SIZE(InData%WinAcc))-1 ) = PACK(InData%WinAcc,.TRUE.)
+      Re_Xferred   = Re_Xferred   + SIZE(InData%WinAcc)
+  END IF
+ END SUBROUTINE Waves_PackKinProviderType
+
+ SUBROUTINE Waves_UnPackKinProviderType( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
+  REAL(ReKi),      ALLOCATABLE, INTENT(IN   ) :: ReKiBuf(:)
+  REAL(DbKi),      ALLOCATABLE, INTENT(IN   ) :: DbKiBuf(:)
+  INTEGER(IntKi),  ALLOCATABLE, INTENT(IN   ) :: IntKiBuf(:)
+  TYPE(Waves_KinProviderType), INTENT(INOUT) :: OutData
+  INTEGER(IntKi),  INTENT(  OUT) :: ErrStat
+  CHARACTER(*),    INTENT(  OUT) :: ErrMsg
+    ! Local variables
+  INTEGER(IntKi)                 :: Buf_size
+  INTEGER(IntKi)                 :: Re_Xferred
+  INTEGER(IntKi)                 :: Db_Xferred
+  INTEGER(IntKi)                 :: Int_Xferred
+  INTEGER(IntKi)                 :: i
+  LOGICAL                        :: mask0
+  LOGICAL, ALLOCATABLE           :: mask1(:)
+  LOGICAL, ALLOCATABLE           :: mask2(:,:)
+  LOGICAL, ALLOCATABLE           :: mask3(:,:,:)
+  LOGICAL, ALLOCATABLE           :: mask4(:,:,:,:)
+  LOGICAL, ALLOCATABLE           :: mask5(:,:,:,:,:)
+  INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
+  INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
+  INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
+  INTEGER(IntKi)                 :: ErrStat2
+  CHARACTER(ErrMsgLen)           :: ErrMsg2
+  CHARACTER(*), PARAMETER        :: RoutineName = 'Waves_UnPackKinProviderType'
+ ! buffers to store meshes, if any
+  REAL(ReKi),      ALLOCATABLE   :: Re_Buf(:)
+  REAL(DbKi),      ALLOCATABLE   :: Db_Buf(:)
+  INTEGER(IntKi),  ALLOCATABLE   :: Int_Buf(:)
+    !
+  ErrStat = ErrID_None
+  ErrMsg  = ""
+  Re_Xferred  = 1
+  Db_Xferred  = 1
+  Int_Xferred  = 1
+      OutData%NStepWave = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
+      OutData%NWaveKin = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
+      OutData%NFreq = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
+      OutData%WtrDpth = REAL( ReKiBuf( Re_Xferred ), SiKi) 
+      Re_Xferred   = Re_Xferred + 1
+      OutData%RhoXg = REAL( ReKiBuf( Re_Xferred ), SiKi) 
+      Re_Xferred   = Re_Xferred + 1
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! FreqIndx not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%FreqIndx)) DEALLOCATE(OutData%FreqIndx)
+    ALLOCATE(OutData%FreqIndx(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%FreqIndx.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%FreqIndx)>0) OutData%FreqIndx = UNPACK( IntKiBuf ( Int_Xferred:Int_Xferred+(SIZE(OutData%FreqIndx))-1 ), mask1, 0_IntKi )
+      Int_Xferred   = Int_Xferred   + SIZE(OutData%FreqIndx)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! Omega not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%Omega)) DEALLOCATE(OutData%Omega)
+    ALLOCATE(OutData%Omega(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%Omega.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%Omega)>0) OutData%Omega = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%Omega))-1 ), mask1, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%Omega)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WaveNmbr not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%WaveNmbr)) DEALLOCATE(OutData%WaveNmbr)
+    ALLOCATE(OutData%WaveNmbr(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%WaveNmbr.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%WaveNmbr)>0) OutData%WaveNmbr = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%WaveNmbr))-1 ), mask1, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%WaveNmbr)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CosWaveDir not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%CosWaveDir)) DEALLOCATE(OutData%CosWaveDir)
+    ALLOCATE(OutData%CosWaveDir(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CosWaveDir.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%CosWaveDir)>0) OutData%CosWaveDir = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%CosWaveDir))-1 ), mask1, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%CosWaveDir)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! SinWaveDir not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%SinWaveDir)) DEALLOCATE(OutData%SinWaveDir)
+    ALLOCATE(OutData%SinWaveDir(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%SinWaveDir.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%SinWaveDir)>0) OutData%SinWaveDir = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%SinWaveDir))-1 ), mask1, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%SinWaveDir)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WaveElevC0 not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%WaveElevC0)) DEALLOCATE(OutData%WaveElevC0)
+    ALLOCATE(OutData%WaveElevC0(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%WaveElevC0.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%WaveElevC0)>0) OutData%WaveElevC0 = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%WaveElevC0))-1 ), mask2, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%WaveElevC0)
+    DEALLOCATE(mask2)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WaveKinxi not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%WaveKinxi)) DEALLOCATE(OutData%WaveKinxi)
+    ALLOCATE(OutData%WaveKinxi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%WaveKinxi.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%WaveKinxi)>0) OutData%WaveKinxi = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%WaveKinxi))-1 ), mask1, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%WaveKinxi)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WaveKinyi not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%WaveKinyi)) DEALLOCATE(OutData%WaveKinyi)
+    ALLOCATE(OutData%WaveKinyi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%WaveKinyi.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%WaveKinyi)>0) OutData%WaveKinyi = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%WaveKinyi))-1 ), mask1, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%WaveKinyi)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WaveKinzi not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%WaveKinzi)) DEALLOCATE(OutData%WaveKinzi)
+    ALLOCATE(OutData%WaveKinzi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%WaveKinzi.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%WaveKinzi)>0) OutData%WaveKinzi = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%WaveKinzi))-1 ), mask1, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%WaveKinzi)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CurrVxi not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%CurrVxi)) DEALLOCATE(OutData%CurrVxi)
+    ALLOCATE(OutData%CurrVxi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CurrVxi.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%CurrVxi)>0) OutData%CurrVxi = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%CurrVxi))-1 ), mask1, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%CurrVxi)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! CurrVyi not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%CurrVyi)) DEALLOCATE(OutData%CurrVyi)
+    ALLOCATE(OutData%CurrVyi(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%CurrVyi.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%CurrVyi)>0) OutData%CurrVyi = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%CurrVyi))-1 ), mask1, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%CurrVyi)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WinStep not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%WinStep)) DEALLOCATE(OutData%WinStep)
+    ALLOCATE(OutData%WinStep(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%WinStep.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask1(i1_l:i1_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask1.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask1 = .TRUE. 
+      IF (SIZE(OutData%WinStep)>0) OutData%WinStep = UNPACK( IntKiBuf ( Int_Xferred:Int_Xferred+(SIZE(OutData%WinStep))-1 ), mask1, 0_IntKi )
+      Int_Xferred   = Int_Xferred   + SIZE(OutData%WinStep)
+    DEALLOCATE(mask1)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WinDynP not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%WinDynP)) DEALLOCATE(OutData%WinDynP)
+    ALLOCATE(OutData%WinDynP(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%WinDynP.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%WinDynP)>0) OutData%WinDynP = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%WinDynP))-1 ), mask2, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%WinDynP)
+    DEALLOCATE(mask2)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WinVel not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%WinVel)) DEALLOCATE(OutData%WinVel)
+    ALLOCATE(OutData%WinVel(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%WinVel.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask3(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask3.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask3 = .TRUE. 
+      IF (SIZE(OutData%WinVel)>0) OutData%WinVel = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%WinVel))-1 ), mask3, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%WinVel)
+    DEALLOCATE(mask3)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! WinAcc not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i3_l = IntKiBuf( Int_Xferred    )
+    i3_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%WinAcc)) DEALLOCATE(OutData%WinAcc)
+    ALLOCATE(OutData%WinAcc(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%WinAcc.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask3(i1_l:i1_u,i2_l:i2_u,i3_l:i3_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask3.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask3 = .TRUE. 
+      IF (SIZE(OutData%WinAcc)>0) OutData%WinAcc = REAL( UNPACK(ReKiBuf( Re_Xferred:Re_Xferred+(SIZE(OutData%WinAcc))-1 ), mask3, 0.0_ReKi ), SiKi)
+      Re_Xferred   = Re_Xferred   + SIZE(OutData%WinAcc)
+    DEALLOCATE(mask3)
+  END IF
+ END SUBROUTINE Waves_UnPackKinProviderType
+
  SUBROUTINE Waves_CopyInitInput( SrcInitInputData, DstInitInputData, CtrlCode, ErrStat, ErrMsg )
    TYPE(Waves_InitInputType), INTENT(IN) :: SrcInitInputData
    TYPE(Waves_InitInputType), INTENT(INOUT) :: DstInitInputData
@@ -160,7 +1236,6 @@ CONTAINS
    INTEGER(IntKi)                 :: i,j,k
    INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
    INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
-   INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
    INTEGER(IntKi)                 :: ErrStat2
    CHARACTER(ErrMsgLen)           :: ErrMsg2
    CHARACTER(*), PARAMETER        :: RoutineName = 'Waves_CopyInitInput'
@@ -170,6 +1245,8 @@ CONTAINS
     DstInitInputData%InputFile = SrcInitInputData%InputFile
     DstInitInputData%DirRoot = SrcInitInputData%DirRoot
     DstInitInputData%WvKinFile = SrcInitInputData%WvKinFile
+    DstInitInputData%WvKinMod = SrcInitInputData%WvKinMod
+    DstInitInputData%WvCacheDir = SrcInitInputData%WvCacheDir
     DstInitInputData%WriteWvKin = SrcInitInputData%WriteWvKin
     DstInitInputData%UnSum = SrcInitInputData%UnSum
     DstInitInputData%Gravity = SrcInitInputData%Gravity
@@ -373,6 +1450,8 @@ ENDIF
       Int_BufSz  = Int_BufSz  + 1*LEN(InData%InputFile)  ! InputFile
       Int_BufSz  = Int_BufSz  + 1*LEN(InData%DirRoot)  ! DirRoot
       Int_BufSz  = Int_BufSz  + 1*LEN(InData%WvKinFile)  ! WvKinFile
+      Int_BufSz  = Int_BufSz  + 1  ! WvKinMod
+      Int_BufSz  = Int_BufSz  + 1*LEN(InData%WvCacheDir)  ! WvCacheDir
       Int_BufSz  = Int_BufSz  + 1  ! WriteWvKin
       Int_BufSz  = Int_BufSz  + 1  ! UnSum
       Re_BufSz   = Re_BufSz   + 1  ! Gravity
@@ -482,6 +1561,12 @@ ENDIF
           IntKiBuf(Int_Xferred) = ICHAR(InData%WvKinFile(I:I), IntKi)
           Int_Xferred = Int_Xferred   + 1
         END DO ! I
+      IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%WvKinMod
+      Int_Xferred   = Int_Xferred   + 1
+        DO I = 1, LEN(InData%WvCacheDir)
+          IntKiBuf(Int_Xferred) = ICHAR(InData%WvCacheDir(I:I), IntKi)
+          Int_Xferred = Int_Xferred   + 1
+        END DO ! I
       IntKiBuf ( Int_Xferred:Int_Xferred+1-1 ) = TRANSFER( InData%WriteWvKin , IntKiBuf(1), 1)
       Int_Xferred   = Int_Xferred   + 1
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%UnSum
@@ -676,7 +1761,6 @@ ENDIF
   LOGICAL, ALLOCATABLE           :: mask5(:,:,:,:,:)
   INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
   INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
-  INTEGER(IntKi)                 :: i3, i3_l, i3_u  !  bounds (upper/lower) for an array dimension 3
   INTEGER(IntKi)                 :: ErrStat2
   CHARACTER(ErrMsgLen)           :: ErrMsg2
   CHARACTER(*), PARAMETER        :: RoutineName = 'Waves_UnPackInitInput'
@@ -702,6 +1786,12 @@ ENDIF
         OutData%WvKinFile(I:I) = CHAR(IntKiBuf(Int_Xferred))
         Int_Xferred = Int_Xferred   + 1
       END DO ! I
+      OutData%WvKinMod = IntKiBuf( Int_Xferred ) 
+      Int_Xferred   = Int_Xferred + 1
+      DO I = 1, LEN(OutData%WvCacheDir)
+        OutData%WvCacheDir(I:I) = CHAR(IntKiBuf(Int_Xferred))
+        Int_Xferred = Int_Xferred   + 1
+      END DO ! I
       OutData%WriteWvKin = TRANSFER( IntKiBuf( Int_Xferred ), mask0 )
       Int_Xferred   = Int_Xferred + 1
       OutData%UnSum = IntKiBuf( Int_Xferred ) 
@@ -1175,6 +2265,9 @@ ENDIF
     DstInitOutputData%RhoXg = SrcInitOutputData%RhoXg
     DstInitOutputData%NStepWave = SrcInitOutputData%NStepWave
     DstInitOutputData%NStepWave2 = SrcInitOutputData%NStepWave2
+      CALL Waves_Copykinprovidertype( SrcInitOutputData%WaveKin, DstInitOutputData%WaveKin, CtrlCode, ErrStat2, ErrMsg2 )
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
+         IF (ErrStat>=AbortErrLev) RETURN
  END SUBROUTINE Waves_CopyInitOutput
 
  SUBROUTINE Waves_DestroyInitOutput( InitOutputData, ErrStat, ErrMsg )
@@ -1225,6 +2318,7 @@ ENDIF
 IF (ALLOCATED(InitOutputData%nodeInWater)) THEN
   DEALLOCATE(InitOutputData%nodeInWater)
 ENDIF
+  CALL Waves_Destroykinprovidertype( InitOutputData%WaveKin, ErrStat, ErrMsg )
  END SUBROUTINE Waves_DestroyInitOutput
 
  SUBROUTINE Waves_PackInitOutput( ReKiBuf, DbKiBuf, IntKiBuf, Indata, ErrStat, ErrMsg, SizeOnly )
@@ -1337,6 +2431,24 @@ ENDIF
       Re_BufSz   = Re_BufSz   + 1  ! RhoXg
       Int_BufSz  = Int_BufSz  + 1  ! NStepWave
       Int_BufSz  = Int_BufSz  + 1  ! NStepWave2
+   ! Allocate buffers for subtypes, if any (we'll get sizes from these) 
+      Int_BufSz   = Int_BufSz + 3  ! WaveKin: size of buffers for each call to pack subtype
+      CALL Waves_Packkinprovidertype( Re_Buf, Db_Buf, Int_Buf, InData%WaveKin, ErrStat2, ErrMsg2, .TRUE. ) ! WaveKin 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN ! WaveKin
+         Re_BufSz  = Re_BufSz  + SIZE( Re_Buf  )
+         DEALLOCATE(Re_Buf)
+      END IF
+      IF(ALLOCATED(Db_Buf)) THEN ! WaveKin
+         Db_BufSz  = Db_BufSz  + SIZE( Db_Buf  )
+         DEALLOCATE(Db_Buf)
+      END IF
+      IF(ALLOCATED(Int_Buf)) THEN ! WaveKin
+         Int_BufSz = Int_BufSz + SIZE( Int_Buf )
+         DEALLOCATE(Int_Buf)
+      END IF
   IF ( Re_BufSz  .GT. 0 ) THEN 
      ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
      IF (ErrStat2 /= 0) THEN 
@@ -1595,6 +2707,34 @@ ENDIF
       Int_Xferred   = Int_Xferred   + 1
       IntKiBuf ( Int_Xferred:Int_Xferred+(1)-1 ) = InData%NStepWave2
       Int_Xferred   = Int_Xferred   + 1
+      CALL Waves_Packkinprovidertype( Re_Buf, Db_Buf, Int_Buf, InData%WaveKin, ErrStat2, ErrMsg2, OnlySize ) ! WaveKin 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Re_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Re_Buf) > 0) ReKiBuf( Re_Xferred:Re_Xferred+SIZE(Re_Buf)-1 ) = Re_Buf
+        Re_Xferred = Re_Xferred + SIZE(Re_Buf)
+        DEALLOCATE(Re_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Db_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Db_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Db_Buf) > 0) DbKiBuf( Db_Xferred:Db_Xferred+SIZE(Db_Buf)-1 ) = Db_Buf
+        Db_Xferred = Db_Xferred + SIZE(Db_Buf)
+        DEALLOCATE(Db_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
+      IF(ALLOCATED(Int_Buf)) THEN
+        IntKiBuf( Int_Xferred ) = SIZE(Int_Buf); Int_Xferred = Int_Xferred + 1
+        IF (SIZE(Int_Buf) > 0) IntKiBuf( Int_Xferred:Int_Xferred+SIZE(Int_Buf)-1 ) = Int_Buf
+        Int_Xferred = Int_Xferred + SIZE(Int_Buf)
+        DEALLOCATE(Int_Buf)
+      ELSE
+        IntKiBuf( Int_Xferred ) = 0; Int_Xferred = Int_Xferred + 1
+      ENDIF
  END SUBROUTINE Waves_PackInitOutput
 
  SUBROUTINE Waves_UnPackInitOutput( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
@@ -1993,6 +3133,46 @@ ENDIF
       Int_Xferred   = Int_Xferred + 1
       OutData%NStepWave2 = IntKiBuf( Int_Xferred ) 
       Int_Xferred   = Int_Xferred + 1
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Re_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Re_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Re_Buf = ReKiBuf( Re_Xferred:Re_Xferred+Buf_size-1 )
+        Re_Xferred = Re_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Db_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Db_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Db_Buf = DbKiBuf( Db_Xferred:Db_Xferred+Buf_size-1 )
+        Db_Xferred = Db_Xferred + Buf_size
+      END IF
+      Buf_size=IntKiBuf( Int_Xferred )
+      Int_Xferred = Int_Xferred + 1
+      IF(Buf_size > 0) THEN
+        ALLOCATE(Int_Buf(Buf_size),STAT=ErrStat2)
+        IF (ErrStat2 /= 0) THEN 
+           CALL SetErrStat(ErrID_Fatal, 'Error allocating Int_Buf.', ErrStat, ErrMsg,RoutineName)
+           RETURN
+        END IF
+        Int_Buf = IntKiBuf( Int_Xferred:Int_Xferred+Buf_size-1 )
+        Int_Xferred = Int_Xferred + Buf_size
+      END IF
+      CALL Waves_Unpackkinprovidertype( Re_Buf, Db_Buf, Int_Buf, OutData%WaveKin, ErrStat2, ErrMsg2 ) ! WaveKin 
+        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+        IF (ErrStat >= AbortErrLev) RETURN
+
+      IF(ALLOCATED(Re_Buf )) DEALLOCATE(Re_Buf )
+      IF(ALLOCATED(Db_Buf )) DEALLOCATE(Db_Buf )
+      IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
  END SUBROUTINE Waves_UnPackInitOutput
 
  SUBROUTINE Waves_CopyContState( SrcContStateData, DstContStateData, CtrlCode, ErrStat, ErrMsg )
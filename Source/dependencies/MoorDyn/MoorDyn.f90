@@ -29,6 +29,10 @@ MODULE MoorDyn
 
    TYPE(ProgDesc), PARAMETER            :: MD_ProgDesc = ProgDesc( 'MoorDyn', 'v1.01.02F', '8-Apr-2016' )
 
+#ifdef DEBUG_SCRATCH_ALLOC
+   INTEGER(IntKi), PUBLIC               :: MD_NumScratchAllocs = 0  ! number of times MD_CalcContStateDeriv allocated dxdt; should stay 0 after MD_Init
+#endif
+
 
    PUBLIC :: MD_Init
    PUBLIC :: MD_UpdateStates
@@ -290,6 +294,18 @@ CONTAINS
       IF (ErrStat >= AbortErrLev) RETURN
 
 
+      ! allocate the scratch states and inputs used by MD_CalcOutput and TimeStep once here instead of on every call
+      CALL MD_CopyContState( x, m%xdot, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
+         CALL CheckError( ErrStat2, ErrMsg2 )
+         IF (ErrStat >= AbortErrLev) RETURN
+      CALL MD_CopyContState( x, m%x2, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
+         CALL CheckError( ErrStat2, ErrMsg2 )
+         IF (ErrStat >= AbortErrLev) RETURN
+      CALL MD_CopyInput( u, m%u_interp, MESH_NEWCOPY, ErrStat2, ErrMsg2 )
+         CALL CheckError( ErrStat2, ErrMsg2 )
+         IF (ErrStat >= AbortErrLev) RETURN
+
+
       ! --------------------------------------------------------------------
       !   go through all Connects and set position based on input file
       ! --------------------------------------------------------------------
@@ -601,7 +617,6 @@ CONTAINS
       INTEGER(IntKi)                 , INTENT(INOUT) :: ErrStat
       CHARACTER(*)                   , INTENT(INOUT) :: ErrMsg
 
-      TYPE(MD_ContinuousStateType)                   :: dxdt    ! time derivatives of continuous states (initialized in CalcContStateDeriv)
       INTEGER(IntKi)                                 :: I       ! counter
       INTEGER(IntKi)                                 :: J       ! counter
       REAL(ReKi)                                     :: t2      ! real version of t (double)
@@ -623,7 +638,7 @@ CONTAINS
       END DO
 
       ! call CalcContStateDeriv in order to run model and calculate dynamics with provided x and u
-      CALL MD_CalcContStateDeriv( t2, u, p, x, xd, z, other, m, dxdt, ErrStat, ErrMsg )
+      CALL MD_CalcContStateDeriv( t2, u, p, x, xd, z, other, m, m%xdot, ErrStat, ErrMsg )
 
 
       ! assign net force on fairlead Connects to the output mesh
@@ -640,17 +655,11 @@ CONTAINS
       IF ( ErrStat >= AbortErrLev ) RETURN
 
 
-      ! destroy dxdt
-      CALL MD_DestroyContState( dxdt, ErrStat2, ErrMsg2)
-      CALL CheckError(ErrStat2, 'When destroying dxdt: '//trim(ErrMsg2))
-      IF ( ErrStat >= AbortErrLev ) RETURN
-
-
 
    CONTAINS
 
       SUBROUTINE CheckError(ErrId, Msg)
-        ! This subroutine sets the error message and level and cleans up if the error is >= AbortErrLev
+        ! This subroutine sets the error message and level
 
          INTEGER(IntKi), INTENT(IN) :: ErrID       ! The error identifier (ErrStat)
          CHARACTER(*),   INTENT(IN) :: Msg         ! The error message (ErrMsg)
@@ -663,10 +672,6 @@ CONTAINS
             ErrStat = MAX(ErrStat, ErrID)
 
             CALL WrScr( ErrMsg )  ! do this always or only if warning level? <<<<<<<<<<<<<<<<<<<<<< probably should remove all instances
-
-            IF( ErrStat > ErrID_Warn ) THEN
-                CALL MD_DestroyContState( dxdt, ErrStat2, ErrMsg2)
-            END IF
          END IF
 
       END SUBROUTINE CheckError
@@ -688,7 +693,7 @@ CONTAINS
       TYPE(MD_ConstraintStateType),       INTENT(IN )    :: z       ! Constraint states at t
       TYPE(MD_OtherStateType),            INTENT(IN )    :: other   ! Other states at t
       TYPE(MD_MiscVarType),               INTENT(INOUT)  :: m       ! misc/optimization variables
-      TYPE(MD_ContinuousStateType),       INTENT(  OUT)  :: dxdt    ! Continuous state derivatives at t
+      TYPE(MD_ContinuousStateType),       INTENT(INOUT)  :: dxdt    ! Continuous state derivatives at t (allocated in MD_Init when passed from m)
       INTEGER(IntKi),                     INTENT( OUT)   :: ErrStat ! Error status of the operation
       CHARACTER(*),                       INTENT( OUT)   :: ErrMsg  ! Error message if ErrStat /= ErrID_None
 
@@ -704,11 +709,16 @@ CONTAINS
       ErrStat = ErrID_None
       ErrMsg = ""
 
-      ! allocations of dxdt (as in SubDyn.  "INTENT(OUT) automatically deallocates the arrays on entry, we have to allocate them here"  is this right/efficient?)
-      ALLOCATE ( dxdt%states(size(x%states)), STAT = ErrStat )
-      IF ( ErrStat /= ErrID_None ) THEN
-          ErrMsg  = ' Error allocating dxdt%states array.'
-          RETURN
+      ! dxdt is normally one of the scratch states in m, which are allocated in MD_Init; only allocate it for other callers
+      IF ( .NOT. ALLOCATED(dxdt%states) ) THEN
+         ALLOCATE ( dxdt%states(size(x%states)), STAT = ErrStat )
+         IF ( ErrStat /= ErrID_None ) THEN
+             ErrMsg  = ' Error allocating dxdt%states array.'
+             RETURN
+         END IF
+#ifdef DEBUG_SCRATCH_ALLOC
+         MD_NumScratchAllocs = MD_NumScratchAllocs + 1
+#endif
       END IF
 
 
@@ -1130,6 +1140,10 @@ CONTAINS
       CALL MD_DestroyMisc(m, ErrStat2, ErrMsg2)
          CALL CheckError( ErrStat2, ErrMsg2 )
 
+#ifdef DEBUG_SCRATCH_ALLOC
+      CALL WrScr( ' MD_End: MD_CalcContStateDeriv allocated dxdt '//TRIM(Num2LStr(MD_NumScratchAllocs))//' time(s).' )
+#endif
+
  !     IF ( ErrStat==ErrID_None) THEN
  !        CALL WrScr('MoorDyn closed without errors')
  !     ELSE
@@ -1193,24 +1207,16 @@ CONTAINS
       CHARACTER(*)                   , INTENT(  OUT)      :: ErrMsg
 
 
-      TYPE(MD_ContinuousStateType)                        :: dxdt       ! time derivatives of continuous states (initialized in CalcContStateDeriv)
-      TYPE(MD_ContinuousStateType)                        :: x2         ! temporary copy of continuous states used in RK2 calculations
       INTEGER(IntKi)                                      :: NdtM       ! the number of time steps to make with the mooring model
       Real(ReKi)                                          :: dtM        ! the actual time step size to use
       INTEGER(IntKi)                                      :: Nx         ! size of states vector
       INTEGER(IntKi)                                      :: I          ! counter
       INTEGER(IntKi)                                      :: J          ! counter
-      TYPE(MD_InputType)                                  :: u_interp   ! interpolated instantaneous input values to be calculated for each mooring time step
 
       Real(DbKi)                                          :: tDbKi   ! double version because that's what MD_Input_ExtrapInterp needs.
       
       
-      ! allocate space for x2
-      CALL MD_CopyContState( x, x2, 0, ErrStat, ErrMsg)
-         
-      ! create space for arrays/meshes in u_interp   ... is it efficient to do this every time step???
-      CALL MD_CopyInput(u(1), u_interp, MESH_NEWCOPY, ErrStat, ErrMsg)
-         
+      ! the derivatives (m%xdot), the RK2 midpoint states (m%x2), and the interpolated inputs (m%u_interp) were allocated in MD_Init
 
       Nx = size(x%states)
 
@@ -1233,20 +1239,20 @@ CONTAINS
 
          ! step 1
 
-         CALL MD_Input_ExtrapInterp(u, utimes, u_interp, tDbKi          , ErrStat, ErrMsg)   ! interpolate input mesh to correct time (t)
+         CALL MD_Input_ExtrapInterp(u, utimes, m%u_interp, tDbKi          , ErrStat, ErrMsg)   ! interpolate input mesh to correct time (t)
       
-         CALL MD_CalcContStateDeriv( t, u_interp, p, x, xd, z, other, m, dxdt, ErrStat, ErrMsg )
+         CALL MD_CalcContStateDeriv( t, m%u_interp, p, x, xd, z, other, m, m%xdot, ErrStat, ErrMsg )
          DO J = 1, Nx
-            x2%states(J) = x%states(J) + 0.5*dtM*dxdt%states(J)                                           !x1 = x0 + dt*f0/2.0;
+            m%x2%states(J) = x%states(J) + 0.5*dtM*m%xdot%states(J)                                       !x1 = x0 + dt*f0/2.0;
          END DO
 
          ! step 2
    
-         CALL MD_Input_ExtrapInterp(u, utimes, u_interp, tDbKi + 0.5*dtM, ErrStat, ErrMsg)   ! interpolate input mesh to correct time (t+0.5*dtM)
+         CALL MD_Input_ExtrapInterp(u, utimes, m%u_interp, tDbKi + 0.5*dtM, ErrStat, ErrMsg)   ! interpolate input mesh to correct time (t+0.5*dtM)
             
-         CALL MD_CalcContStateDeriv( (t + 0.5*dtM), u_interp, p, x2, xd, z, other, m, dxdt, ErrStat, ErrMsg )       !called with updated states x2 and time = t + dt/2.0
+         CALL MD_CalcContStateDeriv( (t + 0.5*dtM), m%u_interp, p, m%x2, xd, z, other, m, m%xdot, ErrStat, ErrMsg )       !called with updated states x2 and time = t + dt/2.0
          DO J = 1, Nx
-            x%states(J) = x%states(J) + dtM*dxdt%states(J)
+            x%states(J) = x%states(J) + dtM*m%xdot%states(J)
          END DO
 
          t = t + dtM  ! update time
@@ -1264,16 +1270,6 @@ CONTAINS
    
       END DO  ! I  time steps
 
-
-      ! destroy dxdt and x2, and u_interp
-      CALL MD_DestroyContState( dxdt, ErrStat, ErrMsg)
-      CALL MD_DestroyContState( x2, ErrStat, ErrMsg)
-      CALL MD_DestroyInput(u_interp, ErrStat, ErrMsg)
-      IF ( ErrStat /= ErrID_None ) THEN
-         ErrMsg  = ' Error destroying dxdt or x2.'
-      END IF
-      !   CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'MD_UpdateStates')
-
       
       ! check for NaNs - is this a good place/way to do it?
       DO J = 1, Nx
@@ -114,6 +114,8 @@ SUBROUTINE Init_OpFM( InitInp, p_FAST, AirDens, u_AD14, u_AD, y_AD, y_ED, OpFM,
    CALL AllocPAry( OpFM%u%fx, OpFM%p%Nnodes, 'fx', ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
    CALL AllocPAry( OpFM%u%fy, OpFM%p%Nnodes, 'fy', ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
    CALL AllocPAry( OpFM%u%fz, OpFM%p%Nnodes, 'fz', ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL AllocAry( OpFM%m%Pos,   OpFM%p%Nnodes, 3, 'Pos',   ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL AllocAry( OpFM%m%Force, OpFM%p%Nnodes, 3, 'Force', ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
    IF (InitInp%NumCtrl2SC > 0) THEN
       CALL AllocPAry( OpFM%u%SuperController, InitInp%NumCtrl2SC, 'u%SuperController', ErrStat2, ErrMsg2 )
@@ -137,6 +139,7 @@ SUBROUTINE Init_OpFM( InitInp, p_FAST, AirDens, u_AD14, u_AD, y_AD, y_ED, OpFM,
       
       ! initialize the arrays:
    call SetOpFMPositions(p_FAST, u_AD14, u_AD, y_ED, OpFM)
+   OpFM%m%Force = 0.0_R8Ki
    OpFM%u%fx = 0.0_ReKi
    OpFM%u%fy = 0.0_ReKi
    OpFM%u%fz = 0.0_ReKi
@@ -352,6 +355,25 @@ SUBROUTINE SetOpFMPositions(p_FAST, u_AD14, u_AD, y_ED, OpFM)
    TYPE(FAST_ParameterType),       INTENT(IN   )   :: p_FAST      ! FAST parameter data 
    
 
+   call OpFM_GetPositions(p_FAST, u_AD14, u_AD, y_ED, OpFM%m%Pos)
+
+   OpFM%u%px = OpFM%m%Pos(:,1)
+   OpFM%u%py = OpFM%m%Pos(:,2)
+   OpFM%u%pz = OpFM%m%Pos(:,3)
+
+END SUBROUTINE SetOpFMPositions
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine computes the positions of the OpenFOAM interface nodes (hub, blades, then tower) in double precision, so that
+!! external code can use them (OpFM%m%Pos) without going through the single-precision arrays of OpFM_InputType.
+SUBROUTINE OpFM_GetPositions(p_FAST, u_AD14, u_AD, y_ED, Pos)
+
+   TYPE(AD14_InputType),           INTENT(IN)      :: u_AD14      ! The input meshes (already calculated) from AeroDyn14
+   TYPE(AD_InputType),             INTENT(IN)      :: u_AD        ! The input meshes (already calculated) from AeroDyn
+   TYPE(ED_OutputType),            INTENT(IN)      :: y_ED        ! The outputs of the structural dynamics module
+   TYPE(FAST_ParameterType),       INTENT(IN   )   :: p_FAST      ! FAST parameter data 
+   REAL(R8Ki),                     INTENT(INOUT)   :: Pos(:,:)    ! positions of the interface nodes (Nnodes x 3: all x, then all y, then all z)
+   
+
       ! Local variables:
 
    INTEGER(IntKi)                                  :: J           ! Loops through nodes / elements.
@@ -362,9 +384,9 @@ SUBROUTINE SetOpFMPositions(p_FAST, u_AD14, u_AD, y_ED, OpFM)
       
    !-------------------------------------------------------------------------------------------------
    Node = 1   ! undisplaced hub position    ( Maybe we also want to use the displaced position (add y_ED%HubPtMotion%TranslationDisp) at some point in time.)
-   OpFM%u%px(Node) = y_ED%HubPtMotion%Position(1,1)  
-   OpFM%u%py(Node) = y_ED%HubPtMotion%Position(2,1) 
-   OpFM%u%pz(Node) = y_ED%HubPtMotion%Position(3,1) 
+   Pos(Node,1) = y_ED%HubPtMotion%Position(1,1)  
+   Pos(Node,2) = y_ED%HubPtMotion%Position(2,1) 
+   Pos(Node,3) = y_ED%HubPtMotion%Position(3,1) 
             
    
    IF (p_FAST%CompAero == MODULE_AD14) THEN   
@@ -373,18 +395,18 @@ SUBROUTINE SetOpFMPositions(p_FAST, u_AD14, u_AD, y_ED, OpFM)
       DO K = 1,SIZE(u_AD14%InputMarkers)
          DO J = 1,u_AD14%InputMarkers(K)%nnodes  !this mesh isn't properly set up (it's got the global [absolute] position and no reference position)
             Node = Node + 1
-            OpFM%u%px(Node) = u_AD14%InputMarkers(K)%Position(1,J)
-            OpFM%u%py(Node) = u_AD14%InputMarkers(K)%Position(2,J)
-            OpFM%u%pz(Node) = u_AD14%InputMarkers(K)%Position(3,J)
+            Pos(Node,1) = u_AD14%InputMarkers(K)%Position(1,J)
+            Pos(Node,2) = u_AD14%InputMarkers(K)%Position(2,J)
+            Pos(Node,3) = u_AD14%InputMarkers(K)%Position(3,J)
          END DO !J = 1,p%BldNodes ! Loop through the blade nodes / elements
       END DO !K = 1,p%NumBl         
                   
          ! tower nodes
       DO J=1,u_AD14%Twr_InputMarkers%nnodes
          Node = Node + 1      
-         OpFM%u%px(Node) = u_AD14%Twr_InputMarkers%TranslationDisp(1,J) + u_AD14%Twr_InputMarkers%Position(1,J)
-         OpFM%u%py(Node) = u_AD14%Twr_InputMarkers%TranslationDisp(2,J) + u_AD14%Twr_InputMarkers%Position(2,J)
-         OpFM%u%pz(Node) = u_AD14%Twr_InputMarkers%TranslationDisp(3,J) + u_AD14%Twr_InputMarkers%Position(3,J)
+         Pos(Node,1) = u_AD14%Twr_InputMarkers%TranslationDisp(1,J) + u_AD14%Twr_InputMarkers%Position(1,J)
+         Pos(Node,2) = u_AD14%Twr_InputMarkers%TranslationDisp(2,J) + u_AD14%Twr_InputMarkers%Position(2,J)
+         Pos(Node,3) = u_AD14%Twr_InputMarkers%TranslationDisp(3,J) + u_AD14%Twr_InputMarkers%Position(3,J)
       END DO      
          
    ELSEIF (p_FAST%CompAero == MODULE_AD) THEN               
@@ -394,9 +416,9 @@ SUBROUTINE SetOpFMPositions(p_FAST, u_AD14, u_AD, y_ED, OpFM)
          DO J = 1,u_AD%BladeMotion(k)%Nnodes
             
             Node = Node + 1
-            OpFM%u%px(Node) = u_AD%BladeMotion(k)%TranslationDisp(1,j) + u_AD%BladeMotion(k)%Position(1,j)
-            OpFM%u%py(Node) = u_AD%BladeMotion(k)%TranslationDisp(2,j) + u_AD%BladeMotion(k)%Position(2,j)
-            OpFM%u%pz(Node) = u_AD%BladeMotion(k)%TranslationDisp(3,j) + u_AD%BladeMotion(k)%Position(3,j)
+            Pos(Node,1) = u_AD%BladeMotion(k)%TranslationDisp(1,j) + u_AD%BladeMotion(k)%Position(1,j)
+            Pos(Node,2) = u_AD%BladeMotion(k)%TranslationDisp(2,j) + u_AD%BladeMotion(k)%Position(2,j)
+            Pos(Node,3) = u_AD%BladeMotion(k)%TranslationDisp(3,j) + u_AD%BladeMotion(k)%Position(3,j)
             
          END DO !J = 1,p%BldNodes ! Loop through the blade nodes / elements
       END DO !K = 1,p%NumBl         
@@ -404,16 +426,16 @@ SUBROUTINE SetOpFMPositions(p_FAST, u_AD14, u_AD, y_ED, OpFM)
          ! tower nodes
       DO J=1,u_AD%TowerMotion%nnodes
          Node = Node + 1      
-         OpFM%u%px(Node) = u_AD%TowerMotion%TranslationDisp(1,J) + u_AD%TowerMotion%Position(1,J)
-         OpFM%u%py(Node) = u_AD%TowerMotion%TranslationDisp(2,J) + u_AD%TowerMotion%Position(2,J)
-         OpFM%u%pz(Node) = u_AD%TowerMotion%TranslationDisp(3,J) + u_AD%TowerMotion%Position(3,J)
+         Pos(Node,1) = u_AD%TowerMotion%TranslationDisp(1,J) + u_AD%TowerMotion%Position(1,J)
+         Pos(Node,2) = u_AD%TowerMotion%TranslationDisp(2,J) + u_AD%TowerMotion%Position(2,J)
+         Pos(Node,3) = u_AD%TowerMotion%TranslationDisp(3,J) + u_AD%TowerMotion%Position(3,J)
       END DO      
                                           
    END IF
 
 
 
-END SUBROUTINE SetOpFMPositions
+END SUBROUTINE OpFM_GetPositions
 !----------------------------------------------------------------------------------------------------------------------------------
 SUBROUTINE SetOpFMForces(p_FAST, p_AD14, u_AD14, y_AD14, u_AD, y_AD, y_ED, OpFM, ErrStat, ErrMsg)
 
@@ -431,7 +453,7 @@ SUBROUTINE SetOpFMForces(p_FAST, p_AD14, u_AD14, y_AD14, u_AD, y_AD, y_ED, OpFM,
    
 
       ! Local variables:
-   REAL(ReKi )                                     :: factor      ! scaling factor to get normalized forces for OpenFOAM
+   REAL(R8Ki)                                      :: factor      ! scaling factor to get normalized forces for OpenFOAM
 
    INTEGER(IntKi)                                  :: J           ! Loops through nodes / elements
    INTEGER(IntKi)                                  :: K           ! Loops through blades.
@@ -447,9 +469,9 @@ SUBROUTINE SetOpFMForces(p_FAST, p_AD14, u_AD14, y_AD14, u_AD, y_AD, y_ED, OpFM,
    
    !-------------------------------------------------------------------------------------------------
    Node = 1   ! undisplaced hub position  (no aerodynamics computed here)
-   OpFM%u%fx(Node) = 0.0_ReKi  
-   OpFM%u%fy(Node) = 0.0_ReKi 
-   OpFM%u%fz(Node) = 0.0_ReKi 
+   OpFM%m%Force(Node,1) = 0.0_R8Ki
+   OpFM%m%Force(Node,2) = 0.0_R8Ki
+   OpFM%m%Force(Node,3) = 0.0_R8Ki
             
    
    IF (p_FAST%CompAero == MODULE_AD14) THEN   
@@ -459,9 +481,9 @@ SUBROUTINE SetOpFMForces(p_FAST, p_AD14, u_AD14, y_AD14, u_AD, y_AD, y_ED, OpFM,
          DO J = 1,u_AD14%InputMarkers(K)%nnodes  !this mesh isn't properly set up (it's got the global [absolute] position and no reference position), and the loads are not yet in the global coordinate system            
             Node = Node + 1
             factor = p_AD14%Blade%DR(j) / OpFM%p%AirDens
-            OpFM%u%fx(Node) = dot_product( u_AD14%InputMarkers(K)%Orientation(:,1,J), y_AD14%OutputLoads(k)%Force(:,j) ) * factor
-            OpFM%u%fy(Node) = dot_product( u_AD14%InputMarkers(K)%Orientation(:,2,J), y_AD14%OutputLoads(k)%Force(:,j) ) * factor
-            OpFM%u%fz(Node) = dot_product( u_AD14%InputMarkers(K)%Orientation(:,3,J), y_AD14%OutputLoads(k)%Force(:,j) ) * factor                        
+            OpFM%m%Force(Node,1) = dot_product( u_AD14%InputMarkers(K)%Orientation(:,1,J), y_AD14%OutputLoads(k)%Force(:,j) ) * factor
+            OpFM%m%Force(Node,2) = dot_product( u_AD14%InputMarkers(K)%Orientation(:,2,J), y_AD14%OutputLoads(k)%Force(:,j) ) * factor
+            OpFM%m%Force(Node,3) = dot_product( u_AD14%InputMarkers(K)%Orientation(:,3,J), y_AD14%OutputLoads(k)%Force(:,j) ) * factor                        
          END DO !J = 1,p%BldNodes ! Loop through the blade nodes / elements
       END DO !K = 1,p%NumBl         
                   
@@ -469,9 +491,9 @@ SUBROUTINE SetOpFMForces(p_FAST, p_AD14, u_AD14, y_AD14, u_AD, y_AD, y_ED, OpFM,
       DO J=1,y_AD14%Twr_OutputLoads%nnodes
          Node = Node + 1      
          factor = p_AD14%TwrProps%TwrNodeWidth(j) / OpFM%p%AirDens
-         OpFM%u%fx(Node) = y_AD14%Twr_OutputLoads%Force(1,j) * factor
-         OpFM%u%fy(Node) = y_AD14%Twr_OutputLoads%Force(2,j) * factor
-         OpFM%u%fz(Node) = y_AD14%Twr_OutputLoads%Force(3,j) * factor         
+         OpFM%m%Force(Node,1) = y_AD14%Twr_OutputLoads%Force(1,j) * factor
+         OpFM%m%Force(Node,2) = y_AD14%Twr_OutputLoads%Force(2,j) * factor
+         OpFM%m%Force(Node,3) = y_AD14%Twr_OutputLoads%Force(3,j) * factor         
       END DO      
          
    ELSEIF (p_FAST%CompAero == MODULE_AD) THEN               
@@ -491,9 +513,9 @@ SUBROUTINE SetOpFMForces(p_FAST, p_AD14, u_AD14, y_AD14, u_AD, y_AD, y_ED, OpFM,
          
          DO J = 1,u_AD%BladeMotion(k)%Nnodes            
             Node = Node + 1                        
-            OpFM%u%fx(Node) = OpFM%m%AeroLoads(k)%Force(1,j) / OpFM%p%AirDens
-            OpFM%u%fy(Node) = OpFM%m%AeroLoads(k)%Force(2,j) / OpFM%p%AirDens
-            OpFM%u%fz(Node) = OpFM%m%AeroLoads(k)%Force(3,j) / OpFM%p%AirDens            
+            OpFM%m%Force(Node,1) = OpFM%m%AeroLoads(k)%Force(1,j) / REAL(OpFM%p%AirDens,R8Ki)
+            OpFM%m%Force(Node,2) = OpFM%m%AeroLoads(k)%Force(2,j) / REAL(OpFM%p%AirDens,R8Ki)
+            OpFM%m%Force(Node,3) = OpFM%m%AeroLoads(k)%Force(3,j) / REAL(OpFM%p%AirDens,R8Ki)            
          END DO !J = 1,p%BldNodes ! Loop through the blade nodes / elements
          
       END DO !K = 1,p%NumBl         
@@ -512,14 +534,17 @@ SUBROUTINE SetOpFMForces(p_FAST, p_AD14, u_AD14, y_AD14, u_AD, y_AD, y_ED, OpFM,
             
       DO J=1,y_AD%TowerLoad%nnodes
          Node = Node + 1      
-         OpFM%u%fx(Node) = OpFM%m%AeroLoads(k)%Force(1,j) / OpFM%p%AirDens
-         OpFM%u%fy(Node) = OpFM%m%AeroLoads(k)%Force(2,j) / OpFM%p%AirDens
-         OpFM%u%fz(Node) = OpFM%m%AeroLoads(k)%Force(3,j) / OpFM%p%AirDens 
+         OpFM%m%Force(Node,1) = OpFM%m%AeroLoads(k)%Force(1,j) / REAL(OpFM%p%AirDens,R8Ki)
+         OpFM%m%Force(Node,2) = OpFM%m%AeroLoads(k)%Force(2,j) / REAL(OpFM%p%AirDens,R8Ki)
+         OpFM%m%Force(Node,3) = OpFM%m%AeroLoads(k)%Force(3,j) / REAL(OpFM%p%AirDens,R8Ki) 
       END DO      
                                           
    END IF
 
-
+      ! single-precision copies for the registry-generated C interface (OpFM_InputType_C)
+   OpFM%u%fx = OpFM%m%Force(:,1)
+   OpFM%u%fy = OpFM%m%Force(:,2)
+   OpFM%u%fz = OpFM%m%Force(:,3)
 
 END SUBROUTINE SetOpFMForces
 !----------------------------------------------------------------------------------------------------------------------------------
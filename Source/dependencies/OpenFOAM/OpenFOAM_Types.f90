@@ -71,6 +71,8 @@ IMPLICIT NONE
     TYPE(MeshType) , DIMENSION(:), ALLOCATABLE  :: AeroMotions      !< point mesh for transferring AeroDyn distributed loads to OpenFOAM (needs translationDisp) [-]
     TYPE(MeshMapType) , DIMENSION(:), ALLOCATABLE  :: Line2_to_Point_Loads      !< mapping data structure to convert line2 loads to point loads [-]
     TYPE(MeshMapType) , DIMENSION(:), ALLOCATABLE  :: Line2_to_Point_Motions      !< mapping data structure to convert line2 loads to point loads [-]
+    REAL(R8Ki) , DIMENSION(:,:), ALLOCATABLE  :: Pos      !< positions of the interface nodes in double precision (Nnodes x 3: all x, then all y, then all z) [m]
+    REAL(R8Ki) , DIMENSION(:,:), ALLOCATABLE  :: Force      !< normalized forces of the interface nodes in double precision (Nnodes x 3: all x, then all y, then all z) [N/kg/m^3]
   END TYPE OpFM_MiscVarType
 ! =======================
 ! =========  OpFM_ParameterType_C  =======
@@ -659,6 +661,7 @@ ENDIF
 ! Local 
    INTEGER(IntKi)                 :: i,j,k
    INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
+   INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
    INTEGER(IntKi)                 :: ErrStat2
    CHARACTER(ErrMsgLen)           :: ErrMsg2
    CHARACTER(*), PARAMETER        :: RoutineName = 'OpFM_CopyMisc'
@@ -728,6 +731,34 @@ IF (ALLOCATED(SrcMiscData%Line2_to_Point_Motions)) THEN
          CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg,RoutineName)
          IF (ErrStat>=AbortErrLev) RETURN
     ENDDO
+ENDIF
+IF (ALLOCATED(SrcMiscData%Pos)) THEN
+  i1_l = LBOUND(SrcMiscData%Pos,1)
+  i1_u = UBOUND(SrcMiscData%Pos,1)
+  i2_l = LBOUND(SrcMiscData%Pos,2)
+  i2_u = UBOUND(SrcMiscData%Pos,2)
+  IF (.NOT. ALLOCATED(DstMiscData%Pos)) THEN 
+    ALLOCATE(DstMiscData%Pos(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%Pos.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstMiscData%Pos = SrcMiscData%Pos
+ENDIF
+IF (ALLOCATED(SrcMiscData%Force)) THEN
+  i1_l = LBOUND(SrcMiscData%Force,1)
+  i1_u = UBOUND(SrcMiscData%Force,1)
+  i2_l = LBOUND(SrcMiscData%Force,2)
+  i2_u = UBOUND(SrcMiscData%Force,2)
+  IF (.NOT. ALLOCATED(DstMiscData%Force)) THEN 
+    ALLOCATE(DstMiscData%Force(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+      CALL SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%Force.', ErrStat, ErrMsg,RoutineName)
+      RETURN
+    END IF
+  END IF
+    DstMiscData%Force = SrcMiscData%Force
 ENDIF
  END SUBROUTINE OpFM_CopyMisc
 
@@ -763,6 +794,12 @@ DO i1 = LBOUND(MiscData%Line2_to_Point_Motions,1), UBOUND(MiscData%Line2_to_Poin
   CALL NWTC_Library_Destroymeshmaptype( MiscData%Line2_to_Point_Motions(i1), ErrStat, ErrMsg )
 ENDDO
   DEALLOCATE(MiscData%Line2_to_Point_Motions)
+ENDIF
+IF (ALLOCATED(MiscData%Pos)) THEN
+  DEALLOCATE(MiscData%Pos)
+ENDIF
+IF (ALLOCATED(MiscData%Force)) THEN
+  DEALLOCATE(MiscData%Force)
 ENDIF
  END SUBROUTINE OpFM_DestroyMisc
 
@@ -894,6 +931,16 @@ ENDIF
       END IF
     END DO
   END IF
+  Int_BufSz   = Int_BufSz   + 1     ! Pos allocated yes/no
+  IF ( ALLOCATED(InData%Pos) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! Pos upper/lower bounds for each dimension
+      Db_BufSz   = Db_BufSz   + SIZE(InData%Pos)  ! Pos
+  END IF
+  Int_BufSz   = Int_BufSz   + 1     ! Force allocated yes/no
+  IF ( ALLOCATED(InData%Force) ) THEN
+    Int_BufSz   = Int_BufSz   + 2*2  ! Force upper/lower bounds for each dimension
+      Db_BufSz   = Db_BufSz   + SIZE(InData%Force)  ! Force
+  END IF
   IF ( Re_BufSz  .GT. 0 ) THEN 
      ALLOCATE( ReKiBuf(  Re_BufSz  ), STAT=ErrStat2 )
      IF (ErrStat2 /= 0) THEN 
@@ -1087,6 +1134,38 @@ ENDIF
       ENDIF
     END DO
   END IF
+  IF ( .NOT. ALLOCATED(InData%Pos) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%Pos,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%Pos,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%Pos,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%Pos,2)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%Pos)>0) DbKiBuf ( Db_Xferred:Db_Xferred+(SIZE(InData%Pos))-1 ) = PACK(InData%Pos,.TRUE.)
+      Db_Xferred   = Db_Xferred   + SIZE(InData%Pos)
+  END IF
+  IF ( .NOT. ALLOCATED(InData%Force) ) THEN
+    IntKiBuf( Int_Xferred ) = 0
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    IntKiBuf( Int_Xferred ) = 1
+    Int_Xferred = Int_Xferred + 1
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%Force,1)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%Force,1)
+    Int_Xferred = Int_Xferred + 2
+    IntKiBuf( Int_Xferred    ) = LBOUND(InData%Force,2)
+    IntKiBuf( Int_Xferred + 1) = UBOUND(InData%Force,2)
+    Int_Xferred = Int_Xferred + 2
+
+      IF (SIZE(InData%Force)>0) DbKiBuf ( Db_Xferred:Db_Xferred+(SIZE(InData%Force))-1 ) = PACK(InData%Force,.TRUE.)
+      Db_Xferred   = Db_Xferred   + SIZE(InData%Force)
+  END IF
  END SUBROUTINE OpFM_PackMisc
 
  SUBROUTINE OpFM_UnPackMisc( ReKiBuf, DbKiBuf, IntKiBuf, Outdata, ErrStat, ErrMsg )
@@ -1109,6 +1188,7 @@ ENDIF
   LOGICAL, ALLOCATABLE           :: mask4(:,:,:,:)
   LOGICAL, ALLOCATABLE           :: mask5(:,:,:,:,:)
   INTEGER(IntKi)                 :: i1, i1_l, i1_u  !  bounds (upper/lower) for an array dimension 1
+  INTEGER(IntKi)                 :: i2, i2_l, i2_u  !  bounds (upper/lower) for an array dimension 2
   INTEGER(IntKi)                 :: ErrStat2
   CHARACTER(ErrMsgLen)           :: ErrMsg2
   CHARACTER(*), PARAMETER        :: RoutineName = 'OpFM_UnPackMisc'
@@ -1346,6 +1426,58 @@ ENDIF
       IF(ALLOCATED(Int_Buf)) DEALLOCATE(Int_Buf)
     END DO
   END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! Pos not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%Pos)) DEALLOCATE(OutData%Pos)
+    ALLOCATE(OutData%Pos(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%Pos.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%Pos)>0) OutData%Pos = REAL( UNPACK(DbKiBuf( Db_Xferred:Db_Xferred+(SIZE(OutData%Pos))-1 ), mask2, 0.0_DbKi ), R8Ki)
+      Db_Xferred   = Db_Xferred   + SIZE(OutData%Pos)
+    DEALLOCATE(mask2)
+  END IF
+  IF ( IntKiBuf( Int_Xferred ) == 0 ) THEN  ! Force not allocated
+    Int_Xferred = Int_Xferred + 1
+  ELSE
+    Int_Xferred = Int_Xferred + 1
+    i1_l = IntKiBuf( Int_Xferred    )
+    i1_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    i2_l = IntKiBuf( Int_Xferred    )
+    i2_u = IntKiBuf( Int_Xferred + 1)
+    Int_Xferred = Int_Xferred + 2
+    IF (ALLOCATED(OutData%Force)) DEALLOCATE(OutData%Force)
+    ALLOCATE(OutData%Force(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating OutData%Force.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    ALLOCATE(mask2(i1_l:i1_u,i2_l:i2_u),STAT=ErrStat2)
+    IF (ErrStat2 /= 0) THEN 
+       CALL SetErrStat(ErrID_Fatal, 'Error allocating mask2.', ErrStat, ErrMsg,RoutineName)
+       RETURN
+    END IF
+    mask2 = .TRUE. 
+      IF (SIZE(OutData%Force)>0) OutData%Force = REAL( UNPACK(DbKiBuf( Db_Xferred:Db_Xferred+(SIZE(OutData%Force))-1 ), mask2, 0.0_DbKi ), R8Ki)
+      Db_Xferred   = Db_Xferred   + SIZE(OutData%Force)
+    DEALLOCATE(mask2)
+  END IF
  END SUBROUTINE OpFM_UnPackMisc
 
  SUBROUTINE OpFM_C2Fary_CopyMisc( MiscData, ErrStat, ErrMsg )